@@ -0,0 +1,87 @@
+#include "bootrom.h"
+
+#include <string.h>
+
+#include "cpubus.h"
+#include "opcodes.h"
+#include "ppu.h"
+
+//The DMG boot rom is not visible to us, but its addresses are. So instead of waiting for the game to start, we follow the boot rom along a few known addresses and reproduce what it does to VRAM:
+//It decodes the logo from the cartridge header (which we see on the bus, as the cartridge answers these reads) into tiles 1 to 24, adds the (R) as tile 0x19, turns on the LCD and scrolls the logo down via SCY.
+//Everything else (sound, the logo check) does not matter for the picture. The GBC boot rom is a different story, so we give up on it as soon as we see it executing beyond 0x0100.
+
+bool bootRomTracking = false;
+bool bootRomRunning = false; //From the calibration until the game starts at 0x0100, even if we do not follow this boot rom
+uint bootRomScrollSteps;
+
+const uint8_t registeredTrademarkTile[8] = {0x3c, 0x42, 0xb9, 0xa5, 0xb9, 0xa5, 0x42, 0x3c}; //Lower bit plane only, stored in the boot rom at 0x00d8
+const uint8_t doubledNibble[16] = {0x00, 0x03, 0x0c, 0x0f, 0x30, 0x33, 0x3c, 0x3f, 0xc0, 0xc3, 0xcc, 0xcf, 0xf0, 0xf3, 0xfc, 0xff}; //The logo is stored at half resolution
+
+void startBootRom() {
+    bootRomTracking = true;
+    bootRomRunning = true;
+    bootRomScrollSteps = 0;
+    toMemory(0xff40, 0x00); //LCD is off until the logo is ready
+    toMemory(0xff42, 0x00); //SCY
+}
+
+void trackBootRom() {
+    const uint16_t addr = *address;
+    if (addr >= 0x0104 && addr < 0x0134) {
+        //Logo data from the cartridge header. The boot rom reads it twice: First to decode it and again for the logo check while the LCD is already on.
+        if (!lcdAndPpuEnable) {
+            const uint index = addr - 0x0104;
+            const uint16_t tileRows = 0x8010 + ((index >> 1) << 4) + ((index & 0x01) << 3);
+            //Each nibble becomes two identical rows of the lower bit plane
+            for (uint row = 0; row < 4; row++) {
+                memory[tileRows + (row << 1)] = doubledNibble[(row < 2) ? (*opcode >> 4) : (*opcode & 0x0f)];
+                TILE_CACHE_MARK(tileRows + (row << 1))
+            }
+        }
+        return;
+    }
+    switch (addr) {
+        case 0x0040: //Logo decoded, boot rom copies the (R) and sets up the tile map
+            for (uint i = 0; i < 8; i++) {
+                memory[0x8190 + (i << 1)] = registeredTrademarkTile[i];
+                TILE_CACHE_MARK(0x8190 + (i << 1))
+            }
+            for (uint i = 0; i < 12; i++) {
+                memory[0x9904 + i] = 0x01 + i;
+                memory[0x9924 + i] = 0x0d + i;
+            }
+            memory[0x9910] = 0x19;
+            break;
+        case 0x0059: //ldh (SCY), a
+            toMemory(0xff42, BOOT_ROM_SCROLL_STEPS);
+            break;
+        case 0x005d: //ldh (LCDC), a
+            toMemory(0xff40, 0x91);
+            break;
+        case 0x006a: //Loop waiting for LY = 0x90 has just ended, which tells us where the PPU is
+            setOffsetToLine(0x90);
+            vblankOffset = syncOffset;
+            break;
+        case 0x0089: //ldh (SCY), a - after SCY reaches zero, the boot rom keeps looping for a while without changing it
+            if (bootRomScrollSteps < BOOT_ROM_SCROLL_STEPS) {
+                bootRomScrollSteps++;
+                toMemory(0xff42, BOOT_ROM_SCROLL_STEPS - bootRomScrollSteps);
+            }
+            break;
+        default:
+            if (addr >= 0x0200 && addr < 0x0900) { //Second part of the GBC boot rom
+                bootRomTracking = false;
+                toMemory(0xff40, 0x00);
+            }
+    }
+}
+
+void endBootRom() {
+    //Games expect VRAM the way the boot rom left it, but game detection relies on hashing writes to a cleared VRAM. So we remove our logo again.
+    bootRomTracking = false;
+    bootRomRunning = false;
+    memset((void *)&memory[0x8010], 0, 0x0190);
+    memset((void *)&tileCache[0x0001 << 3], 0, (0x19 << 3) * sizeof(uint16_t)); //Tiles 1 to 0x19
+    memset((void *)&memory[0x9904], 0, 0x2c);
+    ppuDirtyStamp = ppuLineCount;
+}
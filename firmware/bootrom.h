@@ -0,0 +1,15 @@
+#ifndef GBINTERCEPTOR_BOOTROM
+#define GBINTERCEPTOR_BOOTROM
+
+#include "pico/stdlib.h"
+
+#define BOOT_ROM_SCROLL_STEPS 0x64 //The logo starts at SCY = 0x64 and moves down one line per step
+
+extern bool bootRomTracking;
+extern bool bootRomRunning;
+
+void startBootRom();
+void trackBootRom();
+void endBootRom();
+
+#endif
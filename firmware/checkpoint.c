@@ -0,0 +1,55 @@
+#include "checkpoint.h"
+
+#include "cpubus.h"
+#include "opcodes.h"
+
+//Instead of giving up on the first inconsistency, we keep a lightweight checkpoint of the CPU state whenever we are sure to be in sync (i.e. when we see an interrupt entry).
+//If something goes wrong, we wait for the next interrupt entry on the bus to pick up the game again. If that entry matches the checkpoint (same interrupt vector and stack pointer,
+//usually the next vblank of the same main loop), the registers are restored to what the main loop had at the checkpoint.
+//Memory is never rolled back: The Game Boy has already run past the checkpoint, so the writes we have seen since then are still what the real memory holds. An older copy would only
+//add to the writes we missed while searching for the interrupt entry, which the game usually overwrites soon anyway.
+//The checkpoint itself is just a few registers, so it can be taken on every interrupt without noticeable cost and memory writes do not cost anything extra.
+
+uint32_t checkpointRegisters[2]; //Same layout as registers[], copied as two 32bit words
+uint16_t checkpointSP;
+uint16_t checkpointVector;
+uint32_t checkpointFlags;
+bool checkpointInterruptsEnabled;
+
+volatile bool resyncRequested = false;
+volatile const char * desyncReason;
+volatile uint resyncCount = 0;
+
+void resetCheckpoint() {
+    resyncRequested = false;
+    desyncReason = NULL;
+    saveCheckpoint(0x0000); //Not an interrupt vector, so this is never restored
+}
+
+void saveCheckpoint(uint16_t vector) {
+    checkpointRegisters[0] = ((uint32_t *)registers)[0];
+    checkpointRegisters[1] = ((uint32_t *)registers)[1];
+    checkpointSP = sp;
+    checkpointVector = vector;
+    checkpointFlags = flags;
+    checkpointInterruptsEnabled = interruptsEnabled;
+}
+
+bool checkpointMatches(uint16_t vector, uint16_t stackPointer) { //Can we restore the checkpoint at an interrupt entry to this vector with this sp after the pushes?
+    return vector == checkpointVector && stackPointer == checkpointSP;
+}
+
+void restoreCheckpoint() { //Only the CPU state, memory and the copies of the registers in the PPU and the timer stay as they are
+    ((uint32_t *)registers)[0] = checkpointRegisters[0];
+    ((uint32_t *)registers)[1] = checkpointRegisters[1];
+    sp = checkpointSP;
+    flags = checkpointFlags;
+    interruptsEnabled = checkpointInterruptsEnabled;
+}
+
+void desync(const char* errorMsg) {
+    if (running && !resyncRequested) { //Like stop(), avoid overwriting the first reason
+        desyncReason = errorMsg;
+        resyncRequested = true;
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef GBINTERCEPTOR_CHECKPOINT
+#define GBINTERCEPTOR_CHECKPOINT
+
+#include "pico/stdlib.h"
+#include "ppu.h"
+
+#define RESYNC_TIMEOUT (60 * CYCLES_PER_FRAME) //If we cannot find an anchor in the live bus data within a second, we give up and stop.
+
+extern volatile bool resyncRequested;
+extern volatile const char * desyncReason;
+extern volatile uint resyncCount;
+
+void resetCheckpoint();
+void saveCheckpoint(uint16_t vector);
+bool checkpointMatches(uint16_t vector, uint16_t stackPointer);
+void restoreCheckpoint();
+void desync(const char* errorMsg);
+
+#endif
@@ -4,6 +4,9 @@
 
 #include "main.h"
 #include "opcodes.h"
+#include "checkpoint.h"
+#include "timer.h"
+#include "bootrom.h"
 #include "debug.h"
 #include "gamedb/game_detection.h"
 
@@ -36,6 +39,7 @@ uint volatile cycleIndex; // Just counting cycles. Lowest byte can be used as in
 uint8_t volatile * historyIndex = (uint8_t *)&cycleIndex; //Index for history array, lowest byte of cycleIndex
 uint volatile div; //cycle that corresponds to DIV register equaling zero
 uint8_t readAheadIndex;
+volatile uint softResetCount = 0;
 
 mutex_t cpubusMutex;
 
@@ -45,17 +49,29 @@ int volatile errorOpcode;
 uint delayedOpcodeCount = 0; //Counts the number of times we did not see a new clock from the Game Boy when expected in order to detect a halt state
 
 uint ignoreCycles; //(Remaining) number of cycles to ignore, typically during DMA. Will try to detect a ret instruction to find back.
+bool retSyncAfterDMA; //OAM DMA is usually waited out in HRAM and ends with a ret, while the CPU simply continues after a general purpose VRAM DMA on the GBC.
 
 uint8_t volatile memory[0x010000]; //We are actually only interested in 0x8000 to 0xffff in the Game Boy's address space. We don't care about the cartridge, because we get fresh data from the real one whenever the Game Boy reads it. However, wasting 32kB here by reserving this for the rare cases of writing to a cartridge, allows us to do all other memory writes without a range check.
 
+//Game Boy Color
+uint16_t memoryPageOffset[16];
+bool volatile cgbMode = false; //Set as soon as a game uses GBC features. Until then, the GBC behaves like a DMG.
+bool volatile doubleSpeed = false;
+uint8_t cartridgeCgbFlag; //Byte 0x0143 of the cartridge header as seen while the boot rom checks the header
+bool cgbConsole = false; //We have seen the GBC boot rom, so GBC games start in GBC mode
+
 //DMA from memory
 int oamDmaChannel;
+int vramDmaChannel;
 dma_channel_config oamDmaConfig;
+dma_channel_config clearDmaConfig;
+const uint32_t zeroWord = 0;
 
 //DMA from cartridge
 bool cartridgeDMA = false;
 uint cartridgeDMAsrc;
 uint cartridgeDMAdst;
+uint cartridgeDMAlength;
 
 
 //CPU registers
@@ -103,29 +119,122 @@ void stop(const char* errorMsg) {
 
 void setupOamDMA() {
     oamDmaChannel = dma_claim_unused_channel(true);
-    oamDmaConfig = dma_channel_get_default_config(oamDmaChannel);
+    vramDmaChannel = dma_claim_unused_channel(true);
+    oamDmaConfig = dma_channel_get_default_config(oamDmaChannel); //Also used for the VRAM DMA channel as the settings are identical
     channel_config_set_read_increment(&oamDmaConfig, true);
     channel_config_set_write_increment(&oamDmaConfig, true);
+    clearDmaConfig = oamDmaConfig;
+    channel_config_set_read_increment(&clearDmaConfig, false);
 }
 
 void dmaToOAM(uint16_t source) {
     if (dma_channel_is_busy(oamDmaChannel)) {
-        stop("DMA started while channel busy.");
+        desync("DMA started while channel busy.");
         return;
     }
-    dma_channel_configure(oamDmaChannel, &oamDmaConfig, &memory[0xfe00], &memory[source], 0xa0 / 4, true);
+    dma_channel_configure(oamDmaChannel, &oamDmaConfig, &memory[0xfe00], &memory[MAPPED_ADDRESS(source)], 0xa0 / 4, true);
 }
 
-void reset() {
-    cycleIndex = 0;
-    readAheadIndex = HISTORY_READAHEAD;
-    div = cycleIndex - 0x0000ab00u; //Starts at 0xab
+void dmaToVRAM(uint8_t control) {
+    //GBC VRAM DMA (HDMA1-5). We do not emulate the HBlank DMA in steps of 16 bytes but copy everything at once. This means that the data may be available a few lines early, which usually does not matter as the game waits for the transfer before using it.
+    const uint16_t source = (((uint16_t)memory[0xff51] << 8) | memory[0xff52]) & 0xfff0;
+    const uint16_t destination = 0x8000 | ((((uint16_t)memory[0xff53] << 8) | memory[0xff54]) & 0x1ff0);
+    uint length = ((uint)(control & 0x7f) + 1) << 4;
+    if (destination + length > 0xa000)
+        length = 0xa000 - destination;
+
+    if ((source & 0x8000) != 0 && ((source & 0xe000) != 0xa000)) {
+        //From our RAM copy
+        dma_channel_wait_for_finish_blocking(vramDmaChannel); //Only busy if we are still clearing VRAM bank 1 after entering GBC mode, which takes a few microseconds
+        uint split = 0;
+        if ((source ^ (source + length - 1)) & 0xf000) {
+            //Banked WRAM is not contiguous in our copy, so a transfer across a 4kB page (i.e. into 0xd000) is done in two parts. At most 2kB, so waiting for the first one is short.
+            split = 0x1000 - (source & 0x0fff);
+            dma_channel_configure(vramDmaChannel, &oamDmaConfig, &memory[MAPPED_ADDRESS(destination)], &memory[MAPPED_ADDRESS(source)], split / 4, true);
+            dma_channel_wait_for_finish_blocking(vramDmaChannel);
+        }
+        dma_channel_configure(vramDmaChannel, &oamDmaConfig, &memory[MAPPED_ADDRESS(destination + split)], &memory[MAPPED_ADDRESS(source + split)], (length - split) / 4, true);
+        requestTileCacheUpdate(MAPPED_ADDRESS(destination), length); //The PPU decodes the new tiles once the transfer is done
+    } else if ((control & 0x80) == 0) {
+        //From the cartridge (ROM or external RAM). We can only pick up what shows up on the bus while we are ignoring cycles, so this only works for general purpose DMA.
+        cartridgeDMAsrc = source;
+        cartridgeDMAdst = MAPPED_ADDRESS(destination);
+        cartridgeDMAlength = length;
+        cartridgeDMA = true;
+    } else {
+        //HBlank DMA from the cartridge moves 16 bytes per line between the game's instructions, which we have no window for. Those tiles stay as they are.
+        cartridgeDMA = false;
+    }
 
-    ignoreCycles = 0;
+    if ((control & 0x80) == 0) {
+        //General purpose DMA halts the CPU for 8 cycles per 16 bytes (16 in double speed mode) and then simply continues with the next instruction
+        ignoreCycles = (length >> 4) * (doubleSpeed ? 16 : 8);
+        retSyncAfterDMA = false;
+    }
+}
 
-    error = NULL;
-    errorOpcode = -1;
+bool oamDmaBusy() {
+    return dma_channel_is_busy(oamDmaChannel);
+}
+
+bool vramDmaBusy() {
+    return dma_channel_is_busy(vramDmaChannel);
+}
 
+bool enableCgbMode() { //Returns if GBC features are available
+    if (!cgbMode && (cartridgeCgbFlag & 0x80)) { //A DMG game writing to these registers by accident should not trigger anything
+        cgbMode = true;
+        //Writes to the cartridge area no longer have a place in our memory copy. Redirect them to the echo RAM area, which is not used by any sane game.
+        //All other pages start over at the banks the boot rom leaves behind, so nothing from DMG mode or an earlier game stays mapped.
+        for (uint page = 0x0; page < 0x10; page++)
+            memoryPageOffset[page] = page < 0x8 ? (uint16_t)(0xe000 - (page << 12)) : 0x0000;
+        memory[0xff4f] = 0x00;
+        memory[0xff70] = 0x00;
+        setVramBank(0);
+        setWramBank(1);
+        //Our VRAM bank 1 still holds cartridge writes or an earlier game, while the GBC boot rom clears it. DMA does this in the background and the PPU decodes the tiles afterwards.
+        dma_channel_wait_for_finish_blocking(vramDmaChannel);
+        dma_channel_configure(vramDmaChannel, &clearDmaConfig, &memory[CGB_VRAM_BANK1], &zeroWord, 0x2000 / 4, true);
+        requestTileCacheUpdate(CGB_VRAM_BANK1, 0x1800);
+        oamChanged = true; //Sprites are no longer sorted by x
+    }
+    return cgbMode;
+}
+
+void setVramBank(uint8_t bank) {
+    const uint16_t offset = (bank & 0x01) ? (uint16_t)(CGB_VRAM_BANK1 - 0x8000) : 0x0000;
+    memoryPageOffset[0x8] = offset;
+    memoryPageOffset[0x9] = offset;
+}
+
+void setWramBank(uint8_t bank) {
+    bank &= 0x07;
+    if (bank <= 1) //Bank 0 selects bank 1
+        memoryPageOffset[0xd] = 0x0000;
+    else
+        memoryPageOffset[0xd] = (uint16_t)(CGB_WRAM_BANK2 + ((bank - 2) << 12) - 0xd000);
+}
+
+void setDoubleSpeed(bool enable) {
+    doubleSpeed = enable;
+    memory[0xff4d] = enable ? 0x80 : 0x00;
+    //The substitute clock during halt has to tick at the new rate, too
+    systick_hw->rvr = (enable ? cycleRatio / 2 : cycleRatio) - 1;
+}
+
+void disableCgbMode() { //Back to the state of a DMG, the CGB boot rom leaves everything like this if it starts a DMG game
+    cgbMode = false;
+    for (uint page = 0x0; page < 0x10; page++)
+        memoryPageOffset[page] = 0x0000;
+    memory[0xff4f] = 0x00;
+    memory[0xff70] = 0x00;
+    if (doubleSpeed)
+        setDoubleSpeed(false);
+    else
+        memory[0xff4d] = 0x00;
+}
+
+void resetRegisters() { //State of the CPU after the boot rom
     *a = 0x01;
     *b = 0x00;
     *c = 0x13;
@@ -135,14 +244,36 @@ void reset() {
     *l = 0x4d;
     sp = 0xfffe;
     flags = 0x01010001;
+}
+
+void reset() {
+    cycleIndex = 0;
+    readAheadIndex = HISTORY_READAHEAD;
+    div = cycleIndex - 0x0000ab00u; //Starts at 0xab
+
+    ignoreCycles = 0;
+    retSyncAfterDMA = true;
+
+    error = NULL;
+    errorOpcode = -1;
+
+    resetRegisters();
 
     interruptsEnabled = false;
     interruptsEnableCycle = 0;
 
     cartridgeDMA = false;
 
+    doubleSpeed = false;
+    disableCgbMode();
+    cartridgeCgbFlag = 0x00;
+    cgbConsole = false;
+    memset(memoryPageOffset, 0, sizeof(memoryPageOffset));
+
     memset((void*)memory, 0, sizeof(memory));
+    memset((void*)tileCache, 0, 2 * TILE_CACHE_BANK_SIZE * sizeof(uint16_t));
 
+    resetTimer();
     toMemory(0xff04, 0xab); // DIV
     toMemory(0xff05, 0x00); // TIMA
     toMemory(0xff06, 0x00); // TMA
@@ -177,12 +308,13 @@ void reset() {
     toMemory(0xffff, 0x00); // IE
 
     resetHashes();
+    resetCheckpoint();
 }
 
 void inline substitudeBusdataFromMemory() {
     if ((*address & 0x8000) != 0 && ((*address & 0xe000) != 0xa000)) { //Neither ROM 0x0000-0x7fff nor external RAM 0xa000-0xbfff
         //This is from RAM, load our version as we cannot see the data on the bus
-        *opcode = memory[*address];
+        *opcode = memory[MAPPED_ADDRESS(*address)];
         history[*historyIndex] = rawBusData;
     }
 }
@@ -208,7 +340,12 @@ void getNextFromBus() {
                         //This should not happen unless the Game Boy has been turned off.
                         //I can imaginge that a game could wait indefinitely for a gamepad input (can it?), but not using vblank to have anything active on the screen would be unusual.
                         //If we find a game that waits longer than one frame, we need to check which interrupts are enabled and will not have a chance to determine if the Game Boy was turned off if only the gamepad interrupt is enabled.
-                        stop("Halt timed out.");
+                        if (gpio_get(GBSENSE_PIN))
+                            desync("Halt timed out."); //Still powered, so let's try to pick up the game once the clock returns
+                        else if (bootRomRunning)
+                            running = false; //Turned off during the boot logo, which is not an error. Just go back to waiting for the game.
+                        else
+                            stop("Halt timed out.");
                     }
                     return;
                 }
@@ -225,6 +362,70 @@ void getNextFromBus() {
     substitudeBusdataFromMemory();
 }
 
+void softReset(bool reboot) {
+    //The game jumped back to its entry point at 0x0100. This is either a soft reset by the game or the Game Boy has been power cycled faster than we could notice.
+    //Either way, the game will initialize everything it needs again, so we keep our memory copy, the cycleRatio and the running video stream and only reset the CPU side.
+    //Like cycleIndex, our memory copy must not be reset here as the PPU on the other core keeps running and we could not clear it without stalling the bus PIO anyway.
+    if (reboot) {
+        resetRegisters();
+        div = cycleIndex - 0x0000ab00u;
+        resetTimer();
+        //The new game might not even be a GBC game, so everything GBC specific starts over including the speed of the substitute clock
+        disableCgbMode();
+        if (cgbConsole)
+            enableCgbMode();
+    }
+    ignoreCycles = 0;
+    retSyncAfterDMA = true;
+    cartridgeDMA = false;
+    interruptsEnabled = false;
+    interruptsEnableCycle = cycleIndex;
+    resetCheckpoint();
+    softResetCount++;
+}
+
+void resync() {
+    //Something went wrong, so we wait for the next interrupt entry on the live bus. Meanwhile, the PPU keeps rendering from our memory copy as it is.
+    //Without knowing sp, an interrupt entry is still easy to recognize: two consecutive pushes to decrementing addresses followed by a jump to one of the interrupt vectors.
+    //If this entry matches the last checkpoint, we restore the registers from it, see checkpoint.c.
+    ignoreCycles = 0;
+    retSyncAfterDMA = true;
+    cartridgeDMA = false;
+    uint resyncStart = cycleIndex;
+    bool reboot = false;
+    while (running) {
+        if (*address == 0x0104) { //The boot rom checks the logo in the cartridge header, so the Game Boy has been power cycled. Wait for it to finish instead of timing out.
+            reboot = true;
+            resyncStart = cycleIndex;
+        } else if (*address == 0x0143 && reboot) { //Might be another game now
+            cartridgeCgbFlag = *opcode;
+        } else if (*address == 0x0100) { //Back at the entry point
+            softReset(reboot);
+            BUS_PIO->fdebug = busPIOstallMask;
+            resyncRequested = false;
+            return;
+        }
+        const uint16_t push1 = (uint16_t)history[(uint8_t)(readAheadIndex-2)];
+        const uint16_t push2 = (uint16_t)history[(uint8_t)(readAheadIndex-1)];
+        if ((history[readAheadIndex] & 0x0000ffc7) == 0x0040 && push2 == (uint16_t)(push1 - 1) && (push1 >= 0xff80 || (push1 & 0xc000) == 0xc000)) {
+            if (checkpointMatches((uint16_t)history[readAheadIndex], push2))
+                restoreCheckpoint();
+            sp = push1 + 1; //The interrupt detection in the main loop will now see exactly what it expects and continue from there
+            interruptsEnabled = true; //We just saw an interrupt, so they must have been enabled...
+            interruptsEnableCycle = resyncStart; //...and long enough to use it for synchronizing the PPU
+            BUS_PIO->fdebug = busPIOstallMask; //We do not care about anything we missed while searching
+            resyncRequested = false;
+            resyncCount++;
+            return;
+        }
+        getNextFromBus();
+        if (cycleIndex - resyncStart > RESYNC_TIMEOUT) {
+            stop((const char *)desyncReason);
+            return;
+        }
+    }
+}
+
 void handleMemoryBus() { //To be executed on second core
     setupPIO();
     setupOamDMA();
@@ -251,25 +452,40 @@ void handleMemoryBus() { //To be executed on second core
                 if (!count) {
                     cycleRatio = (0x00FFFFFF - systick_hw->cvr) / CYCLE_RATIO_STATISTIC_SIZE;
                     systick_hw->rvr = cycleRatio-1;
+                    //Calibrated, so we can start streaming the boot rom right away
+                    startBootRom();
+                    running = true;
                 }
+            } else if (bootRomTracking) {
+                trackBootRom();
             }
-        } while (*address != 0x0100);
-
-        running = true;
-
-        BUS_PIO->fdebug = busPIOstallMask; //Clear stall flag
+            if (*address == 0x0143) //Both boot roms read the header. The GBC flag tells us if a game runs in GBC mode.
+                cartridgeCgbFlag = *opcode;
+            else if (*address >= 0x0200 && *address < 0x0900) //Only the GBC boot rom has code here, the DMG one never leaves the first 256 bytes except for the header
+                cgbConsole = true;
+        } while (*address != 0x0100 && (running || leadIn || count)); //Also leave if the Game Boy has been turned off during the boot rom
+
+        if (*address == 0x0100) {
+            endBootRom();
+            if (cgbConsole) //Like the GBC, we decide based on the header flag right away instead of waiting for the game to use GBC features
+                enableCgbMode();
+            running = true;
+            BUS_PIO->fdebug = busPIOstallMask; //Clear stall flag
+        }
 
         while (running) {
 
             //Ignore events during DMA
             while (ignoreCycles) {
                 getNextFromBus();
-                if (cartridgeDMA && *address == cartridgeDMAsrc) {
-                    memory[cartridgeDMAdst] = *opcode;
-                    cartridgeDMAsrc++;
-                    cartridgeDMAdst++;
-                    if (cartridgeDMAdst >= 0xfea0)
-                        cartridgeDMA = false;
+                if (cartridgeDMA && (uint16_t)(*address - cartridgeDMAsrc) < cartridgeDMAlength) {
+                    const uint16_t destination = cartridgeDMAdst + *address - cartridgeDMAsrc;
+                    memory[destination] = *opcode;
+                    if (IS_TILE_DATA(destination)) {
+                        TILE_CACHE_MARK(destination)
+                    } else if (destination >= 0xfe00) {
+                        oamChanged = true;
+                    }
                 }
                 ignoreCycles--;
                 if (ignoreCycles == 10) { //Some games copy some HRAM/IO addresses during DMA (Tetris 2). We do this a few cycles before DMA ends.
@@ -278,7 +494,11 @@ void handleMemoryBus() { //To be executed on second core
                             break;
                         toMemory(0xff00 | gameInfo.writeRegistersDuringDMA[i+1], memory[0xff00 | gameInfo.writeRegistersDuringDMA[i]]); //Note: Using fromMemory does not make sense here because it would try to use the opcode data filled in by getNextFromBus, which is not relevant as we are not seeing correct addresses on the bus.
                     }
+                } else if (ignoreCycles == 0 && !retSyncAfterDMA) { //General purpose DMA, the CPU continues right where it stopped
+                    cartridgeDMA = false;
+                    retSyncAfterDMA = true;
                 } else if (ignoreCycles == 0) { //We are done, but we now have to look for a return instruction to sync back up with the CPU which was doing unknown instructions during DMA
+                    cartridgeDMA = false;
                     bool synchronized = false;
                     int wait = 0;
                     while (!synchronized) {
@@ -296,7 +516,7 @@ void handleMemoryBus() { //To be executed on second core
                         getNextFromBus();
                         wait++;
                         if (wait > 100) {
-                            stop("Could not find a ret after DMA.");
+                            desync("Could not find a ret after DMA.");
                             break;
                         }
                     }
@@ -306,7 +526,8 @@ void handleMemoryBus() { //To be executed on second core
             //Detect interrupts
             if   ( (history[readAheadIndex] & 0x0000ffc7) == 0x0040             //fifth instruction continues from 0x0040, 0x0048, 0x0050, 0x0058 or 0x0060 (this bitmask permits some rare and unlikely edge cases)
                 && (uint16_t)history[(uint8_t)(readAheadIndex-2)] == sp-1       //third instruction has address of decremented stack pointer
-                && (uint16_t)history[(uint8_t)(readAheadIndex-1)] == sp-2) {    //fourth instruction has decremented it even further
+                && (uint16_t)history[(uint8_t)(readAheadIndex-1)] == sp-2       //fourth instruction has decremented it even further
+                && ((uint16_t)history[readAheadIndex] != 0x0050 || timerCanInterrupt())) { //a jump to the timer interrupt is only plausible if the timer is running
                 // This is an interrupt. These are tricky to catch as two seemingly random reads are done first
                 // which can easily be mistaken for opcodes that are actully executed. This is why we do the read
                 // ahead, so we can see if the instruction after the next one reads the sp register. Additionally,
@@ -324,6 +545,7 @@ void handleMemoryBus() { //To be executed on second core
                 #ifdef DEBUG_EVENTS
                 history[*historyIndex] |= 0x02000000; //Use this bit to mark this event as an interrupt for debugging
                 #endif
+                const uint dispatchCycle = cycleIndex;
                 uint16_t oldAddress = (uint16_t)history[(uint8_t)(*historyIndex - 1)];
                 toMemory(--sp, oldAddress >> 8);
                 toMemory(--sp, (uint8_t)oldAddress);
@@ -332,13 +554,17 @@ void handleMemoryBus() { //To be executed on second core
                 getNextFromBus();
                 getNextFromBus();
                 getNextFromBus();
-                if (interruptsEnabled && (cycleIndex - interruptsEnableCycle > 16 || gameInfo.useImmediateIRQ)) {
+                const bool useForSync = interruptsEnabled && (cycleIndex - interruptsEnableCycle > 16 || gameInfo.useImmediateIRQ);
+                const int entryCycles = doubleSpeed ? 3 : 6; //The cycles it took to get here as seen by the PPU, which runs at half the CPU clock in double speed mode
+                if (*address == 0x0050) //Timer interrupt, the overflow happened right before the dispatch if interrupts were enabled
+                    timerInterruptEntry(dispatchCycle, useForSync);
+                if (useForSync) {
                     if (*address == 0x0040) { //vsync, set PPU to the beginning of vsync plus a few cycles that it took to get here.
-                        vblankOffset = (144 - y) * CYCLES_PER_LINE - lineCycle - 6;
+                        vblankOffset = (144 - y) * CYCLES_PER_LINE - lineCycle - entryCycles;
                         if (vblankOffset > CYCLES_PER_FRAME/2)
                             vblankOffset -= CYCLES_PER_FRAME;
                     } else if (*address == 0x0048 && ((memory[0xff41] & 0b01111000) == 0b01000000)) { //STAT interrupt for LY = LYC. That's helpful.
-                        vblankOffset = (memory[0xff45] - y) * CYCLES_PER_LINE - lineCycle - 6;
+                        vblankOffset = (memory[0xff45] - y) * CYCLES_PER_LINE - lineCycle - entryCycles;
                         if (vblankOffset > CYCLES_PER_FRAME/2)
                             vblankOffset -= CYCLES_PER_FRAME;
                         else if (vblankOffset < -CYCLES_PER_FRAME/2)
@@ -346,6 +572,7 @@ void handleMemoryBus() { //To be executed on second core
                     }
                 }
                 interruptsEnabled = false;
+                saveCheckpoint(*address); //The stack pointer just matched the bus, so this is a good moment to remember our state
             }
 
             //Execute an opcode
@@ -355,13 +582,20 @@ void handleMemoryBus() { //To be executed on second core
             DEBUG_TRIGGER_LOG_REGISTERS
             (*opcodes[*opcode])();
 
+            //A jump back to the entry point means that the game has been reset
+            if (*address == 0x0100)
+                softReset(false);
+
             // Debugging Breakpoint at specific address
             DEBUG_TRIGGER_BREAKPOINT_AT_ADDRESS
 
-            //Check if we missed an instruction and stop if we did.
+            //Check if we missed an instruction and resync if we did.
             if (BUS_PIO->fdebug & busPIOstallMask) {
-                stop("PIO stalled.");
+                desync("PIO stalled.");
             }
+
+            if (resyncRequested)
+                resync();
         }
 
         //Collect following instructions to get context for dump
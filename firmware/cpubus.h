@@ -22,14 +22,18 @@ extern uint8_t volatile * extra;
 
 #define HISTORY_READAHEAD 5
 extern uint32_t history[];
+extern uint8_t readAheadIndex;
+extern volatile uint softResetCount;
 extern uint volatile cycleIndex;
 extern uint8_t volatile * historyIndex; //Index for history array, lowest byte of cycleIndex
 extern uint volatile div;
 
 extern uint ignoreCycles;
+extern bool retSyncAfterDMA;
 extern bool cartridgeDMA;
 extern uint cartridgeDMAsrc;
 extern uint cartridgeDMAdst;
+extern uint cartridgeDMAlength;
 
 extern mutex_t cpubusMutex;
 #define DUMPMORE 10 //Additional lines to dump after error
@@ -37,6 +41,17 @@ extern mutex_t cpubusMutex;
 
 extern volatile uint8_t memory[];
 
+//Game Boy Color
+//The CGB has a second VRAM bank and six additional WRAM banks. We store them in our otherwise unused copy of the cartridge area:
+#define CGB_VRAM_BANK1 0x0000 //0x0000-0x1fff: VRAM bank 1
+#define CGB_WRAM_BANK2 0x2000 //0x2000-0x7fff: WRAM banks 2 to 7 (bank 1 stays at 0xd000)
+//Every access to the memory copy can be redirected per 4kB page via this offset (with 16 bit wrap around), which is all zero for the DMG.
+extern uint16_t memoryPageOffset[];
+#define MAPPED_ADDRESS(ADDR) ((uint16_t)((ADDR) + memoryPageOffset[(uint16_t)(ADDR) >> 12]))
+extern volatile bool cgbMode;
+extern volatile bool doubleSpeed;
+extern uint8_t cartridgeCgbFlag;
+
 //CPU registers
 extern uint8_t registers[];
 extern uint8_t * b;
@@ -64,7 +79,18 @@ void handleMemoryBus();
 void getNextFromBus();
 
 void dmaToOAM(uint16_t source);
+bool oamDmaBusy();
+void dmaToVRAM(uint8_t control);
+bool vramDmaBusy();
+
+bool enableCgbMode();
+void setVramBank(uint8_t bank);
+void setWramBank(uint8_t bank);
+void setDoubleSpeed(bool enable);
 
 void stop(const char* errorMsg);
 
+void resync();
+void softReset(bool reboot);
+
 #endif
\ No newline at end of file
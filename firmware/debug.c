@@ -131,7 +131,8 @@ void printPPUTiming() {
         printf("|% 4d |% 4d ..% 4d |% 4d ..% 4d |\n", line, ppuTiming[line][0], ppuTiming[line][1], ppuTiming[line][2], ppuTiming[line][3]);
     }
     printf(" ===============================\n");
-    printf("Frame: %d .. %d => %d (Should be %d), vblank adjusted by %d\n\n", ppuTimingEvents.frameStartCycle, ppuTimingEvents.frameEndCycle, ppuTimingEvents.frameEndCycle - ppuTimingEvents.frameStartCycle, CYCLES_PER_FRAME, ppuTimingEvents.vblankOffset);
+    printf("Frame: %d .. %d => %d (Should be %d), vblank adjusted by %d\n", ppuTimingEvents.frameStartCycle, ppuTimingEvents.frameEndCycle, ppuTimingEvents.frameEndCycle - ppuTimingEvents.frameStartCycle, CYCLES_PER_FRAME, ppuTimingEvents.vblankOffset);
+    printf("Rendering: %d us per frame, %d ns per visible line (%s)\n\n", ppuTimingEvents.renderMicros, ppuTimingEvents.renderMicros * 1000 / SCREEN_H, wholeLineRendering && !cgbMode ? "whole lines" : "8 pixel steps");
 }
 
 #endif
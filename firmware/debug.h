@@ -71,6 +71,7 @@ struct PPUTimingEvents {
     uint frameStartCycle;
     uint frameEndCycle;
     int vblankOffset;
+    uint renderMicros; //Time spent rendering pixels during the frame
 };
 
 extern struct PPUTimingEvents ppuTimingEvents;
@@ -87,6 +88,7 @@ void printPPUTiming();
         } else { \
             recordPPUTimingStarted = true; \
             ppuTimingEvents.vblankOffset = 0; \
+            ppuTimingEvents.renderMicros = 0; \
             ppuTimingEvents.frameStartCycle = cycleIndex; \
             for (int i = 0; i < LINES; i++) { \
                 ppuTiming[i][0] = 0; \
@@ -123,6 +125,14 @@ void printPPUTiming();
         ppuTimingEvents.vblankOffset = vblankOffset; \
     }
 
+#define DEBUG_RENDER_TIME_START \
+    const uint debugRenderTimeStart = timer_hw->timerawl;
+
+#define DEBUG_RENDER_TIME_STOP \
+    if (recordPPUTimingStarted) { \
+        ppuTimingEvents.renderMicros += timer_hw->timerawl - debugRenderTimeStart; \
+    }
+
 #else
 
 #define DEBUG_MARK_YRESET
@@ -131,6 +141,8 @@ void printPPUTiming();
 #define DEBUG_MARK_RENDERSTART
 #define DEBUG_MARK_RENDERSTOP
 #define DEBUG_MARK_VBLANK_ADJUST
+#define DEBUG_RENDER_TIME_START
+#define DEBUG_RENDER_TIME_STOP
 
 #endif
 
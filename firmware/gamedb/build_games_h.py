@@ -45,6 +45,8 @@ with open('games.csv') as csvfile:
                     gameInfo["disableLySyncs"] = parts[2]
                 elif parts[1].lower() == "windowLineAlwaysPauses".lower():
                     gameInfo["windowLineAlwaysPauses"] = parts[2]
+                elif parts[1].lower() == "accurateRendering".lower():
+                    gameInfo["accurateRendering"] = parts[2]
                 elif parts[1].lower() == "branchBasedFix".lower():
                     branchBasedFixParameters = parts[2].split(",")
                     branchBasedFix = {}
@@ -88,6 +90,7 @@ for gameInfo in gameInfos:
     print(".disableStatSyncs = " + gameInfo.get("disableStatSyncs", "false") + ", ", end="")
     print(".disableLySyncs = " + gameInfo.get("disableLySyncs", "false") + ", ", end="")
     print(".windowLineAlwaysPauses = " + gameInfo.get("windowLineAlwaysPauses", "false") + ", ", end="")
+    print(".accurateRendering = " + gameInfo.get("accurateRendering", "false") + ", ", end="")
     print(".branchBasedFixes = {", end="")
     for branchBasedFix in gameInfo["branchBasedFixes"]:
         print("{", end="")
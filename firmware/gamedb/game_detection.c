@@ -17,6 +17,7 @@ void resetHashes() {
     gameInfo.disableStatSyncs = false;
     gameInfo.disableLySyncs = false;
     gameInfo.windowLineAlwaysPauses = false;
+    gameInfo.accurateRendering = false;
     gameInfo.branchBasedFixes[0].jumpAddress = 0x0000;
     gameInfo.writeRegistersDuringDMA[0] = 0x00;
 
@@ -6,1407 +6,1407 @@
 #define GAME_LIST_SIZE 1401
 
 GameInfo __in_flash("games") gameInfos[GAME_LIST_SIZE] = {
-    {.vramHash1 = 0xbb016582, .vramHash2 = 0x00174aa3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLEBOBBLE2",      }, // Bubble Bobble Part 2 (USA, Europe)
-    {.vramHash1 = 0xa73564ac, .vramHash2 = 0x006734f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOIHOI DMG BAN",     }, // Hoi Hoi - Game Boy Ban (Japan)
-    {.vramHash1 = 0xad2efabf, .vramHash2 = 0x00ee7098, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GODZILLA",           }, // Godzilla (USA, Europe)
-    {.vramHash1 = 0x4d5fe1f9, .vramHash2 = 0x00f70c2c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KYORCHANLANDHI",     }, // Kyoro-chan Land (Japan)
-    {.vramHash1 = 0x7a2466fc, .vramHash2 = 0x015f6283, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Blue",       }, // Pocket Monsters - Ao (Japan)
-    {.vramHash1 = 0x57a10f1f, .vramHash2 = 0x017816f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SAILORMOON ",     }, // Bishoujo Senshi Sailor Moon R (Japan)
-    {.vramHash1 = 0xf4733db7, .vramHash2 = 0x019d7f63, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mystic Quest",       }, // Mystic Quest (France)
-    {.vramHash1 = 0xd7f9cb34, .vramHash2 = 0x01c8ee2c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL MANIA",      }, // Pinball Mania (Europe)
-    {.vramHash1 = 0x1725d07f, .vramHash2 = 0x02cf332a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROBIN HOOD",         }, // Robin Hood - Prince of Thieves (Europe), Robin Hood - Prince of Thieves (France), Robin Hood - Prince of Thieves (Germany), Robin Hood - Prince of Thieves (Spain), Robin Hood - Prince of Thieves (USA)
-    {.vramHash1 = 0x9fca15fa, .vramHash2 = 0x0317eded, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WARRIOR",            }, // Bakuretsu Senshi Warrior (Japan)
-    {.vramHash1 = 0x30addbea, .vramHash2 = 0x03212415, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VATTLE GIUCE",       }, // Vattle Giuce (Japan)
-    {.vramHash1 = 0x580a69f4, .vramHash2 = 0x033df3ee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONCHU HAKASE",      }, // Konchuu Hakase (Japan) (Rev A), Konchuu Hakase (Japan)
-    {.vramHash1 = 0xae2e6bda, .vramHash2 = 0x03591025, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DISNEYS MULAN",      }, // Mulan (USA, Europe)
-    {.vramHash1 = 0x6a31adfd, .vramHash2 = 0x03652bf1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAST BIBLE2",        }, // Megami Tensei Gaiden - Last Bible II (Japan)
-    {.vramHash1 = 0x24962fc5, .vramHash2 = 0x0372d4ef, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB DRUAGA 1",        }, // Druaga no Tou (Japan)
-    {.vramHash1 = 0x91eab4a0, .vramHash2 = 0x037441d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BASS POCKET 2",      }, // Super Black Bass Pocket 2 (Japan)
-    {.vramHash1 = 0xa91da2e7, .vramHash2 = 0x0378dcb4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE CHESSMASTE",     }, // Chessmaster, The (DMG-EM) (Europe)
-    {.vramHash1 = 0x0aba6190, .vramHash2 = 0x03a473e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAPERBOY 2",         }, // Paperboy 2 (USA, Europe)
-    {.vramHash1 = 0x543cfdc1, .vramHash2 = 0x03d342ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EITANGO SENTA",      }, // Goukaku Boy Series - 99 Nendo Ban Eitango Center 1500 (Japan)
-    {.vramHash1 = 0x44032954, .vramHash2 = 0x03e89e8d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIMPSON ESCAPE",     }, // Bart Simpson's Escape from Camp Deadly (USA, Europe), Bart no Survival Camp (Japan)
-    {.vramHash1 = 0x68c44806, .vramHash2 = 0x03f36702, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPY VS SPY",         }, // Spy vs Spy - Operation Boobytrap (Europe)
-    {.vramHash1 = 0x4796c727, .vramHash2 = 0x03f4c476, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOUKONSANJYUUS",     }, // Shin Nihon Pro Wrestling - Toukon Sanjuushi (Japan)
-    {.vramHash1 = 0x52209df5, .vramHash2 = 0x041127aa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOGU MOGU Q",        }, // Oyatsu Quiz Mogu Mogu Q (Japan)
-    {.vramHash1 = 0xb36e8c9d, .vramHash2 = 0x045657ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TWIN",               }, // Twin (Japan)
-    {.vramHash1 = 0xd4a22717, .vramHash2 = 0x0456bf4f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ACE STRIKER",        }, // Takeda Nobuhiro no Ace Striker (Japan)
-    {.vramHash1 = 0xb76050cd, .vramHash2 = 0x0477c5ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWFKOR",             }, // WWF King of the Ring (Japan)
-    {.vramHash1 = 0x99624616, .vramHash2 = 0x04aa67b6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOD MEDICINE F",     }, // God Medicine - Fukkokuban (Japan)
-    {.vramHash1 = 0x522fa5e1, .vramHash2 = 0x04ac02ec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUGSCRAZYCASTL",     }, // Bugs Bunny Crazy Castle 2, The (USA)
-    {.vramHash1 = 0x41d0b700, .vramHash2 = 0x04ce9222, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANIMAL BREEDER",     }, // Animal Breeder (Japan)
-    {.vramHash1 = 0x4345f295, .vramHash2 = 0x04d86798, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Donkey Kong Land 2", }, // Donkey Kong Land 2 (USA, Europe)
-    {.vramHash1 = 0xa15fc834, .vramHash2 = 0x04eb6502, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR WARS",          }, // Star Wars (Europe)
-    {.vramHash1 = 0x62fa9fc3, .vramHash2 = 0x057b8142, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAESARS PALACE",     }, // Caesars Palace (USA)
-    {.vramHash1 = 0x9728e4e7, .vramHash2 = 0x05869223, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKEMON YELLOW",     }, // Pocket Monsters - Pikachu (Japan) (Rev 1), Pocket Monsters - Pikachu (Japan) (Rev 2), Pocket Monsters - Pikachu (Japan) (Rev 3), Pocket Monsters - Pikachu (Japan)
-    {.vramHash1 = 0xcdeb73f9, .vramHash2 = 0x059b4758, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENGUINKUNWARS",     }, // Penguin-kun Wars VS. (Japan)
-    {.vramHash1 = 0x252641c7, .vramHash2 = 0x06b500d3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEKOJARA",           }, // Nekojara Monogatari (Japan)
-    {.vramHash1 = 0x1d7bfe9b, .vramHash2 = 0x06f6efe0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TESSERAE",           }, // Tesserae (USA)
-    {.vramHash1 = 0xb416685e, .vramHash2 = 0x07518481, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOME ALONE2",        }, // Home Alone 2 - Lost In New York (USA, Europe)
-    {.vramHash1 = 0x2f14ce27, .vramHash2 = 0x078ba8eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANJIRO       ",     }, // Pocket Kanjirou (Japan)
-    {.vramHash1 = 0x764285d3, .vramHash2 = 0x07d9c0b9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN4",           }, // Mega Man IV (USA)
-    {.vramHash1 = 0x8ff5ca5e, .vramHash2 = 0x07deb53d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KID DRACULA",        }, // Kid Dracula (USA, Europe)
-    {.vramHash1 = 0x19c36bf3, .vramHash2 = 0x07dfcce1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHANGHAI",           }, // Shanghai (Japan) (Activision)
-    {.vramHash1 = 0x1f475dcf, .vramHash2 = 0x07f94d2b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "INFREY QUEST",       }, // Adventures of Pinocchio, The (Unknown) (Proto)
-    {.vramHash1 = 0x3ea32306, .vramHash2 = 0x0844bb8c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-KMJ",            }, // Kakomunja (Japan)
-    {.vramHash1 = 0x57b6f1c7, .vramHash2 = 0x0866d32d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMICICEHOCK",     }, // Konamic Ice Hockey (Japan)
-    {.vramHash1 = 0x16f8e76c, .vramHash2 = 0x08796112, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIBIMARUKO2",       }, // Chibi Maruko-chan 2 - Deluxe Maruko World (Japan)
-    {.vramHash1 = 0x07a9f6ab, .vramHash2 = 0x08ba78c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TESSERAE",           }, // Tesserae (Europe) (En,Fr,De,Es,It)
-    {.vramHash1 = 0x5f33eff4, .vramHash2 = 0x08be3e04, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RIKA  ANKI  25",     }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Rika Anki Point 250 (Japan)
-    {.vramHash1 = 0xe18cae3c, .vramHash2 = 0x08c1ddf8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {{.jumpAddress = 0x1a42, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x1a47, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x1ad6, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "BattletoadsDDragon", }, // Battletoads-Double Dragon (Europe)
-    {.vramHash1 = 0x611fd9af, .vramHash2 = 0x08eea5e1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAFFY DUCK",         }, // Daffy Duck (Europe)
-    {.vramHash1 = 0xfc507dd2, .vramHash2 = 0x08fdbba5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {{.jumpAddress = 0x1a42, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x1a47, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x1ad6, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "BattletoadsDDragon", }, // Battletoads-Double Dragon (USA)
-    {.vramHash1 = 0x596f2ebb, .vramHash2 = 0x0959365f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTELIAN",          }, // Castelian (Europe)
-    {.vramHash1 = 0x0ef71ab9, .vramHash2 = 0x097ea5fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SQUARE DEAL",        }, // Square Deal - The Game of Two-Dimensional Poker (USA)
-    {.vramHash1 = 0xeae86919, .vramHash2 = 0x099bc3fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TDL FANTASYTOU",     }, // Tokyo Disneyland - Fantasy Tour (Japan)
-    {.vramHash1 = 0x9b59a121, .vramHash2 = 0x09abc1a8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PHANTASM",           }, // Phantasm (Japan)
-    {.vramHash1 = 0x684917c2, .vramHash2 = 0x09e8b7be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TYUUGAKUKANJI ",     }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Kanji Mondai no Seifuku (Japan)
-    {.vramHash1 = 0x09eb96ef, .vramHash2 = 0x0a00691b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKEMON YELLOW",     }, // Pokemon - Yellow Version - Special Pikachu Edition (USA, Europe) (GBC,SGB Enhanced)
-    {.vramHash1 = 0x09eb98bb, .vramHash2 = 0x0a016f3f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKEMON YELAPS",     }, // Pokemon - Edicion Amarilla - Edicion Especial Pikachu (Spain) (GBC,SGB Enhanced), Pokemon - Gelbe Edition - Special Pikachu Edition (Germany) (GBC,SGB Enhanced), Pokemon - Version Jaune - Edition Speciale Pikachu (France) (GBC,SGB Enhanced), Pokemon - Versione Gialla - Speciale Edizione Pikachu (Italy) (GBC,SGB Enhanced)
-    {.vramHash1 = 0x59b49501, .vramHash2 = 0x0a2969ae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAPTAIN TUBASA",     }, // Captain Tsubasa J - Zenkoku Seiha e no Chousen (Japan)
-    {.vramHash1 = 0x958ab290, .vramHash2 = 0x0a3484f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PALAMEDES",          }, // Palamedes (Europe)
-    {.vramHash1 = 0x21003137, .vramHash2 = 0x0a6b5d77, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALAGA&GALAXIA",     }, // Arcade Classic No. 3 - Galaga & Galaxian (USA)
-    {.vramHash1 = 0xf35c6d48, .vramHash2 = 0x0a7434eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MILON CASTLE",       }, // Milon no Meikyuu Kumikyoku (Japan)
-    {.vramHash1 = 0x86f3caba, .vramHash2 = 0x0a83ee42, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GEARWORKS",          }, // Gear Works (USA, Europe)
-    {.vramHash1 = 0xed45af4a, .vramHash2 = 0x0ab7a3ca, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPACE INVADERS",     }, // Space Invaders (Japan)
-    {.vramHash1 = 0xf0622de8, .vramHash2 = 0x0b15458d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOPRANKTENNIS",      }, // Top Rank Tennis (USA)
-    {.vramHash1 = 0xe8520a3f, .vramHash2 = 0x0b19cb62, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIDER-MAN 3 D",     }, // Spider-Man 3 - Invasion of the Spider-Slayers (USA, Europe)
-    {.vramHash1 = 0x208a1089, .vramHash2 = 0x0b421ab0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPEYE 2",           }, // Popeye 2 (Europe)
-    {.vramHash1 = 0x9d38c5d1, .vramHash2 = 0x0b8d1823, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-ASE",            }, // Boomer's Adventure in ASMIK World (USA)
-    {.vramHash1 = 0x246bdb0a, .vramHash2 = 0x0bb39726, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY MOUSE",       }, // Mickey Mouse (Japan)
-    {.vramHash1 = 0xbbc44c9d, .vramHash2 = 0x0bddbe54, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR WARS",          }, // Star Wars (USA)
-    {.vramHash1 = 0x4c6c5154, .vramHash2 = 0x0c3dfe8c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOXIC CRUSADER",     }, // Toxic Crusaders (USA)
-    {.vramHash1 = 0xaf7991ce, .vramHash2 = 0x0c62c343, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NHL 96",             }, // NHL '96 (USA, Europe)
-    {.vramHash1 = 0x149a28f0, .vramHash2 = 0x0c748280, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOUKENJIMA3",        }, // Takahashi Meijin no Bouken-jima III (Japan)
-    {.vramHash1 = 0x83039d94, .vramHash2 = 0x0c7d2557, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORASUREGAIDEN",     }, // Dragon Slayer - Nemuri no Oukan (Japan)
-    {.vramHash1 = 0xfc4c4f3a, .vramHash2 = 0x0c9901dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REN AND STIMPY",     }, // Ren & Stimpy Show, The - Space Cadet Adventures (USA)
-    {.vramHash1 = 0x49be4d06, .vramHash2 = 0x0cc77d1d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU KOF 95",      }, // Nettou The King of Fighters '95 (Japan)
-    {.vramHash1 = 0xe201a30a, .vramHash2 = 0x0cc9e88c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOCK'N CHASE",       }, // Lock n' Chase ~ Lock 'n' Chase (World)
-    {.vramHash1 = 0xa7096e59, .vramHash2 = 0x0cfa766c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Game Boy Gallery 2", }, // Game Boy Gallery 2 (Japan)
-    {.vramHash1 = 0x043a5b93, .vramHash2 = 0x0d26af13, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOAL!",              }, // Goal! (USA)
-    {.vramHash1 = 0x439789d8, .vramHash2 = 0x0d33310c, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Kirby's DreamLand2", }, // Hoshi no Kirby 2 (Japan), Kirby's Dream Land 2 (USA, Europe)
-    {.vramHash1 = 0xccdcb676, .vramHash2 = 0x0d362626, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISLOT KIDS",     }, // Pachi-Slot Kids 2 (Japan)
-    {.vramHash1 = 0x154d47f0, .vramHash2 = 0x0d419c8e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUNES OF VIRTU",     }, // Ultima - Runes of Virtue (USA), Ultima - Ushinawareta Runes (Japan)
-    {.vramHash1 = 0x80c0355c, .vramHash2 = 0x0d45fc38, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHUCK ROCK",         }, // Chuck Rock (USA, Europe)
-    {.vramHash1 = 0x0562304a, .vramHash2 = 0x0e82e510, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COLLEGE SLAM",       }, // College Slam (USA)
-    {.vramHash1 = 0xdccb2ee6, .vramHash2 = 0x0e94b696, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mortal Combat 3",    }, // Mortal Kombat 3 (Europe), Mortal Kombat 3 (USA)
-    {.vramHash1 = 0x0d79be91, .vramHash2 = 0x0f036a3a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PGA TOUR 96",        }, // PGA Tour 96 (USA, Europe)
-    {.vramHash1 = 0xf633bdbb, .vramHash2 = 0x0f3ba53e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SMARTCOM",           }, // SMARTCOM (Europe) (Unl)
-    {.vramHash1 = 0x130f55a1, .vramHash2 = 0x0f3fc488, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRINCE OF PERS",     }, // Prince of Persia (Japan)
-    {.vramHash1 = 0x94829d09, .vramHash2 = 0x0f47a121, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANIMANIACS",         }, // Animaniacs (Europe), Animaniacs (USA)
-    {.vramHash1 = 0x84e3bb22, .vramHash2 = 0x0f4f4a62, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKEBOM",            }, // Pocket Bomberman (Europe)
-    {.vramHash1 = 0x7f040b0c, .vramHash2 = 0x0f6e901d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINTAMA EAWASE",     }, // Nintama Rantarou GB - Eawase Challenge Puzzle (Japan)
-    {.vramHash1 = 0xfbf0c712, .vramHash2 = 0x0facf4b3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JUNGLE WARS",        }, // Jungle Wars (Japan)
-    {.vramHash1 = 0x815efe19, .vramHash2 = 0x0fb364be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOOK",               }, // Hook (Japan)
-    {.vramHash1 = 0xec31ea0e, .vramHash2 = 0x0fbc0f64, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADDAMS FAMILY",      }, // Addams Family, The (USA)
-    {.vramHash1 = 0x53cef250, .vramHash2 = 0x101f8fb7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB GENJIN LAND",     }, // GB Genjin Land - Viva! Chikkun Oukoku (Japan)
-    {.vramHash1 = 0x9e1e2758, .vramHash2 = 0x10291f82, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Burai Fighter",      }, // Burai Fighter Deluxe (USA, Europe)
-    {.vramHash1 = 0x663dabe2, .vramHash2 = 0x10b2aeab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FELIX THE CAT",      }, // Felix the Cat (USA, Europe)
-    {.vramHash1 = 0xdd955e43, .vramHash2 = 0x10dbdf9f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWF RAW",            }, // WWF Raw (USA, Europe)
-    {.vramHash1 = 0x3273aee2, .vramHash2 = 0x10e8683e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BREAKTHRU!",         }, // BreakThru! (USA)
-    {.vramHash1 = 0xbac4bb32, .vramHash2 = 0x11139763, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HIRYU GAIDEN",       }, // Hiryuu no Ken Gaiden (Japan)
-    {.vramHash1 = 0xc228fdc0, .vramHash2 = 0x11520b6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PHANTOM AIR MI",     }, // Phantom Air Mission (Europe)
-    {.vramHash1 = 0xbed08eec, .vramHash2 = 0x115cb15a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WINTER OLYMPIC",     }, // XVII Olympic Winter Games, The - Lillehammer 1994 (USA)
-    {.vramHash1 = 0x30a5220c, .vramHash2 = 0x122d91be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GARFIELD",           }, // Garfield Labyrinth (Europe)
-    {.vramHash1 = 0x1615d8f1, .vramHash2 = 0x1273a391, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KID ICARUS",         }, // Kid Icarus - Of Myths and Monsters (USA, Europe)
-    {.vramHash1 = 0x957f6280, .vramHash2 = 0x12d6eb0d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Double Dragon 3",    }, // Double Dragon 3 - The Arcade Game (USA, Europe)
-    {.vramHash1 = 0x8ee7ff81, .vramHash2 = 0x12f11c1b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY MOUSE 2",     }, // Mickey Mouse II (Japan)
-    {.vramHash1 = 0x7170f72c, .vramHash2 = 0x12fcb048, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB MARMALADEBO",     }, // Marmalade Boy (Japan)
-    {.vramHash1 = 0xc1b3c3d5, .vramHash2 = 0x1358cdf1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZOOP",               }, // Zoop (Japan), Zoop (USA, Europe)
-    {.vramHash1 = 0xe4792058, .vramHash2 = 0x13621c3d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HIGH STAKES",        }, // High Stakes (USA)
-    {.vramHash1 = 0x8d1c0e48, .vramHash2 = 0x136cca90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PALAMEDES",          }, // Palamedes (Japan)
-    {.vramHash1 = 0x02629658, .vramHash2 = 0x137d1030, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAINBENDER",        }, // Brain Bender (Europe)
-    {.vramHash1 = 0xb0df541e, .vramHash2 = 0x13ac5072, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KITERETU ZYURA",     }, // Kiteretsu Daihyakka - Bouken Ooedo Juraki (Japan)
-    {.vramHash1 = 0x97430eca, .vramHash2 = 0x13ac9560, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEST OF THE BE",     }, // Best of the Best - Championship Karate (USA)
-    {.vramHash1 = 0x0b3f4b18, .vramHash2 = 0x13be94a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAMCOCLASSIC",       }, // Namco Classic (Japan)
-    {.vramHash1 = 0x3ee044db, .vramHash2 = 0x13cded50, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOM AND JERRY",      }, // Tom to Jerry Part 2 (Japan)
-    {.vramHash1 = 0x20e1eb6e, .vramHash2 = 0x13e0a8b1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOD MEDICINE",       }, // God Medicine - Fantasy Sekai no Tanjou (Japan)
-    {.vramHash1 = 0x6a54cffb, .vramHash2 = 0x1449b592, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAKIBAO",            }, // Midori no Makibaou (Japan)
-    {.vramHash1 = 0xf223cc33, .vramHash2 = 0x147058e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KITAROU",         }, // Gegege no Kitarou - Youkai Souzoushu Arawaru! (Japan)
-    {.vramHash1 = 0x9b23a71e, .vramHash2 = 0x147f9afc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLE BOBBLE",      }, // Bubble Bobble (USA, Europe)
-    {.vramHash1 = 0x910fd7ee, .vramHash2 = 0x149e199b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TUMBLE POP",         }, // Tumble Pop (Japan), Tumble Pop (USA, Europe)
-    {.vramHash1 = 0xec1cc5bb, .vramHash2 = 0x14a97ba3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HEAD ON",            }, // Head On (Japan)
-    {.vramHash1 = 0x78d3355f, .vramHash2 = 0x14bf7648, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINY TOON 2 MM",     }, // Tiny Toon Adventures 2 - Montana's Movie Madness (USA, Europe)
-    {.vramHash1 = 0xb3985c64, .vramHash2 = 0x14ddc1dc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KUREYON SHI",     }, // Crayon Shin-chan - Ora to Shiro wa Otomodachi Da yo (Japan)
-    {.vramHash1 = 0x2a920759, .vramHash2 = 0x1506c79c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRAGONTAILBIT2",     }, // Dragon Tail (Japan)
-    {.vramHash1 = 0x0585f212, .vramHash2 = 0x15091fff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIRTY RACIN'",       }, // Dirty Racing (Japan)
-    {.vramHash1 = 0xc39cc3c3, .vramHash2 = 0x1530f19a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F1 SUPER DRIVI",     }, // Suzuki Aguri no F-1 Super Driving (Japan)
-    {.vramHash1 = 0x03d00708, .vramHash2 = 0x1585d54c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMISTA2",           }, // Famista 2 (Japan)
-    {.vramHash1 = 0x508b8421, .vramHash2 = 0x158ca00d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PYRAMIDS OF RA",     }, // Pyramids of Ra (USA)
-    {.vramHash1 = 0xdc4e6088, .vramHash2 = 0x15cee607, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY MOUSE",       }, // Mickey Mouse - Magic Wands (USA, Europe)
-    {.vramHash1 = 0x3d0a6e2f, .vramHash2 = 0x15dcb77f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIG WAVE SOCCE",     }, // J.League Big Wave Soccer (Japan)
-    {.vramHash1 = 0x8fcd97c7, .vramHash2 = 0x15e5c401, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER CHINESE ",     }, // Super Chinese Land 2 (Japan)
-    {.vramHash1 = 0x21c0ae4d, .vramHash2 = 0x16463e2c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WH2JET",             }, // World Heroes 2 Jet (USA, Europe)
-    {.vramHash1 = 0xbed9ba80, .vramHash2 = 0x1671455f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALIEN",              }, // Alien 3 (Japan), Alien 3 (USA, Europe)
-    {.vramHash1 = 0xab22eaae, .vramHash2 = 0x17c7b511, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DESERT STRIKE",      }, // Desert Strike - Return to the Gulf (Europe)
-    {.vramHash1 = 0xf4a7ddd2, .vramHash2 = 0x17cee232, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HONMEI BOY",         }, // Honmei Boy (Japan)
-    {.vramHash1 = 0x01ac4993, .vramHash2 = 0x17dce499, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUMOU FIGHTER",      }, // Sumou Fighter - Toukaidou Basho (Japan)
-    {.vramHash1 = 0x17ab2884, .vramHash2 = 0x180577bd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ECLIPSE",            }, // X (USA) (Proto)
-    {.vramHash1 = 0x8a023b67, .vramHash2 = 0x1853b75f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TWIN-BEE DA!!",      }, // TwinBee da!! (Japan)
-    {.vramHash1 = 0x9c7d9cc3, .vramHash2 = 0x18588ac3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE MASTER",      }, // Little Master - Raikuban no Densetsu (Japan)
-    {.vramHash1 = 0x78c71739, .vramHash2 = 0x187b66e7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOULDER DASH",       }, // Boulder Dash (Europe)
-    {.vramHash1 = 0xa3264be8, .vramHash2 = 0x18a3c0ad, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KLAX",               }, // Klax (USA)
-    {.vramHash1 = 0x53595f03, .vramHash2 = 0x194e6f46, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NBA JAM",            }, // NBA Jam (USA, Europe)
-    {.vramHash1 = 0x61a95a6e, .vramHash2 = 0x1989c62c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris",             }, // Tetris (Japan) (En)
-    {.vramHash1 = 0x165341fc, .vramHash2 = 0x19bf6324, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUNGEONLAND",        }, // Dungeon Land (Japan)
-    {.vramHash1 = 0xf483870b, .vramHash2 = 0x19ffc737, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALL STAR BB '9",     }, // All-Star Baseball 99 (USA)
-    {.vramHash1 = 0xb1536f98, .vramHash2 = 0x1a26b873, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOY AND BLOB G",     }, // David Crane's The Rescue of Princess Blobette Starring A Boy and His Blob (USA)
-    {.vramHash1 = 0x3204ccfd, .vramHash2 = 0x1a648642, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAMBORGHINI",        }, // Lamborghini American Challenge (USA, Europe)
-    {.vramHash1 = 0x3ce6c778, .vramHash2 = 0x1ab88c17, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KAGUYAHIME",         }, // Pachinko Kaguya Hime (Japan)
-    {.vramHash1 = 0x0e007039, .vramHash2 = 0x1b2fbf92, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PIPE DREAM",         }, // Pipe Dream (Japan)
-    {.vramHash1 = 0x0bd5ef13, .vramHash2 = 0x1b3372f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAYS OF THUNDE",     }, // Days of Thunder (USA, Europe)
-    {.vramHash1 = 0x2837db2b, .vramHash2 = 0x1b74c815, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA",               }, // Makai Toushi Sa-Ga (Japan) (Rev A)
-    {.vramHash1 = 0x2837db33, .vramHash2 = 0x1b750d11, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA",               }, // Makai Toushi Sa-Ga (Japan)
-    {.vramHash1 = 0x4620706a, .vramHash2 = 0x1b79df6c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUST A MOVE 3",      }, // Bust-A-Move 3 DX (Europe)
-    {.vramHash1 = 0xf503cdf4, .vramHash2 = 0x1b9410d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENGUIN WARS",       }, // Penguin Wars (USA)
-    {.vramHash1 = 0x7823678b, .vramHash2 = 0x1b9e461a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOGGLE PLUS",        }, // Boggle Plus (USA)
-    {.vramHash1 = 0xb2102a3c, .vramHash2 = 0x1baa6107, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TIP OFF",            }, // Tip Off (Europe)
-    {.vramHash1 = 0xce81b682, .vramHash2 = 0x1bbe71a3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris FLASH",       }, // Tetris Flash (Japan)
-    {.vramHash1 = 0xcdb0041d, .vramHash2 = 0x1bd146ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOKUJOU GB",         }, // Bokujou Monogatari GB (Japan) (Rev AB), Bokujou Monogatari GB (Japan)
-    {.vramHash1 = 0x8bbe89ec, .vramHash2 = 0x1c031457, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SD SEINTPARADA",     }, // Saint Paradise - Saikyou no Senshi-tachi (Japan)
-    {.vramHash1 = 0x023b2354, .vramHash2 = 0x1cef0854, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLEETCOMMANDER",     }, // Fleet Commander VS. (Japan)
-    {.vramHash1 = 0x60019404, .vramHash2 = 0x1cf83420, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL DREAMS",     }, // Pinball Dreams (USA, Europe)
-    {.vramHash1 = 0xfe419599, .vramHash2 = 0x1d00a518, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER MAKER ",     }, // Monster Maker (Japan)
-    {.vramHash1 = 0x4d8a2aa7, .vramHash2 = 0x1d3b08ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NIHON DAIHYOU ",     }, // Nihon Daihyou Team - Eikou no Eleven (Japan)
-    {.vramHash1 = 0x1ca83ef7, .vramHash2 = 0x1d4557af, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS",            }, // Nemesis (USA)
-    {.vramHash1 = 0x63fb862c, .vramHash2 = 0x1d7c30e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mario's Picross",    }, // Mario no Picross (Japan)
-    {.vramHash1 = 0xb24f34d8, .vramHash2 = 0x1d86a03e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER WARS",       }, // Monster Truck Wars (USA, Europe)
-    {.vramHash1 = 0xb6af1815, .vramHash2 = 0x1dc7d2ab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POWER RANGERS",      }, // Mighty Morphin Power Rangers (USA, Europe)
-    {.vramHash1 = 0x7997ca14, .vramHash2 = 0x1dead3ad, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PGA EURO TOUR",      }, // PGA European Tour (USA, Europe)
-    {.vramHash1 = 0x6c096051, .vramHash2 = 0x1e1d022c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SHINRI GAM",     }, // Shinri Game, The (Japan)
-    {.vramHash1 = 0x512c6b41, .vramHash2 = 0x1e5e135c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOOPY 2",           }, // Snoopy no Hajimete no Otsukai (Japan)
-    {.vramHash1 = 0x2d7fa794, .vramHash2 = 0x1f2255ff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARU'S MISSION",     }, // Maru's Mission (USA)
-    {.vramHash1 = 0x959b5478, .vramHash2 = 0x1f326a90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZOOL",               }, // Zool - Ninja of the 'Nth' Dimension (Europe), Zool - Ninja of the 'Nth' Dimension (USA)
-    {.vramHash1 = 0x2745126d, .vramHash2 = 0x1f432500, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RANMA1/2KAKUGE",     }, // Ranma 1-2 - Kakugeki Mondou!! (Japan)
-    {.vramHash1 = 0xf91edc75, .vramHash2 = 0x1f4d0ed8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TEKKAMANBLA",     }, // Uchuu no Kishi Tekkaman Blade (Japan)
-    {.vramHash1 = 0xdb4abb84, .vramHash2 = 0x1f855b74, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANDUME MONSTE",     }, // Kandume Monsters (Japan)
-    {.vramHash1 = 0x5861a85b, .vramHash2 = 0x1f870ac3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOCCER MANIA",       }, // Soccer Mania (USA)
-    {.vramHash1 = 0xf21674c7, .vramHash2 = 0x1fa41c9a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOULDER DASH",       }, // Boulder Dash (Japan)
-    {.vramHash1 = 0x2d8015fe, .vramHash2 = 0x1fa6f62a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OIRA JAJAMARU",      }, // Oira Jajamaru! Sekai Daibouken (Japan)
-    {.vramHash1 = 0x29edd7bc, .vramHash2 = 0x1ffb2090, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJATARO",          }, // Ninja Taro (USA) (Beta)
-    {.vramHash1 = 0xba4bb8e5, .vramHash2 = 0x2022c9b6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REKISI MASTER5",     }, // Goukaku Boy Series - Gakken - Rekishi 512 (Japan)
-    {.vramHash1 = 0xd46a2840, .vramHash2 = 0x20731945, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOME ALONE",         }, // Home Alone (USA, Europe)
-    {.vramHash1 = 0xc3afe463, .vramHash2 = 0x20b8c6cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAWNMOWER MAN",      }, // Lawnmower Man, The (Europe)
-    {.vramHash1 = 0x3ce8971d, .vramHash2 = 0x215e66fd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ATOMIC PUNK",        }, // Atomic Punk (USA)
-    {.vramHash1 = 0x25cab5f4, .vramHash2 = 0x21aaca15, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Ikari No Yousai 2",  }, // Ikari no Yousai 2 (Japan)
-    {.vramHash1 = 0x9d918f47, .vramHash2 = 0x226d8946, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FASTEST LAP",        }, // Fastest Lap (Japan, USA)
-    {.vramHash1 = 0x8f4a3d3c, .vramHash2 = 0x2287270f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "4 IN 1 FUN PAK",     }, // 4-in-1 Fun Pak (USA, Europe)
-    {.vramHash1 = 0xa82d6d92, .vramHash2 = 0x22e6ba57, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLITAIRE     ",     }, // Solitaire (Japan)
-    {.vramHash1 = 0xf9f383f5, .vramHash2 = 0x236fa1dc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB NAKAYOSHI1",      }, // Welcome Nakayoshi Park (Japan)
-    {.vramHash1 = 0x54d2f0a7, .vramHash2 = 0x238d6b11, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEMMINGS 2",         }, // Lemmings 2 - The Tribes (Europe)
-    {.vramHash1 = 0xc6970db2, .vramHash2 = 0x238e02a6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAZLOS LEAP",        }, // Lazlos' Leap (USA)
-    {.vramHash1 = 0xf444baf9, .vramHash2 = 0x2390aab3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WIZARDRY CAE",       }, // Wizardry Gaiden 2 - Kodai Koutei no Noroi (Japan)
-    {.vramHash1 = 0x98073350, .vramHash2 = 0x23d190fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOKU DRACURA K",     }, // Akumajou Special - Boku Dracula-kun (Japan)
-    {.vramHash1 = 0xf9e67e0d, .vramHash2 = 0x244aa38b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SEIKEN DENSETS",     }, // Seiken Densetsu - Final Fantasy Gaiden (Japan)
-    {.vramHash1 = 0xd3d999c3, .vramHash2 = 0x244f3b84, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PURIKURAPOCKET",     }, // Purikura Pocket 3 - Talent Debut Daisakusen (Japan)
-    {.vramHash1 = 0x78f6ed44, .vramHash2 = 0x246f56b2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBER BOY",         }, // Bomber Boy (Japan)
-    {.vramHash1 = 0xba2f239d, .vramHash2 = 0x24967987, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOM AND JERRY ",     }, // Tom & Jerry (USA, Europe)
-    {.vramHash1 = 0xa1e56c8a, .vramHash2 = 0x2498d345, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD ICE HOKK",     }, // World Ice Hockey (Japan)
-    {.vramHash1 = 0xe97643e9, .vramHash2 = 0x249ab4aa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI4WD GB2   ",     }, // Mini Yonku GB Let's & Go!! - All-Star Battle Max (Japan)
-    {.vramHash1 = 0x15107c20, .vramHash2 = 0x24a0975a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBERMAN GB3",      }, // Bomber Man GB 3 (Japan)
-    {.vramHash1 = 0xe97644a3, .vramHash2 = 0x24a208d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI4WD GB    ",     }, // Mini Yonku GB Let's & Go!! (Japan)
-    {.vramHash1 = 0xb35aa3e4, .vramHash2 = 0x24b79ea9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STOP THAT ROAC",     }, // Stop That Roach! (USA)
-    {.vramHash1 = 0x9de388c9, .vramHash2 = 0x24c434c1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {{.jumpAddress = 0x3427, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x342b, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x3499, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "Battletoads",        }, // Battletoads (Japan)
-    {.vramHash1 = 0x6423f549, .vramHash2 = 0x24d0fa93, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROBOCOP",            }, // RoboCop (USA)
-    {.vramHash1 = 0x83658634, .vramHash2 = 0x24f78692, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTAROU GAID",     }, // Momotarou Densetsu Gaiden (Japan)
-    {.vramHash1 = 0x623052c8, .vramHash2 = 0x255d9011, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE FLASH",          }, // Flash, The (USA, Europe)
-    {.vramHash1 = 0xe40575a3, .vramHash2 = 0x25852319, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JAMES  BOND  0",     }, // James Bond 007 (USA, Europe)
-    {.vramHash1 = 0x56d24684, .vramHash2 = 0x25d4de47, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ASTRO RABBY",        }, // Astro Rabby (Japan)
-    {.vramHash1 = 0x7fc32e85, .vramHash2 = 0x26056d7c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "B.C.KID2",           }, // B.C. Kid 2 (Europe)
-    {.vramHash1 = 0x3fa8ae15, .vramHash2 = 0x26585a34, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SQ DSV DMG",         }, // SeaQuest DSV (USA, Europe)
-    {.vramHash1 = 0x407a84fd, .vramHash2 = 0x268b5f6a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR SAVER",         }, // Adventures of Star Saver, The (USA, Europe)
-    {.vramHash1 = 0x6424c101, .vramHash2 = 0x26adaa4b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROBOCOP",            }, // RoboCop (Japan)
-    {.vramHash1 = 0x59ac2686, .vramHash2 = 0x272db829, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TERMINATOR 2",       }, // Terminator 2 - Judgment Day (USA, Europe)
-    {.vramHash1 = 0x65244354, .vramHash2 = 0x27786d49, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GINGA",              }, // Ginga - Card & Puzzle Collection (Japan) (En,Ja)
-    {.vramHash1 = 0x2d8eb18c, .vramHash2 = 0x27a02e60, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HUGO2",              }, // Hugo 2 (Germany)
-    {.vramHash1 = 0x8b1eb0d9, .vramHash2 = 0x27a2362d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLAPPY SPECIAL",     }, // Flappy Special (Japan)
-    {.vramHash1 = 0xb596ded9, .vramHash2 = 0x27c9aaf5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROBOCOP",            }, // RoboCop (USA, Europe) (Rev A)
-    {.vramHash1 = 0x30d3d897, .vramHash2 = 0x2806f2e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB CREYON 5",        }, // Crayon Shin-chan - Ora no Gokigen Collection (Japan)
-    {.vramHash1 = 0x813e41c3, .vramHash2 = 0x28161601, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOGURA DE PON!",     }, // Mogura de Pon! (Japan)
-    {.vramHash1 = 0x02ded5a0, .vramHash2 = 0x28928958, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEKICHUJUTSU",       }, // Mr. Go no Baken Tekichuu Jutsu (Japan)
-    {.vramHash1 = 0x8fcfa279, .vramHash2 = 0x2897c6e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHOPLIFTER III",     }, // Choplifter III (Europe)
-    {.vramHash1 = 0x84f564d8, .vramHash2 = 0x28a3ca1a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOTOCROSSMANIA",     }, // Motocross Maniacs (Europe)
-    {.vramHash1 = 0xe89a50f8, .vramHash2 = 0x28c3bef6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STUDYBOY SANSU",     }, // Doraemon no Study Boy 5 - Shou 2 Sansuu Keisan (Japan)
-    {.vramHash1 = 0x13d7fe1b, .vramHash2 = 0x290761da, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIFA SOCCER",        }, // FIFA International Soccer (USA, Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0xac84504c, .vramHash2 = 0x2942d61a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KUMANOPUTARO",       }, // Kuma no Puutarou - Takara Sagashi da Ooiri Game Battle! (Japan)
-    {.vramHash1 = 0x9415bb8c, .vramHash2 = 0x2948b6d0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUKEISNBC4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Keisan no Tatsujin (Japan)
-    {.vramHash1 = 0x12058fe0, .vramHash2 = 0x294ba9f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIONIC-COMMAND",     }, // Bionic Commando (Japan)
-    {.vramHash1 = 0x08cbd196, .vramHash2 = 0x29bb7e7b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Nicklaus Golf",      }, // Jack Nicklaus Golf (France), Jack Nicklaus Golf (USA, Europe)
-    {.vramHash1 = 0x49b0ceae, .vramHash2 = 0x29ebe835, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AMAZING PENGUI",     }, // Amazing Penguin (USA, Europe)
-    {.vramHash1 = 0xa0ec71d8, .vramHash2 = 0x29f15b02, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UMABAN CLUB",        }, // 3-pun Yosou - Umaban Club (Japan)
-    {.vramHash1 = 0x42fac4cc, .vramHash2 = 0x29ffc5c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAUI MALLARD",       }, // Maui Mallard (USA)
-    {.vramHash1 = 0xba2a6563, .vramHash2 = 0x2a92a371, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE PUNISHER",       }, // Punisher, The - The Ultimate Payback (USA)
-    {.vramHash1 = 0x84cc1d4f, .vramHash2 = 0x2aaad2a5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERMAN",           }, // Superman (USA, Europe)
-    {.vramHash1 = 0x8032cf44, .vramHash2 = 0x2b3f6432, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TARZAN",             }, // Tarzan (USA, Europe)
-    {.vramHash1 = 0x66ea5f80, .vramHash2 = 0x2b78df56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAIN DRAIN",        }, // Brain Drain (Japan)
-    {.vramHash1 = 0xb452973b, .vramHash2 = 0x2b80affc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAHOUJINGURUGU",     }, // Mahoujin Guruguru (Japan)
-    {.vramHash1 = 0xe714adec, .vramHash2 = 0x2b81d69c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TVCHAMPION",         }, // TV Champion (Japan)
-    {.vramHash1 = 0x8934dac1, .vramHash2 = 0x2ba626f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHIOKUN 2",        }, // Pachio-kun 2 (Japan)
-    {.vramHash1 = 0xf54a6158, .vramHash2 = 0x2bc9645a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUGRATS MOVIE",      }, // Rugrats Movie, The (USA)
-    {.vramHash1 = 0x8318b369, .vramHash2 = 0x2bd23552, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRAGON SLAYER ",     }, // Dragon Slayer I (Japan)
-    {.vramHash1 = 0x55e591d2, .vramHash2 = 0x2bf9a99d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHI SLOT KID",     }, // Pachi-Slot Kids 3 (Japan)
-    {.vramHash1 = 0x5ed7838f, .vramHash2 = 0x2c193099, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEGEND OF ZERD",     }, // Zerd no Densetsu (Japan)
-    {.vramHash1 = 0x8c381ef6, .vramHash2 = 0x2c2c6e56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "INDIANA JONES ",     }, // Indiana Jones and the Last Crusade (USA, Europe)
-    {.vramHash1 = 0x347d411f, .vramHash2 = 0x2c3c3f3a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIDERMAN XMEN",     }, // Spider-Man - X-Men (USA, Europe)
-    {.vramHash1 = 0x656fd664, .vramHash2 = 0x2c4166fa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STREET RACER",       }, // Street Racer (Japan), Street Racer (USA, Europe)
-    {.vramHash1 = 0x9e026242, .vramHash2 = 0x2c55bf8e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Sanrio Uranai",      }, // Sanrio Uranai Party (Japan) (Rev A), Sanrio Uranai Party (Japan)
-    {.vramHash1 = 0x44fadb1f, .vramHash2 = 0x2cc6dfae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RVT           ",     }, // RoboCop vs. The Terminator (Europe)
-    {.vramHash1 = 0xf0875859, .vramHash2 = 0x2d1b87c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mortal Combat I&II", }, // Mortal Kombat & Mortal Kombat II (Japan), Mortal Kombat & Mortal Kombat II (USA, Europe)
-    {.vramHash1 = 0x85671c60, .vramHash2 = 0x2d5fa070, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAIBA",              }, // Kenyuu Densetsu Yaiba (Japan)
-    {.vramHash1 = 0x4b3472f4, .vramHash2 = 0x2d778283, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GREAT GREED",        }, // Great Greed (USA)
-    {.vramHash1 = 0xa892047d, .vramHash2 = 0x2dfc5908, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TECMO BOWL",         }, // Tecmo Bowl (Japan)
-    {.vramHash1 = 0x03f08315, .vramHash2 = 0x2e02ee20, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAZMANIA",           }, // Taz-Mania (Europe)
-    {.vramHash1 = 0xe74f339d, .vramHash2 = 0x2e310a76, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RODLAND",            }, // Rodland (Europe)
-    {.vramHash1 = 0xe65713f3, .vramHash2 = 0x2e88a003, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mario's Picross",    }, // Mario's Picross (USA, Europe)
-    {.vramHash1 = 0x17defa97, .vramHash2 = 0x2ea24872, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL QUARTERBAC",     }, // NFL Quarterback Club (USA, Europe)
-    {.vramHash1 = 0x3c994212, .vramHash2 = 0x2ebc0341, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AMAZING-TATER",      }, // A-mazing Tater (USA)
-    {.vramHash1 = 0x74d2b36e, .vramHash2 = 0x2eca2688, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARODIUS DA!",       }, // Parodius Da! (Japan)
-    {.vramHash1 = 0x4ff103ed, .vramHash2 = 0x2f42aa31, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAKA SEKAISHI ",     }, // Goukaku Boy Series - Yamakawa Ichimonittou - Sekaishi B Yougo Mondaishuu (Japan)
-    {.vramHash1 = 0x9a66a1a5, .vramHash2 = 0x2fe97e95, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOKING DENSET",     }, // Hitori de Dekirumon! - Cooking Densetsu (Japan)
-    {.vramHash1 = 0xe88173a0, .vramHash2 = 0x304509c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F15 STRIKE EAG",     }, // F-15 Strike Eagle (USA, Europe)
-    {.vramHash1 = 0xd2414e3f, .vramHash2 = 0x3062a390, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRA-4",            }, // America Oudan Ultra Quiz Part 4 (Japan)
-    {.vramHash1 = 0x41c3119d, .vramHash2 = 0x309313c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FINAL REVERSE",      }, // Final Reverse (Japan)
-    {.vramHash1 = 0x65eb0f67, .vramHash2 = 0x3130246e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER RACE",       }, // Monster Race (Japan)
-    {.vramHash1 = 0x7615d82a, .vramHash2 = 0x31ba34c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BREAKOUT",     }, // Super Breakout (USA)
-    {.vramHash1 = 0xb9599cc5, .vramHash2 = 0x31bd469e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET GOLF   ",     }, // Pocket Golf (Japan)
-    {.vramHash1 = 0x84c056d5, .vramHash2 = 0x31d44cf1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Wacky Sports",       }, // Tiny Toon Adventures - Dokidoki Sport Festival (Japan), Tiny Toon Adventures - Wacky Sports (Europe), Tiny Toon Adventures - Wacky Sports (USA)
-    {.vramHash1 = 0x58d0e2e2, .vramHash2 = 0x328ad01f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTELIAN",          }, // Castelian (USA)
-    {.vramHash1 = 0x8500d998, .vramHash2 = 0x32c1fabe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-ASJ",            }, // Teke Teke! Asmik-kun World (Japan)
-    {.vramHash1 = 0xce55d575, .vramHash2 = 0x32c765e8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BONKSREVENGE",       }, // Bonk's Revenge (USA)
-    {.vramHash1 = 0x6b93d7dd, .vramHash2 = 0x32d96ae2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FACEBALL 2000 ",     }, // Faceball 2000 (USA)
-    {.vramHash1 = 0x9858719c, .vramHash2 = 0x3326b677, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KUNIO",              }, // Nekketsu Kouha Kunio-kun - Bangai Rantou Hen (Japan)
-    {.vramHash1 = 0x1c6b66e7, .vramHash2 = 0x3374d45b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRAMAN GEKID",     }, // Ultraman Chou Toushi Gekiden (Japan)
-    {.vramHash1 = 0x9cb9e2bd, .vramHash2 = 0x337a7480, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLECITY",         }, // BattleCity (Japan)
-    {.vramHash1 = 0x24eebd5f, .vramHash2 = 0x33b501f1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BLACK BA",     }, // Super Black Bass Pocket (Japan)
-    {.vramHash1 = 0x5364ff23, .vramHash2 = 0x33b65960, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STUDYBOY KOKUG",     }, // Doraemon no Study Boy 4 - Shou ni Kokugo Kanji (Japan)
-    {.vramHash1 = 0x50d9e91f, .vramHash2 = 0x33b9e41e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ELITE SOCCER",       }, // Elite Soccer (USA)
-    {.vramHash1 = 0xb40599bf, .vramHash2 = 0x33c262c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TSUMEGO_FUJISA",     }, // Tsumego Series 1 - Fujisawa Hideyuki Meiyo Kisei (Japan)
-    {.vramHash1 = 0xb0c143c7, .vramHash2 = 0x33d5835a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUUYUU-3",           }, // Yu Yu Hakusho Dai-3-dan - Makai no Tobira Hen (Japan)
-    {.vramHash1 = 0xe12b1961, .vramHash2 = 0x33e7df55, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CRYSTAL QUEST",      }, // Crystal Quest (USA)
-    {.vramHash1 = 0x68302295, .vramHash2 = 0x33eba75e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PICROSS 2",          }, // Picross 2 (Japan)
-    {.vramHash1 = 0xe3988e9c, .vramHash2 = 0x346135b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEAVIS & BUTTH",     }, // Beavis and Butt-Head (USA, Europe)
-    {.vramHash1 = 0x1297af19, .vramHash2 = 0x34804b13, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIONIC-COMMAND",     }, // Bionic Commando (Europe), Bionic Commando (USA)
-    {.vramHash1 = 0xd1a8162c, .vramHash2 = 0x35141065, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER KICK OFF",     }, // Super Kick Off (Europe) (En,Fr,De,It,Nl)
-    {.vramHash1 = 0xff2813a0, .vramHash2 = 0x352e4058, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-ATTACK",         }, // Pac-Attack (USA)
-    {.vramHash1 = 0x712093f5, .vramHash2 = 0x3577bfc3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALADDIN",            }, // Aladdin (Europe), Aladdin (USA)
-    {.vramHash1 = 0x18f1490d, .vramHash2 = 0x3587620f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAISENRYAKU HI",     }, // Daisenryaku (Japan)
-    {.vramHash1 = 0x43a3438b, .vramHash2 = 0x3589e6ab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE MAIN EVENT",     }, // WCW Main Event (USA, Europe)
-    {.vramHash1 = 0x94a6bf45, .vramHash2 = 0x358bc4ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TORPEDO RANGE",      }, // Torpedo Range (Japan)
-    {.vramHash1 = 0xc2a07158, .vramHash2 = 0x35ca848f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL",            }, // Pinball - Revenge of the 'Gator (USA, Europe)
-    {.vramHash1 = 0x33503e94, .vramHash2 = 0x35d3c6dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NADA ASATAROU ",     }, // Nada Asatarou no Powerful Mahjong - Tsugi no Itte 100 Dai (Japan)
-    {.vramHash1 = 0x9074e471, .vramHash2 = 0x35f0ec6c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-MQJ",            }, // Maerchen Club (Japan)
-    {.vramHash1 = 0xe34937e9, .vramHash2 = 0x35fd7f02, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEMP",               }, // Game Boy Digital Sampling Oscilloscope (Europe) (v3.6) (GBDSO) (Unl)
-    {.vramHash1 = 0x9fd7b1a2, .vramHash2 = 0x361fadd6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUNES OF VIRTU",     }, // Ultima - Runes of Virtue II (USA)
-    {.vramHash1 = 0x5754a169, .vramHash2 = 0x362cbc3b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DICK TRACY",         }, // Dick Tracy (USA)
-    {.vramHash1 = 0x69971c78, .vramHash2 = 0x363bdd92, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI4BOY",           }, // Mini 4 Boy (Japan)
-    {.vramHash1 = 0xe3d3f857, .vramHash2 = 0x3654285a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOTSUGEKI TANK",     }, // Totsugeki! Ponkotsu Tank (Japan)
-    {.vramHash1 = 0xb9a7b563, .vramHash2 = 0x36875c8f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET LOVE 2",      }, // Pocket Love 2 (Japan)
-    {.vramHash1 = 0x49b30e24, .vramHash2 = 0x36ba4614, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GHOSTBUSTERS I",     }, // Ghostbusters II (USA, Europe)
-    {.vramHash1 = 0x9207a0de, .vramHash2 = 0x37145a86, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHOUGI",             }, // Shougi (Japan)
-    {.vramHash1 = 0x96f3ce6b, .vramHash2 = 0x375689f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES 2",       }, // DuckTales 2 (Europe)
-    {.vramHash1 = 0x522ae3e7, .vramHash2 = 0x377aecf4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOTOCROSSMANIA",     }, // Motocross Maniacs (USA)
-    {.vramHash1 = 0x36abbd52, .vramHash2 = 0x37876e38, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "URBAN STRIKE",       }, // Urban Strike (USA, Europe)
-    {.vramHash1 = 0x9f38a94b, .vramHash2 = 0x38238b9c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AEROSTAR",           }, // Aerostar (USA, Europe)
-    {.vramHash1 = 0x4801dabb, .vramHash2 = 0x388b7338, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAMAGOTCH 2",     }, // Game de Hakken!! Tamagotchi 2 (Japan)
-    {.vramHash1 = 0x9ea576cf, .vramHash2 = 0x388e89f2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SD HIRYUNOKEN",      }, // SD Hiryuu no Ken Gaiden (Japan)
-    {.vramHash1 = 0xc469d5b1, .vramHash2 = 0x38bd528d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENGUIN LAND",       }, // Penguin Land (Japan)
-    {.vramHash1 = 0xcd047f64, .vramHash2 = 0x38e79f3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RIDDICK BOWE",       }, // Riddick Bowe Boxing (USA)
-    {.vramHash1 = 0x5afd85bd, .vramHash2 = 0x38fbd995, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOTOCROSSMANIA",     }, // Motocross Maniacs (Europe) (Rev A)
-    {.vramHash1 = 0x81c3da6d, .vramHash2 = 0x39bf1c4a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EITANGO 1900",       }, // Goukaku Boy Series - Eitango Target 1900 (Japan)
-    {.vramHash1 = 0x52336d62, .vramHash2 = 0x39fb9154, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Ca Da",              }, // Hiden Inyou Kikouhou - Ca Da (Japan)
-    {.vramHash1 = 0x29fe0189, .vramHash2 = 0x3a82e1aa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VIKING CHILD 1",     }, // Prophecy - The Viking Child (USA)
-    {.vramHash1 = 0x6eb85cc3, .vramHash2 = 0x3a86c3f7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALTERED SPACE",      }, // Altered Space - A 3-D Alien Adventure (USA)
-    {.vramHash1 = 0x54e70bbc, .vramHash2 = 0x3aa5baa1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PEETAN",             }, // Peetan (Japan)
-    {.vramHash1 = 0x43ac9274, .vramHash2 = 0x3ab63d48, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAME GAME",          }, // Same Game (Japan)
-    {.vramHash1 = 0x9fd8a853, .vramHash2 = 0x3aba3a76, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUNES OF VIRTU",     }, // Ultima - Ushinawareta Runes II (Japan)
-    {.vramHash1 = 0x0b5fc287, .vramHash2 = 0x3af5642b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUJOSIKBS4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Joushiki no Sho (Japan) (Special Edition)
-    {.vramHash1 = 0xb21cf345, .vramHash2 = 0x3b1b80b4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WEREBACK BC",        }, // We're Back! - A Dinosaur's Story (USA, Europe)
-    {.vramHash1 = 0xcef99108, .vramHash2 = 0x3b4c6470, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEYS CHASE",      }, // Mickey's Dangerous Chase (USA)
-    {.vramHash1 = 0xdfda6b1e, .vramHash2 = 0x3becda5d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Joshua",             }, // Joshua & the Battle of Jericho (USA) (Unl)
-    {.vramHash1 = 0x1aeb1b8e, .vramHash2 = 0x3bf0011b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHANGHAI",           }, // Shanghai (Japan) (HAL Laboratory)
-    {.vramHash1 = 0x6c671e5f, .vramHash2 = 0x3c03035f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QUARTH",             }, // Quarth (Japan)
-    {.vramHash1 = 0xc9110778, .vramHash2 = 0x3c045df5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALTERED SPACE",      }, // Altered Space - A 3-D Alien Adventure (Japan)
-    {.vramHash1 = 0xf5bd293f, .vramHash2 = 0x3c088df8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOUR DE THRASH",     }, // Skate or Die - Tour de Thrash (USA)
-    {.vramHash1 = 0xa27a0fac, .vramHash2 = 0x3c15ebec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOOPY",             }, // Snoopy - Magic Show (USA, Europe)
-    {.vramHash1 = 0x7f880456, .vramHash2 = 0x3c33ead7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEKKYUFIGHT!",       }, // Tekkyu Fight! - The Great Battle Gaiden (Japan)
-    {.vramHash1 = 0x884d44b1, .vramHash2 = 0x3c376627, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ITCHY & SCRATC",     }, // Simpsons Itchy & Scratchy, The - Miniature Golf Madness (USA, Europe)
-    {.vramHash1 = 0x62d35351, .vramHash2 = 0x3c3ea3e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOW BROS.JR",       }, // Snow Bros. Jr. (Europe)
-    {.vramHash1 = 0xd95c049e, .vramHash2 = 0x3cb257ae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRAGONS LAIR  ",     }, // Dragon's Lair (Japan)
-    {.vramHash1 = 0x04162af0, .vramHash2 = 0x3ce9d7ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARK WING DUCK",     }, // Darkwing Duck (USA)
-    {.vramHash1 = 0x4e322794, .vramHash2 = 0x3ceeb0e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES",         }, // DuckTales (Europe)
-    {.vramHash1 = 0xa875db02, .vramHash2 = 0x3d55d23f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F1 SPIRIT",          }, // F-1 Spirit (Japan)
-    {.vramHash1 = 0xeb5091c7, .vramHash2 = 0x3d82ba17, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALFRED CHICKEN",     }, // Alfred Chicken (Japan)
-    {.vramHash1 = 0xf41e46b7, .vramHash2 = 0x3d92066d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBSY II",           }, // Bubsy II (Europe)
-    {.vramHash1 = 0xa2add336, .vramHash2 = 0x3e0c3886, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOY AND BLOB G",     }, // David Crane's The Rescue of Princess Blobette Starring A Boy and His Blob (Europe)
-    {.vramHash1 = 0xc8940cd7, .vramHash2 = 0x3e62ffd5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MADDEN 95",          }, // Madden '95 (USA, Europe)
-    {.vramHash1 = 0xe240c4bc, .vramHash2 = 0x3e8a09d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OPERATION C",        }, // Operation C (USA)
-    {.vramHash1 = 0xcbb328c1, .vramHash2 = 0x3ed0bc0d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-MAN",            }, // Pac-Man (Europe)
-    {.vramHash1 = 0x3561044e, .vramHash2 = 0x3eea4abc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY'S PINBAL",     }, // Kirby no Pinball (Japan)
-    {.vramHash1 = 0x96b72d36, .vramHash2 = 0x3f2fffed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SEA BATTLE",         }, // Sea Battle (Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0x53ea93a2, .vramHash2 = 0x3f430288, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARKMAN",            }, // Darkman (USA, Europe)
-    {.vramHash1 = 0x6d5fbe32, .vramHash2 = 0x3f555bdb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINY TOON ADVE",     }, // Tiny Toon Adventures (Japan), Tiny Toon Adventures - Babs' Big Break (USA, Europe)
-    {.vramHash1 = 0x7375c87e, .vramHash2 = 0x3f798a93, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADDAMS FAMILY ",     }, // Addams Family, The - Pugsley's Scavenger Hunt (USA, Europe)
-    {.vramHash1 = 0x898a3d99, .vramHash2 = 0x3fb18544, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PITMAN",             }, // Pitman (Japan)
-    {.vramHash1 = 0xf5362014, .vramHash2 = 0x3fbb6cbc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAINBENDER",        }, // Brain Bender (USA)
-    {.vramHash1 = 0x8d54b6f6, .vramHash2 = 0x3fd827ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VELIOUS 2",          }, // Velious II - Fukushuu no Jashin (Japan)
-    {.vramHash1 = 0xff9b0455, .vramHash2 = 0x3fdb5b6b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGALIT",            }, // Megalit (USA, Europe)
-    {.vramHash1 = 0x0809d543, .vramHash2 = 0x40400497, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "S S BASKETBALL",     }, // Super Street Basketball (Japan)
-    {.vramHash1 = 0xe649e1a7, .vramHash2 = 0x40496a88, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRACK MEET",         }, // Track Meet (USA, Europe)
-    {.vramHash1 = 0x61f50604, .vramHash2 = 0x405de130, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RANMA1/2 PART2",     }, // Ranma 1-2 - Netsuretsu Kakutou Hen (Japan)
-    {.vramHash1 = 0xe3ae2aae, .vramHash2 = 0x40747cac, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE CHESSMASTE",     }, // Chessmaster, The (DMG-N5) (USA) (Rev A), Chessmaster, The (DMG-N5) (USA)
-    {.vramHash1 = 0xa945b8ec, .vramHash2 = 0x40bd8ba4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KOF HEATOFBATT",     }, // King of Fighters, The - Heat of Battle (Europe)
-    {.vramHash1 = 0xa641b25d, .vramHash2 = 0x40de2c5f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KEN GRIFFEY JR",     }, // Ken Griffey Jr. Presents Major League Baseball (USA, Europe)
-    {.vramHash1 = 0x1e990c40, .vramHash2 = 0x4117c55d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOAL!",              }, // Goal! (Europe)
-    {.vramHash1 = 0x6ec2ba5d, .vramHash2 = 0x4178ae6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NBA LIVE 96",        }, // NBA Live 96 (USA, Europe)
-    {.vramHash1 = 0x04c8e9b4, .vramHash2 = 0x41c5f479, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIFA 98",            }, // FIFA Road to World Cup 98 (Europe) (Rev A), FIFA Road to World Cup 98 (Europe)
-    {.vramHash1 = 0x91cb88ba, .vramHash2 = 0x41d91df9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB NEW SD GUND",     }, // Shin SD Gundam Gaiden - Knight Gundam Story (Japan)
-    {.vramHash1 = 0x907d9620, .vramHash2 = 0x41f9e723, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FUNPAK 4IN1",        }, // 4-in-1 Fun Pak (Japan)
-    {.vramHash1 = 0x59adbee8, .vramHash2 = 0x41fba3e6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP",          }, // Nintendo World Cup (USA, Europe)
-    {.vramHash1 = 0xc85fd9de, .vramHash2 = 0x42a42241, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARK WING DUCK",     }, // Darkwing Duck (Germany)
-    {.vramHash1 = 0xa6ea025d, .vramHash2 = 0x42f4fa88, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHINKO TIME",      }, // Pachinko Time (Japan)
-    {.vramHash1 = 0x768e30c2, .vramHash2 = 0x435160e8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSHI'S COOKIE",     }, // Yoshi's Cookie (USA, Europe)
-    {.vramHash1 = 0xfab282bf, .vramHash2 = 0x4363dc73, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NOOBOW",             }, // Noobow (Japan)
-    {.vramHash1 = 0x05118f60, .vramHash2 = 0x437f5c9a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL DELUXE",     }, // Pinball Deluxe (Europe)
-    {.vramHash1 = 0xbc6681d5, .vramHash2 = 0x43d58b15, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEYS CHASE",      }, // Mickey's Dangerous Chase (Europe)
-    {.vramHash1 = 0xa85974fe, .vramHash2 = 0x43d5e5bd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE GETAWAY   ",     }, // Getaway, The (USA)
-    {.vramHash1 = 0xd243ae10, .vramHash2 = 0x43fc85fa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAMAKAWA NIHON",     }, // Goukaku Boy Series - Yamakawa Ichimonittou - Nihonshi B Yougo Mondaishuu (Japan)
-    {.vramHash1 = 0x239da979, .vramHash2 = 0x440c1f1c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JUNGLE STRIKE",      }, // Jungle Strike (USA, Europe)
-    {.vramHash1 = 0x02df2186, .vramHash2 = 0x4438ec97, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOGO ACKMAN   ",     }, // Go Go Ackman (Japan)
-    {.vramHash1 = 0x7b805328, .vramHash2 = 0x445a9483, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIKI 2 TENGOK",     }, // Chiki Chiki Tengoku (Japan)
-    {.vramHash1 = 0x237268f0, .vramHash2 = 0x448d84d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENCHIWOKURAU",      }, // Tenchi o Kurau (Japan)
-    {.vramHash1 = 0x4716d4a5, .vramHash2 = 0x448e6c0f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {{.jumpAddress = 0x3427, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x342b, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x3499, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "Battletoads",        }, // Battletoads (USA, Europe)
-    {.vramHash1 = 0xede0f3e6, .vramHash2 = 0x44965ce8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RODLAND",            }, // Yousei Monogatari - Rod Land (Japan)
-    {.vramHash1 = 0x27da5319, .vramHash2 = 0x44fa4836, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STARGATE",           }, // Stargate (USA, Europe)
-    {.vramHash1 = 0xe2afea7d, .vramHash2 = 0x451d24f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "W CIRCUIT SERI",     }, // World Circuit Series (USA)
-    {.vramHash1 = 0xa08d5b33, .vramHash2 = 0x4543ce26, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GREMLINS 2",         }, // Gremlins 2 - The New Batch (World)
-    {.vramHash1 = 0xcf5801be, .vramHash2 = 0x4588e112, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKKOKUGOAJ6",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Kokugo Battle Hen (Japan)
-    {.vramHash1 = 0x6a51bd65, .vramHash2 = 0x45b47135, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GO GO TANK",         }, // Go! Go! Tank (Japan)
-    {.vramHash1 = 0x6ac76ce5, .vramHash2 = 0x45d1aeab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DLAIR THE LEGE",     }, // Dragon's Lair - The Legend (USA)
-    {.vramHash1 = 0x9ac44ab2, .vramHash2 = 0x45d2a476, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAIL N SCALE",       }, // Nail'n Scale (USA, Europe)
-    {.vramHash1 = 0x7174ec51, .vramHash2 = 0x45e201dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTTIFANTEN",         }, // Otto's Ottifanten - Baby Bruno's Nightmare (Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0x7de30093, .vramHash2 = 0x4601782f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOCCER",             }, // Soccer (Europe) (En,Fr,De)
-    {.vramHash1 = 0x53451c1a, .vramHash2 = 0x461c9f3d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COSMO TANK",         }, // Cosmo Tank (USA)
-    {.vramHash1 = 0xfd648670, .vramHash2 = 0x461e0ea2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORDZAP",            }, // WordZap (USA)
-    {.vramHash1 = 0x1cb87e27, .vramHash2 = 0x4620049f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALAGA&GALAXIA",     }, // Arcade Classic No. 3 - Galaga & Galaxian (Europe)
-    {.vramHash1 = 0x0a4779d0, .vramHash2 = 0x464e9052, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADDAMS FAMILY",      }, // Addams Family, The (Japan)
-    {.vramHash1 = 0xc2f7169a, .vramHash2 = 0x46d51c82, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SMALL SOLDIERS",     }, // Small Soldiers (USA, Europe)
-    {.vramHash1 = 0x3270f833, .vramHash2 = 0x47110e5b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOLF CLASSIC",       }, // Golf Classic (Europe)
-    {.vramHash1 = 0x01893017, .vramHash2 = 0x471f3f6a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAVY BLUE 90",       }, // Navy Blue 90 (Japan)
-    {.vramHash1 = 0x249fdf88, .vramHash2 = 0x473380dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GAUNTLET II",        }, // Gauntlet II (USA, Europe)
-    {.vramHash1 = 0xb920613e, .vramHash2 = 0x4742fc66, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARK WING DUCK",     }, // Darkwing Duck (Spain)
-    {.vramHash1 = 0x07b5a6bf, .vramHash2 = 0x4752cfe9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MILON CASTLE",       }, // Milon's Secret Castle (USA, Europe)
-    {.vramHash1 = 0xca9f1724, .vramHash2 = 0x484bab40, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-MAN",            }, // Pac-Man (Japan)
-    {.vramHash1 = 0x22ded44d, .vramHash2 = 0x485dcb2e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NORTH STAR",         }, // Fist of the North Star (USA)
-    {.vramHash1 = 0x02b4ce82, .vramHash2 = 0x49b82b15, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOUKOBAN",           }, // Soukoban (Japan)
-    {.vramHash1 = 0x2c295f35, .vramHash2 = 0x49c2ebb0, .dmaFix = 0xff95, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Alien vs Predator",  }, // Alien vs Predator (Japan)
-    {.vramHash1 = 0xbcf8ecd9, .vramHash2 = 0x49e30348, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENTADRAGON",        }, // Penta Dragon (Japan)
-    {.vramHash1 = 0x0e36e932, .vramHash2 = 0x49ec5fd6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAZMANIA",           }, // Taz-Mania 2 (USA)
-    {.vramHash1 = 0x4b7feecf, .vramHash2 = 0x4a04ddc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RVT",                }, // RoboCop vs. The Terminator (USA)
-    {.vramHash1 = 0x3717b049, .vramHash2 = 0x4a2c8abf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAIYUUKI",           }, // Pachinko Saiyuuki (Japan)
-    {.vramHash1 = 0x83ae1ce4, .vramHash2 = 0x4a4c8bf5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WINTER GOLD",        }, // Winter Gold (Europe)
-    {.vramHash1 = 0xeadb6b72, .vramHash2 = 0x4a8bb694, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICRO MACHINES",     }, // Micro Machines (USA, Europe)
-    {.vramHash1 = 0x74442121, .vramHash2 = 0x4a955242, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPOT",               }, // Spot (Japan)
-    {.vramHash1 = 0x46d44ed0, .vramHash2 = 0x4affc7ec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPARTAN X",          }, // Spartan X (Japan)
-    {.vramHash1 = 0xaab0f9cc, .vramHash2 = 0x4b396ff4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SMURFS 3",       }, // Smurfs Nightmare, The (Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0xa45ca602, .vramHash2 = 0x4b521df4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKMANWORLD5",      }, // Rockman World 5 (Japan)
-    {.vramHash1 = 0xc124a662, .vramHash2 = 0x4b8a9d23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GRADIUS",            }, // Gradius - The Interstellar Assault (USA)
-    {.vramHash1 = 0x10f943d6, .vramHash2 = 0x4b8ad2f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAWAPURO GB",        }, // Power Pro GB (Japan) (Rev A), Power Pro GB (Japan)
-    {.vramHash1 = 0xc71dd140, .vramHash2 = 0x4c2c283b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NOBUNAGA",           }, // Nobunaga's Ambition (USA)
-    {.vramHash1 = 0xbe407542, .vramHash2 = 0x4cac79e6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SMURFS2",            }, // Smurfs Travel the World, The (Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0x6d2632b0, .vramHash2 = 0x4d617e55, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = " DMG AGING TES",     }, // Game Boy Controller Kensa Cartridge (Japan)
-    {.vramHash1 = 0x20327266, .vramHash2 = 0x4e119ba3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CLEMENS BASEBA",     }, // MVP Baseball (Japan), Roger Clemens' MVP Baseball (USA)
-    {.vramHash1 = 0x79ae9c90, .vramHash2 = 0x4e11c841, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-PANIC",          }, // Pac-Panic (Japan)
-    {.vramHash1 = 0x38826855, .vramHash2 = 0x4e22c6bb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPEYE 2",           }, // Popeye 2 (USA)
-    {.vramHash1 = 0x03bbb827, .vramHash2 = 0x4e3db320, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHIO KUN",         }, // Pachio-kun (Japan)
-    {.vramHash1 = 0x73a8c57b, .vramHash2 = 0x4e5b5ffb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HERCULES EIKOU",     }, // Heracles no Eikou - Ugokidashita Kamigami (Japan)
-    {.vramHash1 = 0x0264ccbe, .vramHash2 = 0x4e8db198, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STUDYBOY KUKU ",     }, // Doraemon no Study Boy 3 - Ku Ku Master (Japan)
-    {.vramHash1 = 0xa4f9ab3f, .vramHash2 = 0x4f13defb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BLODIA",             }, // Blodia (Japan)
-    {.vramHash1 = 0x01096fa3, .vramHash2 = 0x4fadb6f1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KYOUDAI JINGI",      }, // Uchiiwai - Kyoudaijingi no Puzzle Game (Japan)
-    {.vramHash1 = 0x4847f6ff, .vramHash2 = 0x4fc8b229, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KESAMARU",           }, // Panel no Ninja Kesamaru (Japan)
-    {.vramHash1 = 0xc8d0aace, .vramHash2 = 0x4fee59eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PROWRES",            }, // HAL Wrestling (USA) (Beta), HAL Wrestling (USA)
-    {.vramHash1 = 0xd5ddc94e, .vramHash2 = 0x50085161, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FERRARI",            }, // Ferrari Grand Prix Challenge (USA, Europe)
-    {.vramHash1 = 0x8ca509c5, .vramHash2 = 0x507ba749, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MM ULT CHALLEN",     }, // Mickey's Ultimate Challenge (USA, Europe)
-    {.vramHash1 = 0xe6ad4032, .vramHash2 = 0x5098390b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIDER-MAN",         }, // Amazing Spider-Man, The (USA, Europe)
-    {.vramHash1 = 0xcdc793a9, .vramHash2 = 0x50af7440, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UMINUSHI      ",     }, // Umi no Nushi Tsuri 2 (Japan)
-    {.vramHash1 = 0x85a741e0, .vramHash2 = 0x50c90878, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOOK",               }, // Hook (Europe)
-    {.vramHash1 = 0xdd1af877, .vramHash2 = 0x512b09da, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mazekko Monster",    }, // Chou Mashin Eiyuu Den Wataru - Mazekko Monster (Japan) (Beta), Chou Mashin Eiyuu Den Wataru - Mazekko Monster (Japan)
-    {.vramHash1 = 0x58872800, .vramHash2 = 0x5150c400, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET JOCKEY",      }, // Shin Keiba Kizoku Pocket Jockey (Japan)
-    {.vramHash1 = 0xad60273c, .vramHash2 = 0x517fe80d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SRJ DMG",            }, // Super Star Wars - Return of the Jedi (USA, Europe)
-    {.vramHash1 = 0x41d28746, .vramHash2 = 0x51b1ff99, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOUKOBAN2",          }, // Soukoban 2 (Japan)
-    {.vramHash1 = 0x58878fa8, .vramHash2 = 0x51d62aa1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP",          }, // Nekketsu Koukou Soccer-bu - World Cup Hen (Japan)
-    {.vramHash1 = 0x8cd80c16, .vramHash2 = 0x52821e3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKONYAN!",          }, // Pokonyan! - Yume no Daibouken (Japan)
-    {.vramHash1 = 0x1dd08852, .vramHash2 = 0x5296b6a4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE MASTER ",     }, // Little Master 2 - Raikou no Kishi (Japan)
-    {.vramHash1 = 0x2ac51058, .vramHash2 = 0x52b68841, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROGER RABBIT",       }, // Who Framed Roger Rabbit (USA)
-    {.vramHash1 = 0xe0fa8747, .vramHash2 = 0x52bc64eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F15 STRIKE EAG",     }, // F-15 Strike Eagle II (Unknown) (Proto)
-    {.vramHash1 = 0xc1516b68, .vramHash2 = 0x530c1fb8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB DBZ GOKOU",       }, // Dragon Ball Z - Gokuu Hishouden (Japan)
-    {.vramHash1 = 0x835e7b75, .vramHash2 = 0x53554ae9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIABLO",             }, // Diablo (USA) (Proto)
-    {.vramHash1 = 0x9dd8daec, .vramHash2 = 0x5379d274, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOOPY",             }, // Snoopy - Magic Show (Japan)
-    {.vramHash1 = 0x58891940, .vramHash2 = 0x538124a0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BASEBALL",           }, // Baseball (World)
-    {.vramHash1 = 0xa40e12ed, .vramHash2 = 0x53ae877d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RACING DAMASHI",     }, // Racing Damashii (Japan)
-    {.vramHash1 = 0x6e1d7347, .vramHash2 = 0x53d021d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "IN YOUR FACE",       }, // In Your Face (USA)
-    {.vramHash1 = 0x3ee6b814, .vramHash2 = 0x54235de1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUSTER BROTHER",     }, // Buster Bros. (USA)
-    {.vramHash1 = 0x67058322, .vramHash2 = 0x543e30d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENJINCOTTU",        }, // Genjin Cottsu (Japan)
-    {.vramHash1 = 0x7f6434c1, .vramHash2 = 0x545c2c9d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ISHIDO JPN VER",     }, // Ishido - The Way of Stones (Japan)
-    {.vramHash1 = 0x70783e15, .vramHash2 = 0x548d0442, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SWORD OFHO",     }, // Sword of Hope, The (Sweden)
-    {.vramHash1 = 0x3e141bc6, .vramHash2 = 0x54a6ee56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "METROID2",           }, // Metroid II - Return of Samus (World)
-    {.vramHash1 = 0x85af6249, .vramHash2 = 0x54b1d998, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Double Dragon",      }, // Double Dragon (USA, Europe)
-    {.vramHash1 = 0xf17e939f, .vramHash2 = 0x54f8eeac, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZETAN 1500",         }, // Goukaku Boy Series - Z Kai Kyuukyoku no Eitango 1500 (Japan)
-    {.vramHash1 = 0x643f22e2, .vramHash2 = 0x55016c16, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KLAX",               }, // Klax (Japan)
-    {.vramHash1 = 0xcbfe9235, .vramHash2 = 0x55255390, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mazekko Monster",    }, // Chou Mashin Eiyuu Den Wataru - Mazekko Monster 2 (Japan)
-    {.vramHash1 = 0x55a8f7f7, .vramHash2 = 0x55c89c31, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORDTRIS",           }, // Wordtris (USA)
-    {.vramHash1 = 0x45178a83, .vramHash2 = 0x55dc3c10, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPOT",               }, // Spot (USA)
-    {.vramHash1 = 0xbce4c744, .vramHash2 = 0x55e01a0f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTERTRUCK",       }, // Monster Truck (Japan)
-    {.vramHash1 = 0x57509696, .vramHash2 = 0x55fa60d3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLE QUEST U",     }, // Castle Quest (Europe)
-    {.vramHash1 = 0xf8b5d1f1, .vramHash2 = 0x56038d5f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARK WING DUCK",     }, // Darkwing Duck (Europe)
-    {.vramHash1 = 0x4d22eb60, .vramHash2 = 0x5626cd4a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINKU",              }, // Ninku (Japan)
-    {.vramHash1 = 0xaa593437, .vramHash2 = 0x567f8b63, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TDL MICKEY",         }, // Tokyo Disneyland - Mickey no Cinderella-jou Mystery Tour (Japan)
-    {.vramHash1 = 0x97fea4a3, .vramHash2 = 0x57324d4e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUKANJIBK4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Kanji no Tatsujin (Japan) (Special Edition)
-    {.vramHash1 = 0x6795ad60, .vramHash2 = 0x5736794a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Red/Green",  }, // Pocket Monsters - Aka (Japan) (Rev A), Pocket Monsters - Aka (Japan), Pocket Monsters - Midori (Japan) (Rev A), Pocket Monsters - Midori (Japan)
-    {.vramHash1 = 0x17666ff7, .vramHash2 = 0x577a8850, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOCCER BOY",         }, // Soccer Boy (Japan)
-    {.vramHash1 = 0xa3a33649, .vramHash2 = 0x57b78a3a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENNIS",             }, // Tennis (World)
-    {.vramHash1 = 0x3f64bfdd, .vramHash2 = 0x57fd200b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPORTS COLLECT",     }, // Sports Collection (Japan)
-    {.vramHash1 = 0xdd016e16, .vramHash2 = 0x58160fa6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POWER MODELLER",     }, // Gekitou Power Modeller (Japan)
-    {.vramHash1 = 0x7db69807, .vramHash2 = 0x5870f0ad, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOONEY TUNES",       }, // Looney Tunes - Bugs Bunny to Yukai na Nakama-tachi (Japan)
-    {.vramHash1 = 0x4e2fd295, .vramHash2 = 0x58a36a1c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DODGE BOY",          }, // Dodge Boy (Japan)
-    {.vramHash1 = 0x58aa08fe, .vramHash2 = 0x58a5ffea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHIKINJYO",          }, // Shikinjou (Japan)
-    {.vramHash1 = 0x9fd7e83d, .vramHash2 = 0x58e416eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE GAME OF LI",     }, // Jinsei Game (Japan)
-    {.vramHash1 = 0xdda59a3b, .vramHash2 = 0x58fdb050, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZOIDS J1",           }, // Zoids Densetsu (Japan)
-    {.vramHash1 = 0xae8a8bdb, .vramHash2 = 0x590d6f00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIBIMARUKO",        }, // Chibi Maruko-chan - Okozukai Daisakusen! (Japan)
-    {.vramHash1 = 0x97fed640, .vramHash2 = 0x5943d15a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB GENJIN     ",     }, // GB Genjin (Japan), Mani 4 in 1 (China) (DMG-605 CHN)
-    {.vramHash1 = 0xfff04000, .vramHash2 = 0x59502000, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KILLERINSTINCT",     }, // Killer Instinct (USA, Europe)
-    {.vramHash1 = 0x8dff2f1c, .vramHash2 = 0x59548207, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER MAX",        }, // Monster Max (Europe) (En,Fr,De,Es,It,Nl)
-    {.vramHash1 = 0xbf1eb301, .vramHash2 = 0x59595c5a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RED OCTOBER",        }, // Red October o Oe! (Japan)
-    {.vramHash1 = 0x30f4175b, .vramHash2 = 0x59642242, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE PAGEMASTER",     }, // Pagemaster, The (Europe), Pagemaster, The (USA)
-    {.vramHash1 = 0x83697f42, .vramHash2 = 0x59d90b0b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB BASKETBALL",      }, // GB Basketball (Japan)
-    {.vramHash1 = 0xa7a9909b, .vramHash2 = 0x5a1c5eff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SLAM DUNK 2",     }, // From TV Animation Slam Dunk 2 - Zenkoku e no Tip Off (Japan)
-    {.vramHash1 = 0x8cc8b3ef, .vramHash2 = 0x5a20e092, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOOK",               }, // Hook (USA)
-    {.vramHash1 = 0xd49f8ad4, .vramHash2 = 0x5a25cdf6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VALATIONS",          }, // Totsugeki Valations (Japan)
-    {.vramHash1 = 0x772b0889, .vramHash2 = 0x5a2f992f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JOE AND MAC",        }, // Joe & Mac - Caveman Ninja (Europe) (En,Fr,De,Es,It,Nl,Sv)
-    {.vramHash1 = 0x3460badb, .vramHash2 = 0x5a39b9ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LUCLE",              }, // Lucle (Japan, Europe)
-    {.vramHash1 = 0xb05c295d, .vramHash2 = 0x5a9d7c66, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLDAM GB",          }, // Soldam (Japan)
-    {.vramHash1 = 0x6eba6c80, .vramHash2 = 0x5af383d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DETECTIVCONAN2",     }, // Meitantei Conan - Giwaku no Gouka Ressha (Japan)
-    {.vramHash1 = 0x63bff91d, .vramHash2 = 0x5b0b1e8a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-IN-TIME",        }, // Pac-In-Time (Japan)
-    {.vramHash1 = 0xb7526f50, .vramHash2 = 0x5b0e4ca6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CENTIPEDE",          }, // Centipede (USA)
-    {.vramHash1 = 0xa6e776e2, .vramHash2 = 0x5b24137e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DODGE BALL",         }, // Nekketsu Koukou Dodgeball-bu - Kyouteki! Dodge Soldier no Maki (Japan)
-    {.vramHash1 = 0x6d3ab38f, .vramHash2 = 0x5b5f0f03, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Game Boy Gallery",   }, // Game Boy Gallery (Japan)
-    {.vramHash1 = 0xf223fa16, .vramHash2 = 0x5ba30551, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAMAGOTCHI ",     }, // Tamagotchi (France)
-    {.vramHash1 = 0xfe5e2c9d, .vramHash2 = 0x5c114b8f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRUMP COLLECTI",     }, // Trump Collection GB (Japan)
-    {.vramHash1 = 0x4febadd0, .vramHash2 = 0x5c319f4f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Fighbird GB",        }, // Taiyou no Yuusha - Fighbird GB (Japan)
-    {.vramHash1 = 0xee7775bd, .vramHash2 = 0x5ca9d793, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HATRIS",             }, // Hatris (Japan, USA)
-    {.vramHash1 = 0xf22412ec, .vramHash2 = 0x5cae99af, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAMAGOTCHI ",     }, // Tamagotchi (USA, Europe)
-    {.vramHash1 = 0x0c3eba2a, .vramHash2 = 0x5cbbdcf6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Red",        }, // Pokemon - Red Version (USA, Europe)
-    {.vramHash1 = 0xbc7c2fc6, .vramHash2 = 0x5cc66610, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SD LUPIN THE 3",     }, // SD Lupin Sansei - Kinko Yaburi Daisakusen (Japan)
-    {.vramHash1 = 0x504de2c5, .vramHash2 = 0x5cc9841d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP USA ",     }, // World Cup USA 94 (Japan) (En,Fr,De,Es,It,Nl,Pt,Sv)
-    {.vramHash1 = 0xb48b9af0, .vramHash2 = 0x5d05cfd2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SCHIFFE",            }, // Schiffe Versenken (Germany) (En,Fr,De,Es)
-    {.vramHash1 = 0x23003667, .vramHash2 = 0x5d1c6630, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUMO FIGHTER",       }, // Sumo Fighter (USA)
-    {.vramHash1 = 0xc38233bd, .vramHash2 = 0x5d4916e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALLERY2",           }, // Namco Gallery Vol.2 (Japan)
-    {.vramHash1 = 0x0e2275e6, .vramHash2 = 0x5d6759ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERCHINESE 1",     }, // Super Chinese Land 1.2.3' (Japan)
-    {.vramHash1 = 0xfd0e69be, .vramHash2 = 0x5d731f5f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAESARS PALACE",     }, // Caesars Palace (USA) (Rev A)
-    {.vramHash1 = 0xfd0e6e91, .vramHash2 = 0x5d79d330, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAESARS PALACE",     }, // Caesars Palace (Japan)
-    {.vramHash1 = 0x6996f160, .vramHash2 = 0x5db663cc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET SHOGI",       }, // Pocket Shougi (Japan)
-    {.vramHash1 = 0xf2629843, .vramHash2 = 0x5de13e6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWFKOR",             }, // WWF King of the Ring (USA, Europe)
-    {.vramHash1 = 0xf2243640, .vramHash2 = 0x5e151495, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAMAGOTCH 1",     }, // Game de Hakken!! Tamagotchi (Japan)
-    {.vramHash1 = 0xfecac3eb, .vramHash2 = 0x5e1bb447, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALSTARCHALLENG",     }, // NBA All Star Challenge 2 (Japan), NBA All Star Challenge 2 (USA, Europe)
-    {.vramHash1 = 0x3e98fe9b, .vramHash2 = 0x5e672f1e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD STRIKER",      }, // World Cup Striker (Japan)
-    {.vramHash1 = 0x495e2037, .vramHash2 = 0x5e9defa4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEMMINGS",           }, // Lemmings (Europe) (Rev A), Lemmings (USA)
-    {.vramHash1 = 0xcffc57d2, .vramHash2 = 0x5ee7b440, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PA BINGO",           }, // Panel Action Bingo (USA)
-    {.vramHash1 = 0xc30d4007, .vramHash2 = 0x5ef2c003, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJATARO",          }, // Ninja Taro (USA)
-    {.vramHash1 = 0xbb74a003, .vramHash2 = 0x5f061cc5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLEUNIT ZEO",     }, // Battle Unit Zeoth (USA, Europe)
-    {.vramHash1 = 0x7d57a3df, .vramHash2 = 0x5f3d013b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUYOPUYO",           }, // Puyo Puyo (Japan) (Rev A), Puyo Puyo (Japan)
-    {.vramHash1 = 0xe62ca19b, .vramHash2 = 0x5f45f44e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER MARIOLAN",     }, // Super Mario Land (World) (Rev A), Super Mario Land (World)
-    {.vramHash1 = 0xf4104289, .vramHash2 = 0x5fc799ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QIX",                }, // QIX (World)
-    {.vramHash1 = 0x94bf5172, .vramHash2 = 0x60276348, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BARBIE GAME GI",     }, // Barbie - Game Girl (USA, Europe)
-    {.vramHash1 = 0xfab564d9, .vramHash2 = 0x602adfd9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS 2 HERO",     }, // Nemesis II - The Return of the Hero (Europe)
-    {.vramHash1 = 0xe0f677a2, .vramHash2 = 0x60329e80, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY DREAM LA",     }, // Kirby's Dream Land (USA, Europe)
-    {.vramHash1 = 0x9e7b2b0f, .vramHash2 = 0x6063f05a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAPCOM QUIZ",        }, // Capcom Quiz - Hatena no Daibouken (Japan)
-    {.vramHash1 = 0x660ce13f, .vramHash2 = 0x6132f84c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAKENOU",            }, // Ippatsu Gyakuten! DX Bakenou (Japan)
-    {.vramHash1 = 0x469dafbb, .vramHash2 = 0x616ca148, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAVE NOIRE",         }, // Cave Noire (Japan)
-    {.vramHash1 = 0xbb921162, .vramHash2 = 0x61e5352f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HUDSON HAWK",        }, // Hudson Hawk (Japan), Hudson Hawk (USA)
-    {.vramHash1 = 0x7fe4713f, .vramHash2 = 0x621ae35c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOGIS GOLDRUSH",     }, // Yogi Bear in Yogi Bear's Goldrush (Europe)
-    {.vramHash1 = 0x03fcb6bb, .vramHash2 = 0x6225755a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROGER RABBIT",       }, // Who Framed Roger Rabbit (Spain)
-    {.vramHash1 = 0x989ab1d0, .vramHash2 = 0x6233f6d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GARGOYLE'S",         }, // Gargoyle's Quest (USA, Europe)
-    {.vramHash1 = 0xcc1c5ff5, .vramHash2 = 0x62363c94, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "G&W GALLERY",        }, // Game & Watch Gallery (Europe), Game & Watch Gallery (USA) (Rev A), Game & Watch Gallery (USA)
-    {.vramHash1 = 0xd4d203a1, .vramHash2 = 0x6239d89b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALIEN OLYMPICS",     }, // Alien Olympics (Europe)
-    {.vramHash1 = 0xd368cd77, .vramHash2 = 0x6241ecb6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPER BLACKBAS",     }, // Hyper Black Bass (Japan) (En,Ja)
-    {.vramHash1 = 0x5dc952ac, .vramHash2 = 0x624380a2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Medarot",            }, // Medarot - Kabuto Version (Japan) (Rev A), Medarot - Kabuto Version (Japan), Medarot - Kuwagata Version (Japan) (Rev A), Medarot - Kuwagata Version (Japan)
-    {.vramHash1 = 0xd6cfe0f7, .vramHash2 = 0x62470ae1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DOUBLEYAKUMAN ",     }, // Double Yakuman Junior (Japan)
-    {.vramHash1 = 0xb032fec6, .vramHash2 = 0x6270881e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER SCRABBLE",     }, // Super Scrabble (USA)
-    {.vramHash1 = 0xcf0c8dda, .vramHash2 = 0x6271ceee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SENGOKUNINJAKU",     }, // Sengoku Ninja-kun (Japan)
-    {.vramHash1 = 0x36f3e181, .vramHash2 = 0x62963497, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCK'N! MONSTE",     }, // Rock'n! Monster!! (Japan)
-    {.vramHash1 = 0xb09f0e36, .vramHash2 = 0x62b2ae90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GO! GO! HICHHI",     }, // Go! Go! Hitchhike (Japan)
-    {.vramHash1 = 0xa6fc336c, .vramHash2 = 0x62bed973, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-IN-TIME",        }, // Pac-In-Time (USA)
-    {.vramHash1 = 0x979e9919, .vramHash2 = 0x62d702ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLINTSTONES",        }, // Flintstones, The - King Rock Treasure Island (USA, Europe)
-    {.vramHash1 = 0x197686f4, .vramHash2 = 0x62da51af, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MILLI/CENTI/PE",     }, // Arcade Classic No. 2 - Centipede & Millipede (USA, Europe)
-    {.vramHash1 = 0x5a54fd59, .vramHash2 = 0x63182045, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUUYUU-4",           }, // Yu Yu Hakusho Dai-4-dan - Makai Touitsu Hen (Japan)
-    {.vramHash1 = 0x5eec3825, .vramHash2 = 0x636d6580, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BURGER TIME",        }, // BurgerTime Deluxe (World)
-    {.vramHash1 = 0xd9684df4, .vramHash2 = 0x63a80869, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VRALLY",             }, // V-Rally - Championship Edition (Europe) (En,Fr,De)
-    {.vramHash1 = 0xbc2779cb, .vramHash2 = 0x63cd74db, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOST WORLD",         }, // Lost World, The - Jurassic Park (USA, Europe), Monde Perdu, Le - Jurassic Park (France)
-    {.vramHash1 = 0xc81fe796, .vramHash2 = 0x63e60ac4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MISSILE COMMAN",     }, // Missile Command (USA, Europe)
-    {.vramHash1 = 0x9f586321, .vramHash2 = 0x642843ee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUZUKEIBZ4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Zukei no Tatsujin (Japan)
-    {.vramHash1 = 0xeac22dca, .vramHash2 = 0x646ee252, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOXXLE",             }, // Boxxle (USA, Europe) (Rev A)
-    {.vramHash1 = 0xe38de191, .vramHash2 = 0x6493a3ca, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UNDER COVER CO",     }, // Undercover Cops Gaiden - Hakaishin Garumaa (Japan)
-    {.vramHash1 = 0xfda45d1f, .vramHash2 = 0x64d45c67, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALLSTARCHALLEN",     }, // NBA All Star Challenge (USA, Europe)
-    {.vramHash1 = 0x324576d0, .vramHash2 = 0x64f6d8a5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HON SHOGI",          }, // Hon Shougi (Japan)
-    {.vramHash1 = 0x99f64433, .vramHash2 = 0x65110d23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ASTERIX",            }, // Asterix (Europe) (En,Fr,De,Es,It)
-    {.vramHash1 = 0xed13854f, .vramHash2 = 0x651d9376, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIONIC BATTLER",     }, // Bionic Battler (USA)
-    {.vramHash1 = 0x43b92a11, .vramHash2 = 0x6534a3f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBCOLLECTION 1",     }, // Konami GB Collection Vol.1 (Japan)
-    {.vramHash1 = 0xc346f65b, .vramHash2 = 0x653b3167, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIKKURI NEKKET",     }, // Bikkuri Nekketsu Shin Kiroku! - Dokodemo Kin Medal (Japan)
-    {.vramHash1 = 0x965df5c2, .vramHash2 = 0x656cc596, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOOBY BOYS",         }, // Booby Boys (Japan)
-    {.vramHash1 = 0x54a9562d, .vramHash2 = 0x6578929a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KEITAI KEIBA 8",     }, // Keitai Keiba Eight Special (Japan)
-    {.vramHash1 = 0x9725467b, .vramHash2 = 0x65ca49f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHAMPIONSHIP P",     }, // Championship Pool (USA)
-    {.vramHash1 = 0xd4741c35, .vramHash2 = 0x65e6015a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRAMAN",           }, // Ultraman (Japan)
-    {.vramHash1 = 0xf9e89757, .vramHash2 = 0x66278ec0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HARVEST-MOON G",     }, // Harvest Moon GB (USA)
-    {.vramHash1 = 0x6bb82df4, .vramHash2 = 0x6632711c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DOUBLE DRIBBLE",     }, // Double Dribble - 5 on 5 (USA)
-    {.vramHash1 = 0x56d6e7d7, .vramHash2 = 0x664ccf29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REKISINENDAI 2",     }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Rekishi Nendai Anki Point 240 (Japan)
-    {.vramHash1 = 0x83661813, .vramHash2 = 0x668bb2ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOONEY TUNES",       }, // Looney Tunes (USA, Europe)
-    {.vramHash1 = 0xa6bbd2c2, .vramHash2 = 0x668c2462, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FUSHIGINA BULO",     }, // Fushigi na Blobby - Princess Blob o Sukue! (Japan)
-    {.vramHash1 = 0xd296c585, .vramHash2 = 0x6698e149, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {0xff, 0xa8, 0xff, 0xa9, 0xaa, 0x42, 0xab, 0x43, 0xac, 0x4a, 0xad, 0x4b, 0xae, 0x47, 0xaf, 0x48, 0xb0, 0x49, 0xb1, 0x40}, .title = "Tetris 2",           }, // Tetris 2 (USA), Tetris 2 (USA, Europe)
-    {.vramHash1 = 0x35a6e3d4, .vramHash2 = 0x66a4bd3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBER MAN GB ",     }, // Bomber Man GB 2 (Japan)
-    {.vramHash1 = 0x35a6e71c, .vramHash2 = 0x66dbec5a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBER MAN GB",      }, // Bomberman GB (USA, Europe)
-    {.vramHash1 = 0xe88f0f07, .vramHash2 = 0x66e7fb0c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBCOLLECTION 2",     }, // Konami GB Collection Vol.2 (Japan)
-    {.vramHash1 = 0x02080e70, .vramHash2 = 0x6700f0c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STUDYBOY KAN10",     }, // Doraemon no Study Boy 6 - Gakushuu Kanji Master 1006 (Japan)
-    {.vramHash1 = 0xc5f408e6, .vramHash2 = 0x671e1f92, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARUMAN BUSTER",     }, // Peke to Poko no Daruman Busters (Japan)
-    {.vramHash1 = 0x54b3962d, .vramHash2 = 0x6721f29a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THUME SHOGI",        }, // Tsumeshougi - Hyakuban Shoubu (Japan)
-    {.vramHash1 = 0x9c861662, .vramHash2 = 0x6732b36c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOLF",               }, // Golf (World)
-    {.vramHash1 = 0xcc821227, .vramHash2 = 0x673d4aa8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPUDS ADVENTUR",     }, // Spud's Adventure (USA)
-    {.vramHash1 = 0x2451181f, .vramHash2 = 0x673f109f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL PARTY",      }, // Hero Shuugou!! Pinball Party (Japan)
-    {.vramHash1 = 0xe5f359d5, .vramHash2 = 0x67785955, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONOPOLY",           }, // Monopoly (USA)
-    {.vramHash1 = 0xfbc275c6, .vramHash2 = 0x67842d76, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Contra Spirits",     }, // Contra - The Alien Wars (USA), Contra Spirits (Japan), Probotector 2 (Europe) (Beta), Probotector 2 (Europe)
-    {.vramHash1 = 0x50c52e47, .vramHash2 = 0x684f0df5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MR NUTZ",            }, // Mr. Nutz (Europe)
-    {.vramHash1 = 0xe79f0d6b, .vramHash2 = 0x68697850, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris BLAST",       }, // Tetris Blast (USA, Europe)
-    {.vramHash1 = 0xe19e4681, .vramHash2 = 0x68928a06, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = true, .branchBasedFixes = {{.jumpAddress = 0x0526, .fixTarget = 3, .takenMethod = nop, .takenValue = 0x00, .notTakenMethod = sync, .notTakenValue = 0x00}, }, .writeRegistersDuringDMA = {}, .title = "Samurai Shodown",    }, // Samurai Shodown (USA, Europe) (Beta), Samurai Shodown (USA, Europe)
-    {.vramHash1 = 0x7303dc07, .vramHash2 = 0x689477a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATMAN",             }, // Batman - The Video Game (World)
-    {.vramHash1 = 0x009859c4, .vramHash2 = 0x68af048e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "METAL MASTERS",      }, // Metal Masters (USA)
-    {.vramHash1 = 0xf9163ba2, .vramHash2 = 0x68af17c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBWARST",            }, // Game Boy Wars Turbo (Japan)
-    {.vramHash1 = 0xedaaf057, .vramHash2 = 0x68be4ed0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRACK MEET HIR",     }, // Track Meet - Mezase! Barcelona (Japan)
-    {.vramHash1 = 0x32584c84, .vramHash2 = 0x68e687b4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BISHOJYOSENSI ",     }, // Bishoujo Senshi Sailor Moon (Japan)
-    {.vramHash1 = 0xe588671a, .vramHash2 = 0x690dd8b0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENGUIN BOY",        }, // Osawagase! Penguin Boy (Japan)
-    {.vramHash1 = 0x7e18fa94, .vramHash2 = 0x696463fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAKENOH V3",         }, // Bakenou V3 (Japan)
-    {.vramHash1 = 0xd782da14, .vramHash2 = 0x69813ef9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL HAND",          }, // Cool Hand (Europe) (Fr,De)
-    {.vramHash1 = 0x76e80730, .vramHash2 = 0x69967648, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {{.jumpAddress = 0x46ff, .fixTarget = 0xc316, .takenMethod = or, .takenValue = 0x10, .notTakenMethod = and, .notTakenValue = 0xef}, {.jumpAddress = 0x46ff, .fixTarget = 0xc316, .takenMethod = and, .takenValue = 0xdf, .notTakenMethod = or, .notTakenValue = 0x20}, }, .writeRegistersDuringDMA = {}, .title = "Fighting Simulator", }, // Fighting Simulator 2 in 1 (USA, Europe)
-    {.vramHash1 = 0xd0a5220c, .vramHash2 = 0x6a0a6424, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRAKIRA KIDS",      }, // Kirby no Kirakira Kids (Japan)
-    {.vramHash1 = 0xa0f3df32, .vramHash2 = 0x6a1fecc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINTIN TEMPLES",     }, // Tintin - Prisoners of the Sun (Europe) (En,Fr,De)
-    {.vramHash1 = 0x0d1f3144, .vramHash2 = 0x6a3fcb20, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB PATLABOR 1",      }, // Kidou Keisatsu Patlabor - Nerawareta Machi 1990 (Japan)
-    {.vramHash1 = 0x002c185c, .vramHash2 = 0x6a433f3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPEYE 2",           }, // Popeye 2 (Japan)
-    {.vramHash1 = 0x1b5298ad, .vramHash2 = 0x6a55250f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORMS",              }, // Worms (Europe)
-    {.vramHash1 = 0x66b2c8fd, .vramHash2 = 0x6a9f65e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMHT3",              }, // Teenage Mutant Hero Turtles III - Radical Rescue (Europe)
-    {.vramHash1 = 0x359eeafe, .vramHash2 = 0x6aebc715, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU KOF 95",      }, // King of Fighters '95, The (Europe)
-    {.vramHash1 = 0x99def500, .vramHash2 = 0x6aed2b5e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJA SPIRIT",       }, // Saigo no Nindou (Japan)
-    {.vramHash1 = 0xc9c11949, .vramHash2 = 0x6af79d6d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAHJONGKYOUSIT",     }, // Nada Asatarou & Kojima Takeo no Jissen Mahjong Kyoushitsu (Japan)
-    {.vramHash1 = 0x13e9bf58, .vramHash2 = 0x6b09bbb4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAIKYOKU RENJU",     }, // Taikyoku Renju (Japan) (En,Ja)
-    {.vramHash1 = 0xbafc4d73, .vramHash2 = 0x6b41d536, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AGRO SOAR",          }, // Agro Soar (Australia)
-    {.vramHash1 = 0xae591b00, .vramHash2 = 0x6b6b5f4a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN5",           }, // Mega Man V (Europe)
-    {.vramHash1 = 0x1788af4f, .vramHash2 = 0x6ba0dec5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THUNDERBIRDS",       }, // Thunderbirds (Japan)
-    {.vramHash1 = 0x6c754c16, .vramHash2 = 0x6bcbbf08, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Double Dragon",      }, // Double Dragon (Japan)
-    {.vramHash1 = 0x73c0235c, .vramHash2 = 0x6bd74801, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAIN DRAIN",        }, // Brain Drain (USA)
-    {.vramHash1 = 0x2b36890d, .vramHash2 = 0x6c011900, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ASMIK2",             }, // Asmik-kun World 2 (Japan)
-    {.vramHash1 = 0xe3f0c97d, .vramHash2 = 0x6c0ba942, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNEAKY SNAKES",      }, // Sneaky Snakes (USA, Europe)
-    {.vramHash1 = 0xc8b39994, .vramHash2 = 0x6c139fa7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STREET FIGHTER",     }, // Street Fighter II (Japan), Street Fighter II (USA), Street Fighter II (USA, Europe) (Rev A)
-    {.vramHash1 = 0xc4ecee92, .vramHash2 = 0x6c27d793, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VERSUS HERO",        }, // Versus Hero - Kakutou Ou e no Michi (Japan)
-    {.vramHash1 = 0x2f218ef2, .vramHash2 = 0x6c445510, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE FIDGETTS",       }, // Fidgetts, The (Japan)
-    {.vramHash1 = 0x6d843ef9, .vramHash2 = 0x6cc867ae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ASTEROIDS",          }, // Asteroids (USA, Europe)
-    {.vramHash1 = 0x560c6f42, .vramHash2 = 0x6d0d20fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Cosmo Tank",         }, // Cosmo Tank (Japan) (Beta)
-    {.vramHash1 = 0x34816b23, .vramHash2 = 0x6d102762, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WIZARDRY SOQ  ",     }, // Wizardry Gaiden 1 - Joou no Junan (Japan)
-    {.vramHash1 = 0xa3604a88, .vramHash2 = 0x6d25846b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWF SUPERSTARS",     }, // WWF Superstars (USA, Europe)
-    {.vramHash1 = 0xfa6467c8, .vramHash2 = 0x6d2e711f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHINESE FIGHTE",     }, // Super Chinese Fighter GB (Japan)
-    {.vramHash1 = 0xff3bd897, .vramHash2 = 0x6d4634c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPERLODERUNNE",     }, // Hyper Lode Runner (World) (Rev A)
-    {.vramHash1 = 0x9f3fdedf, .vramHash2 = 0x6da8b936, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRIMAL RAGE",        }, // Primal Rage (USA, Europe)
-    {.vramHash1 = 0xbb32d59b, .vramHash2 = 0x6dc09380, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RING RAGE",          }, // Ring Rage (Japan), Ring Rage (USA)
-    {.vramHash1 = 0xce0338b2, .vramHash2 = 0x6dc78c98, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Double Dragon II",   }, // Double Dragon II (USA, Europe)
-    {.vramHash1 = 0xcc20876e, .vramHash2 = 0x6deddc8d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KINNIKUMAN ",     }, // Kinnikuman - The Dream Match (Japan)
-    {.vramHash1 = 0x12a1398d, .vramHash2 = 0x6e0bec08, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOKUTO NO KEN ",     }, // Hokuto no Ken - Seizetsu Juuban Shoubu (Japan)
-    {.vramHash1 = 0xc1959a2f, .vramHash2 = 0x6e24fac6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AEROSTAR",           }, // Aero Star (Japan)
-    {.vramHash1 = 0x04a41339, .vramHash2 = 0x6e299ac9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHACHAMARUPANI",     }, // Chachamaru Panic (Japan)
-    {.vramHash1 = 0xd8567c7e, .vramHash2 = 0x6ecd4a61, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI 5",              }, // Oni V - Innin o Tsugumono (Japan)
-    {.vramHash1 = 0x5601e12d, .vramHash2 = 0x6ece45ef, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KRUSTY",             }, // Krusty World (Japan), Krusty's Fun House (USA, Europe)
-    {.vramHash1 = 0x3df0ffd6, .vramHash2 = 0x6f1bc0ab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL",            }, // Pinball - 66hiki no Wani Daikoushin! (Japan)
-    {.vramHash1 = 0xe4535ff8, .vramHash2 = 0x6f481bdc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPACE INVADERS",     }, // Space Invaders (Europe), Space Invaders (USA)
-    {.vramHash1 = 0x79a8da88, .vramHash2 = 0x6f50d684, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JET PACK",           }, // Jet Pack (USA, Europe) (Beta)
-    {.vramHash1 = 0x0001a000, .vramHash2 = 0x6f58d000, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOKORO JR",          }, // Tokoro's Mahjong Jr. (Japan)
-    {.vramHash1 = 0x540c197d, .vramHash2 = 0x6f844a1b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB CULT ULTRAM",     }, // Cult Master - Ultraman ni Miserarete (Japan)
-    {.vramHash1 = 0xd8e7ba79, .vramHash2 = 0x6f914165, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TUROK BATTLE O",     }, // Turok - Battle of the Bionosaurs (Japan), Turok - Battle of the Bionosaurs (USA, Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0x92d3181b, .vramHash2 = 0x6fcba1a5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JUDGE DREDD",        }, // Judge Dredd (Japan), Judge Dredd (USA, Europe)
-    {.vramHash1 = 0x4291747d, .vramHash2 = 0x6fefe6f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPOT COOL ADV",      }, // Spot - The Cool Adventure (Japan), Spot - The Cool Adventure (USA)
-    {.vramHash1 = 0xb2329eee, .vramHash2 = 0x7001be82, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLE BOBBLE",      }, // Bubble Bobble (Japan)
-    {.vramHash1 = 0x265b40e3, .vramHash2 = 0x700a57bc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAACHIYAN  ",     }, // Jungle no Ouja Tar-chan (Japan)
-    {.vramHash1 = 0xfabcf770, .vramHash2 = 0x70379205, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JURASSIC PARK",      }, // Jurassic Park (Europe) (En,Fr,De,Es,It), Jurassic Park (USA)
-    {.vramHash1 = 0xf579ab5b, .vramHash2 = 0x7094e7bc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER SNAKEY",       }, // Super Snakey (Japan)
-    {.vramHash1 = 0x7e4166ba, .vramHash2 = 0x712c320f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GANBARUGA",          }, // Genki Bakuhatsu Gambaruger (Japan), Mani 4 in 1 (China) (DMG-603 CHN)
-    {.vramHash1 = 0x1d7f62ce, .vramHash2 = 0x716d8a08, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASINO FUNPAK",      }, // Casino FunPak (USA, Europe)
-    {.vramHash1 = 0x4e6bf541, .vramHash2 = 0x719052d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRINCE OF PERS",     }, // Prince of Persia (Europe) (En,Fr,De,Es,It)
-    {.vramHash1 = 0x06b23794, .vramHash2 = 0x720d114f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER RC PRO-A",     }, // Super R.C. Pro-Am (USA, Europe)
-    {.vramHash1 = 0xde2c3213, .vramHash2 = 0x7233da57, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZEN",                }, // Zen - Intergalactic Ninja (USA)
-    {.vramHash1 = 0xde2c3214, .vramHash2 = 0x7233dace, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZEN",                }, // Zen - Intergalactic Ninja (Europe)
-    {.vramHash1 = 0xb841d610, .vramHash2 = 0x723a934f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE PINGPON",     }, // Battle Pingpong (Japan)
-    {.vramHash1 = 0xc74d1a26, .vramHash2 = 0x72777553, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CYBER FORMULA",      }, // Shinseiki GPX Cyber Formula (Japan)
-    {.vramHash1 = 0xcd0bcd87, .vramHash2 = 0x727f2628, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "IRON MAN X-O",       }, // Iron Man X-O Manowar in Heavy Metal (USA, Europe)
-    {.vramHash1 = 0xff71df21, .vramHash2 = 0x72f30682, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NIHONSHI 201 G",     }, // Goukaku Boy Series - Nihonshi Target 201 (Japan)
-    {.vramHash1 = 0x53ce536c, .vramHash2 = 0x733b293f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB JIDAIGEKI",       }, // Kunio-kun no Jidaigeki Da yo Zenin Shuugou! (Japan)
-    {.vramHash1 = 0x7f63f6bf, .vramHash2 = 0x733c0aa0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BURNING PAPER",      }, // Burning Paper (Japan)
-    {.vramHash1 = 0x520b8362, .vramHash2 = 0x7347f082, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DLAIR LEGEND U",     }, // Dragon's Lair - The Legend (Europe)
-    {.vramHash1 = 0x25d2f33e, .vramHash2 = 0x734f2a32, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TALE SPIN",          }, // TaleSpin (Europe)
-    {.vramHash1 = 0x79c16f89, .vramHash2 = 0x735c05c0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN5",           }, // Mega Man V (USA)
-    {.vramHash1 = 0x049737c1, .vramHash2 = 0x73be67b4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHINCOGAIDEN",     }, // Pachinko Monogatari Gaiden (Japan)
-    {.vramHash1 = 0x27a699a9, .vramHash2 = 0x73cb112d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REALBOUTSPECIA",     }, // Nettou Real Bout Garou Densetsu Special (Japan)
-    {.vramHash1 = 0xb2093e00, .vramHash2 = 0x73da6703, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZKAIJUKUGO1017",     }, // Goukaku Boy Series - Z Kai Kyuukyoku no Eijukugo 1017 (Japan)
-    {.vramHash1 = 0xc91839ca, .vramHash2 = 0x73f1479c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RED OCTOBER",        }, // Hunt for Red October, The (USA, Europe)
-    {.vramHash1 = 0x29774450, .vramHash2 = 0x740677a6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLEVANIA AD",     }, // Castlevania - The Adventure (Europe)
-    {.vramHash1 = 0x3f45f5ec, .vramHash2 = 0x7448c955, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUZZNIC",            }, // Puzznic (Japan)
-    {.vramHash1 = 0x06ee590b, .vramHash2 = 0x74e02aa0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROGER RABBIT",       }, // Who Framed Roger Rabbit (Europe)
-    {.vramHash1 = 0x70603ec5, .vramHash2 = 0x7526b341, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZKAIEIGOKOBUN2",     }, // Goukaku Boy Series - Z Kai Kyuukyoku no Eigo Koubun 285 (Japan)
-    {.vramHash1 = 0xa8062ada, .vramHash2 = 0x7571b1be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMI GOLF",        }, // Konami Golf (Europe)
-    {.vramHash1 = 0xa626f1f2, .vramHash2 = 0x7584b451, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KARAMUCHO ZIKE",     }, // Karamuchou no Daijiken (Japan)
-    {.vramHash1 = 0x6df74e1a, .vramHash2 = 0x7596fd12, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MON RACE OTHER",     }, // Monster Race Okawari (Japan)
-    {.vramHash1 = 0x2a25da24, .vramHash2 = 0x7598ac4f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRAVEL GUIDE",       }, // InfoGenius Productivity Pak - Frommer's Travel Guide (USA)
-    {.vramHash1 = 0x1b116ce2, .vramHash2 = 0x75cf9ce0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS",            }, // Nemesis (Japan)
-    {.vramHash1 = 0xf1cc330a, .vramHash2 = 0x760c5f35, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RANMA 1/2",          }, // Ranma 1-2 (Japan)
-    {.vramHash1 = 0x853f751f, .vramHash2 = 0x766edcbf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHANGHAI POCKE",     }, // Shanghai Pocket (Japan)
-    {.vramHash1 = 0x0c05fa7a, .vramHash2 = 0x76b7a823, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMB JACK",          }, // Bomb Jack (Europe)
-    {.vramHash1 = 0x016af74e, .vramHash2 = 0x76dda57b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIGHTING SOCCE",     }, // J.League Fighting Soccer - The King of Ace Strikers (Japan)
-    {.vramHash1 = 0xb097aefb, .vramHash2 = 0x76e11e32, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALLERY1",           }, // Namco Gallery Vol.1 (Japan)
-    {.vramHash1 = 0xff39cd2a, .vramHash2 = 0x7714b5cc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEYS CHASE",      }, // Mickey's Chase (Japan)
-    {.vramHash1 = 0xc2c0cf57, .vramHash2 = 0x7730d7a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CTANGO 1700",        }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Chuugaku Eitango 1700 (Japan)
-    {.vramHash1 = 0xf50ad40e, .vramHash2 = 0x7757d55c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIDE POCKET",        }, // Side Pocket (World)
-    {.vramHash1 = 0x97890331, .vramHash2 = 0x775a46d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMNT 2",             }, // Teenage Mutant Ninja Turtles 2 (Japan), Teenage Mutant Ninja Turtles II - Back from the Sewers (USA)
-    {.vramHash1 = 0x33d48544, .vramHash2 = 0x77622b28, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPELL CHECKER ",     }, // InfoGenius Productivity Pak - Spell Checker and Calculator (USA)
-    {.vramHash1 = 0xd73d61b8, .vramHash2 = 0x7762e096, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD SOCCER G",     }, // World Soccer GB (Japan)
-    {.vramHash1 = 0xd6bc01c4, .vramHash2 = 0x777fa9b9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAKENOH TV",         }, // Bakenou TV '94 (Japan)
-    {.vramHash1 = 0x992577f3, .vramHash2 = 0x779f9d33, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BZONE SBREAKOU",     }, // Arcade Classics - Battlezone & Super Breakout (USA, Europe)
-    {.vramHash1 = 0xc4dbf056, .vramHash2 = 0x77bb7f14, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MIGRAIN ACCLAI",     }, // Migrain (Japan)
-    {.vramHash1 = 0xb77940d0, .vramHash2 = 0x77c2f852, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENERATIONS",        }, // Star Trek Generations - Beyond the Nexus (USA)
-    {.vramHash1 = 0xe79f0d6b, .vramHash2 = 0x7836353a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BOMBLISS",     }, // Super Bombliss (Japan)
-    {.vramHash1 = 0x5462408e, .vramHash2 = 0x7875fe2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOTOCROSSMANIA",     }, // Motocross Maniacs (Japan)
-    {.vramHash1 = 0xe7c679cd, .vramHash2 = 0x787b53d7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "B.C.KID       ",     }, // B.C. Kid (Europe)
-    {.vramHash1 = 0x546b697e, .vramHash2 = 0x788dddd9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR STACKER",       }, // Kirby's Star Stacker (USA, Europe)
-    {.vramHash1 = 0x904c1f03, .vramHash2 = 0x789f156b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KWIRK",              }, // Kwirk - He's A-maze-ing! (USA, Europe)
-    {.vramHash1 = 0x963fd904, .vramHash2 = 0x78b617cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI",                }, // Kinin Koumaroku Oni (Japan)
-    {.vramHash1 = 0x4f69941d, .vramHash2 = 0x78ea99fa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEW CHESSMASTE",     }, // Chessmaster, The (DMG-EM) (Japan)
-    {.vramHash1 = 0xd12e22c4, .vramHash2 = 0x7905e8cf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-PANIC",          }, // Pac-Panic (Europe)
-    {.vramHash1 = 0xb536ca49, .vramHash2 = 0x793bd46d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CARD GAME",          }, // Card Game (Japan)
-    {.vramHash1 = 0x674c87f4, .vramHash2 = 0x7988391c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAMPART_GB",         }, // Rampart (USA, Europe)
-    {.vramHash1 = 0x7e854a61, .vramHash2 = 0x79e2ac65, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL QUARTERBAC",     }, // NFL Quarterback Club (Japan)
-    {.vramHash1 = 0xc1b3c076, .vramHash2 = 0x79fba435, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Trump Boy",          }, // Trump Boy (Japan)
-    {.vramHash1 = 0x4a98f7d9, .vramHash2 = 0x7a25674e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DONKEY KONG",        }, // Donkey Kong (Japan, USA), Donkey Kong (World) (Rev A)
-    {.vramHash1 = 0xf96ce60c, .vramHash2 = 0x7a44aedc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEETHOVEN",          }, // Beethoven (Europe)
-    {.vramHash1 = 0x02f2db50, .vramHash2 = 0x7a4fd4a8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "P-MAN",              }, // P-Man GB (Japan)
-    {.vramHash1 = 0xd6e387d4, .vramHash2 = 0x7ac9e7f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PREHISTORIK MA",     }, // Prehistorik Man (USA, Europe)
-    {.vramHash1 = 0x62b9e936, .vramHash2 = 0x7ae10f20, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SKATE OR DIE B",     }, // Skate or Die - Bad 'N Rad (Europe)
-    {.vramHash1 = 0xeb0b1cdf, .vramHash2 = 0x7b2a8257, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DEADHEATSCRAMB",     }, // Dead Heat Scramble (Japan)
-    {.vramHash1 = 0x34e50bbb, .vramHash2 = 0x7b50539a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SKATE OR DIE B",     }, // Skate or Die - Bad 'N Rad (USA)
-    {.vramHash1 = 0xa3cfe1b9, .vramHash2 = 0x7b914378, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPER BB 95",        }, // Hyper Black Bass '95 (Japan) (En,Ja)
-    {.vramHash1 = 0xd2ef7a7a, .vramHash2 = 0x7bb1e012, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADVENTURE ISLA",     }, // Adventure Island (USA, Europe)
-    {.vramHash1 = 0xbd213f15, .vramHash2 = 0x7be9a464, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JOE AND MAC",        }, // Joe & Mac (USA)
-    {.vramHash1 = 0xf5ad26c3, .vramHash2 = 0x7c283539, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAST BIBLE",         }, // Megami Tensei Gaiden - Last Bible (Japan)
-    {.vramHash1 = 0x9b646cae, .vramHash2 = 0x7c3bde7c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL FANTAS",     }, // Pinball Fantasies (USA, Europe)
-    {.vramHash1 = 0xa45e0a2c, .vramHash2 = 0x7c8a5bdb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHALVO55",           }, // Chalvo 55 - Super Puzzle Action (Japan)
-    {.vramHash1 = 0xc3567002, .vramHash2 = 0x7cad177e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QUARTH",             }, // Quarth (USA, Europe)
-    {.vramHash1 = 0x09213694, .vramHash2 = 0x7cf77393, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINTIN AU TIBE",     }, // Tintin in Tibet (Europe) (En,Fr,De,Nl)
-    {.vramHash1 = 0x507a6cbb, .vramHash2 = 0x7d3cf55c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET BASS FI",     }, // Pocket Bass Fishing (Japan)
-    {.vramHash1 = 0x4c785b76, .vramHash2 = 0x7d595d9a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE CRUSHER",     }, // Battle Crusher (Japan)
-    {.vramHash1 = 0x57ce2cb4, .vramHash2 = 0x7d777feb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET STADIUM",     }, // Pocket Stadium (Japan)
-    {.vramHash1 = 0x23b6d393, .vramHash2 = 0x7d826827, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PLAT JEOPARDY!",     }, // Jeopardy! - Platinum Edition (USA)
-    {.vramHash1 = 0x31a21f79, .vramHash2 = 0x7d826e7d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER MOMOTETU",     }, // Super Momotarou Dentetsu II (Japan)
-    {.vramHash1 = 0xe4253618, .vramHash2 = 0x7da4d83e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONOPOLY",           }, // Monopoly (Japan)
-    {.vramHash1 = 0x622352c8, .vramHash2 = 0x7dd1c1e5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KILLER TOMATOE",     }, // Attack of the Killer Tomatoes (USA, Europe)
-    {.vramHash1 = 0xe5cf93cc, .vramHash2 = 0x7e022890, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NITINOU SANSUU",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Suuji de Asobou Sansuu Hen (Japan) (Rev A), Goukaku Boy Series - Shikakui Atama o Maruku Suru - Suuji de Asobou Sansuu Hen (Japan)
-    {.vramHash1 = 0x7f31a84a, .vramHash2 = 0x7e036be3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLARSTRIKER",       }, // SolarStriker (World)
-    {.vramHash1 = 0xa8e69d5c, .vramHash2 = 0x7e11ff98, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAPUWAKUNN",         }, // Nangoku Shounen Papuwa-kun - Ganmadan no Yabou (Japan)
-    {.vramHash1 = 0x7e448108, .vramHash2 = 0x7e42b604, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET BATTLE",      }, // Pocket Battle (Japan)
-    {.vramHash1 = 0x2ad09cf7, .vramHash2 = 0x7e7b38b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLE GHOST",       }, // Bubble Ghost (USA, Europe)
-    {.vramHash1 = 0x6943e7aa, .vramHash2 = 0x7e7e7b8b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES",         }, // DuckTales (Japan)
-    {.vramHash1 = 0x2ad09fec, .vramHash2 = 0x7e837e16, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLE GHOST",       }, // Bubble Ghost (Japan)
-    {.vramHash1 = 0xb54053f1, .vramHash2 = 0x7eae713d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJA BOY",          }, // Ninja Boy (USA, Europe)
-    {.vramHash1 = 0x56303a43, .vramHash2 = 0x7ef6529b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMIC SPORTS",     }, // Konamic Sports in Barcelona (Japan)
-    {.vramHash1 = 0x3eccc00b, .vramHash2 = 0x7f82b4d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ODDWORLD ADVEN",     }, // Oddworld Adventures (USA, Europe)
-    {.vramHash1 = 0x091a7b73, .vramHash2 = 0x7fd891a1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EARTHWORM JIM",      }, // Earthworm Jim (Europe), Earthworm Jim (USA)
-    {.vramHash1 = 0x23da665c, .vramHash2 = 0x80368144, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARASORU HEMBE",     }, // Parasol Henbee (Japan)
-    {.vramHash1 = 0x0b371933, .vramHash2 = 0x80f45b1b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPULOUS",           }, // Populous (Europe), Populous (Japan)
-    {.vramHash1 = 0x30957497, .vramHash2 = 0x81009149, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TALE SPIN",          }, // TaleSpin (USA)
-    {.vramHash1 = 0x09adfeb3, .vramHash2 = 0x81111afc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKKOKUGOBF3",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Kokugo Battle Hen (Japan) (Special Edition)
-    {.vramHash1 = 0xdc68678a, .vramHash2 = 0x811168e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZAS",                }, // Chikyuu Kaihou Gun ZAS (Japan)
-    {.vramHash1 = 0x1ce00eb1, .vramHash2 = 0x81126fe0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TASMANIA STORY",     }, // Tasmania Story (USA)
-    {.vramHash1 = 0xcca5fbd0, .vramHash2 = 0x8125c773, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRO SOCCER",         }, // Pro Soccer (Japan)
-    {.vramHash1 = 0x584057e3, .vramHash2 = 0x8134e2b6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOY STORY",          }, // Toy Story (Europe), Toy Story (USA) (Rev A), Toy Story (USA)
-    {.vramHash1 = 0x964829ec, .vramHash2 = 0x8134fdd3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUGS BUNNY",         }, // Bugs Bunny Crazy Castle, The (USA, Europe)
-    {.vramHash1 = 0x400d3346, .vramHash2 = 0x813ca3c9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FURAINO SIREN ",     }, // Fushigi no Dungeon - Fuurai no Shiren GB - Tsukikage Mura no Kaibutsu (Japan)
-    {.vramHash1 = 0x8a0b72db, .vramHash2 = 0x81489ae2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MR.DO!",             }, // Mr. Do! (Europe)
-    {.vramHash1 = 0xdbfa23dd, .vramHash2 = 0x816dbef1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ATHENANOHATENA",     }, // Quiz Nihon Mukashibanashi - Athena no Hatena (Japan)
-    {.vramHash1 = 0xdcdaebc4, .vramHash2 = 0x819635b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIMPSONS3",          }, // Simpsons, The - Bart & the Beanstalk (USA, Europe), Simpsons, The - Bart no Jack to Mame no Ki (Japan)
-    {.vramHash1 = 0xeb62ac9b, .vramHash2 = 0x829b1d03, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CUTTHROAT ISLA",     }, // CutThroat Island (USA, Europe)
-    {.vramHash1 = 0x54e3a5ba, .vramHash2 = 0x82d3c9e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLEVANIA",        }, // Castlevania Legends (USA, Europe)
-    {.vramHash1 = 0x17c8aff8, .vramHash2 = 0x82e481ed, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMHT - Foot Clan",   }, // Teenage Mutant Hero Turtles - Fall of the Foot Clan (Europe)
-    {.vramHash1 = 0xa8e07a43, .vramHash2 = 0x82eb5545, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Blue",       }, // Pokemon - Blaue Edition (Germany), Pokemon - Edicion Azul (Spain), Pokemon - Version Bleue (France), Pokemon - Versione Blu (Italy)
-    {.vramHash1 = 0xdc30dd6c, .vramHash2 = 0x8340e0a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TASMANIA STORY",     }, // Tasmania Monogatari (Japan)
-    {.vramHash1 = 0x0b0fd1a5, .vramHash2 = 0x83455867, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KUREYON SHI",     }, // Crayon Shin-chan 3 - Ora no Gokigen Athletic (Japan)
-    {.vramHash1 = 0xc3f9e000, .vramHash2 = 0x839e7840, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOURMET PARADI",     }, // Mr. Chin's Gourmet Paradise (USA)
-    {.vramHash1 = 0x79d2c70e, .vramHash2 = 0x83c713b8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JLEAGUE",            }, // Nihon Daihyou Team France de Ganbare! - J.League Supporter Soccer (Japan)
-    {.vramHash1 = 0xcd510a85, .vramHash2 = 0x84643fb6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENSANQ",            }, // Kizuchi da Quiz da Gen-san da! (Japan)
-    {.vramHash1 = 0x9a616e5a, .vramHash2 = 0x84774512, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Dr.MARIO",           }, // Dr. Mario (World) (Beta)
-    {.vramHash1 = 0xd14561a2, .vramHash2 = 0x8488c451, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSSY NO COOKI",     }, // Yoshi no Cookie (Japan)
-    {.vramHash1 = 0xc058cf89, .vramHash2 = 0x84ae6ef3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WPGB",               }, // Wedding Peach - Jamapii Panic (Japan)
-    {.vramHash1 = 0x3aa64f8e, .vramHash2 = 0x84dab7e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAIJINOU",           }, // Zettai Muteki Raijin-Oh (Japan)
-    {.vramHash1 = 0xcb002c42, .vramHash2 = 0x84e84877, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANIMAL BREEDER",     }, // Animal Breeder 2 (Japan)
-    {.vramHash1 = 0x6dc6a299, .vramHash2 = 0x850c68c7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FOREMAN FOR RE",     }, // Foreman for Real (Japan)
-    {.vramHash1 = 0xf4df4eca, .vramHash2 = 0x8526be10, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RETRIEVE",           }, // Bakuchou Retrieve Master (Japan)
-    {.vramHash1 = 0x89e3e9f4, .vramHash2 = 0x8574336e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GLKSRAD",            }, // Gluecksrad (Germany)
-    {.vramHash1 = 0xe0498868, .vramHash2 = 0x8619de40, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Wario Land",         }, // Wario Land - Super Mario Land 3 (World)
-    {.vramHash1 = 0x10f7a717, .vramHash2 = 0x86669ff2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORAEMON2",          }, // Doraemon 2 - Animal Planet Densetsu (Japan)
-    {.vramHash1 = 0x25b48813, .vramHash2 = 0x8685e80d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHANGHAI",           }, // Shanghai (USA)
-    {.vramHash1 = 0x54a9d81f, .vramHash2 = 0x86b6ec75, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REAL GHOSTBUST",     }, // Real Ghostbusters, The (USA)
-    {.vramHash1 = 0x16630bec, .vramHash2 = 0x8727ccf3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRAGONHEART",        }, // DragonHeart (France), DragonHeart (USA, Europe)
-    {.vramHash1 = 0xab6d5c44, .vramHash2 = 0x873bb069, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NHL HOCKEY 95",      }, // NHL Hockey '95 (USA, Europe)
-    {.vramHash1 = 0x3fb17081, .vramHash2 = 0x873f7b2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL QUARTERBAC",     }, // NFL Quarterback Club II (USA, Europe)
-    {.vramHash1 = 0x1e157e12, .vramHash2 = 0x877c71e1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOPGUN 2",           }, // Top Gun - Guts & Glory (USA, Europe)
-    {.vramHash1 = 0xc7ccb9aa, .vramHash2 = 0x87850ca9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAGING FIGHTER",     }, // Raging Fighter (USA, Europe)
-    {.vramHash1 = 0xc08e868c, .vramHash2 = 0x88ebcfab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPEEDY GONZALE",     }, // Speedy Gonzales (USA, Europe)
-    {.vramHash1 = 0xc08e868e, .vramHash2 = 0x88ebcfd1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPEEDY GONZALE",     }, // Soreyuke! Speedy Gonzales (Japan)
-    {.vramHash1 = 0x0f296fa0, .vramHash2 = 0x8940c102, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANYOUKU",           }, // Goukaku Boy Series - Gakken - Kanyouku Kotowaza 210 (Japan)
-    {.vramHash1 = 0x7501d84a, .vramHash2 = 0x895f82a4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EUROMONOPOLY",       }, // Monopoly (Europe) (En,Fr,De)
-    {.vramHash1 = 0xc87af993, .vramHash2 = 0x89931e28, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLE",             }, // Pachio-kun - Puzzle Castle (Japan)
-    {.vramHash1 = 0xfeb27bee, .vramHash2 = 0x8a0ec0d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALFRED CHICKEN",     }, // Alfred Chicken (Europe), Alfred Chicken (USA)
-    {.vramHash1 = 0x6f1d267c, .vramHash2 = 0x8a596845, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Jordan vs Bird",     }, // Jordan vs Bird - One on One (Japan), Jordan vs Bird - One on One (USA, Europe)
-    {.vramHash1 = 0x9f1c0ad6, .vramHash2 = 0x8a83a4fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SDGUNDAMKUNITO",     }, // SD Gundam - SD Sengokuden - Kunitori Monogatari (Japan)
-    {.vramHash1 = 0x9ea5f440, .vramHash2 = 0x8aa7018a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB 3TAMA",           }, // 3 Choume no Tama - Tama and Friends - 3 Choume Obake Panic!! (Japan)
-    {.vramHash1 = 0x9a616e5a, .vramHash2 = 0x8af02148, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR.MARIO",           }, // Dr. Mario (World) (Rev A), Dr. Mario (World)
-    {.vramHash1 = 0x6347082f, .vramHash2 = 0x8b301b29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB ULTRAMANCLU",     }, // Ultraman Club - Tekikaijuu o Hakken seyo! (Japan)
-    {.vramHash1 = 0x5ddaac73, .vramHash2 = 0x8b4a05f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKMANWORLD4",      }, // Rockman World 4 (Japan)
-    {.vramHash1 = 0x179ce655, .vramHash2 = 0x8b5841f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHOPLIFTER 2",       }, // Choplifter II (Japan)
-    {.vramHash1 = 0xac4700e1, .vramHash2 = 0x8b67e58b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZEOTH",              }, // Battle Unit Zeoth (Japan)
-    {.vramHash1 = 0x192cc6c3, .vramHash2 = 0x8b984e7e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPER BLACKBAS",     }, // Black Bass - Lure Fishing (USA)
-    {.vramHash1 = 0x3fca11c9, .vramHash2 = 0x8bd1845b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SEASIDE VOLLEY",     }, // Seaside Volley (Japan)
-    {.vramHash1 = 0x01f3917a, .vramHash2 = 0x8c31a21d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NASCARFASTTRAC",     }, // Bill Elliott's NASCAR Fast Tracks (USA)
-    {.vramHash1 = 0xe1ed04ed, .vramHash2 = 0x8c562aaa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY 4",           }, // Mickey Mouse IV (Japan)
-    {.vramHash1 = 0x8e7e4756, .vramHash2 = 0x8c821091, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QBILLION",           }, // Q Billion (Japan)
-    {.vramHash1 = 0xfa17d0ba, .vramHash2 = 0x8c854a29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TORPEDO RANGE",      }, // Torpedo Range (USA)
-    {.vramHash1 = 0x376ddcab, .vramHash2 = 0x8cb93c15, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINOCCHIO",          }, // Pinocchio (USA)
-    {.vramHash1 = 0x89fa669b, .vramHash2 = 0x8cd04623, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB PINGU 1",         }, // Pingu - Sekai de 1ban Genki na Penguin (Japan)
-    {.vramHash1 = 0xfd7a94e1, .vramHash2 = 0x8cd7b64d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Micro machines 2",   }, // Micro Machines 2 - Turbo Tournament (Europe)
-    {.vramHash1 = 0x21e8f206, .vramHash2 = 0x8d0a1062, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS",            }, // Nemesis (Europe)
-    {.vramHash1 = 0x9a72dc58, .vramHash2 = 0x8d0e60a3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HARIMANADA",         }, // Aa Harimanada (Japan)
-    {.vramHash1 = 0x5a0d1e2c, .vramHash2 = 0x8d39992e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OLYMPIC GAMES",      }, // Olympic Summer Games (USA, Europe)
-    {.vramHash1 = 0x6efc296c, .vramHash2 = 0x8d3b5358, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPEED BALL 2",       }, // Speedball 2 - Brutal Deluxe (USA, Europe)
-    {.vramHash1 = 0x95398e2a, .vramHash2 = 0x8d75539c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLIPULL",            }, // Flipull (Japan)
-    {.vramHash1 = 0x2f0651c1, .vramHash2 = 0x8da7e7c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI-PACHINKOTE",     }, // Onigashima Pachinkoten (Japan)
-    {.vramHash1 = 0x9e01f78e, .vramHash2 = 0x8dde51f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARASOL STARS",      }, // Parasol Stars - Rainbow Islands II (Europe)
-    {.vramHash1 = 0x228731e5, .vramHash2 = 0x8e522fcf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CONTRA",             }, // Contra (Japan)
-    {.vramHash1 = 0x2e740367, .vramHash2 = 0x8e59c378, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY BLOCKBAL",     }, // Kirby no Block Ball (Japan)
-    {.vramHash1 = 0xe6d7dc29, .vramHash2 = 0x8e6ade06, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA2",              }, // Sa-Ga 2 - Hihou Densetsu (Japan) (Rev A), Sa-Ga 2 - Hihou Densetsu (Japan)
-    {.vramHash1 = 0x10a02ea6, .vramHash2 = 0x8eba7b4b, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMNT",               }, // Teenage Mutant Ninja Turtles (Japan)
-    {.vramHash1 = 0x5bf353da, .vramHash2 = 0x8edfc3f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB BEACHVOLLEY",     }, // World Beach Volley - 1991 GB Cup (Japan)
-    {.vramHash1 = 0x2e850e36, .vramHash2 = 0x8ee1e622, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATMAN FOREVER",     }, // Batman Forever (USA, Europe)
-    {.vramHash1 = 0xeb59d0cc, .vramHash2 = 0x8f28dcaa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASPER",             }, // Casper (Europe), Casper (USA)
-    {.vramHash1 = 0x15f28040, .vramHash2 = 0x8f830b72, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPLITZ",             }, // Splitz (Europe), Splitz - Nigaoe 15 Game (Japan)
-    {.vramHash1 = 0xe1b55301, .vramHash2 = 0x8f97fabb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Legend of Zelda",    }, // Legend of Zelda, The - Link's Awakening (Germany)
-    {.vramHash1 = 0xe1b5534f, .vramHash2 = 0x8f9b088c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Legend of Zelda",    }, // Legend of Zelda, The - Link's Awakening (USA, Europe) (Rev A), Legend of Zelda, The - Link's Awakening (USA, Europe) (Rev B), Legend of Zelda, The - Link's Awakening (USA, Europe)
-    {.vramHash1 = 0xe1b55357, .vramHash2 = 0x8f9b5808, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Legend of Zelda",    }, // Zelda no Densetsu - Yume o Miru Shima (Japan) (Rev A), Zelda no Densetsu - Yume o Miru Shima (Japan)
-    {.vramHash1 = 0xe1b554df, .vramHash2 = 0x8fb13d7e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Legend of Zelda",    }, // Legend of Zelda, The - Link's Awakening (Canada), Legend of Zelda, The - Link's Awakening (France)
-    {.vramHash1 = 0xbe28c656, .vramHash2 = 0x8fc34c21, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPANKY'S QUEST",     }, // Spanky's Quest (USA)
-    {.vramHash1 = 0xf5a50666, .vramHash2 = 0x8fc466a2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAPERBOY",           }, // Paperboy (USA, Europe)
-    {.vramHash1 = 0xbe28c979, .vramHash2 = 0x8fc8417c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LUCKY MONKEY",       }, // Lucky Monkey (Japan)
-    {.vramHash1 = 0x16b0a4f5, .vramHash2 = 0x8ff26ff2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUZZLE BOY2",        }, // Puzzle Boy II (Japan)
-    {.vramHash1 = 0xe0f6335a, .vramHash2 = 0x90550272, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHOOT",              }, // Aoki Densetsu Shoot! (Japan)
-    {.vramHash1 = 0x4c94df5a, .vramHash2 = 0x905a32d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAMSE",              }, // Bamse (Sweden)
-    {.vramHash1 = 0x7b44d4ca, .vramHash2 = 0x9066106b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL BALL",          }, // Cool Ball (USA)
-    {.vramHash1 = 0x326bd130, .vramHash2 = 0x90934844, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AYAKASI NO SIR",     }, // Ayakashi no Shiro (Japan)
-    {.vramHash1 = 0x0c11c189, .vramHash2 = 0x90a60914, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL HAND",          }, // Cool Hand (Europe)
-    {.vramHash1 = 0xa69905be, .vramHash2 = 0x90d4b660, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERROBOTWAR ",     }, // Dai-2-ji Super Robot Taisen G (Japan)
-    {.vramHash1 = 0xfb85e49f, .vramHash2 = 0x910a3a23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROADSTER",           }, // Roadster (Japan)
-    {.vramHash1 = 0xa23f896a, .vramHash2 = 0x9123b1fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATAILLE NAVAL",     }, // Bataille Navale (France) (En,Fr,De,Es)
-    {.vramHash1 = 0xc2764260, .vramHash2 = 0x912e1916, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KOI WA KAKEHIK",     }, // Koi wa Kakehiki (Japan)
-    {.vramHash1 = 0xdae0c1bf, .vramHash2 = 0x9148145d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUZZLE BOY",         }, // Puzzle Boy (Japan)
-    {.vramHash1 = 0x24f074c8, .vramHash2 = 0x9193cf40, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HIT THE ICE",        }, // Hit the Ice - VHL - The Official Video Hockey League (USA, Europe)
-    {.vramHash1 = 0xfcef76c9, .vramHash2 = 0x91b94676, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VELIOUS",            }, // Velious - Roland no Majuu (Japan)
-    {.vramHash1 = 0x0f249dfb, .vramHash2 = 0x91effe8d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ESPARKS",            }, // Miracle Adventure of Esparks - Ushinawareta Seiseki Perivron (Japan)
-    {.vramHash1 = 0x7af93d05, .vramHash2 = 0x926ada11, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERDONKEYKON",     }, // Super Donkey Kong GB (Japan)
-    {.vramHash1 = 0x59adfd6b, .vramHash2 = 0x9281d109, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BANISHING RACE",     }, // Banishing Racer (Japan)
-    {.vramHash1 = 0xf44f7a19, .vramHash2 = 0x92aaaca8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUI S BAT",      }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Sansuu Battle Hen (Japan)
-    {.vramHash1 = 0x44334e16, .vramHash2 = 0x93393dab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6 Golden Coins (USA, Europe) (Rev B)
-    {.vramHash1 = 0xa2fcbd30, .vramHash2 = 0x9388c6ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY'S PINBAL",     }, // Kirby's Pinball Land (USA, Europe)
-    {.vramHash1 = 0x19ad51d9, .vramHash2 = 0x93dc51c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIO & YOSHI",      }, // Mario & Yoshi (Europe)
-    {.vramHash1 = 0x205e1ac1, .vramHash2 = 0x93e894ee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARTS COLLECTI",     }, // Medarot - Parts Collection (Japan)
-    {.vramHash1 = 0xca0da1d1, .vramHash2 = 0x940d3767, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTARODENGEK",     }, // Momotarou Dengeki 2 (Japan)
-    {.vramHash1 = 0x874796c6, .vramHash2 = 0x9437a5d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BALLOON KID",        }, // Balloon Kid (USA, Europe)
-    {.vramHash1 = 0x553c562f, .vramHash2 = 0x9473f0f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAMPART_GB (JP",     }, // Rampart (Japan)
-    {.vramHash1 = 0x61efe440, .vramHash2 = 0x9474afde, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOSHINOKA-BI",       }, // Hoshi no Kirby (Japan) (Rev A), Hoshi no Kirby (Japan)
-    {.vramHash1 = 0x77c99546, .vramHash2 = 0x94882d48, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KEIBA KIZOKU",       }, // Kachiuma Yosou Keiba Kizoku (Japan)
-    {.vramHash1 = 0x40fc9955, .vramHash2 = 0x94a7fd00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEMMINGS",           }, // Lemmings (Europe)
-    {.vramHash1 = 0x65582db4, .vramHash2 = 0x96487f60, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET MAHJAN",      }, // Pocket Mahjong (Japan)
-    {.vramHash1 = 0x5a7b61f2, .vramHash2 = 0x96866554, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BATTLETA",     }, // Super Battletank (Europe)
-    {.vramHash1 = 0x57b384bb, .vramHash2 = 0x969c88c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE SPACE",       }, // Battle Space (Japan)
-    {.vramHash1 = 0x9a2fa533, .vramHash2 = 0x971adb73, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TUBASA VS",          }, // Captain Tsubasa VS (Japan)
-    {.vramHash1 = 0x504643aa, .vramHash2 = 0x97345741, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F1RACE",             }, // F-1 Race (World) (Rev A), F-1 Race (World)
-    {.vramHash1 = 0x45b5bf7c, .vramHash2 = 0x97d9f106, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUJOSIKBJ3",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Joushiki no Sho (Japan)
-    {.vramHash1 = 0x8b75312a, .vramHash2 = 0x9806a1c7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE LION KING",      }, // Lion King, The (Europe), Lion King, The (USA)
-    {.vramHash1 = 0x4f8fd0dd, .vramHash2 = 0x9823e2f6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRINCE VALIANT",     }, // Legend of Prince Valiant, The (Europe) (En,Fr,De)
-    {.vramHash1 = 0x3ad2227e, .vramHash2 = 0x986977c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Jurassic Park 2",    }, // Jurassic Park Part 2 - The Chaos Continues (USA, Europe) (En,Fr,De,It)
-    {.vramHash1 = 0x390aa93d, .vramHash2 = 0x98997542, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SI GOLF CLASSI",     }, // Sports Illustrated - Golf Classic (USA)
-    {.vramHash1 = 0x4e74d446, .vramHash2 = 0x989a95bb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SENSIBLE SOCCE",     }, // Sensible Soccer - European Champions (Europe)
-    {.vramHash1 = 0xc41bd617, .vramHash2 = 0x98f2499b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRUE LIES",          }, // True Lies (USA, Europe)
-    {.vramHash1 = 0x6667f111, .vramHash2 = 0x990362ab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOW BROS.JR",       }, // Snow Bros. Jr. (USA)
-    {.vramHash1 = 0xb6a82b3c, .vramHash2 = 0x9907118a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOUGAROU2",       }, // Nettou Garou Densetsu 2 - Aratanaru Tatakai (Japan)
-    {.vramHash1 = 0xbdad6da1, .vramHash2 = 0x991fdc33, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SD HIRYUNOKEN2",     }, // SD Hiryuu no Ken Gaiden 2 (Japan)
-    {.vramHash1 = 0x9e121060, .vramHash2 = 0x99503e91, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MADDEN 96",          }, // Madden '96 (USA, Europe)
-    {.vramHash1 = 0xc366527d, .vramHash2 = 0x99bb117c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLEVANIA2 B",     }, // Castlevania II - Belmont's Revenge (USA, Europe)
-    {.vramHash1 = 0x3be815f5, .vramHash2 = 0x99cb21c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKU RIKAAE8",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Rika Battle Hen (Japan)
-    {.vramHash1 = 0x71aabeb9, .vramHash2 = 0x99e5a5f7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTARO DENGE",     }, // Momotarou Dengeki (Japan)
-    {.vramHash1 = 0x138f82c1, .vramHash2 = 0x9a8492cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIFA SOCCER 96",     }, // FIFA Soccer '96 (USA, Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0x186103c9, .vramHash2 = 0x9af6dc5f, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMNT - Foot Clan",   }, // Teenage Mutant Ninja Turtles - Fall of the Foot Clan (USA)
-    {.vramHash1 = 0x1e95db79, .vramHash2 = 0x9afe81c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mystic Quest",       }, // Mystic Quest (Germany)
-    {.vramHash1 = 0x365e9854, .vramHash2 = 0x9b64c858, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAZ-MANIA",          }, // Taz-Mania (USA, Europe)
-    {.vramHash1 = 0x024859b7, .vramHash2 = 0x9b79eb56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BA.TOSHINDEN",       }, // Battle Arena Toshinden (Europe)
-    {.vramHash1 = 0x6f662413, .vramHash2 = 0x9ba38021, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE OFKINGD",     }, // Battle of Kingdom (Japan)
-    {.vramHash1 = 0xb74c03cb, .vramHash2 = 0x9bd3db17, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAVY SEALS",         }, // Navy SEALs (USA, Europe)
-    {.vramHash1 = 0x4ab23fac, .vramHash2 = 0x9c60f0db, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR SWEEP",         }, // Star Sweep (Japan)
-    {.vramHash1 = 0x1d6a3379, .vramHash2 = 0x9c88a943, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GO! GO! KID",        }, // Soreyuke!! Kid (Japan)
-    {.vramHash1 = 0xbdc0b872, .vramHash2 = 0x9cbe423e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TECMO BOWL",         }, // Tecmo Bowl (USA)
-    {.vramHash1 = 0x87573c7c, .vramHash2 = 0x9ce0cba8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA3",              }, // Sa-Ga 3 - Jikuu no Hasha (Japan)
-    {.vramHash1 = 0xf56937f1, .vramHash2 = 0x9d0bc4be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GAMERA DAIKAIJ",     }, // Gamera - Daikaijuu Kuuchuu Kessen (Japan)
-    {.vramHash1 = 0x89529bf3, .vramHash2 = 0x9d1ca5fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HONG KONG",          }, // Hong Kong (Japan)
-    {.vramHash1 = 0xf1077375, .vramHash2 = 0x9d3c41c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mystic Quest",       }, // Mystic Quest (Europe)
-    {.vramHash1 = 0xc6e3326b, .vramHash2 = 0x9d82ee86, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINER 2049ER",       }, // Miner 2049er Starring Bounty Bob (USA)
-    {.vramHash1 = 0xa26f63b8, .vramHash2 = 0x9d9d8b4c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBCOLLECTION 3",     }, // Konami GB Collection Vol.3 (Japan)
-    {.vramHash1 = 0x6f4cf4ba, .vramHash2 = 0x9dd92fae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BLADES OF STEE",     }, // Blades of Steel (Europe)
-    {.vramHash1 = 0x9695c12d, .vramHash2 = 0x9df12376, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER ROBOT WA",     }, // Super Robot Taisen (Japan)
-    {.vramHash1 = 0x75f47e2e, .vramHash2 = 0x9e0e122f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GO GO TANK",         }, // Go! Go! Tank (USA)
-    {.vramHash1 = 0xf32c1798, .vramHash2 = 0x9e14033c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE HUMANS",         }, // Humans, The (Europe) (En,Fr,De,Es,It), Humans, The (USA)
-    {.vramHash1 = 0x02674ab5, .vramHash2 = 0x9e167331, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RTYPE",              }, // R-Type (Japan), R-Type (USA, Europe)
-    {.vramHash1 = 0x9738cc10, .vramHash2 = 0x9e5b270e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NYANTOWONDERFU",     }, // Itsudemo! Nyan to Wonderful (Japan)
-    {.vramHash1 = 0x40bed7eb, .vramHash2 = 0x9e9ed5ff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBWARS",             }, // Game Boy Wars (Japan)
-    {.vramHash1 = 0x983f61b6, .vramHash2 = 0x9e9fc1f7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "INDIANA JONES",      }, // Indiana Jones - Saigo no Seisen (Japan)
-    {.vramHash1 = 0xd148546d, .vramHash2 = 0x9ea89ecb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTARODENGEK",     }, // Momotarou Collection 2 (Japan)
-    {.vramHash1 = 0x971e4ef5, .vramHash2 = 0x9edd0218, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAMATO",             }, // Uchuu Senkan Yamato (Japan)
-    {.vramHash1 = 0xbd196a6a, .vramHash2 = 0x9f0b4c09, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJA RYUKENDE",     }, // Ninja Ryuuken Den - Matenrou Kessen (Japan)
-    {.vramHash1 = 0xc06371bd, .vramHash2 = 0x9f0c5892, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NBA JAM TE",         }, // NBA Jam - Tournament Edition (Japan), NBA Jam - Tournament Edition (USA, Europe)
-    {.vramHash1 = 0x97284cad, .vramHash2 = 0x9f460179, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JAMES POND",         }, // Super James Pond (Europe)
-    {.vramHash1 = 0x2e3c12d9, .vramHash2 = 0x9f526a9b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HUGO",               }, // Hugo (Europe)
-    {.vramHash1 = 0xf665b2eb, .vramHash2 = 0x9f81fde2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "King James Bible",   }, // King James Bible (USA) (Unl), NIV Bible & the 20 Lost Levels of Joshua (USA) (Unl)
-    {.vramHash1 = 0x8532ad14, .vramHash2 = 0x9fb3cbc9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRACULA",            }, // Bram Stoker's Dracula (USA, Europe)
-    {.vramHash1 = 0x710c65b3, .vramHash2 = 0x9fe34c16, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "J.LEAGUE LIVE ",     }, // J.League Live '95 (Japan)
-    {.vramHash1 = 0x0372efa1, .vramHash2 = 0xa009e485, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BILL AND TED",       }, // Bill & Ted's Excellent Game Boy Adventure (USA, Europe)
-    {.vramHash1 = 0x4e844e04, .vramHash2 = 0xa0172139, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIRE FIGHTER",       }, // Fire Fighter (Europe)
-    {.vramHash1 = 0xc853e01d, .vramHash2 = 0xa02d512c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NOBUNAGA",           }, // Nobunaga no Yabou - Game Boy Ban (Japan)
-    {.vramHash1 = 0x13b9d8df, .vramHash2 = 0xa094e958, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLEVANIA AD",     }, // Castlevania - The Adventure (USA)
-    {.vramHash1 = 0x21f9c575, .vramHash2 = 0xa09bad23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOM AND JERRY",      }, // Tom and Jerry - Frantic Antics! (USA, Europe)
-    {.vramHash1 = 0x0fd8ecc4, .vramHash2 = 0xa0c1f11c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER CHASE H.",     }, // Super Chase H.Q. (USA, Europe)
-    {.vramHash1 = 0x68ab2bfc, .vramHash2 = 0xa0e8260e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TARURU-TO 1",     }, // Magical Taruruuto-kun (Japan)
-    {.vramHash1 = 0x05cd3179, .vramHash2 = 0xa110fa3b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY 5",           }, // Mickey Mouse V (Japan)
-    {.vramHash1 = 0x63f13401, .vramHash2 = 0xa112615e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BLADES OF STEE",     }, // Blades of Steel (USA)
-    {.vramHash1 = 0xd4c4bc8c, .vramHash2 = 0xa1577627, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKMANWORLD3",      }, // Rockman World 3 (Japan)
-    {.vramHash1 = 0xa581668b, .vramHash2 = 0xa1759098, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBD1",               }, // Game Boy Datenlogger 1 (Germany) (v1.0) (GBD1) (Unl)
-    {.vramHash1 = 0x7b8faa2a, .vramHash2 = 0xa1b7421b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOCOL",            }, // Momotarou Collection (Japan)
-    {.vramHash1 = 0x4105f94f, .vramHash2 = 0xa1c78841, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris ATTACK",      }, // Tetris Attack (USA), Tetris Attack (USA, Europe) (Rev A)
-    {.vramHash1 = 0x744996b8, .vramHash2 = 0xa1d78433, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WILDSNAKE",          }, // Wild Snake (USA)
-    {.vramHash1 = 0x52e3a68a, .vramHash2 = 0xa2066fee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "G1KING",             }, // GI King! - Sanbiki no Yosouya (Japan)
-    {.vramHash1 = 0xe1890046, .vramHash2 = 0xa26bed5a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALLERY3",           }, // Namco Gallery Vol.3 (Japan)
-    {.vramHash1 = 0xd7164abb, .vramHash2 = 0xa28ef455, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKY BULLWINK",     }, // Adventures of Rocky and Bullwinkle and Friends, The (USA)
-    {.vramHash1 = 0xc8b2f5f4, .vramHash2 = 0xa2d8a651, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA3",              }, // Final Fantasy Legend III (USA)
-    {.vramHash1 = 0x0f5a176e, .vramHash2 = 0xa2f9789d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RADARMISSION",       }, // Radar Mission (Japan), Radar Mission (USA, Europe)
-    {.vramHash1 = 0xd298a1e5, .vramHash2 = 0xa330b903, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NONTAN",             }, // Nontan to Issho - Kurukuru Puzzle (Japan)
-    {.vramHash1 = 0xa38baae1, .vramHash2 = 0xa3451b4c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN",            }, // Mega Man - Dr. Wily's Revenge (USA)
-    {.vramHash1 = 0xb85c82f4, .vramHash2 = 0xa39c167c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SCOTLANDYARD",       }, // Scotland Yard (Japan)
-    {.vramHash1 = 0x9f784904, .vramHash2 = 0xa3d38a4c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PIT FIGHTER",        }, // Pit Fighter (USA, Europe)
-    {.vramHash1 = 0x07b77ec8, .vramHash2 = 0xa3dbee8a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MIKENEKO HOLME",     }, // Mikeneko Holmes no Kishidou (Japan)
-    {.vramHash1 = 0x75a83cc0, .vramHash2 = 0xa3e1afe4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POP'N TWINBEE",      }, // Pop'n TwinBee (Europe)
-    {.vramHash1 = 0x789b4efc, .vramHash2 = 0xa3e6084c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FOREMAN FOR RE",     }, // Foreman for Real (USA, Europe)
-    {.vramHash1 = 0xb5c5a731, .vramHash2 = 0xa406ce9c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBSY II",           }, // Bubsy II (USA)
-    {.vramHash1 = 0xd1c952e9, .vramHash2 = 0xa458ce2a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BLACK BA",     }, // Super Black Bass (USA)
-    {.vramHash1 = 0x94aea104, .vramHash2 = 0xa49eb3bb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ATARUKUN",           }, // Pachinko Data Card - Chou Ataru-kun (Japan)
-    {.vramHash1 = 0xc293e21a, .vramHash2 = 0xa4ddf40f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CLIFFHANGER",        }, // Cliffhanger (USA, Europe)
-    {.vramHash1 = 0xe2976b0d, .vramHash2 = 0xa4e4afdc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKETSONAR",        }, // Pocket Sonar (Japan)
-    {.vramHash1 = 0x06cc2770, .vramHash2 = 0xa5d1abb5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIROU",             }, // Spirou (Europe) (En,Fr,De,Es) (Beta), Spirou (Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0x0e626f0b, .vramHash2 = 0xa5dac33a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET PUYOPUY",     }, // Pocket Puyo Puyo Tsuu (Japan)
-    {.vramHash1 = 0x43885fe6, .vramHash2 = 0xa5df24d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARODIUS",           }, // Parodius (Europe)
-    {.vramHash1 = 0x5ddc4ba3, .vramHash2 = 0xa61051a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OUT OF GAS",         }, // Out of Gas (USA)
-    {.vramHash1 = 0x9ecbc668, .vramHash2 = 0xa645d2e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Heavyweight Boxing", }, // Heavyweight Championship Boxing (USA)
-    {.vramHash1 = 0x2a7bf4a4, .vramHash2 = 0xa6930509, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EMPIRE STRIKES",     }, // Star Wars - The Empire Strikes Back (Europe), Star Wars - The Empire Strikes Back (USA)
-    {.vramHash1 = 0xbb5b153f, .vramHash2 = 0xa6c6eadd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UOOZU",              }, // Uoozu (Japan)
-    {.vramHash1 = 0x6742cbc9, .vramHash2 = 0xa739e031, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI4BOY2",          }, // Mini 4 Boy II - Final Evolution (Japan)
-    {.vramHash1 = 0x2aa4c225, .vramHash2 = 0xa73b7e30, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AMIDA",              }, // Amida (Japan)
-    {.vramHash1 = 0x2622c609, .vramHash2 = 0xa77429a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KAERUNOTAMENI",      }, // Kaeru no Tame ni Kane wa Naru (Japan)
-    {.vramHash1 = 0xcea31e2d, .vramHash2 = 0xa7db1ac0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LINGO",              }, // Lingo (Europe) (En,Fr,De,Nl)
-    {.vramHash1 = 0x02fa2057, .vramHash2 = 0xa7ff6038, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENSAIBAKABON",      }, // Heisei Tensai Bakabon (Japan)
-    {.vramHash1 = 0xb7798793, .vramHash2 = 0xa8645ca1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WATER WORLD",        }, // Water World (Europe)
-    {.vramHash1 = 0x9ea45574, .vramHash2 = 0xa86b771c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KINTARO RPG",        }, // Masakari Densetsu - Kintarou RPG Hen (Japan)
-    {.vramHash1 = 0x6fddb7a4, .vramHash2 = 0xa8ff1554, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EIZYUKUGO 1000",     }, // Goukaku Boy Series - Eijukugo Target 1000 (Japan)
-    {.vramHash1 = 0xddf43507, .vramHash2 = 0xa9219765, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Donkey Kong Land 3", }, // Donkey Kong Land III (USA, Europe) (Beta), Donkey Kong Land III (USA, Europe) (Rev A), Donkey Kong Land III (USA, Europe)
-    {.vramHash1 = 0x92380bab, .vramHash2 = 0xa95c0bea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLIPULL",            }, // Flipull (USA)
-    {.vramHash1 = 0x9f3709e1, .vramHash2 = 0xa9733ab1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BLUES",        }, // Blues Brothers, The - Jukebox Adventure (Europe)
-    {.vramHash1 = 0x48271894, .vramHash2 = 0xa9b95a1e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUBBLE SAVER 2",     }, // Rubble Saver II (Japan)
-    {.vramHash1 = 0x6b91fe32, .vramHash2 = 0xa9e596f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SDSENGOKUDEN2",      }, // SD Sengokuden 2 - Tenka Touitsu Hen (Japan)
-    {.vramHash1 = 0x23c0e2b5, .vramHash2 = 0xaa765508, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATMAN FOREVER",     }, // Batman Forever (Japan)
-    {.vramHash1 = 0xca5c8913, .vramHash2 = 0xaa7921a6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHISENSYO",          }, // Shisenshou - Match-Mania (Japan)
-    {.vramHash1 = 0x6e39293e, .vramHash2 = 0xaafcc111, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KOKIATSUBOY",        }, // Koukiatsu Boy (Japan)
-    {.vramHash1 = 0x0d4529ed, .vramHash2 = 0xab0e636e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUNANMNBD4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Nanmon no Sho (Japan)
-    {.vramHash1 = 0xf7bd088b, .vramHash2 = 0xab33ebfb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADDAMS FAMILY",      }, // Addams Family, The (Europe) (En,Fr,De)
-    {.vramHash1 = 0xf92fcb29, .vramHash2 = 0xab6b1408, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FRANK THOMAS B",     }, // Frank Thomas Big Hurt Baseball (USA, Europe)
-    {.vramHash1 = 0xca17170f, .vramHash2 = 0xab77c7f2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAESARS PALACE",     }, // Caesars Palace (Europe) (En,Fr,De,Es,It)
-    {.vramHash1 = 0x325b520e, .vramHash2 = 0xabc3cbc5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHASE HQ",           }, // Chase H.Q. (USA, Europe)
-    {.vramHash1 = 0x505bef60, .vramHash2 = 0xabc64bd0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PROBOTECTOR",        }, // Probotector (Europe)
-    {.vramHash1 = 0xdb31b60d, .vramHash2 = 0xabcd9c9b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POWER RACER",        }, // Power Racer (Europe), Power Racer (USA)
-    {.vramHash1 = 0x7743cbb7, .vramHash2 = 0xabd3d412, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "METALJACK",          }, // Kikou Keisatsu Metal Jack (Japan)
-    {.vramHash1 = 0x89c32a62, .vramHash2 = 0xac25c88a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KEIBAKIZOKU EX",     }, // Kachiuma Yosou Keiba Kizoku EX '94 (Japan), Kachiuma Yosou Keiba Kizoku EX '95 (Japan)
-    {.vramHash1 = 0x7b67ffb6, .vramHash2 = 0xac2e6404, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY BLOCKBAL",     }, // Kirby's Block Ball (USA, Europe)
-    {.vramHash1 = 0x0f42d36b, .vramHash2 = 0xad01e2b0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOME ALONE",         }, // Home Alone (Japan)
-    {.vramHash1 = 0x321f4a23, .vramHash2 = 0xad769d0c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BASE BALL KIDS",     }, // Baseball Kids (Japan)
-    {.vramHash1 = 0x3ab23d91, .vramHash2 = 0xad79d664, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "J.CUP SOCCER",       }, // Jaleco J.Cup Soccer (Japan)
-    {.vramHash1 = 0x7b98c38e, .vramHash2 = 0xad8076d4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HERCULES",           }, // Hercules (USA, Europe)
-    {.vramHash1 = 0x0399a17a, .vramHash2 = 0xad8f0a6d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMISTA3",           }, // Famista 3 (Japan)
-    {.vramHash1 = 0xb028d211, .vramHash2 = 0xada3636e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UNO2SMALL WORL",     }, // Uno 2 - Small World (Japan)
-    {.vramHash1 = 0xe93bd253, .vramHash2 = 0xae70f4f7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB DBZ GOKOU 2",     }, // Dragon Ball Z - Gokuu Gekitouden (Japan)
-    {.vramHash1 = 0x3241803a, .vramHash2 = 0xaecf0057, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OBELIX",             }, // Asterix & Obelix (Europe) (Fr,De)
-    {.vramHash1 = 0x1f6e009c, .vramHash2 = 0xafb38657, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEACH_VOLLEY",       }, // Nekketsu! Beach Volley Da yo Kunio-kun (Japan)
-    {.vramHash1 = 0x31639ff0, .vramHash2 = 0xafd1a6d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTHELLO",            }, // Othello (Europe)
-    {.vramHash1 = 0x00fed806, .vramHash2 = 0xaffdd739, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAST ACTION HE",     }, // Last Action Hero (USA, Europe)
-    {.vramHash1 = 0xb229999b, .vramHash2 = 0xb03b6c6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIFA SOCCER 97",     }, // FIFA Soccer '97 (USA, Europe)
-    {.vramHash1 = 0xb25ab0c7, .vramHash2 = 0xb0eb4130, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KINGYOTYUUI",     }, // Kingyo Chuuihou! - Wapiko no Wakuwaku Stamp Rally! (Japan)
-    {.vramHash1 = 0xe1e85c1d, .vramHash2 = 0xb14ca8f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU KOF 96",      }, // Nettou The King of Fighters '96 (Japan)
-    {.vramHash1 = 0x10300283, .vramHash2 = 0xb19376ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOPRANKINGTENN",     }, // Top Ranking Tennis (Europe)
-    {.vramHash1 = 0x8a6d48a1, .vramHash2 = 0xb1a6593c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET LOVE",        }, // Pocket Love (Japan)
-    {.vramHash1 = 0xa79475a5, .vramHash2 = 0xb1e5bcef, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DOUBLEYAKUMAN",      }, // Double Yakuman (Japan)
-    {.vramHash1 = 0x3f26dc81, .vramHash2 = 0xb21f736e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KORODICE",           }, // Koro Dice (Japan)
-    {.vramHash1 = 0x35860a1b, .vramHash2 = 0xb230ef2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUST A MOVE 2",      }, // Bust-A-Move 2 - Arcade Edition (USA, Europe)
-    {.vramHash1 = 0x08bb76b0, .vramHash2 = 0xb25036d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SEIKEN DENSETS",     }, // Final Fantasy Adventure (USA)
-    {.vramHash1 = 0xafa23911, .vramHash2 = 0xb28f6fc6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CATRAP",             }, // Catrap (USA)
-    {.vramHash1 = 0x2e9e2303, .vramHash2 = 0xb2c74ec1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BASES LOADED G",     }, // Bases Loaded for Game Boy (USA)
-    {.vramHash1 = 0xde3a946c, .vramHash2 = 0xb2e362aa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGA MAN 2",         }, // Mega Man II (Europe)
-    {.vramHash1 = 0xf2b5def4, .vramHash2 = 0xb31776bc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SPIRIT OF ",     }, // Spirit of F-1, The (Europe)
-    {.vramHash1 = 0x7d065504, .vramHash2 = 0xb38866a0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VIRTUAL WARS",       }, // Virtual Wars (Japan)
-    {.vramHash1 = 0x3ab4fc47, .vramHash2 = 0xb3a76ac5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORAKYURADENSE",     }, // Dracula Densetsu (Japan)
-    {.vramHash1 = 0x3ffb5da5, .vramHash2 = 0xb3c0f628, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE BULL",        }, // Battle Bull (Japan), Battle Bull (USA)
-    {.vramHash1 = 0xcdb2ec5d, .vramHash2 = 0xb3c7c12a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "URUSEIYATSURA",      }, // Urusei Yatsura - Miss Tomobiki o Sagase! (Japan)
-    {.vramHash1 = 0xdfa2a52b, .vramHash2 = 0xb3ce6026, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Burai Senshi",       }, // Burai Senshi Deluxe (Japan)
-    {.vramHash1 = 0x74dc8131, .vramHash2 = 0xb3f66178, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUUYUU-2",           }, // Yu Yu Hakusho Dai-2-dan - Ankoku Bujutsukai Hen (Japan)
-    {.vramHash1 = 0x50892617, .vramHash2 = 0xb409bd29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DENNIS",             }, // Dennis (Europe)
-    {.vramHash1 = 0x508928eb, .vramHash2 = 0xb40cf605, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DENNIS",             }, // Dennis the Menace (USA)
-    {.vramHash1 = 0xeca3e879, .vramHash2 = 0xb4878acb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENSAN",             }, // Daiku no Gen-san - Ghost Building Company (Japan)
-    {.vramHash1 = 0xeca3e8a0, .vramHash2 = 0xb48896d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENSAN",             }, // Hammerin' Harry - Ghost Building Company (Europe)
-    {.vramHash1 = 0x4c0318d7, .vramHash2 = 0xb4c61077, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTHELLO",            }, // Othello (Japan)
-    {.vramHash1 = 0xd71175a0, .vramHash2 = 0xb4f0d1c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERCHINESELA",     }, // Super Chinese Land (Japan)
-    {.vramHash1 = 0x7d427f80, .vramHash2 = 0xb52e079a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISLO GB",        }, // Pachi-Slot Hisshou Guide GB (Japan)
-    {.vramHash1 = 0xfa518d69, .vramHash2 = 0xb5473c2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "XENON 2",            }, // Xenon 2 - Megablast (Japan)
-    {.vramHash1 = 0x32b4118b, .vramHash2 = 0xb56891e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKSYAKAIBE3",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Shakai Battle Hen (Japan) (Special Edition)
-    {.vramHash1 = 0x18d644d3, .vramHash2 = 0xb59af815, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE FIDGETTS",       }, // Fidgetts, The (USA, Europe) (En,Fr,De,Es,It,Nl,Sv)
-    {.vramHash1 = 0xe1dc8ea8, .vramHash2 = 0xb59f9646, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOJIJUKUGO",         }, // Goukaku Boy Series - Gakken - Yojijukugo 288 (Japan) (Rev A), Goukaku Boy Series - Gakken - Yojijukugo 288 (Japan)
-    {.vramHash1 = 0x3af8b8d2, .vramHash2 = 0xb5aa1d71, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANGEL MARLOWE",      }, // Taiyou no Tenshi Marlowe - Ohanabatake wa Dai-panic (Japan)
-    {.vramHash1 = 0x3f614bae, .vramHash2 = 0xb5bebee6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUBBLESA",           }, // Rubble Saver (Japan)
-    {.vramHash1 = 0x5eabf7d6, .vramHash2 = 0xb5f41e75, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROLANS CURSE",       }, // Rolan's Curse (USA)
-    {.vramHash1 = 0xcb86185b, .vramHash2 = 0xb6106c6a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR TREK",          }, // Star Trek - 25th Anniversary (USA, Europe)
-    {.vramHash1 = 0x0828a799, .vramHash2 = 0xb64e9673, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LUNA LANDER",        }, // Lunar Lander (Japan)
-    {.vramHash1 = 0x20f0fddc, .vramHash2 = 0xb64f6563, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHOPLIFTER 2",       }, // Choplifter II - Rescue & Survive (Europe)
-    {.vramHash1 = 0xde873536, .vramHash2 = 0xb70f2bfb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSSY NO TAMAG",     }, // Yoshi (USA)
-    {.vramHash1 = 0x178a558d, .vramHash2 = 0xb712d447, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPARTAN X",          }, // Kung-Fu Master (USA, Europe)
-    {.vramHash1 = 0x3cd85003, .vramHash2 = 0xb7163ae4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALLEY WAY",          }, // Alleyway (World)
-    {.vramHash1 = 0x487e4f4e, .vramHash2 = 0xb73c34bb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBGENJIN2",          }, // GB Genjin 2 (Japan)
-    {.vramHash1 = 0x4b03996b, .vramHash2 = 0xb7b3d026, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHIPPO DE BUN",      }, // Shippo de Bun (Japan)
-    {.vramHash1 = 0xdd34f009, .vramHash2 = 0xb8122d0f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAINTERMOMOPIE",     }, // Painter Momopie (Japan)
-    {.vramHash1 = 0xf948ad3f, .vramHash2 = 0xb81efd2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BA.TOSHINDEN",       }, // Battle Arena Toshinden (USA)
-    {.vramHash1 = 0x932159a5, .vramHash2 = 0xb82bef00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GAME GALLERY",       }, // Pachio-kun - Game Gallery (Japan)
-    {.vramHash1 = 0x148cdcd9, .vramHash2 = 0xb84b07b8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL QB CLUB 96",     }, // NFL Quarterback Club '96 (USA, Europe)
-    {.vramHash1 = 0xb83a54e3, .vramHash2 = 0xb8929798, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TURI SENSEI V1",     }, // Tsuri Sensei (Japan)
-    {.vramHash1 = 0x91c8da3d, .vramHash2 = 0xb8af9218, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MR.DO!",             }, // Mr. Do! (USA)
-    {.vramHash1 = 0x4b140fef, .vramHash2 = 0xb8dbb79e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET KYOROCH",     }, // Pocket Kyoro-chan (Japan)
-    {.vramHash1 = 0x51515d9e, .vramHash2 = 0xb90d6657, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-IN-TIME",        }, // Pac-In-Time (Europe)
-    {.vramHash1 = 0x66022b35, .vramHash2 = 0xb92a6f99, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6-tsu no Kinka (Japan) (Rev 1)
-    {.vramHash1 = 0xa9f839e4, .vramHash2 = 0xb934d3cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD BOWLING",      }, // World Bowling (USA)
-    {.vramHash1 = 0x191d038d, .vramHash2 = 0xb9584fae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPEYE",             }, // Popeye (Japan)
-    {.vramHash1 = 0x58feb1e2, .vramHash2 = 0xb959e302, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Blaster Master",     }, // Blaster Master Boy (USA), Blaster Master Jr. (Europe), Bomber King - Scenario 2 (Japan)
-    {.vramHash1 = 0x86c2e310, .vramHash2 = 0xb976f001, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER MAKER",      }, // Monster Maker - Barcode Saga (Japan)
-    {.vramHash1 = 0x75fdd3a0, .vramHash2 = 0xb9b4a6e0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOGURANYA",          }, // Moguranya (Japan)
-    {.vramHash1 = 0xa6a74dc9, .vramHash2 = 0xb9e34f9f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEW CHESSMASTE",     }, // New Chessmaster, The (Japan) (En,Ja)
-    {.vramHash1 = 0x338f9c87, .vramHash2 = 0xb9e8e8b9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DROPZONE",           }, // Dropzone (Europe)
-    {.vramHash1 = 0xc82a3e23, .vramHash2 = 0xba1a95d7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAKENOUZ",           }, // DX Bakenou Z (Japan) (Rev A), DX Bakenou Z (Japan)
-    {.vramHash1 = 0x71f393e5, .vramHash2 = 0xbaac49a8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AVENGING SPIRI",     }, // Avenging Spirit (USA, Europe)
-    {.vramHash1 = 0xad0db4ac, .vramHash2 = 0xbacdf771, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHASE HQ",           }, // Taito Chase H.Q. (Japan)
-    {.vramHash1 = 0x34ecfbe5, .vramHash2 = 0xbada17f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINESWEEPER",        }, // Minesweeper - Soukaitei (Japan)
-    {.vramHash1 = 0x6604be14, .vramHash2 = 0xbb1c9bb5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6-tsu no Kinka (Japan)
-    {.vramHash1 = 0x57b43bb0, .vramHash2 = 0xbb2c2ef7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS 2",          }, // Nemesis II (Japan)
-    {.vramHash1 = 0xb7c0f34e, .vramHash2 = 0xbb30e5dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB CRAYON 2",        }, // Crayon Shin-chan 2 - Ora to Wanpaku Gokko Dazo (Japan)
-    {.vramHash1 = 0x6a022ce7, .vramHash2 = 0xbb5b0569, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR FRANKEN",         }, // Dr. Franken (Europe) (En,Fr,De,Es,It,Nl,Sv)
-    {.vramHash1 = 0x236d025d, .vramHash2 = 0xbb7d37d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMIC BASKET",     }, // Konamic Basket (Japan)
-    {.vramHash1 = 0x3b21299e, .vramHash2 = 0xbb8752c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SHINRI GAM",     }, // Shinri Game 2, The - Oosaka Hen (Japan)
-    {.vramHash1 = 0x3841b5e6, .vramHash2 = 0xbbb8b6ff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL FOOTBALL",       }, // NFL Football (USA)
-    {.vramHash1 = 0x6da5175a, .vramHash2 = 0xbbc815d4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER OFF ROAD",     }, // Super Off Road (USA, Europe)
-    {.vramHash1 = 0x95ddd866, .vramHash2 = 0xbbd0b695, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RED ARREMER",        }, // Red Arremer - Makai Mura Gaiden (Japan)
-    {.vramHash1 = 0x164ea5b7, .vramHash2 = 0xbbdd0442, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER HUNCHBAC",     }, // Super Hunchback (Europe), Super Hunchback (Japan), Super Hunchback (USA)
-    {.vramHash1 = 0xdb2035ae, .vramHash2 = 0xbc243a40, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRAX",               }, // Trax (USA, Europe)
-    {.vramHash1 = 0x7aed576c, .vramHash2 = 0xbc54c652, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FISH DUDE",          }, // Fish Dude (USA)
-    {.vramHash1 = 0xd400ca48, .vramHash2 = 0xbc5b450a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DINO2         ",     }, // Dino Breeder 2 (Japan)
-    {.vramHash1 = 0x5a66cfdc, .vramHash2 = 0xbc6d4100, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ARETHA",             }, // Aretha (Japan)
-    {.vramHash1 = 0x00686b9d, .vramHash2 = 0xbc9ac236, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WINNER'S HORSE",     }, // Winner's Horse (Japan)
-    {.vramHash1 = 0x4faa2cee, .vramHash2 = 0xbc9ca918, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MADDEN '97",         }, // Madden '97 (USA)
-    {.vramHash1 = 0xb54a120b, .vramHash2 = 0xbca2d561, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-AAJ",            }, // Ponta to Hinako no Chindouchuu - Yuujou Hen (Japan)
-    {.vramHash1 = 0x79077fa7, .vramHash2 = 0xbcef1f02, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR FRANKEN 2",       }, // Dr. Franken II (USA, Europe) (En,Fr,De,Es,It,Nl,Sv)
-    {.vramHash1 = 0xd467c47d, .vramHash2 = 0xbd07ae98, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOM AND JERRY ",     }, // Tom to Jerry (Japan)
-    {.vramHash1 = 0xe11da1f5, .vramHash2 = 0xbd0e824e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHOU HYPER FIS",     }, // Bakuchou Retsuden Shou - Hyper Fishing (Japan)
-    {.vramHash1 = 0xbe8f4f69, .vramHash2 = 0xbd47e104, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMISTA",            }, // Famista (Japan)
-    {.vramHash1 = 0x7131a2c5, .vramHash2 = 0xbd585223, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEETLEJUICE",        }, // Beetlejuice (USA)
-    {.vramHash1 = 0xb48eee85, .vramHash2 = 0xbd59f4f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU KOF 95",      }, // King of Fighters '95, The (USA)
-    {.vramHash1 = 0x9fe911f7, .vramHash2 = 0xbd60f061, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LUCKY LUKE",         }, // Lucky Luke (Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0xf1cde395, .vramHash2 = 0xbdeb20d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RTYPE 2",            }, // Mani 4 in 1 (China) (DMG-604 CHN), R-Type II (Europe), R-Type II (Japan)
-    {.vramHash1 = 0xecb23652, .vramHash2 = 0xbdf3e5fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SUPERBIKKUR",     }, // Super Bikkuriman - Densetsu no Sekiban (Japan)
-    {.vramHash1 = 0xed3c7a64, .vramHash2 = 0xbe15b6f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JANSHIRO2",          }, // Janshirou II - Sekai Saikyou no Janshi (Japan)
-    {.vramHash1 = 0xe4b4245a, .vramHash2 = 0xbeae091d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMIC GOLF",       }, // Konamic Golf (Japan)
-    {.vramHash1 = 0xd6fc6a06, .vramHash2 = 0xbf2e1129, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DETECTIVE CONA",     }, // Meitantei Conan - Chika Yuuenchi Satsujin Jiken (Japan)
-    {.vramHash1 = 0x73c3add9, .vramHash2 = 0xbf2fcf83, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOTAL CARNAGE",      }, // Total Carnage (USA, Europe)
-    {.vramHash1 = 0x470f0e3a, .vramHash2 = 0xbf7e38d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DEFENDER/JOUST",     }, // Arcade Classic No. 4 - Defender & Joust (USA, Europe)
-    {.vramHash1 = 0xbd8c2303, .vramHash2 = 0xbfd58113, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MACH GO",            }, // Mach Go Go Go (Japan)
-    {.vramHash1 = 0x3b1fda0a, .vramHash2 = 0xbff06975, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FRISKY TOM",         }, // Frisky Tom (Japan)
-    {.vramHash1 = 0x342cab43, .vramHash2 = 0xbff31f0d, .dmaFix = 0xff95, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Alien vs Predator",  }, // Alien vs Predator - The Last of His Clan (USA)
-    {.vramHash1 = 0xc4489e72, .vramHash2 = 0xc00fae8b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHIOKUN 3",        }, // Pachio-kun 3 (Japan)
-    {.vramHash1 = 0x2aa7a1fd, .vramHash2 = 0xc020c3f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JANTAKUBOY",         }, // Jantaku Boy (Japan)
-    {.vramHash1 = 0x18799283, .vramHash2 = 0xc037baeb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ARETHA3",            }, // Aretha III (Japan)
-    {.vramHash1 = 0xafe7b9f4, .vramHash2 = 0xc038c351, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ELEVATOR ACTIO",     }, // Elevator Action (Japan), Elevator Action (USA, Europe)
-    {.vramHash1 = 0x2d9c5489, .vramHash2 = 0xc0ec037c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NIGEL MANSELL",      }, // Nigel Mansell's World Championship (Europe)
-    {.vramHash1 = 0x2d9c5491, .vramHash2 = 0xc0ec03d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MANSELL",            }, // Nigel Mansell's World Championship Racing (Europe)
-    {.vramHash1 = 0xf91e5034, .vramHash2 = 0xc115193d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "XENON 2",            }, // Xenon 2 - Megablast (USA, Europe)
-    {.vramHash1 = 0x99c7b23f, .vramHash2 = 0xc1275436, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTOGI BANASI T",     }, // Otogibanashi Taisen (Japan)
-    {.vramHash1 = 0xd6346db6, .vramHash2 = 0xc1377f07, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DINO          ",     }, // Dino Breeder (Japan) (Rev A), Dino Breeder (Japan)
-    {.vramHash1 = 0x4c11d435, .vramHash2 = 0xc1417140, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BATTLETA",     }, // Super Battletank - War in the Gulf (USA)
-    {.vramHash1 = 0x98f88dd9, .vramHash2 = 0xc1479baa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JEOPARDY",           }, // Jeopardy! (USA)
-    {.vramHash1 = 0xb4ab8857, .vramHash2 = 0xc151afb3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SI KIDS",            }, // Sports Illustrated for Kids - The Ultimate Triple Dare! (USA)
-    {.vramHash1 = 0x5bd1761c, .vramHash2 = 0xc16dadbc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PIPE DREAM",         }, // Pipe Dream (USA)
-    {.vramHash1 = 0xe49640ba, .vramHash2 = 0xc176f093, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSSY NO PANEP",     }, // Yoshi no Panepon (Japan)
-    {.vramHash1 = 0xf11daffa, .vramHash2 = 0xc17c9d94, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADVENTUREISLAN",     }, // Adventure Island II - Aliens in Paradise (USA, Europe)
-    {.vramHash1 = 0x45985a6b, .vramHash2 = 0xc1908b0a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE SHIP",        }, // Battleship (USA, Europe)
-    {.vramHash1 = 0x42ac5ed9, .vramHash2 = 0xc1940bcf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Donkey Kong Land",   }, // Donkey Kong Land (Japan)
-    {.vramHash1 = 0x777a95b1, .vramHash2 = 0xc198b10c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Donkey Kong Land",   }, // Donkey Kong Land (USA, Europe)
-    {.vramHash1 = 0xeb701b5d, .vramHash2 = 0xc1e491d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIBIMARUKO4",       }, // Chibi Maruko-chan 4 - Kore ga Nihon Da yo! Ouji-sama (Japan)
-    {.vramHash1 = 0xe290b394, .vramHash2 = 0xc20737ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB LUCKYMAN",        }, // Tottemo! Lucky Man - Lucky Cookie Minna Daisuki!! (Japan)
-    {.vramHash1 = 0x8c89aa47, .vramHash2 = 0xc27852d7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KASEKI REBORN",      }, // Kaseki Sousei Reborn (Japan)
-    {.vramHash1 = 0x0d9025ae, .vramHash2 = 0xc28b3c9d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRA3",             }, // America Oudan Ultra Quiz Part 3 - Champion Taikai (Japan)
-    {.vramHash1 = 0x70ab89fd, .vramHash2 = 0xc2b6a9df, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTHELLO WORLD",      }, // Othello World (Japan)
-    {.vramHash1 = 0x4d33bb9a, .vramHash2 = 0xc3008894, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Ninja Gaiden",       }, // Ninja Gaiden Shadow (USA), Shadow Warriors (Europe)
-    {.vramHash1 = 0x044952ba, .vramHash2 = 0xc30685c0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINKU 2",            }, // Ninku Dai-2-dan - Ninku Sensou Hen (Japan)
-    {.vramHash1 = 0x763e12ea, .vramHash2 = 0xc34e8b31, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKU RIKABH4",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Rika Battle Hen (Japan) (Special Edition)
-    {.vramHash1 = 0x385b8d41, .vramHash2 = 0xc370ad2c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PANG",               }, // Pang (Europe)
-    {.vramHash1 = 0xa7ff4b9f, .vramHash2 = 0xc3718eb0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJA BOY 2",        }, // Ninja Boy 2 (USA, Europe)
-    {.vramHash1 = 0xb790e60c, .vramHash2 = 0xc3d43c4e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEST OF THE BE",     }, // Best of the Best - Championship Karate (Europe)
-    {.vramHash1 = 0x3fa7ed06, .vramHash2 = 0xc3debf55, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENJINKAISEN",       }, // Tenjin Kaisen (Japan)
-    {.vramHash1 = 0x00a75c60, .vramHash2 = 0xc40a4335, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALTERED SPACE",      }, // Altered Space - A 3-D Alien Adventure (Europe)
-    {.vramHash1 = 0x47823887, .vramHash2 = 0xc4103bbb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OUT TO LUNCH",       }, // Pierre le Chef Is... Out to Lunch (Europe)
-    {.vramHash1 = 0x2b55f9bf, .vramHash2 = 0xc4309fe5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL SPOT",          }, // Cool Spot (Europe)
-    {.vramHash1 = 0x5d0da17a, .vramHash2 = 0xc4581ca4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB BEACHVOLLEY",     }, // World Beach Volley - 1992 GB Cup (Europe)
-    {.vramHash1 = 0x51d0a9e3, .vramHash2 = 0xc47289ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-SJJ",            }, // Snow Bros. Jr. (Japan)
-    {.vramHash1 = 0x807121a1, .vramHash2 = 0xc47fec22, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP 98",       }, // World Cup 98 (USA, Europe)
-    {.vramHash1 = 0x39ce1bea, .vramHash2 = 0xc49f36c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "J CONNORS TENN",     }, // Jimmy Connors Tennis (USA, Europe)
-    {.vramHash1 = 0x7f69d047, .vramHash2 = 0xc4a2900a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINTAMA PUZZLE",     }, // Puzzle Nintama Rantarou (Japan)
-    {.vramHash1 = 0x45092441, .vramHash2 = 0xc4da4db1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RACE DAYS",          }, // Race Days (Europe), Race Days (USA)
-    {.vramHash1 = 0x22b15d30, .vramHash2 = 0xc4dbb3e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MYSTERIUM",          }, // Mysterium (Japan), Mysterium (USA)
-    {.vramHash1 = 0x5e91b260, .vramHash2 = 0xc4fdae41, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG GARIBA-BOU",     }, // Kuusou Kagaku Sekai Gulliver Boy - Kuusou Kagaku Puzzle Purittopon!! (Japan)
-    {.vramHash1 = 0x7e437672, .vramHash2 = 0xc4fef73a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SWAMP THING",        }, // Swamp Thing (USA, Europe)
-    {.vramHash1 = 0xc3aa54d8, .vramHash2 = 0xc519bf22, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DESERT STRIKE",      }, // Desert Strike - Return to the Gulf (USA)
-    {.vramHash1 = 0xe0000800, .vramHash2 = 0xc5760400, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAYEARTH2",          }, // Magic Knight Rayearth 2nd. - The Missing Colors (Japan)
-    {.vramHash1 = 0xe613b8a2, .vramHash2 = 0xc5874c90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKSYAKAIAK8",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Shakai Battle Hen (Japan)
-    {.vramHash1 = 0xf77b5e0c, .vramHash2 = 0xc5a47568, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENCOL",             }, // Genjin Collection (Japan)
-    {.vramHash1 = 0xd491d32f, .vramHash2 = 0xc5bcc6cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UNO-SMALL WORL",     }, // Uno - Small World (Japan)
-    {.vramHash1 = 0x45cac450, .vramHash2 = 0xc623b1b1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "J CONNORS TENN",     }, // Jimmy Connors no Pro Tennis Tour (Japan)
-    {.vramHash1 = 0x475db67e, .vramHash2 = 0xc632a1b2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RACE DRIVIN'",       }, // Race Drivin' (USA, Europe)
-    {.vramHash1 = 0xe962808b, .vramHash2 = 0xc6719093, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOXING",             }, // Boxing (Japan)
-    {.vramHash1 = 0xfff39000, .vramHash2 = 0xc721c800, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mick & Mack",        }, // Mick & Mack as the Global Gladiators (USA) (Proto)
-    {.vramHash1 = 0xb0ffd454, .vramHash2 = 0xc79ab341, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SHOUGI SAIK",     }, // Shougi Saikyou (Japan) (Rev A), Shougi Saikyou (Japan)
-    {.vramHash1 = 0x0341ddc0, .vramHash2 = 0xc7c87ff1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR FRANKEN",         }, // Dr. Franken (USA)
-    {.vramHash1 = 0x0341de5e, .vramHash2 = 0xc7c88307, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR FRANKEN",         }, // Dr. Franken (Japan)
-    {.vramHash1 = 0x425f8e11, .vramHash2 = 0xc808c29f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6 Golden Coins (USA, Europe) (Rev A)
-    {.vramHash1 = 0xdd3e15dc, .vramHash2 = 0xc830c642, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Exodus",             }, // Exodus - Journey to the Promised Land (USA) (Unl)
-    {.vramHash1 = 0xda93eb6b, .vramHash2 = 0xc83fc9d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIDER-MAN 2",       }, // Spider-Man 2 (USA, Europe)
-    {.vramHash1 = 0x7034fe80, .vramHash2 = 0xc887f1c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAGNETIC SOCCE",     }, // Magnetic Soccer (Europe)
-    {.vramHash1 = 0x316a20d6, .vramHash2 = 0xc89a692c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPANKY'S QUEST",     }, // Spanky's Quest (Europe)
-    {.vramHash1 = 0x04c50825, .vramHash2 = 0xc89fee5e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PROWRES",            }, // Pro Wrestling (Japan)
-    {.vramHash1 = 0x8a2b0065, .vramHash2 = 0xc8be0df7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHONENASHIBE",       }, // Shounen Ashibe - Yuuenchi Panic (Japan)
-    {.vramHash1 = 0xd7f33e80, .vramHash2 = 0xc8f2671c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAEDALIAN OPUS",     }, // Daedalian Opus (USA)
-    {.vramHash1 = 0x1931ce76, .vramHash2 = 0xc912c82b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "S-PACHINKO WAR",     }, // Super Pachinko Taisen (Japan)
-    {.vramHash1 = 0xe000f800, .vramHash2 = 0xc9367c00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGAIA",             }, // Mani 4 in 1 (China) (DMG-602 CHN), Sagaia (Japan), Taito Variety Pack (Japan)
-    {.vramHash1 = 0xe001f800, .vramHash2 = 0xc936fc00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WARIOLAND2",         }, // Wario Land II (USA, Europe)
-    {.vramHash1 = 0x4b33b7dd, .vramHash2 = 0xc9f693f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {{.jumpAddress = 0x309d, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x30a2, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x3131, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "Battletoads Ragn.",  }, // Battletoads in Ragnarok's World (Europe), Battletoads in Ragnarok's World (USA)
-    {.vramHash1 = 0x4262226b, .vramHash2 = 0xc9fc1270, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6 Golden Coins (USA, Europe)
-    {.vramHash1 = 0x24328224, .vramHash2 = 0xca6345a3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINOCCHIO",          }, // Pinocchio (Europe)
-    {.vramHash1 = 0xf2262595, .vramHash2 = 0xca73ea6d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SELECTION",          }, // Selection - Erabareshi Mono (Japan)
-    {.vramHash1 = 0xa0425786, .vramHash2 = 0xcab6da85, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POWER MISSION",      }, // Power Mission (Japan) (Rev A), Power Mission (Japan), Power Mission (USA)
-    {.vramHash1 = 0xfc165c30, .vramHash2 = 0xcace585f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WHEEL OF FORTU",     }, // Wheel of Fortune (USA)
-    {.vramHash1 = 0x462388ba, .vramHash2 = 0xcada51fb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WAVERACE",           }, // Wave Race (USA, Europe)
-    {.vramHash1 = 0x725856cc, .vramHash2 = 0xcaea3b65, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI PUTT",          }, // Mini Putt (Japan)
-    {.vramHash1 = 0x1cf52ec6, .vramHash2 = 0xcaf62b9d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GANBARE GOEMON",     }, // Ganbare Goemon - Sarawareta Ebisumaru (Japan)
-    {.vramHash1 = 0xdc972106, .vramHash2 = 0xcaf63a10, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRAPPERS TENGO",     }, // Trappers Tengoku - Spy vs Spy (Japan)
-    {.vramHash1 = 0xaa39e0e6, .vramHash2 = 0xcb10822f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TITUS THE FOX",      }, // Titus the Fox to Marrakech and Back (USA, Europe)
-    {.vramHash1 = 0x07fa637e, .vramHash2 = 0xcb2c18fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINTAMA RANTAR",     }, // Nintama Rantarou GB (Japan)
-    {.vramHash1 = 0x0c3bb89b, .vramHash2 = 0xcb4bec66, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE DODGEBA",     }, // Battle Dodge Ball (Japan)
-    {.vramHash1 = 0x310bb5f9, .vramHash2 = 0xcb4c45e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOUSE TRAP HOT",     }, // Mouse Trap Hotel (USA)
-    {.vramHash1 = 0x1770b02b, .vramHash2 = 0xcb5d1aba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KID NIKI",           }, // Ganso!! Yancha Maru (Japan)
-    {.vramHash1 = 0x148f0ea2, .vramHash2 = 0xcbaeddbc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Red",        }, // Pokemon - Edicion Roja (Spain), Pokemon - Rote Edition (Germany), Pokemon - Version Rouge (France), Pokemon - Versione Rossa (Italy)
-    {.vramHash1 = 0xdb133c41, .vramHash2 = 0xcc053e2b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Z KAI KOBUN   ",     }, // Goukaku Boy Series - Z Kai (Reibun de Oboeru) Kyuukyoku no Kobun Tango (Japan)
-    {.vramHash1 = 0xe1604bf0, .vramHash2 = 0xcc413a3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HUNCHBACK",          }, // Hunchback of Notre Dame, The - 5 Foolishly Fun Topsy Turvy Games (USA, Europe)
-    {.vramHash1 = 0xe8fb7028, .vramHash2 = 0xcc482c2f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DEXTERITY",          }, // Dexterity (USA, Europe)
-    {.vramHash1 = 0xaada3149, .vramHash2 = 0xcc48c35b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN4",           }, // Mega Man IV (Europe)
-    {.vramHash1 = 0x2f303476, .vramHash2 = 0xcc81ad27, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP USA ",     }, // World Cup USA 94 (Europe) (En,Fr,De,Es,It,Nl,Pt,Sv)
-    {.vramHash1 = 0x9f3e1294, .vramHash2 = 0xccbc1b95, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMCOL",             }, // Bomber Man Collection (Japan)
-    {.vramHash1 = 0x74d80bc5, .vramHash2 = 0xccf33d77, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCAHONTAS",         }, // Pocahontas (USA, Europe)
-    {.vramHash1 = 0x9981d535, .vramHash2 = 0xcd8d434d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB POWER MOVIE",     }, // Mighty Morphin Power Rangers - The Movie (USA, Europe)
-    {.vramHash1 = 0xed344939, .vramHash2 = 0xcda904c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA",               }, // Final Fantasy Legend, The (USA)
-    {.vramHash1 = 0x9ebd1011, .vramHash2 = 0xcdea80fd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARBLE MADNESS",     }, // Marble Madness (USA, Europe)
-    {.vramHash1 = 0x9826b15a, .vramHash2 = 0xcdebf5f1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIE MAUS",           }, // Maus, Die (Europe) (En,Fr,De,Es)
-    {.vramHash1 = 0xf7bf13f7, .vramHash2 = 0xce94a749, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Batman Animated",    }, // Batman - The Animated Series (USA, Europe)
-    {.vramHash1 = 0xbb213f7f, .vramHash2 = 0xcec0a0b1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMILY JOCKEY2",     }, // Family Jockey 2 - Meiba no Kettou (Japan)
-    {.vramHash1 = 0x30702e88, .vramHash2 = 0xcec713f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MUHAMMAD ALI",       }, // Muhammad Ali Heavyweight Boxing (USA, Europe)
-    {.vramHash1 = 0x0260625f, .vramHash2 = 0xcec9672a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JELLY BOY",          }, // Jelly Boy (Europe)
-    {.vramHash1 = 0x727b85a9, .vramHash2 = 0xceed3f49, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-UQJ",            }, // America Oudan Ultra Quiz (Japan)
-    {.vramHash1 = 0x12c6a6e1, .vramHash2 = 0xcef96664, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAKAIMURAGAIDE",     }, // Makai Mura Gaiden - The Demon Darkness (Japan)
-    {.vramHash1 = 0x6dfeb287, .vramHash2 = 0xcf13b402, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES",         }, // DuckTales (USA)
-    {.vramHash1 = 0xfdbc2709, .vramHash2 = 0xcf369377, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIMPSONS 2",         }, // Simpsons, The - Bart vs. the Juggernauts (USA, Europe)
-    {.vramHash1 = 0x4aba1bcc, .vramHash2 = 0xcfad5319, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BO JACKSON",         }, // Bo Jackson - Two Games in One (USA)
-    {.vramHash1 = 0xd0bc56b1, .vramHash2 = 0xcfd2d831, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI 2",              }, // Oni II - Innin Densetsu (Japan)
-    {.vramHash1 = 0xb3212f2e, .vramHash2 = 0xd02ca400, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAVY BLUE",          }, // Kaisen Game - Navy Blue (Japan)
-    {.vramHash1 = 0xd88334a3, .vramHash2 = 0xd03ef286, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE KICK BOXIN",     }, // Kick Boxing, The (Japan)
-    {.vramHash1 = 0xea02bba6, .vramHash2 = 0xd03f057e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SWORD OFHO",     }, // Sword of Hope, The (USA)
-    {.vramHash1 = 0xe874609b, .vramHash2 = 0xd08313dc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGA MAN 2",         }, // Mega Man II (USA)
-    {.vramHash1 = 0x3cd4abf9, .vramHash2 = 0xd0846350, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEKICHU RUSH",       }, // Tekichuu Rush (Japan)
-    {.vramHash1 = 0x170abb20, .vramHash2 = 0xd111ce4f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE RIVER KING",     }, // Legend of the River King GB (USA)
-    {.vramHash1 = 0xf3b34622, .vramHash2 = 0xd13b6c36, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VS BATTLER",         }, // VS Battler (Japan)
-    {.vramHash1 = 0x3c9826d0, .vramHash2 = 0xd13c8c39, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SI SPORTS",          }, // Sports Illustrated - Football & Baseball (USA)
-    {.vramHash1 = 0xcb9acfbc, .vramHash2 = 0xd1423798, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHOBAISHOBAI",       }, // Quiz Sekai wa Show by Shoubai!! (Japan)
-    {.vramHash1 = 0x430035df, .vramHash2 = 0xd150ffd1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAX",                }, // Max (Europe)
-    {.vramHash1 = 0x04fa7613, .vramHash2 = 0xd1621798, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOXXLE2",            }, // Boxxle II (USA, Europe)
-    {.vramHash1 = 0xdea18375, .vramHash2 = 0xd16c4259, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KINGDOM CRUSAD",     }, // Kingdom Crusade (USA)
-    {.vramHash1 = 0xc1c8a954, .vramHash2 = 0xd18a3512, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL WORLD",         }, // Cool World (USA, Europe)
-    {.vramHash1 = 0x674b3c37, .vramHash2 = 0xd1a1684f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMNT3",              }, // Teenage Mutant Ninja Turtles 3 - Turtles Kikiippatsu (Japan), Teenage Mutant Ninja Turtles III - Radical Rescue (USA)
-    {.vramHash1 = 0xad9b1df4, .vramHash2 = 0xd1a77637, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RIDDICK BOWE",       }, // Riddick Bowe Boxing (Europe)
-    {.vramHash1 = 0x830c99d5, .vramHash2 = 0xd1c8a2ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MANSELL",            }, // Nigel Mansell's World Championship (USA)
-    {.vramHash1 = 0x774dcf2a, .vramHash2 = 0xd205f596, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MERCENARY FORC",     }, // Mercenary Force (USA, Europe)
-    {.vramHash1 = 0x16cd02bc, .vramHash2 = 0xd20fa691, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISLOT KIDS",     }, // Pachi-Slot Kids (Japan)
-    {.vramHash1 = 0x4ec13550, .vramHash2 = 0xd24d3e7f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BERUTOMOKURABU",     }, // Nikkan Berutomo Club (Japan)
-    {.vramHash1 = 0xbcbbe004, .vramHash2 = 0xd26d17f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLEBOBBLEJR",     }, // Bubble Bobble Junior (Japan)
-    {.vramHash1 = 0xcfe20ae4, .vramHash2 = 0xd27e60d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JINSEI",             }, // Jinsei Game Densetsu (Japan)
-    {.vramHash1 = 0x39d2c97a, .vramHash2 = 0xd2aac65c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLOMON'S CLUB",     }, // Solomon's Club (USA)
-    {.vramHash1 = 0x39d2c9b7, .vramHash2 = 0xd2aad704, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLOMON'S CLUB",     }, // Solomon's Club (Europe)
-    {.vramHash1 = 0xa538ed5f, .vramHash2 = 0xd31110eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIG DUG",            }, // Dig Dug (Europe)
-    {.vramHash1 = 0xa538ed63, .vramHash2 = 0xd31111cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIG DUG",            }, // Dig Dug (USA)
-    {.vramHash1 = 0x9d8b8dd7, .vramHash2 = 0xd3385375, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENJIN KAISEN ",     }, // Yomihon Yumegoyomi - Tenjin Kaisen 2 (Japan)
-    {.vramHash1 = 0xe0038000, .vramHash2 = 0xd357c000, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTETSU JR.",      }, // Momotarou Dentetsu jr. - Zenkoku Ramen Meguri no Maki (Japan)
-    {.vramHash1 = 0xabeffe2f, .vramHash2 = 0xd3888501, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENSAN2",            }, // Daiku no Gen-san - Robot Teikoku no Yabou (Japan)
-    {.vramHash1 = 0x99e568d0, .vramHash2 = 0xd38d7b56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PURIKURA POCKE",     }, // Purikura Pocket - Fukanzen Joshikousei Manual (Japan)
-    {.vramHash1 = 0x4f3acb9b, .vramHash2 = 0xd3d92cbf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MATTHIAS SAMME",     }, // Matthias Sammer Soccer (Germany)
-    {.vramHash1 = 0x37925ae4, .vramHash2 = 0xd3df7091, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COLLECTION POC",     }, // Collection Pocket (Japan)
-    {.vramHash1 = 0x6d3adec9, .vramHash2 = 0xd3ece96a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SWORD OF HOPE ",     }, // Sword of Hope II, The (USA)
-    {.vramHash1 = 0xade74511, .vramHash2 = 0xd43227a1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE JETSONS",        }, // Jetsons, The - Robot Panic (USA, Europe)
-    {.vramHash1 = 0x977f3578, .vramHash2 = 0xd43b17c0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CJYUKUGO 350",       }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Chuugaku Eijukugo 350 (Japan)
-    {.vramHash1 = 0xb6c13df5, .vramHash2 = 0xd4fbfa70, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROAD RASH",          }, // Road Rash (USA, Europe) (Beta), Road Rash (USA, Europe)
-    {.vramHash1 = 0x5847aba7, .vramHash2 = 0xd51123d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR TREK",          }, // Star Trek - The Next Generation (USA, Europe)
-    {.vramHash1 = 0x98cf9132, .vramHash2 = 0xd5ad99c5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRACURA2",           }, // Dracula Densetsu II (Japan)
-    {.vramHash1 = 0xcea66cfd, .vramHash2 = 0xd5b6c797, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Y NOAH TENNIS",      }, // Yannick Noah Tennis (France)
-    {.vramHash1 = 0x08dc4e6c, .vramHash2 = 0xd623a8f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PERSONAL ORGAN",     }, // InfoGenius Productivity Pak - Personal Organizer and Phone Book (USA)
-    {.vramHash1 = 0x1f8d6782, .vramHash2 = 0xd65f1e29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VEEDIOTS",           }, // Ren & Stimpy Show, The - Veediots! (USA, Europe)
-    {.vramHash1 = 0x9b1492dc, .vramHash2 = 0xd6771e19, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KINTARO ACG",        }, // Masakari Densetsu - Kintarou Action Hen (Japan)
-    {.vramHash1 = 0xb36d4710, .vramHash2 = 0xd6afa6de, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KAWANUSHI3    ",     }, // Kawa no Nushi Tsuri 3 (Japan)
-    {.vramHash1 = 0x31ee16a6, .vramHash2 = 0xd6f21028, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORAEMONDX10",       }, // Doraemon no Game Boy de Asobouyo Deluxe 10 (Japan)
-    {.vramHash1 = 0x37fcf4ca, .vramHash2 = 0xd72b94c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MCDONALDLAND",       }, // McDonaldland (Europe)
-    {.vramHash1 = 0x33b6d0d2, .vramHash2 = 0xd72ca0b6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROLAN'S CURSE ",     }, // Rolan's Curse II (USA)
-    {.vramHash1 = 0x283fb1e9, .vramHash2 = 0xd760da1c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEEN JEOPARDY!",     }, // Jeopardy! - Teen Tournament (USA)
-    {.vramHash1 = 0x48b17536, .vramHash2 = 0xd78aafdd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AFTER BURST",        }, // After Burst (Japan)
-    {.vramHash1 = 0x4f9d0687, .vramHash2 = 0xd7ab827c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAIN DRAIN",        }, // Brain Drain (Europe)
-    {.vramHash1 = 0x20f7ac1a, .vramHash2 = 0xd7c31c04, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWF SUPERSTARS",     }, // WWF Superstars (Japan)
-    {.vramHash1 = 0x0d92e1e1, .vramHash2 = 0xd7ded45d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MASTER KARATEK",     }, // Master Karateka (Japan)
-    {.vramHash1 = 0xea20b333, .vramHash2 = 0xd7f00afd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DOUBLEYAKUMAN2",     }, // Double Yakuman II (Japan)
-    {.vramHash1 = 0xe7a835f6, .vramHash2 = 0xd7f04443, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris SET",         }, // Mani 4 in 1 (China) (DMG-601 CHN)
-    {.vramHash1 = 0x6cf177be, .vramHash2 = 0xd80cc32d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Trump Boy 2",        }, // Trump Boy II (Japan)
-    {.vramHash1 = 0x5a3366b3, .vramHash2 = 0xd831169e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DODGEDANPEI   ",     }, // Honoo no Toukyuuji - Dodge Danpei (Japan)
-    {.vramHash1 = 0xc1e3cbe9, .vramHash2 = 0xd8a1b56f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "X",                  }, // X (Japan)
-    {.vramHash1 = 0xc1bb65de, .vramHash2 = 0xd8a3c69f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTETU",           }, // Super Momotarou Dentetsu (Japan)
-    {.vramHash1 = 0xfc76e71b, .vramHash2 = 0xd8eb1888, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OUT BURST",          }, // Outburst (Japan)
-    {.vramHash1 = 0x445da6c6, .vramHash2 = 0xd94bc100, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY MOUSE",       }, // Mickey Mouse (Europe)
-    {.vramHash1 = 0x686104ea, .vramHash2 = 0xd956a443, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mortal Combat",      }, // Mortal Kombat (Japan), Mortal Kombat (USA, Europe)
-    {.vramHash1 = 0xb739864b, .vramHash2 = 0xd958dfeb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMGMOGUMOGUGOM",     }, // Mogu Mogu Gombo (Japan)
-    {.vramHash1 = 0x0ce54b67, .vramHash2 = 0xd99dd5e7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QBILLION",           }, // Q Billion (USA)
-    {.vramHash1 = 0x4b5c9da9, .vramHash2 = 0xd9c8e39f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SANRIO CARNIVA",     }, // Sanrio Carnival 2 (Japan)
-    {.vramHash1 = 0xb50fe5fb, .vramHash2 = 0xd9cb5699, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEW CHESSMASTE",     }, // New Chessmaster, The (USA, Europe)
-    {.vramHash1 = 0x59b1dddc, .vramHash2 = 0xda021cb2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL SPOT",          }, // Cool Spot (USA)
-    {.vramHash1 = 0x69d590e9, .vramHash2 = 0xda3d4db0, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOGURANYA",          }, // Mole Mania (USA, Europe)
-    {.vramHash1 = 0x6131f904, .vramHash2 = 0xda8a33b2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GURANDERMUSASH",     }, // Grander Musashi RV (Japan)
-    {.vramHash1 = 0xfc4b9281, .vramHash2 = 0xdb15714c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RENTAIOU",           }, // Rentaiou (Japan)
-    {.vramHash1 = 0xb13f36b1, .vramHash2 = 0xdb5e4d9a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mortal Combat II",   }, // Mortal Kombat II (USA, Europe), Mortal Kombat II - Kyuukyoku Shinken (Japan)
-    {.vramHash1 = 0x541d09d7, .vramHash2 = 0xdb7bd913, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TERMINATOR 2 T",     }, // T2 - The Arcade Game (Japan), T2 - The Arcade Game (USA, Europe)
-    {.vramHash1 = 0x8eeb32cf, .vramHash2 = 0xdbda424d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SDSENGOKUDEN3",      }, // SD Sengokuden 3 - Chijou Saikyou Hen (Japan)
-    {.vramHash1 = 0x3059f474, .vramHash2 = 0xdbf3eb81, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRIPRI",             }, // Pri Pri - Primitive Princess! (Japan)
-    {.vramHash1 = 0x15a405c8, .vramHash2 = 0xdbfc1506, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WIZARDS WARRIO",     }, // Wizards & Warriors Chapter X - The Fortress of Fear (USA, Europe)
-    {.vramHash1 = 0x6fed33e7, .vramHash2 = 0xdc37615a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHAQ FU",            }, // Shaq Fu (USA)
-    {.vramHash1 = 0xad8d1936, .vramHash2 = 0xdc7e1c82, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MS.PAC-MAN",         }, // Ms. Pac-Man (Europe), Ms. Pac-Man (USA)
-    {.vramHash1 = 0xe2082b43, .vramHash2 = 0xdc83108e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOLO2",              }, // Adventures of Lolo (Europe)
-    {.vramHash1 = 0x7103dd6d, .vramHash2 = 0xdcd10170, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKMAN WORLD",      }, // Rockman World (Japan)
-    {.vramHash1 = 0x56f84be9, .vramHash2 = 0xdcd4fdc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ar",                 }, // GameShark (USA)
-    {.vramHash1 = 0xc89f05fd, .vramHash2 = 0xdd273589, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRIP WORLD",         }, // Trip World (Europe), Trip World (Japan)
-    {.vramHash1 = 0x16150dcd, .vramHash2 = 0xdd86ba50, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOUKENJIMA2",        }, // Takahashi Meijin no Bouken-jima II (Japan)
-    {.vramHash1 = 0x0e65cbcd, .vramHash2 = 0xddacdf56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GEMGEM",             }, // Gem Gem (Japan)
-    {.vramHash1 = 0x62dad1a4, .vramHash2 = 0xddec1a90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris",             }, // Tetris (World) (Rev A)
-    {.vramHash1 = 0xcb3dd788, .vramHash2 = 0xde0bf323, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = " ROCKMAN WORLD",     }, // Rockman World 2 (Japan)
-    {.vramHash1 = 0xf24eb67c, .vramHash2 = 0xde3ccdd2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DEADHEATSCRAMB",     }, // Dead Heat Scramble (USA)
-    {.vramHash1 = 0x864ecdc6, .vramHash2 = 0xdf142bb0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TSUMEGO 01",         }, // Ishida Yoshio Tsumego Paradise (Japan)
-    {.vramHash1 = 0x4a997d84, .vramHash2 = 0xdf1d37ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPOT",               }, // Spot (Europe)
-    {.vramHash1 = 0x7084c68f, .vramHash2 = 0xe005002f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAVY BLUE 98",       }, // Navy Blue 98 (Japan)
-    {.vramHash1 = 0x96f0b010, .vramHash2 = 0xe01a884c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMHT BACK FROM",     }, // Teenage Mutant Hero Turtles II - Back from the Sewers (Europe)
-    {.vramHash1 = 0x6800bc00, .vramHash2 = 0xe0235e00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANOTHER BIBLE ",     }, // Another Bible (Japan)
-    {.vramHash1 = 0x44f8e739, .vramHash2 = 0xe052471b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EIKEN2KYUEIKAI",     }, // Goukaku Boy Series - Eiken 2kyuu Level no Kaiwa Hyougen 333 (Japan)
-    {.vramHash1 = 0x04224979, .vramHash2 = 0xe0563a6c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AKAZUKIN-CHACH",     }, // Akazukin Chacha (Japan)
-    {.vramHash1 = 0xb6f8d44f, .vramHash2 = 0xe05a4e7f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WINNING GOAL",       }, // J.League Winning Goal (Japan)
-    {.vramHash1 = 0x68011800, .vramHash2 = 0xe0db8c00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAKUMAN",            }, // Yakuman (Japan) (Rev A), Yakuman (Japan)
-    {.vramHash1 = 0xbe4bbb7b, .vramHash2 = 0xe1159504, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAY THUNDER",        }, // Ray-Thunder (Japan)
-    {.vramHash1 = 0xe0f2ec0d, .vramHash2 = 0xe144b9b0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALAGA&GALAXIA",     }, // Galaga & Galaxian (Japan)
-    {.vramHash1 = 0x788c8638, .vramHash2 = 0xe18f973e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIKI RACE GB",      }, // Chiki Chiki Machine Mou Race (Japan)
-    {.vramHash1 = 0x2b03a9a5, .vramHash2 = 0xe19e008c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGALIT",            }, // Megalit (Japan)
-    {.vramHash1 = 0x74c2aa7b, .vramHash2 = 0xe1ae1f96, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SWORD OFHO",     }, // Sword of Hope, The (Spain)
-    {.vramHash1 = 0xb0460f53, .vramHash2 = 0xe1b1971a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FUNPAK 4IN1 - ",     }, // 4-in-1 Fun Pak Volume II (USA, Europe)
-    {.vramHash1 = 0xcf10c026, .vramHash2 = 0xe2357776, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLITAIRE FUNP",     }, // Solitaire FunPak (USA, Europe)
-    {.vramHash1 = 0xc3b849c6, .vramHash2 = 0xe28dba00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE INDIAN",      }, // Indien dans la Ville, Un (France)
-    {.vramHash1 = 0x7b14f063, .vramHash2 = 0xe29474d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GHOSTBUSTERS 2",     }, // Ghostbusters II (Japan)
-    {.vramHash1 = 0x28333061, .vramHash2 = 0xe2b40ca6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SERPENT",            }, // Serpent (USA)
-    {.vramHash1 = 0x035174ea, .vramHash2 = 0xe2c8068b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VOLLEY FIRE",        }, // Volley Fire (Japan)
-    {.vramHash1 = 0xc0f2f312, .vramHash2 = 0xe30ae1d7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POP UP",             }, // Pop Up (Europe)
-    {.vramHash1 = 0x55b18a2a, .vramHash2 = 0xe366f7b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Q*BERT II",          }, // Q-bert for Game Boy (Japan), Q-bert for Game Boy (USA, Europe)
-    {.vramHash1 = 0x3d32fbeb, .vramHash2 = 0xe387ebdb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JUNGLE BOOK",        }, // Jungle Book, The (USA, Europe)
-    {.vramHash1 = 0x401d5500, .vramHash2 = 0xe3a3c96c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TURRICAN",           }, // Turrican (USA, Europe)
-    {.vramHash1 = 0x7ce34c03, .vramHash2 = 0xe3d0d2a8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER CHINESE ",     }, // Super Chinese Land 3 (Japan)
-    {.vramHash1 = 0xd077f3bf, .vramHash2 = 0xe421f221, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ABYSS NO TOU",       }, // Chachamaru Boukenki 3 - Abyss no Tou (Japan)
-    {.vramHash1 = 0x13a148e2, .vramHash2 = 0xe4b8b6e5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET DENSYA",      }, // Pocket Densha (Japan)
-    {.vramHash1 = 0x1b8ed415, .vramHash2 = 0xe4db3119, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLOMON'S CLUB",     }, // Solomon's Club (Japan)
-    {.vramHash1 = 0xa63626a6, .vramHash2 = 0xe4ec680f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CYRAID",             }, // Cyraid (USA)
-    {.vramHash1 = 0x69decc47, .vramHash2 = 0xe4eead0c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATMAN ROJ",         }, // Batman - Return of the Joker (Japan), Batman - Return of the Joker (USA, Europe)
-    {.vramHash1 = 0xe6a9712b, .vramHash2 = 0xe50c975b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBERMAN GB",       }, // Bomber Man GB (Japan)
-    {.vramHash1 = 0x9c0962be, .vramHash2 = 0xe56b3fb0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JANKENMAN",          }, // Jankenman (Japan)
-    {.vramHash1 = 0xfcd40ea1, .vramHash2 = 0xe5d32245, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FOOTBALL INT'L",     }, // Football International (Europe)
-    {.vramHash1 = 0x6a443e27, .vramHash2 = 0xe5e99742, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB GARMS 1",         }, // SD Command Gundam - G-Arms (Japan)
-    {.vramHash1 = 0x408c7343, .vramHash2 = 0xe5ee0c0d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "S S BASKET BAL",     }, // Super Street Basketball 2 (Japan)
-    {.vramHash1 = 0xc299b627, .vramHash2 = 0xe61e8442, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA2",              }, // Final Fantasy Legend II (USA)
-    {.vramHash1 = 0x84a348d2, .vramHash2 = 0xe63a5a95, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TURN AND BURN",      }, // Turn and Burn (USA)
-    {.vramHash1 = 0xccd35c60, .vramHash2 = 0xe6bd529d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMILYJOCKEY",       }, // Family Jockey (Japan)
-    {.vramHash1 = 0x0a0bfd38, .vramHash2 = 0xe6f6f1e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARUKODXSIATA",      }, // Chibi Maruko-chan - Maruko Deluxe Theater (Japan)
-    {.vramHash1 = 0x17a341c7, .vramHash2 = 0xe73b9adb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE RIVER KING",     }, // Legend of the River King GB (Australia)
-    {.vramHash1 = 0xa45cf6de, .vramHash2 = 0xe7c0e1e6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD BOWLING",      }, // World Bowling (Japan)
-    {.vramHash1 = 0xeec964da, .vramHash2 = 0xe7e21ae4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIBIMARUKO3",       }, // Chibi Maruko-chan 3 - Mezase! Game Taishou no Maki (Japan)
-    {.vramHash1 = 0x97ab01ac, .vramHash2 = 0xe89b6bbd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WAYNE'S WORLD",      }, // Wayne's World (USA)
-    {.vramHash1 = 0x4f6b3792, .vramHash2 = 0xe8e64e8a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TATSUJINTECHO",      }, // Bass Fishing Tatsujin Techou (Japan)
-    {.vramHash1 = 0xf409fd7d, .vramHash2 = 0xe8f12a80, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JEOPARDY SPORT",     }, // Jeopardy! - Sports Edition (USA)
-    {.vramHash1 = 0x5f7d179f, .vramHash2 = 0xe8f7afc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB MASKRIDER S",     }, // Kamen Rider SD - Hashire! Mighty Riders (Japan)
-    {.vramHash1 = 0x600f46e4, .vramHash2 = 0xe9155ac1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAPTAIN AMERIC",     }, // Captain America and the Avengers (USA)
-    {.vramHash1 = 0x07bbfcce, .vramHash2 = 0xe9f634f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHINKO GENSA",     }, // Pachinko CR Daiku no Gen-san GB (Japan)
-    {.vramHash1 = 0x4e667720, .vramHash2 = 0xea94427a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI 3",              }, // Oni III - Kuro no Hakaishin (Japan)
-    {.vramHash1 = 0x189099b3, .vramHash2 = 0xeaa05cca, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SELECTION 1&2",      }, // Selection I & II (Japan)
-    {.vramHash1 = 0x9c3bebcb, .vramHash2 = 0xead6b05c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OLYMPUS",            }, // Battle of Olympus, The (Europe) (En,Fr,De,Es,It)
-    {.vramHash1 = 0x2a3324ad, .vramHash2 = 0xeaeaaa89, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARTSCOLLECTIO",     }, // Medarot - Parts Collection 2 (Japan)
-    {.vramHash1 = 0x86fe5d97, .vramHash2 = 0xeb083c6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "XERD!!",             }, // Zerd no Densetsu 2 - Xerd!! Gishin no Ryouiki (Japan)
-    {.vramHash1 = 0xe2606508, .vramHash2 = 0xeb0cb939, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPY VS SPY",         }, // Spy vs Spy - Operation Boobytrap (USA)
-    {.vramHash1 = 0x7b4e62e8, .vramHash2 = 0xeb444b5c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB LACROANHERO",     }, // SD Gundam Gaiden - Lacroan' Heroes (Japan)
-    {.vramHash1 = 0x8938170b, .vramHash2 = 0xeb62f04d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CRASH DUMMIES",      }, // Incredible Crash Dummies, The (USA, Europe)
-    {.vramHash1 = 0x3e8cd8f9, .vramHash2 = 0xebb27372, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EXCHANGER GB",       }, // Money Idol Exchanger (Japan)
-    {.vramHash1 = 0xd74d05c1, .vramHash2 = 0xec538645, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAIL GATOR",         }, // Tail 'Gator (USA, Europe)
-    {.vramHash1 = 0xafa75779, .vramHash2 = 0xec6ad1ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LETHAL WEAPON",      }, // Lethal Weapon (USA, Europe)
-    {.vramHash1 = 0xba31df74, .vramHash2 = 0xec76109d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB IRON LEAGUE",     }, // Shippuu! Iron Leaguer (Japan)
-    {.vramHash1 = 0x2550dab2, .vramHash2 = 0xec7923dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SELECTION 2",        }, // Selection II - Ankoku no Fuuin (Japan)
-    {.vramHash1 = 0x7e9bbfc8, .vramHash2 = 0xec9fc5ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRA GOLF",         }, // Ultra Golf (USA)
-    {.vramHash1 = 0x59358f2c, .vramHash2 = 0xecbedb0e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SANRIO CARNIVA",     }, // Sanrio Carnival (Japan)
-    {.vramHash1 = 0xc19db03b, .vramHash2 = 0xeccf6ecf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JIKUUSENKI-MU",      }, // Jikuu Senki Mu (Japan)
-    {.vramHash1 = 0xe40234e5, .vramHash2 = 0xed1fcc8f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WARIO BLAST",        }, // Wario Blast featuring Bomberman! (USA, Europe)
-    {.vramHash1 = 0x7b360167, .vramHash2 = 0xed3f96e8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HEIANKYO ALIEN",     }, // Heiankyo Alien (USA), Heiankyou Alien (Japan)
-    {.vramHash1 = 0xfd298ba3, .vramHash2 = 0xed4fb15c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE MERMAID",     }, // Little Mermaid, The (USA)
-    {.vramHash1 = 0xd191f283, .vramHash2 = 0xed5555d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Game Boy Gallery 2", }, // Game Boy Gallery 2 (Australia)
-    {.vramHash1 = 0xd47a8b7b, .vramHash2 = 0xed884aa7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOGIS GOLDRUSH",     }, // Yogi Bear in Yogi Bear's Goldrush (USA)
-    {.vramHash1 = 0x04dd2480, .vramHash2 = 0xedb91dcc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN3",           }, // Mega Man III (USA)
-    {.vramHash1 = 0x04dd2488, .vramHash2 = 0xedb91e26, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN3",           }, // Mega Man III (Europe)
-    {.vramHash1 = 0xaeb3ff8f, .vramHash2 = 0xee5f477c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KITCHIN PANIC",      }, // Kitchen Panic (Japan)
-    {.vramHash1 = 0x9d30efd7, .vramHash2 = 0xee7c183c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRINCE OF PERS",     }, // Prince of Persia (USA)
-    {.vramHash1 = 0x1d3cf92f, .vramHash2 = 0xee8f5554, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KATTOBI ROAD",       }, // Kattobi Road (Japan)
-    {.vramHash1 = 0x052a4e84, .vramHash2 = 0xeeb3786d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISURO WC'9",     }, // Pachi-Slot World Cup '94 (Japan)
-    {.vramHash1 = 0x38a0f135, .vramHash2 = 0xeed56ea8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DYNABLASTER",        }, // Dynablaster (Europe)
-    {.vramHash1 = 0x78400be0, .vramHash2 = 0xeed8dbf0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SLAM DUNK",       }, // From TV Animation Slam Dunk - Gakeppuchi no Kesshou League (Japan)
-    {.vramHash1 = 0xf3379c50, .vramHash2 = 0xeedf2fbe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAFFY DUCK",         }, // Daffy Duck (USA, Europe), Looney Tunes Series - Daffy Duck (Japan)
-    {.vramHash1 = 0x5be7e8f4, .vramHash2 = 0xef308a0c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {{.jumpAddress = 0x0c5a, .fixTarget = 0xffa0, .takenMethod = and, .takenValue = 0xdf, .notTakenMethod = or, .notTakenValue = 0x20}, }, .writeRegistersDuringDMA = {}, .title = "Bonk's Adventure",   }, // Bonk's Adventure (USA)
-    {.vramHash1 = 0x67d5eb3a, .vramHash2 = 0xef42c211, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6-tsu no Kinka (Japan) (Rev 2)
-    {.vramHash1 = 0x713fbb86, .vramHash2 = 0xef5bc196, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUST A MOVE 2 ",     }, // Puzzle Bobble GB (Japan)
-    {.vramHash1 = 0xaeed614e, .vramHash2 = 0xef8601f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KUREYON SHI",     }, // Crayon Shin-chan 4 - Ora no Itazura Daihenshin (Japan)
-    {.vramHash1 = 0xd3d52dc8, .vramHash2 = 0xef979242, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HAYAOSI KUIZU",      }, // Hayaoshi Quiz - Ouza Ketteisen (Japan)
-    {.vramHash1 = 0x6b703160, .vramHash2 = 0xefab6bc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UNIVERSALSOLDI",     }, // Universal Soldier (USA, Europe)
-    {.vramHash1 = 0x6249d956, .vramHash2 = 0xefb76e94, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOOPZ",              }, // Loopz (World)
-    {.vramHash1 = 0x88b8b7ce, .vramHash2 = 0xefcbea81, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORAEMON",           }, // Doraemon - Taiketsu HimitsuDougu!! (Japan)
-    {.vramHash1 = 0xd660d750, .vramHash2 = 0xefed6c60, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB GODZILLA",        }, // Kaijuu Ou Gojira (Japan)
-    {.vramHash1 = 0x0133923a, .vramHash2 = 0xf0157052, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI 4",              }, // Oni IV - Kijin no Ketsuzoku (Japan)
-    {.vramHash1 = 0x2eb3aac7, .vramHash2 = 0xf020dcad, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TARURU-TO 2",     }, // Magical Taruruuto-kun 2 - Raibaa Zone Panic!! (Japan)
-    {.vramHash1 = 0x75002295, .vramHash2 = 0xf03c6201, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWF: WARZONE",       }, // WWF War Zone (USA, Europe)
-    {.vramHash1 = 0x44839841, .vramHash2 = 0xf077a32b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB CULT JUMP",       }, // Cult Jump (Japan)
-    {.vramHash1 = 0x4e2fd7da, .vramHash2 = 0xf07b1396, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUGIOU",             }, // Yu-Gi-Oh! Duel Monsters (Japan)
-    {.vramHash1 = 0x91125c8d, .vramHash2 = 0xf0935694, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPER DUNK",         }, // Hyper Dunk (Europe)
-    {.vramHash1 = 0xf8e6a308, .vramHash2 = 0xf0d44349, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FUNNY FIELD",        }, // Funny Field (Japan)
-    {.vramHash1 = 0x8d166437, .vramHash2 = 0xf13b4f29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR WARS-NOA",      }, // Star Wars (USA, Europe) (Rev A)
-    {.vramHash1 = 0xe64eac6b, .vramHash2 = 0xf17c4185, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB MUSASHIROAD",     }, // Karakuri Kengou Den Musashi Lord (Japan)
-    {.vramHash1 = 0xb375915c, .vramHash2 = 0xf1daef23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GODZILLA",           }, // Gojira-kun (Japan)
-    {.vramHash1 = 0x1ceb3a9c, .vramHash2 = 0xf1e62a63, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHOPLIFTER 2",       }, // Choplifter II - Rescue & Survive (USA)
-    {.vramHash1 = 0xb9317519, .vramHash2 = 0xf1f8afd0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FROGGER",            }, // Frogger (USA)
-    {.vramHash1 = 0x962947bd, .vramHash2 = 0xf2b610cc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GEORGE F. BOXI",     }, // George Foreman's KO Boxing (USA, Europe)
-    {.vramHash1 = 0x97ec779c, .vramHash2 = 0xf31316bf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU SAMURAI",     }, // Nettou Samurai Spirits (Japan) (Rev A), Nettou Samurai Spirits (Japan)
-    {.vramHash1 = 0x815f7dfb, .vramHash2 = 0xf37950a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VIKING CHILD 1",     }, // Prophecy - The Viking Child (Europe) (En,Fr,De,Es,It)
-    {.vramHash1 = 0x0273d66c, .vramHash2 = 0xf3cb6146, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE FLINTSTONE",     }, // Flintstones, The (USA, Europe)
-    {.vramHash1 = 0xd600736a, .vramHash2 = 0xf3ddc8d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Monster Maker 2",    }, // Monster Maker 2 - Uru no Hiken (Japan)
-    {.vramHash1 = 0x0434069d, .vramHash2 = 0xf3de8341, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WIZARDRY SOD",       }, // Wizardry Gaiden 3 - Yami no Seiten (Japan)
-    {.vramHash1 = 0xdff3fe1e, .vramHash2 = 0xf3f2e57e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENERATIONS",        }, // Star Trek Generations - Beyond the Nexus (Europe)
-    {.vramHash1 = 0x03c3f77d, .vramHash2 = 0xf42c65de, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ON THE TILES",       }, // Franky, Joe & Dirk... On the Tiles (Europe) (En,Fr,De,Es,It,Nl)
-    {.vramHash1 = 0x4af60597, .vramHash2 = 0xf48bb2f8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE MERMAID",     }, // Little Mermaid, The (Europe)
-    {.vramHash1 = 0x5f1417d2, .vramHash2 = 0xf48f8ab1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COSMO TANK",         }, // Cosmo Tank (Japan)
-    {.vramHash1 = 0xeadc822e, .vramHash2 = 0xf4c4f7ec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MYSTICAL NINJA",     }, // Mystical Ninja Starring Goemon (Europe), Mystical Ninja Starring Goemon (USA)
-    {.vramHash1 = 0x9f1d0af7, .vramHash2 = 0xf4cc7c6a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAYEARTH1",          }, // Magic Knight Rayearth (Japan)
-    {.vramHash1 = 0xdf63f801, .vramHash2 = 0xf5340400, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRAMAN BALL",      }, // Ultraman Ball (Japan)
-    {.vramHash1 = 0x3beade2f, .vramHash2 = 0xf59d721f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSSY NO TAMAG",     }, // Yoshi no Tamago (Japan)
-    {.vramHash1 = 0xfb8059b0, .vramHash2 = 0xf5ae2aed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JANSHIRO",           }, // Janshirou (Japan)
-    {.vramHash1 = 0xa898cf55, .vramHash2 = 0xf5da39ec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB OTOKOJYUKU ",     }, // Sakigake!! Otoko Juku - Meioutou Kessen (Japan)
-    {.vramHash1 = 0x445b32c4, .vramHash2 = 0xf5e40245, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANKI-TUMESHOG",     }, // Tsumeshougi - Kanki Godan (Japan) (Beta)
-    {.vramHash1 = 0x135a5d81, .vramHash2 = 0xf5f032be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZCHUGAKUEITANG",     }, // Goukaku Boy Series - Z Kai (Reibun de Oboeru) Chuugaku Eitango 1132 (Japan)
-    {.vramHash1 = 0x7b17c09b, .vramHash2 = 0xf5f7061c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZENNICHI JET",       }, // Zen-Nihon Pro Wrestling Jet (Japan)
-    {.vramHash1 = 0x8c2822aa, .vramHash2 = 0xf5f76f45, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES 2",       }, // DuckTales 2 (Japan)
-    {.vramHash1 = 0xa3159545, .vramHash2 = 0xf624bff5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BABY TREX",          }, // Baby T-Rex (Europe)
-    {.vramHash1 = 0x41fb9e63, .vramHash2 = 0xf650f0af, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEGEND",             }, // Legend (Japan)
-    {.vramHash1 = 0x942b3319, .vramHash2 = 0xf67cf3f8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOLO",               }, // Lolo no Daibouken (Japan)
-    {.vramHash1 = 0xa09025cb, .vramHash2 = 0xf67e47df, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Blue",       }, // Pokemon - Blue Version (USA, Europe)
-    {.vramHash1 = 0x412f75ac, .vramHash2 = 0xf68bc73b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GAME&WATCH",         }, // Game Boy Gallery - 5 Games in One (Europe)
-    {.vramHash1 = 0xe7df069a, .vramHash2 = 0xf69d3d18, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBWARST",            }, // Game Boy Wars Turbo - Famitsu Version (Japan)
-    {.vramHash1 = 0xc144bcab, .vramHash2 = 0xf6c2c0ee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HINSYUTU EIBUN",     }, // Goukaku Boy Series - Kirihara Shoten Hinshutsu Eibunpou Gohou Mondai 1000 (Japan)
-    {.vramHash1 = 0xa865b989, .vramHash2 = 0xf6d1d4d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOKIO SENKI",        }, // Tokio Senki - Eiyuu Retsuden (Japan)
-    {.vramHash1 = 0xaa279014, .vramHash2 = 0xf73cf7fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CADILLAC2",          }, // Cadillac II (Japan)
-    {.vramHash1 = 0x50ecc0fe, .vramHash2 = 0xf790d43b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FERRARI G-PRIX",     }, // Ferrari (Japan)
-    {.vramHash1 = 0x8fd4488e, .vramHash2 = 0xf7d3fab0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERWWF",           }, // WWF Superstars 2 (Japan), WWF Superstars 2 (USA, Europe)
-    {.vramHash1 = 0xd1c0dedd, .vramHash2 = 0xf816af0d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG FOOTBALL",       }, // Play Action Football (USA)
-    {.vramHash1 = 0xe6a1256d, .vramHash2 = 0xf829d741, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-MAN",            }, // Pac-Man (USA)
-    {.vramHash1 = 0x8b2feedd, .vramHash2 = 0xf84108e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ISHIDO USA VER",     }, // Ishido - The Way of Stones (USA)
-    {.vramHash1 = 0x76670844, .vramHash2 = 0xf88f6ced, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SWORD OFHO",     }, // Sword of Hope, The (Germany)
-    {.vramHash1 = 0xd3c0b963, .vramHash2 = 0xf8f19043, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SANGOKUSHI",         }, // Sangokushi - Game Boy Ban (Japan)
-    {.vramHash1 = 0xb772428b, .vramHash2 = 0xf9303d37, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ARETHA2",            }, // Aretha II (Japan)
-    {.vramHash1 = 0x0f563e18, .vramHash2 = 0xf93edff6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KILLER TOMATOE",     }, // Attack of the Killer Tomatoes (Japan)
-    {.vramHash1 = 0xe304ca7d, .vramHash2 = 0xf9afca79, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JEEP JAMBOREE",      }, // Jeep Jamboree (USA)
-    {.vramHash1 = 0xed158d85, .vramHash2 = 0xf9c523a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "IREM FIGHTER",       }, // Shuyaku Sentai Irem Fighter (Japan)
-    {.vramHash1 = 0xc926b969, .vramHash2 = 0xfa00d6da, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUZZLE ROAD",        }, // Bouken! Puzzle Road (Japan)
-    {.vramHash1 = 0x7b231841, .vramHash2 = 0xfa155033, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINY TOON 2",        }, // Tiny Toon Adventures 2 (Japan)
-    {.vramHash1 = 0x5f925a45, .vramHash2 = 0xfa6c6ac7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EXTRA BASES!",       }, // Extra Bases! (USA)
-    {.vramHash1 = 0x59b76840, .vramHash2 = 0xfa90e40d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANKI-TUMESHOG",     }, // Tsumeshougi - Kanki Godan (Japan)
-    {.vramHash1 = 0x8e639fef, .vramHash2 = 0xfaf20aa1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR TREK",          }, // Star Trek - The Next Generation (Germany), Star Trek - The Next Generation (Spain)
-    {.vramHash1 = 0x1544118b, .vramHash2 = 0xfb4891e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUI S BBB4",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Sansuu Battle Hen (Japan) (Special Edition)
-    {.vramHash1 = 0x42c367f9, .vramHash2 = 0xfb6093e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRA2",             }, // America Oudan Ultra Quiz Part 2 (Japan)
-    {.vramHash1 = 0x96f39f1e, .vramHash2 = 0xfb85f549, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NANONOTE",           }, // Nanonote (Japan)
-    {.vramHash1 = 0x844e51fe, .vramHash2 = 0xfb8ea2b9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEACH,VOLLEYBA",     }, // Malibu Beach Volleyball (USA)
-    {.vramHash1 = 0x10429394, .vramHash2 = 0xfb9e63fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PURIKURA POCKE",     }, // Purikura Pocket 2 - Kareshi Kaizou Daisakusen (Japan)
-    {.vramHash1 = 0x2906eb74, .vramHash2 = 0xfbf13c0b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBCOLLECTION 4",     }, // Konami GB Collection Vol.4 (Japan)
-    {.vramHash1 = 0x91bccf9a, .vramHash2 = 0xfc01726e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOCCER",             }, // Soccer (Japan)
-    {.vramHash1 = 0x485d757e, .vramHash2 = 0xfc131af2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIWAME-GB",          }, // Pro Mahjong Kiwame GB (Japan)
-    {.vramHash1 = 0x508c9175, .vramHash2 = 0xfc28f1ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEMMINGS",           }, // Lemmings (Japan)
-    {.vramHash1 = 0xfba74f1f, .vramHash2 = 0xfc51a3d5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CENTIPEDE",          }, // Centipede (USA, Europe)
-    {.vramHash1 = 0x718305f9, .vramHash2 = 0xfc6256a2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STARHAWK",           }, // Star Hawk (Europe)
-    {.vramHash1 = 0x2118b876, .vramHash2 = 0xfca35a08, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAHJONGYOSHIMO",     }, // Nichibutsu Mahjong - Yoshimoto Gekijou (Japan)
-    {.vramHash1 = 0x656f0c5d, .vramHash2 = 0xfd11428d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN",            }, // Mega Man - Dr. Wily's Revenge (Europe)
-    {.vramHash1 = 0x1b5acbd3, .vramHash2 = 0xfdafe8a2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TSUMESHOUGI",        }, // Tsumeshougi - Mondai Teikyou Shougi Sekai (Japan)
-    {.vramHash1 = 0x87518ed5, .vramHash2 = 0xfdd3856d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRACK MEET",         }, // Litti's Summer Sports (Germany)
-    {.vramHash1 = 0xa2ce601e, .vramHash2 = 0xfdd98469, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUUYUU-1",           }, // Yu Yu Hakusho (Japan)
-    {.vramHash1 = 0x38d9ec72, .vramHash2 = 0xff0a713e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OBELIX",             }, // Asterix & Obelix (Europe) (En,Es)
-    {.vramHash1 = 0xe60d832d, .vramHash2 = 0xff30e20e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BLUES BROTHERS",     }, // Blues Brothers, The (USA, Europe)
-    {.vramHash1 = 0x97730a2d, .vramHash2 = 0xff371d07, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris PLUS",        }, // Tetris Plus (Japan), Tetris Plus (USA, Europe)
-    {.vramHash1 = 0xdf2792c0, .vramHash2 = 0xff37d653, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB UNDOUKAI",        }, // Downtown - Nekketsu Koushinkyoku - Dokodemo Daiundoukai (Japan)
-    {.vramHash1 = 0x79ad4a76, .vramHash2 = 0xff53deff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUGS COLLECTIO",     }, // Bugs Bunny Collection (Japan) (Rev A), Bugs Bunny Collection (Japan)
-    {.vramHash1 = 0xfdd27b70, .vramHash2 = 0xff568593, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THEGAMEOFHARMO",     }, // Game of Harmony, The (USA)
-    {.vramHash1 = 0xa8f91961, .vramHash2 = 0xff9ea01c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISLOT JR 0",     }, // GB Pachi-Slot Hisshouhou! Jr (Japan)
-    {.vramHash1 = 0x09ab898a, .vramHash2 = 0xffa349b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KINGOFTHEZOO",       }, // King of the Zoo (Europe)
-    {.vramHash1 = 0xe06debfe, .vramHash2 = 0xffa757e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PERSONAL ORGAN",     }, // InfoGenius Systems - Personal Organizer with Phone Book (Europe)
-    {.vramHash1 = 0x98bf45f0, .vramHash2 = 0xffb1ba64, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES 2",       }, // DuckTales 2 (USA)
+    {.vramHash1 = 0xbb016582, .vramHash2 = 0x00174aa3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLEBOBBLE2",      }, // Bubble Bobble Part 2 (USA, Europe)
+    {.vramHash1 = 0xa73564ac, .vramHash2 = 0x006734f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOIHOI DMG BAN",     }, // Hoi Hoi - Game Boy Ban (Japan)
+    {.vramHash1 = 0xad2efabf, .vramHash2 = 0x00ee7098, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GODZILLA",           }, // Godzilla (USA, Europe)
+    {.vramHash1 = 0x4d5fe1f9, .vramHash2 = 0x00f70c2c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KYORCHANLANDHI",     }, // Kyoro-chan Land (Japan)
+    {.vramHash1 = 0x7a2466fc, .vramHash2 = 0x015f6283, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Blue",       }, // Pocket Monsters - Ao (Japan)
+    {.vramHash1 = 0x57a10f1f, .vramHash2 = 0x017816f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SAILORMOON ",     }, // Bishoujo Senshi Sailor Moon R (Japan)
+    {.vramHash1 = 0xf4733db7, .vramHash2 = 0x019d7f63, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mystic Quest",       }, // Mystic Quest (France)
+    {.vramHash1 = 0xd7f9cb34, .vramHash2 = 0x01c8ee2c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL MANIA",      }, // Pinball Mania (Europe)
+    {.vramHash1 = 0x1725d07f, .vramHash2 = 0x02cf332a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROBIN HOOD",         }, // Robin Hood - Prince of Thieves (Europe), Robin Hood - Prince of Thieves (France), Robin Hood - Prince of Thieves (Germany), Robin Hood - Prince of Thieves (Spain), Robin Hood - Prince of Thieves (USA)
+    {.vramHash1 = 0x9fca15fa, .vramHash2 = 0x0317eded, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WARRIOR",            }, // Bakuretsu Senshi Warrior (Japan)
+    {.vramHash1 = 0x30addbea, .vramHash2 = 0x03212415, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VATTLE GIUCE",       }, // Vattle Giuce (Japan)
+    {.vramHash1 = 0x580a69f4, .vramHash2 = 0x033df3ee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONCHU HAKASE",      }, // Konchuu Hakase (Japan) (Rev A), Konchuu Hakase (Japan)
+    {.vramHash1 = 0xae2e6bda, .vramHash2 = 0x03591025, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DISNEYS MULAN",      }, // Mulan (USA, Europe)
+    {.vramHash1 = 0x6a31adfd, .vramHash2 = 0x03652bf1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAST BIBLE2",        }, // Megami Tensei Gaiden - Last Bible II (Japan)
+    {.vramHash1 = 0x24962fc5, .vramHash2 = 0x0372d4ef, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB DRUAGA 1",        }, // Druaga no Tou (Japan)
+    {.vramHash1 = 0x91eab4a0, .vramHash2 = 0x037441d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BASS POCKET 2",      }, // Super Black Bass Pocket 2 (Japan)
+    {.vramHash1 = 0xa91da2e7, .vramHash2 = 0x0378dcb4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE CHESSMASTE",     }, // Chessmaster, The (DMG-EM) (Europe)
+    {.vramHash1 = 0x0aba6190, .vramHash2 = 0x03a473e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAPERBOY 2",         }, // Paperboy 2 (USA, Europe)
+    {.vramHash1 = 0x543cfdc1, .vramHash2 = 0x03d342ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EITANGO SENTA",      }, // Goukaku Boy Series - 99 Nendo Ban Eitango Center 1500 (Japan)
+    {.vramHash1 = 0x44032954, .vramHash2 = 0x03e89e8d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIMPSON ESCAPE",     }, // Bart Simpson's Escape from Camp Deadly (USA, Europe), Bart no Survival Camp (Japan)
+    {.vramHash1 = 0x68c44806, .vramHash2 = 0x03f36702, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPY VS SPY",         }, // Spy vs Spy - Operation Boobytrap (Europe)
+    {.vramHash1 = 0x4796c727, .vramHash2 = 0x03f4c476, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOUKONSANJYUUS",     }, // Shin Nihon Pro Wrestling - Toukon Sanjuushi (Japan)
+    {.vramHash1 = 0x52209df5, .vramHash2 = 0x041127aa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOGU MOGU Q",        }, // Oyatsu Quiz Mogu Mogu Q (Japan)
+    {.vramHash1 = 0xb36e8c9d, .vramHash2 = 0x045657ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TWIN",               }, // Twin (Japan)
+    {.vramHash1 = 0xd4a22717, .vramHash2 = 0x0456bf4f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ACE STRIKER",        }, // Takeda Nobuhiro no Ace Striker (Japan)
+    {.vramHash1 = 0xb76050cd, .vramHash2 = 0x0477c5ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWFKOR",             }, // WWF King of the Ring (Japan)
+    {.vramHash1 = 0x99624616, .vramHash2 = 0x04aa67b6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOD MEDICINE F",     }, // God Medicine - Fukkokuban (Japan)
+    {.vramHash1 = 0x522fa5e1, .vramHash2 = 0x04ac02ec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUGSCRAZYCASTL",     }, // Bugs Bunny Crazy Castle 2, The (USA)
+    {.vramHash1 = 0x41d0b700, .vramHash2 = 0x04ce9222, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANIMAL BREEDER",     }, // Animal Breeder (Japan)
+    {.vramHash1 = 0x4345f295, .vramHash2 = 0x04d86798, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Donkey Kong Land 2", }, // Donkey Kong Land 2 (USA, Europe)
+    {.vramHash1 = 0xa15fc834, .vramHash2 = 0x04eb6502, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR WARS",          }, // Star Wars (Europe)
+    {.vramHash1 = 0x62fa9fc3, .vramHash2 = 0x057b8142, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAESARS PALACE",     }, // Caesars Palace (USA)
+    {.vramHash1 = 0x9728e4e7, .vramHash2 = 0x05869223, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKEMON YELLOW",     }, // Pocket Monsters - Pikachu (Japan) (Rev 1), Pocket Monsters - Pikachu (Japan) (Rev 2), Pocket Monsters - Pikachu (Japan) (Rev 3), Pocket Monsters - Pikachu (Japan)
+    {.vramHash1 = 0xcdeb73f9, .vramHash2 = 0x059b4758, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENGUINKUNWARS",     }, // Penguin-kun Wars VS. (Japan)
+    {.vramHash1 = 0x252641c7, .vramHash2 = 0x06b500d3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEKOJARA",           }, // Nekojara Monogatari (Japan)
+    {.vramHash1 = 0x1d7bfe9b, .vramHash2 = 0x06f6efe0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TESSERAE",           }, // Tesserae (USA)
+    {.vramHash1 = 0xb416685e, .vramHash2 = 0x07518481, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOME ALONE2",        }, // Home Alone 2 - Lost In New York (USA, Europe)
+    {.vramHash1 = 0x2f14ce27, .vramHash2 = 0x078ba8eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANJIRO       ",     }, // Pocket Kanjirou (Japan)
+    {.vramHash1 = 0x764285d3, .vramHash2 = 0x07d9c0b9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN4",           }, // Mega Man IV (USA)
+    {.vramHash1 = 0x8ff5ca5e, .vramHash2 = 0x07deb53d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KID DRACULA",        }, // Kid Dracula (USA, Europe)
+    {.vramHash1 = 0x19c36bf3, .vramHash2 = 0x07dfcce1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHANGHAI",           }, // Shanghai (Japan) (Activision)
+    {.vramHash1 = 0x1f475dcf, .vramHash2 = 0x07f94d2b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "INFREY QUEST",       }, // Adventures of Pinocchio, The (Unknown) (Proto)
+    {.vramHash1 = 0x3ea32306, .vramHash2 = 0x0844bb8c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-KMJ",            }, // Kakomunja (Japan)
+    {.vramHash1 = 0x57b6f1c7, .vramHash2 = 0x0866d32d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMICICEHOCK",     }, // Konamic Ice Hockey (Japan)
+    {.vramHash1 = 0x16f8e76c, .vramHash2 = 0x08796112, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIBIMARUKO2",       }, // Chibi Maruko-chan 2 - Deluxe Maruko World (Japan)
+    {.vramHash1 = 0x07a9f6ab, .vramHash2 = 0x08ba78c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TESSERAE",           }, // Tesserae (Europe) (En,Fr,De,Es,It)
+    {.vramHash1 = 0x5f33eff4, .vramHash2 = 0x08be3e04, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RIKA  ANKI  25",     }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Rika Anki Point 250 (Japan)
+    {.vramHash1 = 0xe18cae3c, .vramHash2 = 0x08c1ddf8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {{.jumpAddress = 0x1a42, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x1a47, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x1ad6, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "BattletoadsDDragon", }, // Battletoads-Double Dragon (Europe)
+    {.vramHash1 = 0x611fd9af, .vramHash2 = 0x08eea5e1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAFFY DUCK",         }, // Daffy Duck (Europe)
+    {.vramHash1 = 0xfc507dd2, .vramHash2 = 0x08fdbba5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {{.jumpAddress = 0x1a42, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x1a47, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x1ad6, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "BattletoadsDDragon", }, // Battletoads-Double Dragon (USA)
+    {.vramHash1 = 0x596f2ebb, .vramHash2 = 0x0959365f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTELIAN",          }, // Castelian (Europe)
+    {.vramHash1 = 0x0ef71ab9, .vramHash2 = 0x097ea5fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SQUARE DEAL",        }, // Square Deal - The Game of Two-Dimensional Poker (USA)
+    {.vramHash1 = 0xeae86919, .vramHash2 = 0x099bc3fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TDL FANTASYTOU",     }, // Tokyo Disneyland - Fantasy Tour (Japan)
+    {.vramHash1 = 0x9b59a121, .vramHash2 = 0x09abc1a8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PHANTASM",           }, // Phantasm (Japan)
+    {.vramHash1 = 0x684917c2, .vramHash2 = 0x09e8b7be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TYUUGAKUKANJI ",     }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Kanji Mondai no Seifuku (Japan)
+    {.vramHash1 = 0x09eb96ef, .vramHash2 = 0x0a00691b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKEMON YELLOW",     }, // Pokemon - Yellow Version - Special Pikachu Edition (USA, Europe) (GBC,SGB Enhanced)
+    {.vramHash1 = 0x09eb98bb, .vramHash2 = 0x0a016f3f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKEMON YELAPS",     }, // Pokemon - Edicion Amarilla - Edicion Especial Pikachu (Spain) (GBC,SGB Enhanced), Pokemon - Gelbe Edition - Special Pikachu Edition (Germany) (GBC,SGB Enhanced), Pokemon - Version Jaune - Edition Speciale Pikachu (France) (GBC,SGB Enhanced), Pokemon - Versione Gialla - Speciale Edizione Pikachu (Italy) (GBC,SGB Enhanced)
+    {.vramHash1 = 0x59b49501, .vramHash2 = 0x0a2969ae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAPTAIN TUBASA",     }, // Captain Tsubasa J - Zenkoku Seiha e no Chousen (Japan)
+    {.vramHash1 = 0x958ab290, .vramHash2 = 0x0a3484f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PALAMEDES",          }, // Palamedes (Europe)
+    {.vramHash1 = 0x21003137, .vramHash2 = 0x0a6b5d77, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALAGA&GALAXIA",     }, // Arcade Classic No. 3 - Galaga & Galaxian (USA)
+    {.vramHash1 = 0xf35c6d48, .vramHash2 = 0x0a7434eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MILON CASTLE",       }, // Milon no Meikyuu Kumikyoku (Japan)
+    {.vramHash1 = 0x86f3caba, .vramHash2 = 0x0a83ee42, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GEARWORKS",          }, // Gear Works (USA, Europe)
+    {.vramHash1 = 0xed45af4a, .vramHash2 = 0x0ab7a3ca, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPACE INVADERS",     }, // Space Invaders (Japan)
+    {.vramHash1 = 0xf0622de8, .vramHash2 = 0x0b15458d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOPRANKTENNIS",      }, // Top Rank Tennis (USA)
+    {.vramHash1 = 0xe8520a3f, .vramHash2 = 0x0b19cb62, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIDER-MAN 3 D",     }, // Spider-Man 3 - Invasion of the Spider-Slayers (USA, Europe)
+    {.vramHash1 = 0x208a1089, .vramHash2 = 0x0b421ab0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPEYE 2",           }, // Popeye 2 (Europe)
+    {.vramHash1 = 0x9d38c5d1, .vramHash2 = 0x0b8d1823, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-ASE",            }, // Boomer's Adventure in ASMIK World (USA)
+    {.vramHash1 = 0x246bdb0a, .vramHash2 = 0x0bb39726, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY MOUSE",       }, // Mickey Mouse (Japan)
+    {.vramHash1 = 0xbbc44c9d, .vramHash2 = 0x0bddbe54, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR WARS",          }, // Star Wars (USA)
+    {.vramHash1 = 0x4c6c5154, .vramHash2 = 0x0c3dfe8c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOXIC CRUSADER",     }, // Toxic Crusaders (USA)
+    {.vramHash1 = 0xaf7991ce, .vramHash2 = 0x0c62c343, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NHL 96",             }, // NHL '96 (USA, Europe)
+    {.vramHash1 = 0x149a28f0, .vramHash2 = 0x0c748280, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOUKENJIMA3",        }, // Takahashi Meijin no Bouken-jima III (Japan)
+    {.vramHash1 = 0x83039d94, .vramHash2 = 0x0c7d2557, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORASUREGAIDEN",     }, // Dragon Slayer - Nemuri no Oukan (Japan)
+    {.vramHash1 = 0xfc4c4f3a, .vramHash2 = 0x0c9901dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REN AND STIMPY",     }, // Ren & Stimpy Show, The - Space Cadet Adventures (USA)
+    {.vramHash1 = 0x49be4d06, .vramHash2 = 0x0cc77d1d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU KOF 95",      }, // Nettou The King of Fighters '95 (Japan)
+    {.vramHash1 = 0xe201a30a, .vramHash2 = 0x0cc9e88c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOCK'N CHASE",       }, // Lock n' Chase ~ Lock 'n' Chase (World)
+    {.vramHash1 = 0xa7096e59, .vramHash2 = 0x0cfa766c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Game Boy Gallery 2", }, // Game Boy Gallery 2 (Japan)
+    {.vramHash1 = 0x043a5b93, .vramHash2 = 0x0d26af13, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOAL!",              }, // Goal! (USA)
+    {.vramHash1 = 0x439789d8, .vramHash2 = 0x0d33310c, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Kirby's DreamLand2", }, // Hoshi no Kirby 2 (Japan), Kirby's Dream Land 2 (USA, Europe)
+    {.vramHash1 = 0xccdcb676, .vramHash2 = 0x0d362626, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISLOT KIDS",     }, // Pachi-Slot Kids 2 (Japan)
+    {.vramHash1 = 0x154d47f0, .vramHash2 = 0x0d419c8e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUNES OF VIRTU",     }, // Ultima - Runes of Virtue (USA), Ultima - Ushinawareta Runes (Japan)
+    {.vramHash1 = 0x80c0355c, .vramHash2 = 0x0d45fc38, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHUCK ROCK",         }, // Chuck Rock (USA, Europe)
+    {.vramHash1 = 0x0562304a, .vramHash2 = 0x0e82e510, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COLLEGE SLAM",       }, // College Slam (USA)
+    {.vramHash1 = 0xdccb2ee6, .vramHash2 = 0x0e94b696, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mortal Combat 3",    }, // Mortal Kombat 3 (Europe), Mortal Kombat 3 (USA)
+    {.vramHash1 = 0x0d79be91, .vramHash2 = 0x0f036a3a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PGA TOUR 96",        }, // PGA Tour 96 (USA, Europe)
+    {.vramHash1 = 0xf633bdbb, .vramHash2 = 0x0f3ba53e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SMARTCOM",           }, // SMARTCOM (Europe) (Unl)
+    {.vramHash1 = 0x130f55a1, .vramHash2 = 0x0f3fc488, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRINCE OF PERS",     }, // Prince of Persia (Japan)
+    {.vramHash1 = 0x94829d09, .vramHash2 = 0x0f47a121, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANIMANIACS",         }, // Animaniacs (Europe), Animaniacs (USA)
+    {.vramHash1 = 0x84e3bb22, .vramHash2 = 0x0f4f4a62, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKEBOM",            }, // Pocket Bomberman (Europe)
+    {.vramHash1 = 0x7f040b0c, .vramHash2 = 0x0f6e901d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINTAMA EAWASE",     }, // Nintama Rantarou GB - Eawase Challenge Puzzle (Japan)
+    {.vramHash1 = 0xfbf0c712, .vramHash2 = 0x0facf4b3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JUNGLE WARS",        }, // Jungle Wars (Japan)
+    {.vramHash1 = 0x815efe19, .vramHash2 = 0x0fb364be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOOK",               }, // Hook (Japan)
+    {.vramHash1 = 0xec31ea0e, .vramHash2 = 0x0fbc0f64, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADDAMS FAMILY",      }, // Addams Family, The (USA)
+    {.vramHash1 = 0x53cef250, .vramHash2 = 0x101f8fb7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB GENJIN LAND",     }, // GB Genjin Land - Viva! Chikkun Oukoku (Japan)
+    {.vramHash1 = 0x9e1e2758, .vramHash2 = 0x10291f82, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Burai Fighter",      }, // Burai Fighter Deluxe (USA, Europe)
+    {.vramHash1 = 0x663dabe2, .vramHash2 = 0x10b2aeab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FELIX THE CAT",      }, // Felix the Cat (USA, Europe)
+    {.vramHash1 = 0xdd955e43, .vramHash2 = 0x10dbdf9f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWF RAW",            }, // WWF Raw (USA, Europe)
+    {.vramHash1 = 0x3273aee2, .vramHash2 = 0x10e8683e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BREAKTHRU!",         }, // BreakThru! (USA)
+    {.vramHash1 = 0xbac4bb32, .vramHash2 = 0x11139763, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HIRYU GAIDEN",       }, // Hiryuu no Ken Gaiden (Japan)
+    {.vramHash1 = 0xc228fdc0, .vramHash2 = 0x11520b6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PHANTOM AIR MI",     }, // Phantom Air Mission (Europe)
+    {.vramHash1 = 0xbed08eec, .vramHash2 = 0x115cb15a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WINTER OLYMPIC",     }, // XVII Olympic Winter Games, The - Lillehammer 1994 (USA)
+    {.vramHash1 = 0x30a5220c, .vramHash2 = 0x122d91be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GARFIELD",           }, // Garfield Labyrinth (Europe)
+    {.vramHash1 = 0x1615d8f1, .vramHash2 = 0x1273a391, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KID ICARUS",         }, // Kid Icarus - Of Myths and Monsters (USA, Europe)
+    {.vramHash1 = 0x957f6280, .vramHash2 = 0x12d6eb0d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Double Dragon 3",    }, // Double Dragon 3 - The Arcade Game (USA, Europe)
+    {.vramHash1 = 0x8ee7ff81, .vramHash2 = 0x12f11c1b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY MOUSE 2",     }, // Mickey Mouse II (Japan)
+    {.vramHash1 = 0x7170f72c, .vramHash2 = 0x12fcb048, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB MARMALADEBO",     }, // Marmalade Boy (Japan)
+    {.vramHash1 = 0xc1b3c3d5, .vramHash2 = 0x1358cdf1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZOOP",               }, // Zoop (Japan), Zoop (USA, Europe)
+    {.vramHash1 = 0xe4792058, .vramHash2 = 0x13621c3d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HIGH STAKES",        }, // High Stakes (USA)
+    {.vramHash1 = 0x8d1c0e48, .vramHash2 = 0x136cca90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PALAMEDES",          }, // Palamedes (Japan)
+    {.vramHash1 = 0x02629658, .vramHash2 = 0x137d1030, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAINBENDER",        }, // Brain Bender (Europe)
+    {.vramHash1 = 0xb0df541e, .vramHash2 = 0x13ac5072, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KITERETU ZYURA",     }, // Kiteretsu Daihyakka - Bouken Ooedo Juraki (Japan)
+    {.vramHash1 = 0x97430eca, .vramHash2 = 0x13ac9560, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEST OF THE BE",     }, // Best of the Best - Championship Karate (USA)
+    {.vramHash1 = 0x0b3f4b18, .vramHash2 = 0x13be94a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAMCOCLASSIC",       }, // Namco Classic (Japan)
+    {.vramHash1 = 0x3ee044db, .vramHash2 = 0x13cded50, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOM AND JERRY",      }, // Tom to Jerry Part 2 (Japan)
+    {.vramHash1 = 0x20e1eb6e, .vramHash2 = 0x13e0a8b1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOD MEDICINE",       }, // God Medicine - Fantasy Sekai no Tanjou (Japan)
+    {.vramHash1 = 0x6a54cffb, .vramHash2 = 0x1449b592, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAKIBAO",            }, // Midori no Makibaou (Japan)
+    {.vramHash1 = 0xf223cc33, .vramHash2 = 0x147058e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KITAROU",         }, // Gegege no Kitarou - Youkai Souzoushu Arawaru! (Japan)
+    {.vramHash1 = 0x9b23a71e, .vramHash2 = 0x147f9afc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLE BOBBLE",      }, // Bubble Bobble (USA, Europe)
+    {.vramHash1 = 0x910fd7ee, .vramHash2 = 0x149e199b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TUMBLE POP",         }, // Tumble Pop (Japan), Tumble Pop (USA, Europe)
+    {.vramHash1 = 0xec1cc5bb, .vramHash2 = 0x14a97ba3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HEAD ON",            }, // Head On (Japan)
+    {.vramHash1 = 0x78d3355f, .vramHash2 = 0x14bf7648, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINY TOON 2 MM",     }, // Tiny Toon Adventures 2 - Montana's Movie Madness (USA, Europe)
+    {.vramHash1 = 0xb3985c64, .vramHash2 = 0x14ddc1dc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KUREYON SHI",     }, // Crayon Shin-chan - Ora to Shiro wa Otomodachi Da yo (Japan)
+    {.vramHash1 = 0x2a920759, .vramHash2 = 0x1506c79c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRAGONTAILBIT2",     }, // Dragon Tail (Japan)
+    {.vramHash1 = 0x0585f212, .vramHash2 = 0x15091fff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIRTY RACIN'",       }, // Dirty Racing (Japan)
+    {.vramHash1 = 0xc39cc3c3, .vramHash2 = 0x1530f19a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F1 SUPER DRIVI",     }, // Suzuki Aguri no F-1 Super Driving (Japan)
+    {.vramHash1 = 0x03d00708, .vramHash2 = 0x1585d54c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMISTA2",           }, // Famista 2 (Japan)
+    {.vramHash1 = 0x508b8421, .vramHash2 = 0x158ca00d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PYRAMIDS OF RA",     }, // Pyramids of Ra (USA)
+    {.vramHash1 = 0xdc4e6088, .vramHash2 = 0x15cee607, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY MOUSE",       }, // Mickey Mouse - Magic Wands (USA, Europe)
+    {.vramHash1 = 0x3d0a6e2f, .vramHash2 = 0x15dcb77f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIG WAVE SOCCE",     }, // J.League Big Wave Soccer (Japan)
+    {.vramHash1 = 0x8fcd97c7, .vramHash2 = 0x15e5c401, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER CHINESE ",     }, // Super Chinese Land 2 (Japan)
+    {.vramHash1 = 0x21c0ae4d, .vramHash2 = 0x16463e2c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WH2JET",             }, // World Heroes 2 Jet (USA, Europe)
+    {.vramHash1 = 0xbed9ba80, .vramHash2 = 0x1671455f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALIEN",              }, // Alien 3 (Japan), Alien 3 (USA, Europe)
+    {.vramHash1 = 0xab22eaae, .vramHash2 = 0x17c7b511, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DESERT STRIKE",      }, // Desert Strike - Return to the Gulf (Europe)
+    {.vramHash1 = 0xf4a7ddd2, .vramHash2 = 0x17cee232, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HONMEI BOY",         }, // Honmei Boy (Japan)
+    {.vramHash1 = 0x01ac4993, .vramHash2 = 0x17dce499, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUMOU FIGHTER",      }, // Sumou Fighter - Toukaidou Basho (Japan)
+    {.vramHash1 = 0x17ab2884, .vramHash2 = 0x180577bd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ECLIPSE",            }, // X (USA) (Proto)
+    {.vramHash1 = 0x8a023b67, .vramHash2 = 0x1853b75f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TWIN-BEE DA!!",      }, // TwinBee da!! (Japan)
+    {.vramHash1 = 0x9c7d9cc3, .vramHash2 = 0x18588ac3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE MASTER",      }, // Little Master - Raikuban no Densetsu (Japan)
+    {.vramHash1 = 0x78c71739, .vramHash2 = 0x187b66e7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOULDER DASH",       }, // Boulder Dash (Europe)
+    {.vramHash1 = 0xa3264be8, .vramHash2 = 0x18a3c0ad, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KLAX",               }, // Klax (USA)
+    {.vramHash1 = 0x53595f03, .vramHash2 = 0x194e6f46, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NBA JAM",            }, // NBA Jam (USA, Europe)
+    {.vramHash1 = 0x61a95a6e, .vramHash2 = 0x1989c62c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris",             }, // Tetris (Japan) (En)
+    {.vramHash1 = 0x165341fc, .vramHash2 = 0x19bf6324, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUNGEONLAND",        }, // Dungeon Land (Japan)
+    {.vramHash1 = 0xf483870b, .vramHash2 = 0x19ffc737, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALL STAR BB '9",     }, // All-Star Baseball 99 (USA)
+    {.vramHash1 = 0xb1536f98, .vramHash2 = 0x1a26b873, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOY AND BLOB G",     }, // David Crane's The Rescue of Princess Blobette Starring A Boy and His Blob (USA)
+    {.vramHash1 = 0x3204ccfd, .vramHash2 = 0x1a648642, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAMBORGHINI",        }, // Lamborghini American Challenge (USA, Europe)
+    {.vramHash1 = 0x3ce6c778, .vramHash2 = 0x1ab88c17, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KAGUYAHIME",         }, // Pachinko Kaguya Hime (Japan)
+    {.vramHash1 = 0x0e007039, .vramHash2 = 0x1b2fbf92, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PIPE DREAM",         }, // Pipe Dream (Japan)
+    {.vramHash1 = 0x0bd5ef13, .vramHash2 = 0x1b3372f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAYS OF THUNDE",     }, // Days of Thunder (USA, Europe)
+    {.vramHash1 = 0x2837db2b, .vramHash2 = 0x1b74c815, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA",               }, // Makai Toushi Sa-Ga (Japan) (Rev A)
+    {.vramHash1 = 0x2837db33, .vramHash2 = 0x1b750d11, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA",               }, // Makai Toushi Sa-Ga (Japan)
+    {.vramHash1 = 0x4620706a, .vramHash2 = 0x1b79df6c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUST A MOVE 3",      }, // Bust-A-Move 3 DX (Europe)
+    {.vramHash1 = 0xf503cdf4, .vramHash2 = 0x1b9410d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENGUIN WARS",       }, // Penguin Wars (USA)
+    {.vramHash1 = 0x7823678b, .vramHash2 = 0x1b9e461a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOGGLE PLUS",        }, // Boggle Plus (USA)
+    {.vramHash1 = 0xb2102a3c, .vramHash2 = 0x1baa6107, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TIP OFF",            }, // Tip Off (Europe)
+    {.vramHash1 = 0xce81b682, .vramHash2 = 0x1bbe71a3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris FLASH",       }, // Tetris Flash (Japan)
+    {.vramHash1 = 0xcdb0041d, .vramHash2 = 0x1bd146ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOKUJOU GB",         }, // Bokujou Monogatari GB (Japan) (Rev AB), Bokujou Monogatari GB (Japan)
+    {.vramHash1 = 0x8bbe89ec, .vramHash2 = 0x1c031457, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SD SEINTPARADA",     }, // Saint Paradise - Saikyou no Senshi-tachi (Japan)
+    {.vramHash1 = 0x023b2354, .vramHash2 = 0x1cef0854, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLEETCOMMANDER",     }, // Fleet Commander VS. (Japan)
+    {.vramHash1 = 0x60019404, .vramHash2 = 0x1cf83420, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL DREAMS",     }, // Pinball Dreams (USA, Europe)
+    {.vramHash1 = 0xfe419599, .vramHash2 = 0x1d00a518, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER MAKER ",     }, // Monster Maker (Japan)
+    {.vramHash1 = 0x4d8a2aa7, .vramHash2 = 0x1d3b08ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NIHON DAIHYOU ",     }, // Nihon Daihyou Team - Eikou no Eleven (Japan)
+    {.vramHash1 = 0x1ca83ef7, .vramHash2 = 0x1d4557af, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS",            }, // Nemesis (USA)
+    {.vramHash1 = 0x63fb862c, .vramHash2 = 0x1d7c30e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mario's Picross",    }, // Mario no Picross (Japan)
+    {.vramHash1 = 0xb24f34d8, .vramHash2 = 0x1d86a03e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER WARS",       }, // Monster Truck Wars (USA, Europe)
+    {.vramHash1 = 0xb6af1815, .vramHash2 = 0x1dc7d2ab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POWER RANGERS",      }, // Mighty Morphin Power Rangers (USA, Europe)
+    {.vramHash1 = 0x7997ca14, .vramHash2 = 0x1dead3ad, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PGA EURO TOUR",      }, // PGA European Tour (USA, Europe)
+    {.vramHash1 = 0x6c096051, .vramHash2 = 0x1e1d022c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SHINRI GAM",     }, // Shinri Game, The (Japan)
+    {.vramHash1 = 0x512c6b41, .vramHash2 = 0x1e5e135c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOOPY 2",           }, // Snoopy no Hajimete no Otsukai (Japan)
+    {.vramHash1 = 0x2d7fa794, .vramHash2 = 0x1f2255ff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARU'S MISSION",     }, // Maru's Mission (USA)
+    {.vramHash1 = 0x959b5478, .vramHash2 = 0x1f326a90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZOOL",               }, // Zool - Ninja of the 'Nth' Dimension (Europe), Zool - Ninja of the 'Nth' Dimension (USA)
+    {.vramHash1 = 0x2745126d, .vramHash2 = 0x1f432500, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RANMA1/2KAKUGE",     }, // Ranma 1-2 - Kakugeki Mondou!! (Japan)
+    {.vramHash1 = 0xf91edc75, .vramHash2 = 0x1f4d0ed8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TEKKAMANBLA",     }, // Uchuu no Kishi Tekkaman Blade (Japan)
+    {.vramHash1 = 0xdb4abb84, .vramHash2 = 0x1f855b74, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANDUME MONSTE",     }, // Kandume Monsters (Japan)
+    {.vramHash1 = 0x5861a85b, .vramHash2 = 0x1f870ac3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOCCER MANIA",       }, // Soccer Mania (USA)
+    {.vramHash1 = 0xf21674c7, .vramHash2 = 0x1fa41c9a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOULDER DASH",       }, // Boulder Dash (Japan)
+    {.vramHash1 = 0x2d8015fe, .vramHash2 = 0x1fa6f62a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OIRA JAJAMARU",      }, // Oira Jajamaru! Sekai Daibouken (Japan)
+    {.vramHash1 = 0x29edd7bc, .vramHash2 = 0x1ffb2090, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJATARO",          }, // Ninja Taro (USA) (Beta)
+    {.vramHash1 = 0xba4bb8e5, .vramHash2 = 0x2022c9b6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REKISI MASTER5",     }, // Goukaku Boy Series - Gakken - Rekishi 512 (Japan)
+    {.vramHash1 = 0xd46a2840, .vramHash2 = 0x20731945, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOME ALONE",         }, // Home Alone (USA, Europe)
+    {.vramHash1 = 0xc3afe463, .vramHash2 = 0x20b8c6cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAWNMOWER MAN",      }, // Lawnmower Man, The (Europe)
+    {.vramHash1 = 0x3ce8971d, .vramHash2 = 0x215e66fd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ATOMIC PUNK",        }, // Atomic Punk (USA)
+    {.vramHash1 = 0x25cab5f4, .vramHash2 = 0x21aaca15, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Ikari No Yousai 2",  }, // Ikari no Yousai 2 (Japan)
+    {.vramHash1 = 0x9d918f47, .vramHash2 = 0x226d8946, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FASTEST LAP",        }, // Fastest Lap (Japan, USA)
+    {.vramHash1 = 0x8f4a3d3c, .vramHash2 = 0x2287270f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "4 IN 1 FUN PAK",     }, // 4-in-1 Fun Pak (USA, Europe)
+    {.vramHash1 = 0xa82d6d92, .vramHash2 = 0x22e6ba57, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLITAIRE     ",     }, // Solitaire (Japan)
+    {.vramHash1 = 0xf9f383f5, .vramHash2 = 0x236fa1dc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB NAKAYOSHI1",      }, // Welcome Nakayoshi Park (Japan)
+    {.vramHash1 = 0x54d2f0a7, .vramHash2 = 0x238d6b11, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEMMINGS 2",         }, // Lemmings 2 - The Tribes (Europe)
+    {.vramHash1 = 0xc6970db2, .vramHash2 = 0x238e02a6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAZLOS LEAP",        }, // Lazlos' Leap (USA)
+    {.vramHash1 = 0xf444baf9, .vramHash2 = 0x2390aab3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WIZARDRY CAE",       }, // Wizardry Gaiden 2 - Kodai Koutei no Noroi (Japan)
+    {.vramHash1 = 0x98073350, .vramHash2 = 0x23d190fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOKU DRACURA K",     }, // Akumajou Special - Boku Dracula-kun (Japan)
+    {.vramHash1 = 0xf9e67e0d, .vramHash2 = 0x244aa38b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SEIKEN DENSETS",     }, // Seiken Densetsu - Final Fantasy Gaiden (Japan)
+    {.vramHash1 = 0xd3d999c3, .vramHash2 = 0x244f3b84, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PURIKURAPOCKET",     }, // Purikura Pocket 3 - Talent Debut Daisakusen (Japan)
+    {.vramHash1 = 0x78f6ed44, .vramHash2 = 0x246f56b2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBER BOY",         }, // Bomber Boy (Japan)
+    {.vramHash1 = 0xba2f239d, .vramHash2 = 0x24967987, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOM AND JERRY ",     }, // Tom & Jerry (USA, Europe)
+    {.vramHash1 = 0xa1e56c8a, .vramHash2 = 0x2498d345, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD ICE HOKK",     }, // World Ice Hockey (Japan)
+    {.vramHash1 = 0xe97643e9, .vramHash2 = 0x249ab4aa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI4WD GB2   ",     }, // Mini Yonku GB Let's & Go!! - All-Star Battle Max (Japan)
+    {.vramHash1 = 0x15107c20, .vramHash2 = 0x24a0975a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBERMAN GB3",      }, // Bomber Man GB 3 (Japan)
+    {.vramHash1 = 0xe97644a3, .vramHash2 = 0x24a208d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI4WD GB    ",     }, // Mini Yonku GB Let's & Go!! (Japan)
+    {.vramHash1 = 0xb35aa3e4, .vramHash2 = 0x24b79ea9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STOP THAT ROAC",     }, // Stop That Roach! (USA)
+    {.vramHash1 = 0x9de388c9, .vramHash2 = 0x24c434c1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {{.jumpAddress = 0x3427, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x342b, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x3499, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "Battletoads",        }, // Battletoads (Japan)
+    {.vramHash1 = 0x6423f549, .vramHash2 = 0x24d0fa93, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROBOCOP",            }, // RoboCop (USA)
+    {.vramHash1 = 0x83658634, .vramHash2 = 0x24f78692, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTAROU GAID",     }, // Momotarou Densetsu Gaiden (Japan)
+    {.vramHash1 = 0x623052c8, .vramHash2 = 0x255d9011, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE FLASH",          }, // Flash, The (USA, Europe)
+    {.vramHash1 = 0xe40575a3, .vramHash2 = 0x25852319, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JAMES  BOND  0",     }, // James Bond 007 (USA, Europe)
+    {.vramHash1 = 0x56d24684, .vramHash2 = 0x25d4de47, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ASTRO RABBY",        }, // Astro Rabby (Japan)
+    {.vramHash1 = 0x7fc32e85, .vramHash2 = 0x26056d7c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "B.C.KID2",           }, // B.C. Kid 2 (Europe)
+    {.vramHash1 = 0x3fa8ae15, .vramHash2 = 0x26585a34, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SQ DSV DMG",         }, // SeaQuest DSV (USA, Europe)
+    {.vramHash1 = 0x407a84fd, .vramHash2 = 0x268b5f6a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR SAVER",         }, // Adventures of Star Saver, The (USA, Europe)
+    {.vramHash1 = 0x6424c101, .vramHash2 = 0x26adaa4b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROBOCOP",            }, // RoboCop (Japan)
+    {.vramHash1 = 0x59ac2686, .vramHash2 = 0x272db829, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TERMINATOR 2",       }, // Terminator 2 - Judgment Day (USA, Europe)
+    {.vramHash1 = 0x65244354, .vramHash2 = 0x27786d49, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GINGA",              }, // Ginga - Card & Puzzle Collection (Japan) (En,Ja)
+    {.vramHash1 = 0x2d8eb18c, .vramHash2 = 0x27a02e60, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HUGO2",              }, // Hugo 2 (Germany)
+    {.vramHash1 = 0x8b1eb0d9, .vramHash2 = 0x27a2362d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLAPPY SPECIAL",     }, // Flappy Special (Japan)
+    {.vramHash1 = 0xb596ded9, .vramHash2 = 0x27c9aaf5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROBOCOP",            }, // RoboCop (USA, Europe) (Rev A)
+    {.vramHash1 = 0x30d3d897, .vramHash2 = 0x2806f2e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB CREYON 5",        }, // Crayon Shin-chan - Ora no Gokigen Collection (Japan)
+    {.vramHash1 = 0x813e41c3, .vramHash2 = 0x28161601, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOGURA DE PON!",     }, // Mogura de Pon! (Japan)
+    {.vramHash1 = 0x02ded5a0, .vramHash2 = 0x28928958, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEKICHUJUTSU",       }, // Mr. Go no Baken Tekichuu Jutsu (Japan)
+    {.vramHash1 = 0x8fcfa279, .vramHash2 = 0x2897c6e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHOPLIFTER III",     }, // Choplifter III (Europe)
+    {.vramHash1 = 0x84f564d8, .vramHash2 = 0x28a3ca1a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOTOCROSSMANIA",     }, // Motocross Maniacs (Europe)
+    {.vramHash1 = 0xe89a50f8, .vramHash2 = 0x28c3bef6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STUDYBOY SANSU",     }, // Doraemon no Study Boy 5 - Shou 2 Sansuu Keisan (Japan)
+    {.vramHash1 = 0x13d7fe1b, .vramHash2 = 0x290761da, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIFA SOCCER",        }, // FIFA International Soccer (USA, Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0xac84504c, .vramHash2 = 0x2942d61a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KUMANOPUTARO",       }, // Kuma no Puutarou - Takara Sagashi da Ooiri Game Battle! (Japan)
+    {.vramHash1 = 0x9415bb8c, .vramHash2 = 0x2948b6d0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUKEISNBC4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Keisan no Tatsujin (Japan)
+    {.vramHash1 = 0x12058fe0, .vramHash2 = 0x294ba9f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIONIC-COMMAND",     }, // Bionic Commando (Japan)
+    {.vramHash1 = 0x08cbd196, .vramHash2 = 0x29bb7e7b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Nicklaus Golf",      }, // Jack Nicklaus Golf (France), Jack Nicklaus Golf (USA, Europe)
+    {.vramHash1 = 0x49b0ceae, .vramHash2 = 0x29ebe835, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AMAZING PENGUI",     }, // Amazing Penguin (USA, Europe)
+    {.vramHash1 = 0xa0ec71d8, .vramHash2 = 0x29f15b02, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UMABAN CLUB",        }, // 3-pun Yosou - Umaban Club (Japan)
+    {.vramHash1 = 0x42fac4cc, .vramHash2 = 0x29ffc5c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAUI MALLARD",       }, // Maui Mallard (USA)
+    {.vramHash1 = 0xba2a6563, .vramHash2 = 0x2a92a371, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE PUNISHER",       }, // Punisher, The - The Ultimate Payback (USA)
+    {.vramHash1 = 0x84cc1d4f, .vramHash2 = 0x2aaad2a5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERMAN",           }, // Superman (USA, Europe)
+    {.vramHash1 = 0x8032cf44, .vramHash2 = 0x2b3f6432, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TARZAN",             }, // Tarzan (USA, Europe)
+    {.vramHash1 = 0x66ea5f80, .vramHash2 = 0x2b78df56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAIN DRAIN",        }, // Brain Drain (Japan)
+    {.vramHash1 = 0xb452973b, .vramHash2 = 0x2b80affc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAHOUJINGURUGU",     }, // Mahoujin Guruguru (Japan)
+    {.vramHash1 = 0xe714adec, .vramHash2 = 0x2b81d69c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TVCHAMPION",         }, // TV Champion (Japan)
+    {.vramHash1 = 0x8934dac1, .vramHash2 = 0x2ba626f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHIOKUN 2",        }, // Pachio-kun 2 (Japan)
+    {.vramHash1 = 0xf54a6158, .vramHash2 = 0x2bc9645a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUGRATS MOVIE",      }, // Rugrats Movie, The (USA)
+    {.vramHash1 = 0x8318b369, .vramHash2 = 0x2bd23552, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRAGON SLAYER ",     }, // Dragon Slayer I (Japan)
+    {.vramHash1 = 0x55e591d2, .vramHash2 = 0x2bf9a99d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHI SLOT KID",     }, // Pachi-Slot Kids 3 (Japan)
+    {.vramHash1 = 0x5ed7838f, .vramHash2 = 0x2c193099, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEGEND OF ZERD",     }, // Zerd no Densetsu (Japan)
+    {.vramHash1 = 0x8c381ef6, .vramHash2 = 0x2c2c6e56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "INDIANA JONES ",     }, // Indiana Jones and the Last Crusade (USA, Europe)
+    {.vramHash1 = 0x347d411f, .vramHash2 = 0x2c3c3f3a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIDERMAN XMEN",     }, // Spider-Man - X-Men (USA, Europe)
+    {.vramHash1 = 0x656fd664, .vramHash2 = 0x2c4166fa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STREET RACER",       }, // Street Racer (Japan), Street Racer (USA, Europe)
+    {.vramHash1 = 0x9e026242, .vramHash2 = 0x2c55bf8e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Sanrio Uranai",      }, // Sanrio Uranai Party (Japan) (Rev A), Sanrio Uranai Party (Japan)
+    {.vramHash1 = 0x44fadb1f, .vramHash2 = 0x2cc6dfae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RVT           ",     }, // RoboCop vs. The Terminator (Europe)
+    {.vramHash1 = 0xf0875859, .vramHash2 = 0x2d1b87c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mortal Combat I&II", }, // Mortal Kombat & Mortal Kombat II (Japan), Mortal Kombat & Mortal Kombat II (USA, Europe)
+    {.vramHash1 = 0x85671c60, .vramHash2 = 0x2d5fa070, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAIBA",              }, // Kenyuu Densetsu Yaiba (Japan)
+    {.vramHash1 = 0x4b3472f4, .vramHash2 = 0x2d778283, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GREAT GREED",        }, // Great Greed (USA)
+    {.vramHash1 = 0xa892047d, .vramHash2 = 0x2dfc5908, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TECMO BOWL",         }, // Tecmo Bowl (Japan)
+    {.vramHash1 = 0x03f08315, .vramHash2 = 0x2e02ee20, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAZMANIA",           }, // Taz-Mania (Europe)
+    {.vramHash1 = 0xe74f339d, .vramHash2 = 0x2e310a76, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RODLAND",            }, // Rodland (Europe)
+    {.vramHash1 = 0xe65713f3, .vramHash2 = 0x2e88a003, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mario's Picross",    }, // Mario's Picross (USA, Europe)
+    {.vramHash1 = 0x17defa97, .vramHash2 = 0x2ea24872, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL QUARTERBAC",     }, // NFL Quarterback Club (USA, Europe)
+    {.vramHash1 = 0x3c994212, .vramHash2 = 0x2ebc0341, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AMAZING-TATER",      }, // A-mazing Tater (USA)
+    {.vramHash1 = 0x74d2b36e, .vramHash2 = 0x2eca2688, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARODIUS DA!",       }, // Parodius Da! (Japan)
+    {.vramHash1 = 0x4ff103ed, .vramHash2 = 0x2f42aa31, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAKA SEKAISHI ",     }, // Goukaku Boy Series - Yamakawa Ichimonittou - Sekaishi B Yougo Mondaishuu (Japan)
+    {.vramHash1 = 0x9a66a1a5, .vramHash2 = 0x2fe97e95, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOKING DENSET",     }, // Hitori de Dekirumon! - Cooking Densetsu (Japan)
+    {.vramHash1 = 0xe88173a0, .vramHash2 = 0x304509c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F15 STRIKE EAG",     }, // F-15 Strike Eagle (USA, Europe)
+    {.vramHash1 = 0xd2414e3f, .vramHash2 = 0x3062a390, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRA-4",            }, // America Oudan Ultra Quiz Part 4 (Japan)
+    {.vramHash1 = 0x41c3119d, .vramHash2 = 0x309313c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FINAL REVERSE",      }, // Final Reverse (Japan)
+    {.vramHash1 = 0x65eb0f67, .vramHash2 = 0x3130246e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER RACE",       }, // Monster Race (Japan)
+    {.vramHash1 = 0x7615d82a, .vramHash2 = 0x31ba34c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BREAKOUT",     }, // Super Breakout (USA)
+    {.vramHash1 = 0xb9599cc5, .vramHash2 = 0x31bd469e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET GOLF   ",     }, // Pocket Golf (Japan)
+    {.vramHash1 = 0x84c056d5, .vramHash2 = 0x31d44cf1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Wacky Sports",       }, // Tiny Toon Adventures - Dokidoki Sport Festival (Japan), Tiny Toon Adventures - Wacky Sports (Europe), Tiny Toon Adventures - Wacky Sports (USA)
+    {.vramHash1 = 0x58d0e2e2, .vramHash2 = 0x328ad01f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTELIAN",          }, // Castelian (USA)
+    {.vramHash1 = 0x8500d998, .vramHash2 = 0x32c1fabe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-ASJ",            }, // Teke Teke! Asmik-kun World (Japan)
+    {.vramHash1 = 0xce55d575, .vramHash2 = 0x32c765e8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BONKSREVENGE",       }, // Bonk's Revenge (USA)
+    {.vramHash1 = 0x6b93d7dd, .vramHash2 = 0x32d96ae2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FACEBALL 2000 ",     }, // Faceball 2000 (USA)
+    {.vramHash1 = 0x9858719c, .vramHash2 = 0x3326b677, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KUNIO",              }, // Nekketsu Kouha Kunio-kun - Bangai Rantou Hen (Japan)
+    {.vramHash1 = 0x1c6b66e7, .vramHash2 = 0x3374d45b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRAMAN GEKID",     }, // Ultraman Chou Toushi Gekiden (Japan)
+    {.vramHash1 = 0x9cb9e2bd, .vramHash2 = 0x337a7480, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLECITY",         }, // BattleCity (Japan)
+    {.vramHash1 = 0x24eebd5f, .vramHash2 = 0x33b501f1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BLACK BA",     }, // Super Black Bass Pocket (Japan)
+    {.vramHash1 = 0x5364ff23, .vramHash2 = 0x33b65960, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STUDYBOY KOKUG",     }, // Doraemon no Study Boy 4 - Shou ni Kokugo Kanji (Japan)
+    {.vramHash1 = 0x50d9e91f, .vramHash2 = 0x33b9e41e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ELITE SOCCER",       }, // Elite Soccer (USA)
+    {.vramHash1 = 0xb40599bf, .vramHash2 = 0x33c262c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TSUMEGO_FUJISA",     }, // Tsumego Series 1 - Fujisawa Hideyuki Meiyo Kisei (Japan)
+    {.vramHash1 = 0xb0c143c7, .vramHash2 = 0x33d5835a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUUYUU-3",           }, // Yu Yu Hakusho Dai-3-dan - Makai no Tobira Hen (Japan)
+    {.vramHash1 = 0xe12b1961, .vramHash2 = 0x33e7df55, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CRYSTAL QUEST",      }, // Crystal Quest (USA)
+    {.vramHash1 = 0x68302295, .vramHash2 = 0x33eba75e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PICROSS 2",          }, // Picross 2 (Japan)
+    {.vramHash1 = 0xe3988e9c, .vramHash2 = 0x346135b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEAVIS & BUTTH",     }, // Beavis and Butt-Head (USA, Europe)
+    {.vramHash1 = 0x1297af19, .vramHash2 = 0x34804b13, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIONIC-COMMAND",     }, // Bionic Commando (Europe), Bionic Commando (USA)
+    {.vramHash1 = 0xd1a8162c, .vramHash2 = 0x35141065, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER KICK OFF",     }, // Super Kick Off (Europe) (En,Fr,De,It,Nl)
+    {.vramHash1 = 0xff2813a0, .vramHash2 = 0x352e4058, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-ATTACK",         }, // Pac-Attack (USA)
+    {.vramHash1 = 0x712093f5, .vramHash2 = 0x3577bfc3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALADDIN",            }, // Aladdin (Europe), Aladdin (USA)
+    {.vramHash1 = 0x18f1490d, .vramHash2 = 0x3587620f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAISENRYAKU HI",     }, // Daisenryaku (Japan)
+    {.vramHash1 = 0x43a3438b, .vramHash2 = 0x3589e6ab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE MAIN EVENT",     }, // WCW Main Event (USA, Europe)
+    {.vramHash1 = 0x94a6bf45, .vramHash2 = 0x358bc4ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TORPEDO RANGE",      }, // Torpedo Range (Japan)
+    {.vramHash1 = 0xc2a07158, .vramHash2 = 0x35ca848f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL",            }, // Pinball - Revenge of the 'Gator (USA, Europe)
+    {.vramHash1 = 0x33503e94, .vramHash2 = 0x35d3c6dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NADA ASATAROU ",     }, // Nada Asatarou no Powerful Mahjong - Tsugi no Itte 100 Dai (Japan)
+    {.vramHash1 = 0x9074e471, .vramHash2 = 0x35f0ec6c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-MQJ",            }, // Maerchen Club (Japan)
+    {.vramHash1 = 0xe34937e9, .vramHash2 = 0x35fd7f02, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEMP",               }, // Game Boy Digital Sampling Oscilloscope (Europe) (v3.6) (GBDSO) (Unl)
+    {.vramHash1 = 0x9fd7b1a2, .vramHash2 = 0x361fadd6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUNES OF VIRTU",     }, // Ultima - Runes of Virtue II (USA)
+    {.vramHash1 = 0x5754a169, .vramHash2 = 0x362cbc3b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DICK TRACY",         }, // Dick Tracy (USA)
+    {.vramHash1 = 0x69971c78, .vramHash2 = 0x363bdd92, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI4BOY",           }, // Mini 4 Boy (Japan)
+    {.vramHash1 = 0xe3d3f857, .vramHash2 = 0x3654285a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOTSUGEKI TANK",     }, // Totsugeki! Ponkotsu Tank (Japan)
+    {.vramHash1 = 0xb9a7b563, .vramHash2 = 0x36875c8f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET LOVE 2",      }, // Pocket Love 2 (Japan)
+    {.vramHash1 = 0x49b30e24, .vramHash2 = 0x36ba4614, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GHOSTBUSTERS I",     }, // Ghostbusters II (USA, Europe)
+    {.vramHash1 = 0x9207a0de, .vramHash2 = 0x37145a86, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHOUGI",             }, // Shougi (Japan)
+    {.vramHash1 = 0x96f3ce6b, .vramHash2 = 0x375689f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES 2",       }, // DuckTales 2 (Europe)
+    {.vramHash1 = 0x522ae3e7, .vramHash2 = 0x377aecf4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOTOCROSSMANIA",     }, // Motocross Maniacs (USA)
+    {.vramHash1 = 0x36abbd52, .vramHash2 = 0x37876e38, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "URBAN STRIKE",       }, // Urban Strike (USA, Europe)
+    {.vramHash1 = 0x9f38a94b, .vramHash2 = 0x38238b9c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AEROSTAR",           }, // Aerostar (USA, Europe)
+    {.vramHash1 = 0x4801dabb, .vramHash2 = 0x388b7338, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAMAGOTCH 2",     }, // Game de Hakken!! Tamagotchi 2 (Japan)
+    {.vramHash1 = 0x9ea576cf, .vramHash2 = 0x388e89f2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SD HIRYUNOKEN",      }, // SD Hiryuu no Ken Gaiden (Japan)
+    {.vramHash1 = 0xc469d5b1, .vramHash2 = 0x38bd528d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENGUIN LAND",       }, // Penguin Land (Japan)
+    {.vramHash1 = 0xcd047f64, .vramHash2 = 0x38e79f3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RIDDICK BOWE",       }, // Riddick Bowe Boxing (USA)
+    {.vramHash1 = 0x5afd85bd, .vramHash2 = 0x38fbd995, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOTOCROSSMANIA",     }, // Motocross Maniacs (Europe) (Rev A)
+    {.vramHash1 = 0x81c3da6d, .vramHash2 = 0x39bf1c4a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EITANGO 1900",       }, // Goukaku Boy Series - Eitango Target 1900 (Japan)
+    {.vramHash1 = 0x52336d62, .vramHash2 = 0x39fb9154, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Ca Da",              }, // Hiden Inyou Kikouhou - Ca Da (Japan)
+    {.vramHash1 = 0x29fe0189, .vramHash2 = 0x3a82e1aa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VIKING CHILD 1",     }, // Prophecy - The Viking Child (USA)
+    {.vramHash1 = 0x6eb85cc3, .vramHash2 = 0x3a86c3f7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALTERED SPACE",      }, // Altered Space - A 3-D Alien Adventure (USA)
+    {.vramHash1 = 0x54e70bbc, .vramHash2 = 0x3aa5baa1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PEETAN",             }, // Peetan (Japan)
+    {.vramHash1 = 0x43ac9274, .vramHash2 = 0x3ab63d48, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAME GAME",          }, // Same Game (Japan)
+    {.vramHash1 = 0x9fd8a853, .vramHash2 = 0x3aba3a76, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUNES OF VIRTU",     }, // Ultima - Ushinawareta Runes II (Japan)
+    {.vramHash1 = 0x0b5fc287, .vramHash2 = 0x3af5642b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUJOSIKBS4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Joushiki no Sho (Japan) (Special Edition)
+    {.vramHash1 = 0xb21cf345, .vramHash2 = 0x3b1b80b4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WEREBACK BC",        }, // We're Back! - A Dinosaur's Story (USA, Europe)
+    {.vramHash1 = 0xcef99108, .vramHash2 = 0x3b4c6470, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEYS CHASE",      }, // Mickey's Dangerous Chase (USA)
+    {.vramHash1 = 0xdfda6b1e, .vramHash2 = 0x3becda5d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Joshua",             }, // Joshua & the Battle of Jericho (USA) (Unl)
+    {.vramHash1 = 0x1aeb1b8e, .vramHash2 = 0x3bf0011b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHANGHAI",           }, // Shanghai (Japan) (HAL Laboratory)
+    {.vramHash1 = 0x6c671e5f, .vramHash2 = 0x3c03035f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QUARTH",             }, // Quarth (Japan)
+    {.vramHash1 = 0xc9110778, .vramHash2 = 0x3c045df5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALTERED SPACE",      }, // Altered Space - A 3-D Alien Adventure (Japan)
+    {.vramHash1 = 0xf5bd293f, .vramHash2 = 0x3c088df8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOUR DE THRASH",     }, // Skate or Die - Tour de Thrash (USA)
+    {.vramHash1 = 0xa27a0fac, .vramHash2 = 0x3c15ebec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOOPY",             }, // Snoopy - Magic Show (USA, Europe)
+    {.vramHash1 = 0x7f880456, .vramHash2 = 0x3c33ead7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEKKYUFIGHT!",       }, // Tekkyu Fight! - The Great Battle Gaiden (Japan)
+    {.vramHash1 = 0x884d44b1, .vramHash2 = 0x3c376627, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ITCHY & SCRATC",     }, // Simpsons Itchy & Scratchy, The - Miniature Golf Madness (USA, Europe)
+    {.vramHash1 = 0x62d35351, .vramHash2 = 0x3c3ea3e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOW BROS.JR",       }, // Snow Bros. Jr. (Europe)
+    {.vramHash1 = 0xd95c049e, .vramHash2 = 0x3cb257ae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRAGONS LAIR  ",     }, // Dragon's Lair (Japan)
+    {.vramHash1 = 0x04162af0, .vramHash2 = 0x3ce9d7ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARK WING DUCK",     }, // Darkwing Duck (USA)
+    {.vramHash1 = 0x4e322794, .vramHash2 = 0x3ceeb0e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES",         }, // DuckTales (Europe)
+    {.vramHash1 = 0xa875db02, .vramHash2 = 0x3d55d23f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F1 SPIRIT",          }, // F-1 Spirit (Japan)
+    {.vramHash1 = 0xeb5091c7, .vramHash2 = 0x3d82ba17, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALFRED CHICKEN",     }, // Alfred Chicken (Japan)
+    {.vramHash1 = 0xf41e46b7, .vramHash2 = 0x3d92066d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBSY II",           }, // Bubsy II (Europe)
+    {.vramHash1 = 0xa2add336, .vramHash2 = 0x3e0c3886, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOY AND BLOB G",     }, // David Crane's The Rescue of Princess Blobette Starring A Boy and His Blob (Europe)
+    {.vramHash1 = 0xc8940cd7, .vramHash2 = 0x3e62ffd5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MADDEN 95",          }, // Madden '95 (USA, Europe)
+    {.vramHash1 = 0xe240c4bc, .vramHash2 = 0x3e8a09d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OPERATION C",        }, // Operation C (USA)
+    {.vramHash1 = 0xcbb328c1, .vramHash2 = 0x3ed0bc0d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-MAN",            }, // Pac-Man (Europe)
+    {.vramHash1 = 0x3561044e, .vramHash2 = 0x3eea4abc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY'S PINBAL",     }, // Kirby no Pinball (Japan)
+    {.vramHash1 = 0x96b72d36, .vramHash2 = 0x3f2fffed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SEA BATTLE",         }, // Sea Battle (Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0x53ea93a2, .vramHash2 = 0x3f430288, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARKMAN",            }, // Darkman (USA, Europe)
+    {.vramHash1 = 0x6d5fbe32, .vramHash2 = 0x3f555bdb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINY TOON ADVE",     }, // Tiny Toon Adventures (Japan), Tiny Toon Adventures - Babs' Big Break (USA, Europe)
+    {.vramHash1 = 0x7375c87e, .vramHash2 = 0x3f798a93, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADDAMS FAMILY ",     }, // Addams Family, The - Pugsley's Scavenger Hunt (USA, Europe)
+    {.vramHash1 = 0x898a3d99, .vramHash2 = 0x3fb18544, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PITMAN",             }, // Pitman (Japan)
+    {.vramHash1 = 0xf5362014, .vramHash2 = 0x3fbb6cbc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAINBENDER",        }, // Brain Bender (USA)
+    {.vramHash1 = 0x8d54b6f6, .vramHash2 = 0x3fd827ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VELIOUS 2",          }, // Velious II - Fukushuu no Jashin (Japan)
+    {.vramHash1 = 0xff9b0455, .vramHash2 = 0x3fdb5b6b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGALIT",            }, // Megalit (USA, Europe)
+    {.vramHash1 = 0x0809d543, .vramHash2 = 0x40400497, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "S S BASKETBALL",     }, // Super Street Basketball (Japan)
+    {.vramHash1 = 0xe649e1a7, .vramHash2 = 0x40496a88, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRACK MEET",         }, // Track Meet (USA, Europe)
+    {.vramHash1 = 0x61f50604, .vramHash2 = 0x405de130, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RANMA1/2 PART2",     }, // Ranma 1-2 - Netsuretsu Kakutou Hen (Japan)
+    {.vramHash1 = 0xe3ae2aae, .vramHash2 = 0x40747cac, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE CHESSMASTE",     }, // Chessmaster, The (DMG-N5) (USA) (Rev A), Chessmaster, The (DMG-N5) (USA)
+    {.vramHash1 = 0xa945b8ec, .vramHash2 = 0x40bd8ba4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KOF HEATOFBATT",     }, // King of Fighters, The - Heat of Battle (Europe)
+    {.vramHash1 = 0xa641b25d, .vramHash2 = 0x40de2c5f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KEN GRIFFEY JR",     }, // Ken Griffey Jr. Presents Major League Baseball (USA, Europe)
+    {.vramHash1 = 0x1e990c40, .vramHash2 = 0x4117c55d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOAL!",              }, // Goal! (Europe)
+    {.vramHash1 = 0x6ec2ba5d, .vramHash2 = 0x4178ae6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NBA LIVE 96",        }, // NBA Live 96 (USA, Europe)
+    {.vramHash1 = 0x04c8e9b4, .vramHash2 = 0x41c5f479, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIFA 98",            }, // FIFA Road to World Cup 98 (Europe) (Rev A), FIFA Road to World Cup 98 (Europe)
+    {.vramHash1 = 0x91cb88ba, .vramHash2 = 0x41d91df9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB NEW SD GUND",     }, // Shin SD Gundam Gaiden - Knight Gundam Story (Japan)
+    {.vramHash1 = 0x907d9620, .vramHash2 = 0x41f9e723, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FUNPAK 4IN1",        }, // 4-in-1 Fun Pak (Japan)
+    {.vramHash1 = 0x59adbee8, .vramHash2 = 0x41fba3e6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP",          }, // Nintendo World Cup (USA, Europe)
+    {.vramHash1 = 0xc85fd9de, .vramHash2 = 0x42a42241, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARK WING DUCK",     }, // Darkwing Duck (Germany)
+    {.vramHash1 = 0xa6ea025d, .vramHash2 = 0x42f4fa88, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHINKO TIME",      }, // Pachinko Time (Japan)
+    {.vramHash1 = 0x768e30c2, .vramHash2 = 0x435160e8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSHI'S COOKIE",     }, // Yoshi's Cookie (USA, Europe)
+    {.vramHash1 = 0xfab282bf, .vramHash2 = 0x4363dc73, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NOOBOW",             }, // Noobow (Japan)
+    {.vramHash1 = 0x05118f60, .vramHash2 = 0x437f5c9a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL DELUXE",     }, // Pinball Deluxe (Europe)
+    {.vramHash1 = 0xbc6681d5, .vramHash2 = 0x43d58b15, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEYS CHASE",      }, // Mickey's Dangerous Chase (Europe)
+    {.vramHash1 = 0xa85974fe, .vramHash2 = 0x43d5e5bd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE GETAWAY   ",     }, // Getaway, The (USA)
+    {.vramHash1 = 0xd243ae10, .vramHash2 = 0x43fc85fa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAMAKAWA NIHON",     }, // Goukaku Boy Series - Yamakawa Ichimonittou - Nihonshi B Yougo Mondaishuu (Japan)
+    {.vramHash1 = 0x239da979, .vramHash2 = 0x440c1f1c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JUNGLE STRIKE",      }, // Jungle Strike (USA, Europe)
+    {.vramHash1 = 0x02df2186, .vramHash2 = 0x4438ec97, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOGO ACKMAN   ",     }, // Go Go Ackman (Japan)
+    {.vramHash1 = 0x7b805328, .vramHash2 = 0x445a9483, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIKI 2 TENGOK",     }, // Chiki Chiki Tengoku (Japan)
+    {.vramHash1 = 0x237268f0, .vramHash2 = 0x448d84d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENCHIWOKURAU",      }, // Tenchi o Kurau (Japan)
+    {.vramHash1 = 0x4716d4a5, .vramHash2 = 0x448e6c0f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {{.jumpAddress = 0x3427, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x342b, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x3499, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "Battletoads",        }, // Battletoads (USA, Europe)
+    {.vramHash1 = 0xede0f3e6, .vramHash2 = 0x44965ce8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RODLAND",            }, // Yousei Monogatari - Rod Land (Japan)
+    {.vramHash1 = 0x27da5319, .vramHash2 = 0x44fa4836, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STARGATE",           }, // Stargate (USA, Europe)
+    {.vramHash1 = 0xe2afea7d, .vramHash2 = 0x451d24f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "W CIRCUIT SERI",     }, // World Circuit Series (USA)
+    {.vramHash1 = 0xa08d5b33, .vramHash2 = 0x4543ce26, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GREMLINS 2",         }, // Gremlins 2 - The New Batch (World)
+    {.vramHash1 = 0xcf5801be, .vramHash2 = 0x4588e112, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKKOKUGOAJ6",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Kokugo Battle Hen (Japan)
+    {.vramHash1 = 0x6a51bd65, .vramHash2 = 0x45b47135, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GO GO TANK",         }, // Go! Go! Tank (Japan)
+    {.vramHash1 = 0x6ac76ce5, .vramHash2 = 0x45d1aeab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DLAIR THE LEGE",     }, // Dragon's Lair - The Legend (USA)
+    {.vramHash1 = 0x9ac44ab2, .vramHash2 = 0x45d2a476, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAIL N SCALE",       }, // Nail'n Scale (USA, Europe)
+    {.vramHash1 = 0x7174ec51, .vramHash2 = 0x45e201dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTTIFANTEN",         }, // Otto's Ottifanten - Baby Bruno's Nightmare (Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0x7de30093, .vramHash2 = 0x4601782f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOCCER",             }, // Soccer (Europe) (En,Fr,De)
+    {.vramHash1 = 0x53451c1a, .vramHash2 = 0x461c9f3d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COSMO TANK",         }, // Cosmo Tank (USA)
+    {.vramHash1 = 0xfd648670, .vramHash2 = 0x461e0ea2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORDZAP",            }, // WordZap (USA)
+    {.vramHash1 = 0x1cb87e27, .vramHash2 = 0x4620049f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALAGA&GALAXIA",     }, // Arcade Classic No. 3 - Galaga & Galaxian (Europe)
+    {.vramHash1 = 0x0a4779d0, .vramHash2 = 0x464e9052, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADDAMS FAMILY",      }, // Addams Family, The (Japan)
+    {.vramHash1 = 0xc2f7169a, .vramHash2 = 0x46d51c82, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SMALL SOLDIERS",     }, // Small Soldiers (USA, Europe)
+    {.vramHash1 = 0x3270f833, .vramHash2 = 0x47110e5b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOLF CLASSIC",       }, // Golf Classic (Europe)
+    {.vramHash1 = 0x01893017, .vramHash2 = 0x471f3f6a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAVY BLUE 90",       }, // Navy Blue 90 (Japan)
+    {.vramHash1 = 0x249fdf88, .vramHash2 = 0x473380dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GAUNTLET II",        }, // Gauntlet II (USA, Europe)
+    {.vramHash1 = 0xb920613e, .vramHash2 = 0x4742fc66, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARK WING DUCK",     }, // Darkwing Duck (Spain)
+    {.vramHash1 = 0x07b5a6bf, .vramHash2 = 0x4752cfe9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MILON CASTLE",       }, // Milon's Secret Castle (USA, Europe)
+    {.vramHash1 = 0xca9f1724, .vramHash2 = 0x484bab40, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-MAN",            }, // Pac-Man (Japan)
+    {.vramHash1 = 0x22ded44d, .vramHash2 = 0x485dcb2e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NORTH STAR",         }, // Fist of the North Star (USA)
+    {.vramHash1 = 0x02b4ce82, .vramHash2 = 0x49b82b15, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOUKOBAN",           }, // Soukoban (Japan)
+    {.vramHash1 = 0x2c295f35, .vramHash2 = 0x49c2ebb0, .dmaFix = 0xff95, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Alien vs Predator",  }, // Alien vs Predator (Japan)
+    {.vramHash1 = 0xbcf8ecd9, .vramHash2 = 0x49e30348, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENTADRAGON",        }, // Penta Dragon (Japan)
+    {.vramHash1 = 0x0e36e932, .vramHash2 = 0x49ec5fd6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAZMANIA",           }, // Taz-Mania 2 (USA)
+    {.vramHash1 = 0x4b7feecf, .vramHash2 = 0x4a04ddc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RVT",                }, // RoboCop vs. The Terminator (USA)
+    {.vramHash1 = 0x3717b049, .vramHash2 = 0x4a2c8abf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAIYUUKI",           }, // Pachinko Saiyuuki (Japan)
+    {.vramHash1 = 0x83ae1ce4, .vramHash2 = 0x4a4c8bf5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WINTER GOLD",        }, // Winter Gold (Europe)
+    {.vramHash1 = 0xeadb6b72, .vramHash2 = 0x4a8bb694, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICRO MACHINES",     }, // Micro Machines (USA, Europe)
+    {.vramHash1 = 0x74442121, .vramHash2 = 0x4a955242, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPOT",               }, // Spot (Japan)
+    {.vramHash1 = 0x46d44ed0, .vramHash2 = 0x4affc7ec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPARTAN X",          }, // Spartan X (Japan)
+    {.vramHash1 = 0xaab0f9cc, .vramHash2 = 0x4b396ff4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SMURFS 3",       }, // Smurfs Nightmare, The (Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0xa45ca602, .vramHash2 = 0x4b521df4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKMANWORLD5",      }, // Rockman World 5 (Japan)
+    {.vramHash1 = 0xc124a662, .vramHash2 = 0x4b8a9d23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GRADIUS",            }, // Gradius - The Interstellar Assault (USA)
+    {.vramHash1 = 0x10f943d6, .vramHash2 = 0x4b8ad2f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAWAPURO GB",        }, // Power Pro GB (Japan) (Rev A), Power Pro GB (Japan)
+    {.vramHash1 = 0xc71dd140, .vramHash2 = 0x4c2c283b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NOBUNAGA",           }, // Nobunaga's Ambition (USA)
+    {.vramHash1 = 0xbe407542, .vramHash2 = 0x4cac79e6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SMURFS2",            }, // Smurfs Travel the World, The (Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0x6d2632b0, .vramHash2 = 0x4d617e55, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = " DMG AGING TES",     }, // Game Boy Controller Kensa Cartridge (Japan)
+    {.vramHash1 = 0x20327266, .vramHash2 = 0x4e119ba3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CLEMENS BASEBA",     }, // MVP Baseball (Japan), Roger Clemens' MVP Baseball (USA)
+    {.vramHash1 = 0x79ae9c90, .vramHash2 = 0x4e11c841, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-PANIC",          }, // Pac-Panic (Japan)
+    {.vramHash1 = 0x38826855, .vramHash2 = 0x4e22c6bb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPEYE 2",           }, // Popeye 2 (USA)
+    {.vramHash1 = 0x03bbb827, .vramHash2 = 0x4e3db320, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHIO KUN",         }, // Pachio-kun (Japan)
+    {.vramHash1 = 0x73a8c57b, .vramHash2 = 0x4e5b5ffb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HERCULES EIKOU",     }, // Heracles no Eikou - Ugokidashita Kamigami (Japan)
+    {.vramHash1 = 0x0264ccbe, .vramHash2 = 0x4e8db198, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STUDYBOY KUKU ",     }, // Doraemon no Study Boy 3 - Ku Ku Master (Japan)
+    {.vramHash1 = 0xa4f9ab3f, .vramHash2 = 0x4f13defb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BLODIA",             }, // Blodia (Japan)
+    {.vramHash1 = 0x01096fa3, .vramHash2 = 0x4fadb6f1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KYOUDAI JINGI",      }, // Uchiiwai - Kyoudaijingi no Puzzle Game (Japan)
+    {.vramHash1 = 0x4847f6ff, .vramHash2 = 0x4fc8b229, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KESAMARU",           }, // Panel no Ninja Kesamaru (Japan)
+    {.vramHash1 = 0xc8d0aace, .vramHash2 = 0x4fee59eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PROWRES",            }, // HAL Wrestling (USA) (Beta), HAL Wrestling (USA)
+    {.vramHash1 = 0xd5ddc94e, .vramHash2 = 0x50085161, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FERRARI",            }, // Ferrari Grand Prix Challenge (USA, Europe)
+    {.vramHash1 = 0x8ca509c5, .vramHash2 = 0x507ba749, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MM ULT CHALLEN",     }, // Mickey's Ultimate Challenge (USA, Europe)
+    {.vramHash1 = 0xe6ad4032, .vramHash2 = 0x5098390b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIDER-MAN",         }, // Amazing Spider-Man, The (USA, Europe)
+    {.vramHash1 = 0xcdc793a9, .vramHash2 = 0x50af7440, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UMINUSHI      ",     }, // Umi no Nushi Tsuri 2 (Japan)
+    {.vramHash1 = 0x85a741e0, .vramHash2 = 0x50c90878, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOOK",               }, // Hook (Europe)
+    {.vramHash1 = 0xdd1af877, .vramHash2 = 0x512b09da, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mazekko Monster",    }, // Chou Mashin Eiyuu Den Wataru - Mazekko Monster (Japan) (Beta), Chou Mashin Eiyuu Den Wataru - Mazekko Monster (Japan)
+    {.vramHash1 = 0x58872800, .vramHash2 = 0x5150c400, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET JOCKEY",      }, // Shin Keiba Kizoku Pocket Jockey (Japan)
+    {.vramHash1 = 0xad60273c, .vramHash2 = 0x517fe80d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SRJ DMG",            }, // Super Star Wars - Return of the Jedi (USA, Europe)
+    {.vramHash1 = 0x41d28746, .vramHash2 = 0x51b1ff99, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOUKOBAN2",          }, // Soukoban 2 (Japan)
+    {.vramHash1 = 0x58878fa8, .vramHash2 = 0x51d62aa1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP",          }, // Nekketsu Koukou Soccer-bu - World Cup Hen (Japan)
+    {.vramHash1 = 0x8cd80c16, .vramHash2 = 0x52821e3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POKONYAN!",          }, // Pokonyan! - Yume no Daibouken (Japan)
+    {.vramHash1 = 0x1dd08852, .vramHash2 = 0x5296b6a4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE MASTER ",     }, // Little Master 2 - Raikou no Kishi (Japan)
+    {.vramHash1 = 0x2ac51058, .vramHash2 = 0x52b68841, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROGER RABBIT",       }, // Who Framed Roger Rabbit (USA)
+    {.vramHash1 = 0xe0fa8747, .vramHash2 = 0x52bc64eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F15 STRIKE EAG",     }, // F-15 Strike Eagle II (Unknown) (Proto)
+    {.vramHash1 = 0xc1516b68, .vramHash2 = 0x530c1fb8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB DBZ GOKOU",       }, // Dragon Ball Z - Gokuu Hishouden (Japan)
+    {.vramHash1 = 0x835e7b75, .vramHash2 = 0x53554ae9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIABLO",             }, // Diablo (USA) (Proto)
+    {.vramHash1 = 0x9dd8daec, .vramHash2 = 0x5379d274, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOOPY",             }, // Snoopy - Magic Show (Japan)
+    {.vramHash1 = 0x58891940, .vramHash2 = 0x538124a0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BASEBALL",           }, // Baseball (World)
+    {.vramHash1 = 0xa40e12ed, .vramHash2 = 0x53ae877d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RACING DAMASHI",     }, // Racing Damashii (Japan)
+    {.vramHash1 = 0x6e1d7347, .vramHash2 = 0x53d021d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "IN YOUR FACE",       }, // In Your Face (USA)
+    {.vramHash1 = 0x3ee6b814, .vramHash2 = 0x54235de1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUSTER BROTHER",     }, // Buster Bros. (USA)
+    {.vramHash1 = 0x67058322, .vramHash2 = 0x543e30d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENJINCOTTU",        }, // Genjin Cottsu (Japan)
+    {.vramHash1 = 0x7f6434c1, .vramHash2 = 0x545c2c9d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ISHIDO JPN VER",     }, // Ishido - The Way of Stones (Japan)
+    {.vramHash1 = 0x70783e15, .vramHash2 = 0x548d0442, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SWORD OFHO",     }, // Sword of Hope, The (Sweden)
+    {.vramHash1 = 0x3e141bc6, .vramHash2 = 0x54a6ee56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "METROID2",           }, // Metroid II - Return of Samus (World)
+    {.vramHash1 = 0x85af6249, .vramHash2 = 0x54b1d998, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Double Dragon",      }, // Double Dragon (USA, Europe)
+    {.vramHash1 = 0xf17e939f, .vramHash2 = 0x54f8eeac, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZETAN 1500",         }, // Goukaku Boy Series - Z Kai Kyuukyoku no Eitango 1500 (Japan)
+    {.vramHash1 = 0x643f22e2, .vramHash2 = 0x55016c16, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KLAX",               }, // Klax (Japan)
+    {.vramHash1 = 0xcbfe9235, .vramHash2 = 0x55255390, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mazekko Monster",    }, // Chou Mashin Eiyuu Den Wataru - Mazekko Monster 2 (Japan)
+    {.vramHash1 = 0x55a8f7f7, .vramHash2 = 0x55c89c31, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORDTRIS",           }, // Wordtris (USA)
+    {.vramHash1 = 0x45178a83, .vramHash2 = 0x55dc3c10, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPOT",               }, // Spot (USA)
+    {.vramHash1 = 0xbce4c744, .vramHash2 = 0x55e01a0f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTERTRUCK",       }, // Monster Truck (Japan)
+    {.vramHash1 = 0x57509696, .vramHash2 = 0x55fa60d3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLE QUEST U",     }, // Castle Quest (Europe)
+    {.vramHash1 = 0xf8b5d1f1, .vramHash2 = 0x56038d5f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARK WING DUCK",     }, // Darkwing Duck (Europe)
+    {.vramHash1 = 0x4d22eb60, .vramHash2 = 0x5626cd4a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINKU",              }, // Ninku (Japan)
+    {.vramHash1 = 0xaa593437, .vramHash2 = 0x567f8b63, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TDL MICKEY",         }, // Tokyo Disneyland - Mickey no Cinderella-jou Mystery Tour (Japan)
+    {.vramHash1 = 0x97fea4a3, .vramHash2 = 0x57324d4e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUKANJIBK4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Kanji no Tatsujin (Japan) (Special Edition)
+    {.vramHash1 = 0x6795ad60, .vramHash2 = 0x5736794a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Red/Green",  }, // Pocket Monsters - Aka (Japan) (Rev A), Pocket Monsters - Aka (Japan), Pocket Monsters - Midori (Japan) (Rev A), Pocket Monsters - Midori (Japan)
+    {.vramHash1 = 0x17666ff7, .vramHash2 = 0x577a8850, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOCCER BOY",         }, // Soccer Boy (Japan)
+    {.vramHash1 = 0xa3a33649, .vramHash2 = 0x57b78a3a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENNIS",             }, // Tennis (World)
+    {.vramHash1 = 0x3f64bfdd, .vramHash2 = 0x57fd200b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPORTS COLLECT",     }, // Sports Collection (Japan)
+    {.vramHash1 = 0xdd016e16, .vramHash2 = 0x58160fa6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POWER MODELLER",     }, // Gekitou Power Modeller (Japan)
+    {.vramHash1 = 0x7db69807, .vramHash2 = 0x5870f0ad, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOONEY TUNES",       }, // Looney Tunes - Bugs Bunny to Yukai na Nakama-tachi (Japan)
+    {.vramHash1 = 0x4e2fd295, .vramHash2 = 0x58a36a1c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DODGE BOY",          }, // Dodge Boy (Japan)
+    {.vramHash1 = 0x58aa08fe, .vramHash2 = 0x58a5ffea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHIKINJYO",          }, // Shikinjou (Japan)
+    {.vramHash1 = 0x9fd7e83d, .vramHash2 = 0x58e416eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE GAME OF LI",     }, // Jinsei Game (Japan)
+    {.vramHash1 = 0xdda59a3b, .vramHash2 = 0x58fdb050, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZOIDS J1",           }, // Zoids Densetsu (Japan)
+    {.vramHash1 = 0xae8a8bdb, .vramHash2 = 0x590d6f00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIBIMARUKO",        }, // Chibi Maruko-chan - Okozukai Daisakusen! (Japan)
+    {.vramHash1 = 0x97fed640, .vramHash2 = 0x5943d15a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB GENJIN     ",     }, // GB Genjin (Japan), Mani 4 in 1 (China) (DMG-605 CHN)
+    {.vramHash1 = 0xfff04000, .vramHash2 = 0x59502000, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KILLERINSTINCT",     }, // Killer Instinct (USA, Europe)
+    {.vramHash1 = 0x8dff2f1c, .vramHash2 = 0x59548207, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER MAX",        }, // Monster Max (Europe) (En,Fr,De,Es,It,Nl)
+    {.vramHash1 = 0xbf1eb301, .vramHash2 = 0x59595c5a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RED OCTOBER",        }, // Red October o Oe! (Japan)
+    {.vramHash1 = 0x30f4175b, .vramHash2 = 0x59642242, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE PAGEMASTER",     }, // Pagemaster, The (Europe), Pagemaster, The (USA)
+    {.vramHash1 = 0x83697f42, .vramHash2 = 0x59d90b0b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB BASKETBALL",      }, // GB Basketball (Japan)
+    {.vramHash1 = 0xa7a9909b, .vramHash2 = 0x5a1c5eff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SLAM DUNK 2",     }, // From TV Animation Slam Dunk 2 - Zenkoku e no Tip Off (Japan)
+    {.vramHash1 = 0x8cc8b3ef, .vramHash2 = 0x5a20e092, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOOK",               }, // Hook (USA)
+    {.vramHash1 = 0xd49f8ad4, .vramHash2 = 0x5a25cdf6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VALATIONS",          }, // Totsugeki Valations (Japan)
+    {.vramHash1 = 0x772b0889, .vramHash2 = 0x5a2f992f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JOE AND MAC",        }, // Joe & Mac - Caveman Ninja (Europe) (En,Fr,De,Es,It,Nl,Sv)
+    {.vramHash1 = 0x3460badb, .vramHash2 = 0x5a39b9ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LUCLE",              }, // Lucle (Japan, Europe)
+    {.vramHash1 = 0xb05c295d, .vramHash2 = 0x5a9d7c66, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLDAM GB",          }, // Soldam (Japan)
+    {.vramHash1 = 0x6eba6c80, .vramHash2 = 0x5af383d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DETECTIVCONAN2",     }, // Meitantei Conan - Giwaku no Gouka Ressha (Japan)
+    {.vramHash1 = 0x63bff91d, .vramHash2 = 0x5b0b1e8a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-IN-TIME",        }, // Pac-In-Time (Japan)
+    {.vramHash1 = 0xb7526f50, .vramHash2 = 0x5b0e4ca6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CENTIPEDE",          }, // Centipede (USA)
+    {.vramHash1 = 0xa6e776e2, .vramHash2 = 0x5b24137e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DODGE BALL",         }, // Nekketsu Koukou Dodgeball-bu - Kyouteki! Dodge Soldier no Maki (Japan)
+    {.vramHash1 = 0x6d3ab38f, .vramHash2 = 0x5b5f0f03, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Game Boy Gallery",   }, // Game Boy Gallery (Japan)
+    {.vramHash1 = 0xf223fa16, .vramHash2 = 0x5ba30551, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAMAGOTCHI ",     }, // Tamagotchi (France)
+    {.vramHash1 = 0xfe5e2c9d, .vramHash2 = 0x5c114b8f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRUMP COLLECTI",     }, // Trump Collection GB (Japan)
+    {.vramHash1 = 0x4febadd0, .vramHash2 = 0x5c319f4f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Fighbird GB",        }, // Taiyou no Yuusha - Fighbird GB (Japan)
+    {.vramHash1 = 0xee7775bd, .vramHash2 = 0x5ca9d793, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HATRIS",             }, // Hatris (Japan, USA)
+    {.vramHash1 = 0xf22412ec, .vramHash2 = 0x5cae99af, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAMAGOTCHI ",     }, // Tamagotchi (USA, Europe)
+    {.vramHash1 = 0x0c3eba2a, .vramHash2 = 0x5cbbdcf6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Red",        }, // Pokemon - Red Version (USA, Europe)
+    {.vramHash1 = 0xbc7c2fc6, .vramHash2 = 0x5cc66610, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SD LUPIN THE 3",     }, // SD Lupin Sansei - Kinko Yaburi Daisakusen (Japan)
+    {.vramHash1 = 0x504de2c5, .vramHash2 = 0x5cc9841d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP USA ",     }, // World Cup USA 94 (Japan) (En,Fr,De,Es,It,Nl,Pt,Sv)
+    {.vramHash1 = 0xb48b9af0, .vramHash2 = 0x5d05cfd2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SCHIFFE",            }, // Schiffe Versenken (Germany) (En,Fr,De,Es)
+    {.vramHash1 = 0x23003667, .vramHash2 = 0x5d1c6630, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUMO FIGHTER",       }, // Sumo Fighter (USA)
+    {.vramHash1 = 0xc38233bd, .vramHash2 = 0x5d4916e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALLERY2",           }, // Namco Gallery Vol.2 (Japan)
+    {.vramHash1 = 0x0e2275e6, .vramHash2 = 0x5d6759ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERCHINESE 1",     }, // Super Chinese Land 1.2.3' (Japan)
+    {.vramHash1 = 0xfd0e69be, .vramHash2 = 0x5d731f5f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAESARS PALACE",     }, // Caesars Palace (USA) (Rev A)
+    {.vramHash1 = 0xfd0e6e91, .vramHash2 = 0x5d79d330, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAESARS PALACE",     }, // Caesars Palace (Japan)
+    {.vramHash1 = 0x6996f160, .vramHash2 = 0x5db663cc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET SHOGI",       }, // Pocket Shougi (Japan)
+    {.vramHash1 = 0xf2629843, .vramHash2 = 0x5de13e6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWFKOR",             }, // WWF King of the Ring (USA, Europe)
+    {.vramHash1 = 0xf2243640, .vramHash2 = 0x5e151495, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAMAGOTCH 1",     }, // Game de Hakken!! Tamagotchi (Japan)
+    {.vramHash1 = 0xfecac3eb, .vramHash2 = 0x5e1bb447, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALSTARCHALLENG",     }, // NBA All Star Challenge 2 (Japan), NBA All Star Challenge 2 (USA, Europe)
+    {.vramHash1 = 0x3e98fe9b, .vramHash2 = 0x5e672f1e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD STRIKER",      }, // World Cup Striker (Japan)
+    {.vramHash1 = 0x495e2037, .vramHash2 = 0x5e9defa4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEMMINGS",           }, // Lemmings (Europe) (Rev A), Lemmings (USA)
+    {.vramHash1 = 0xcffc57d2, .vramHash2 = 0x5ee7b440, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PA BINGO",           }, // Panel Action Bingo (USA)
+    {.vramHash1 = 0xc30d4007, .vramHash2 = 0x5ef2c003, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJATARO",          }, // Ninja Taro (USA)
+    {.vramHash1 = 0xbb74a003, .vramHash2 = 0x5f061cc5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLEUNIT ZEO",     }, // Battle Unit Zeoth (USA, Europe)
+    {.vramHash1 = 0x7d57a3df, .vramHash2 = 0x5f3d013b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUYOPUYO",           }, // Puyo Puyo (Japan) (Rev A), Puyo Puyo (Japan)
+    {.vramHash1 = 0xe62ca19b, .vramHash2 = 0x5f45f44e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER MARIOLAN",     }, // Super Mario Land (World) (Rev A), Super Mario Land (World)
+    {.vramHash1 = 0xf4104289, .vramHash2 = 0x5fc799ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QIX",                }, // QIX (World)
+    {.vramHash1 = 0x94bf5172, .vramHash2 = 0x60276348, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BARBIE GAME GI",     }, // Barbie - Game Girl (USA, Europe)
+    {.vramHash1 = 0xfab564d9, .vramHash2 = 0x602adfd9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS 2 HERO",     }, // Nemesis II - The Return of the Hero (Europe)
+    {.vramHash1 = 0xe0f677a2, .vramHash2 = 0x60329e80, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY DREAM LA",     }, // Kirby's Dream Land (USA, Europe)
+    {.vramHash1 = 0x9e7b2b0f, .vramHash2 = 0x6063f05a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAPCOM QUIZ",        }, // Capcom Quiz - Hatena no Daibouken (Japan)
+    {.vramHash1 = 0x660ce13f, .vramHash2 = 0x6132f84c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAKENOU",            }, // Ippatsu Gyakuten! DX Bakenou (Japan)
+    {.vramHash1 = 0x469dafbb, .vramHash2 = 0x616ca148, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAVE NOIRE",         }, // Cave Noire (Japan)
+    {.vramHash1 = 0xbb921162, .vramHash2 = 0x61e5352f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HUDSON HAWK",        }, // Hudson Hawk (Japan), Hudson Hawk (USA)
+    {.vramHash1 = 0x7fe4713f, .vramHash2 = 0x621ae35c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOGIS GOLDRUSH",     }, // Yogi Bear in Yogi Bear's Goldrush (Europe)
+    {.vramHash1 = 0x03fcb6bb, .vramHash2 = 0x6225755a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROGER RABBIT",       }, // Who Framed Roger Rabbit (Spain)
+    {.vramHash1 = 0x989ab1d0, .vramHash2 = 0x6233f6d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GARGOYLE'S",         }, // Gargoyle's Quest (USA, Europe)
+    {.vramHash1 = 0xcc1c5ff5, .vramHash2 = 0x62363c94, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "G&W GALLERY",        }, // Game & Watch Gallery (Europe), Game & Watch Gallery (USA) (Rev A), Game & Watch Gallery (USA)
+    {.vramHash1 = 0xd4d203a1, .vramHash2 = 0x6239d89b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALIEN OLYMPICS",     }, // Alien Olympics (Europe)
+    {.vramHash1 = 0xd368cd77, .vramHash2 = 0x6241ecb6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPER BLACKBAS",     }, // Hyper Black Bass (Japan) (En,Ja)
+    {.vramHash1 = 0x5dc952ac, .vramHash2 = 0x624380a2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Medarot",            }, // Medarot - Kabuto Version (Japan) (Rev A), Medarot - Kabuto Version (Japan), Medarot - Kuwagata Version (Japan) (Rev A), Medarot - Kuwagata Version (Japan)
+    {.vramHash1 = 0xd6cfe0f7, .vramHash2 = 0x62470ae1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DOUBLEYAKUMAN ",     }, // Double Yakuman Junior (Japan)
+    {.vramHash1 = 0xb032fec6, .vramHash2 = 0x6270881e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER SCRABBLE",     }, // Super Scrabble (USA)
+    {.vramHash1 = 0xcf0c8dda, .vramHash2 = 0x6271ceee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SENGOKUNINJAKU",     }, // Sengoku Ninja-kun (Japan)
+    {.vramHash1 = 0x36f3e181, .vramHash2 = 0x62963497, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCK'N! MONSTE",     }, // Rock'n! Monster!! (Japan)
+    {.vramHash1 = 0xb09f0e36, .vramHash2 = 0x62b2ae90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GO! GO! HICHHI",     }, // Go! Go! Hitchhike (Japan)
+    {.vramHash1 = 0xa6fc336c, .vramHash2 = 0x62bed973, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-IN-TIME",        }, // Pac-In-Time (USA)
+    {.vramHash1 = 0x979e9919, .vramHash2 = 0x62d702ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLINTSTONES",        }, // Flintstones, The - King Rock Treasure Island (USA, Europe)
+    {.vramHash1 = 0x197686f4, .vramHash2 = 0x62da51af, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MILLI/CENTI/PE",     }, // Arcade Classic No. 2 - Centipede & Millipede (USA, Europe)
+    {.vramHash1 = 0x5a54fd59, .vramHash2 = 0x63182045, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUUYUU-4",           }, // Yu Yu Hakusho Dai-4-dan - Makai Touitsu Hen (Japan)
+    {.vramHash1 = 0x5eec3825, .vramHash2 = 0x636d6580, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BURGER TIME",        }, // BurgerTime Deluxe (World)
+    {.vramHash1 = 0xd9684df4, .vramHash2 = 0x63a80869, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VRALLY",             }, // V-Rally - Championship Edition (Europe) (En,Fr,De)
+    {.vramHash1 = 0xbc2779cb, .vramHash2 = 0x63cd74db, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOST WORLD",         }, // Lost World, The - Jurassic Park (USA, Europe), Monde Perdu, Le - Jurassic Park (France)
+    {.vramHash1 = 0xc81fe796, .vramHash2 = 0x63e60ac4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MISSILE COMMAN",     }, // Missile Command (USA, Europe)
+    {.vramHash1 = 0x9f586321, .vramHash2 = 0x642843ee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUZUKEIBZ4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Zukei no Tatsujin (Japan)
+    {.vramHash1 = 0xeac22dca, .vramHash2 = 0x646ee252, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOXXLE",             }, // Boxxle (USA, Europe) (Rev A)
+    {.vramHash1 = 0xe38de191, .vramHash2 = 0x6493a3ca, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UNDER COVER CO",     }, // Undercover Cops Gaiden - Hakaishin Garumaa (Japan)
+    {.vramHash1 = 0xfda45d1f, .vramHash2 = 0x64d45c67, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALLSTARCHALLEN",     }, // NBA All Star Challenge (USA, Europe)
+    {.vramHash1 = 0x324576d0, .vramHash2 = 0x64f6d8a5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HON SHOGI",          }, // Hon Shougi (Japan)
+    {.vramHash1 = 0x99f64433, .vramHash2 = 0x65110d23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ASTERIX",            }, // Asterix (Europe) (En,Fr,De,Es,It)
+    {.vramHash1 = 0xed13854f, .vramHash2 = 0x651d9376, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIONIC BATTLER",     }, // Bionic Battler (USA)
+    {.vramHash1 = 0x43b92a11, .vramHash2 = 0x6534a3f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBCOLLECTION 1",     }, // Konami GB Collection Vol.1 (Japan)
+    {.vramHash1 = 0xc346f65b, .vramHash2 = 0x653b3167, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BIKKURI NEKKET",     }, // Bikkuri Nekketsu Shin Kiroku! - Dokodemo Kin Medal (Japan)
+    {.vramHash1 = 0x965df5c2, .vramHash2 = 0x656cc596, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOOBY BOYS",         }, // Booby Boys (Japan)
+    {.vramHash1 = 0x54a9562d, .vramHash2 = 0x6578929a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KEITAI KEIBA 8",     }, // Keitai Keiba Eight Special (Japan)
+    {.vramHash1 = 0x9725467b, .vramHash2 = 0x65ca49f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHAMPIONSHIP P",     }, // Championship Pool (USA)
+    {.vramHash1 = 0xd4741c35, .vramHash2 = 0x65e6015a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRAMAN",           }, // Ultraman (Japan)
+    {.vramHash1 = 0xf9e89757, .vramHash2 = 0x66278ec0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HARVEST-MOON G",     }, // Harvest Moon GB (USA)
+    {.vramHash1 = 0x6bb82df4, .vramHash2 = 0x6632711c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DOUBLE DRIBBLE",     }, // Double Dribble - 5 on 5 (USA)
+    {.vramHash1 = 0x56d6e7d7, .vramHash2 = 0x664ccf29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REKISINENDAI 2",     }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Rekishi Nendai Anki Point 240 (Japan)
+    {.vramHash1 = 0x83661813, .vramHash2 = 0x668bb2ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOONEY TUNES",       }, // Looney Tunes (USA, Europe)
+    {.vramHash1 = 0xa6bbd2c2, .vramHash2 = 0x668c2462, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FUSHIGINA BULO",     }, // Fushigi na Blobby - Princess Blob o Sukue! (Japan)
+    {.vramHash1 = 0xd296c585, .vramHash2 = 0x6698e149, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {0xff, 0xa8, 0xff, 0xa9, 0xaa, 0x42, 0xab, 0x43, 0xac, 0x4a, 0xad, 0x4b, 0xae, 0x47, 0xaf, 0x48, 0xb0, 0x49, 0xb1, 0x40}, .title = "Tetris 2",           }, // Tetris 2 (USA), Tetris 2 (USA, Europe)
+    {.vramHash1 = 0x35a6e3d4, .vramHash2 = 0x66a4bd3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBER MAN GB ",     }, // Bomber Man GB 2 (Japan)
+    {.vramHash1 = 0x35a6e71c, .vramHash2 = 0x66dbec5a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBER MAN GB",      }, // Bomberman GB (USA, Europe)
+    {.vramHash1 = 0xe88f0f07, .vramHash2 = 0x66e7fb0c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBCOLLECTION 2",     }, // Konami GB Collection Vol.2 (Japan)
+    {.vramHash1 = 0x02080e70, .vramHash2 = 0x6700f0c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STUDYBOY KAN10",     }, // Doraemon no Study Boy 6 - Gakushuu Kanji Master 1006 (Japan)
+    {.vramHash1 = 0xc5f408e6, .vramHash2 = 0x671e1f92, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DARUMAN BUSTER",     }, // Peke to Poko no Daruman Busters (Japan)
+    {.vramHash1 = 0x54b3962d, .vramHash2 = 0x6721f29a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THUME SHOGI",        }, // Tsumeshougi - Hyakuban Shoubu (Japan)
+    {.vramHash1 = 0x9c861662, .vramHash2 = 0x6732b36c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOLF",               }, // Golf (World)
+    {.vramHash1 = 0xcc821227, .vramHash2 = 0x673d4aa8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPUDS ADVENTUR",     }, // Spud's Adventure (USA)
+    {.vramHash1 = 0x2451181f, .vramHash2 = 0x673f109f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL PARTY",      }, // Hero Shuugou!! Pinball Party (Japan)
+    {.vramHash1 = 0xe5f359d5, .vramHash2 = 0x67785955, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONOPOLY",           }, // Monopoly (USA)
+    {.vramHash1 = 0xfbc275c6, .vramHash2 = 0x67842d76, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Contra Spirits",     }, // Contra - The Alien Wars (USA), Contra Spirits (Japan), Probotector 2 (Europe) (Beta), Probotector 2 (Europe)
+    {.vramHash1 = 0x50c52e47, .vramHash2 = 0x684f0df5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MR NUTZ",            }, // Mr. Nutz (Europe)
+    {.vramHash1 = 0xe79f0d6b, .vramHash2 = 0x68697850, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris BLAST",       }, // Tetris Blast (USA, Europe)
+    {.vramHash1 = 0xe19e4681, .vramHash2 = 0x68928a06, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = true, .accurateRendering = false, .branchBasedFixes = {{.jumpAddress = 0x0526, .fixTarget = 3, .takenMethod = nop, .takenValue = 0x00, .notTakenMethod = sync, .notTakenValue = 0x00}, }, .writeRegistersDuringDMA = {}, .title = "Samurai Shodown",    }, // Samurai Shodown (USA, Europe) (Beta), Samurai Shodown (USA, Europe)
+    {.vramHash1 = 0x7303dc07, .vramHash2 = 0x689477a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATMAN",             }, // Batman - The Video Game (World)
+    {.vramHash1 = 0x009859c4, .vramHash2 = 0x68af048e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "METAL MASTERS",      }, // Metal Masters (USA)
+    {.vramHash1 = 0xf9163ba2, .vramHash2 = 0x68af17c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBWARST",            }, // Game Boy Wars Turbo (Japan)
+    {.vramHash1 = 0xedaaf057, .vramHash2 = 0x68be4ed0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRACK MEET HIR",     }, // Track Meet - Mezase! Barcelona (Japan)
+    {.vramHash1 = 0x32584c84, .vramHash2 = 0x68e687b4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BISHOJYOSENSI ",     }, // Bishoujo Senshi Sailor Moon (Japan)
+    {.vramHash1 = 0xe588671a, .vramHash2 = 0x690dd8b0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PENGUIN BOY",        }, // Osawagase! Penguin Boy (Japan)
+    {.vramHash1 = 0x7e18fa94, .vramHash2 = 0x696463fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAKENOH V3",         }, // Bakenou V3 (Japan)
+    {.vramHash1 = 0xd782da14, .vramHash2 = 0x69813ef9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL HAND",          }, // Cool Hand (Europe) (Fr,De)
+    {.vramHash1 = 0x76e80730, .vramHash2 = 0x69967648, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {{.jumpAddress = 0x46ff, .fixTarget = 0xc316, .takenMethod = or, .takenValue = 0x10, .notTakenMethod = and, .notTakenValue = 0xef}, {.jumpAddress = 0x46ff, .fixTarget = 0xc316, .takenMethod = and, .takenValue = 0xdf, .notTakenMethod = or, .notTakenValue = 0x20}, }, .writeRegistersDuringDMA = {}, .title = "Fighting Simulator", }, // Fighting Simulator 2 in 1 (USA, Europe)
+    {.vramHash1 = 0xd0a5220c, .vramHash2 = 0x6a0a6424, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRAKIRA KIDS",      }, // Kirby no Kirakira Kids (Japan)
+    {.vramHash1 = 0xa0f3df32, .vramHash2 = 0x6a1fecc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINTIN TEMPLES",     }, // Tintin - Prisoners of the Sun (Europe) (En,Fr,De)
+    {.vramHash1 = 0x0d1f3144, .vramHash2 = 0x6a3fcb20, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB PATLABOR 1",      }, // Kidou Keisatsu Patlabor - Nerawareta Machi 1990 (Japan)
+    {.vramHash1 = 0x002c185c, .vramHash2 = 0x6a433f3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPEYE 2",           }, // Popeye 2 (Japan)
+    {.vramHash1 = 0x1b5298ad, .vramHash2 = 0x6a55250f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORMS",              }, // Worms (Europe)
+    {.vramHash1 = 0x66b2c8fd, .vramHash2 = 0x6a9f65e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMHT3",              }, // Teenage Mutant Hero Turtles III - Radical Rescue (Europe)
+    {.vramHash1 = 0x359eeafe, .vramHash2 = 0x6aebc715, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU KOF 95",      }, // King of Fighters '95, The (Europe)
+    {.vramHash1 = 0x99def500, .vramHash2 = 0x6aed2b5e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJA SPIRIT",       }, // Saigo no Nindou (Japan)
+    {.vramHash1 = 0xc9c11949, .vramHash2 = 0x6af79d6d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAHJONGKYOUSIT",     }, // Nada Asatarou & Kojima Takeo no Jissen Mahjong Kyoushitsu (Japan)
+    {.vramHash1 = 0x13e9bf58, .vramHash2 = 0x6b09bbb4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAIKYOKU RENJU",     }, // Taikyoku Renju (Japan) (En,Ja)
+    {.vramHash1 = 0xbafc4d73, .vramHash2 = 0x6b41d536, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AGRO SOAR",          }, // Agro Soar (Australia)
+    {.vramHash1 = 0xae591b00, .vramHash2 = 0x6b6b5f4a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN5",           }, // Mega Man V (Europe)
+    {.vramHash1 = 0x1788af4f, .vramHash2 = 0x6ba0dec5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THUNDERBIRDS",       }, // Thunderbirds (Japan)
+    {.vramHash1 = 0x6c754c16, .vramHash2 = 0x6bcbbf08, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Double Dragon",      }, // Double Dragon (Japan)
+    {.vramHash1 = 0x73c0235c, .vramHash2 = 0x6bd74801, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAIN DRAIN",        }, // Brain Drain (USA)
+    {.vramHash1 = 0x2b36890d, .vramHash2 = 0x6c011900, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ASMIK2",             }, // Asmik-kun World 2 (Japan)
+    {.vramHash1 = 0xe3f0c97d, .vramHash2 = 0x6c0ba942, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNEAKY SNAKES",      }, // Sneaky Snakes (USA, Europe)
+    {.vramHash1 = 0xc8b39994, .vramHash2 = 0x6c139fa7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STREET FIGHTER",     }, // Street Fighter II (Japan), Street Fighter II (USA), Street Fighter II (USA, Europe) (Rev A)
+    {.vramHash1 = 0xc4ecee92, .vramHash2 = 0x6c27d793, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VERSUS HERO",        }, // Versus Hero - Kakutou Ou e no Michi (Japan)
+    {.vramHash1 = 0x2f218ef2, .vramHash2 = 0x6c445510, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE FIDGETTS",       }, // Fidgetts, The (Japan)
+    {.vramHash1 = 0x6d843ef9, .vramHash2 = 0x6cc867ae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ASTEROIDS",          }, // Asteroids (USA, Europe)
+    {.vramHash1 = 0x560c6f42, .vramHash2 = 0x6d0d20fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Cosmo Tank",         }, // Cosmo Tank (Japan) (Beta)
+    {.vramHash1 = 0x34816b23, .vramHash2 = 0x6d102762, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WIZARDRY SOQ  ",     }, // Wizardry Gaiden 1 - Joou no Junan (Japan)
+    {.vramHash1 = 0xa3604a88, .vramHash2 = 0x6d25846b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWF SUPERSTARS",     }, // WWF Superstars (USA, Europe)
+    {.vramHash1 = 0xfa6467c8, .vramHash2 = 0x6d2e711f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHINESE FIGHTE",     }, // Super Chinese Fighter GB (Japan)
+    {.vramHash1 = 0xff3bd897, .vramHash2 = 0x6d4634c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPERLODERUNNE",     }, // Hyper Lode Runner (World) (Rev A)
+    {.vramHash1 = 0x9f3fdedf, .vramHash2 = 0x6da8b936, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRIMAL RAGE",        }, // Primal Rage (USA, Europe)
+    {.vramHash1 = 0xbb32d59b, .vramHash2 = 0x6dc09380, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RING RAGE",          }, // Ring Rage (Japan), Ring Rage (USA)
+    {.vramHash1 = 0xce0338b2, .vramHash2 = 0x6dc78c98, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Double Dragon II",   }, // Double Dragon II (USA, Europe)
+    {.vramHash1 = 0xcc20876e, .vramHash2 = 0x6deddc8d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KINNIKUMAN ",     }, // Kinnikuman - The Dream Match (Japan)
+    {.vramHash1 = 0x12a1398d, .vramHash2 = 0x6e0bec08, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOKUTO NO KEN ",     }, // Hokuto no Ken - Seizetsu Juuban Shoubu (Japan)
+    {.vramHash1 = 0xc1959a2f, .vramHash2 = 0x6e24fac6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AEROSTAR",           }, // Aero Star (Japan)
+    {.vramHash1 = 0x04a41339, .vramHash2 = 0x6e299ac9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHACHAMARUPANI",     }, // Chachamaru Panic (Japan)
+    {.vramHash1 = 0xd8567c7e, .vramHash2 = 0x6ecd4a61, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI 5",              }, // Oni V - Innin o Tsugumono (Japan)
+    {.vramHash1 = 0x5601e12d, .vramHash2 = 0x6ece45ef, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KRUSTY",             }, // Krusty World (Japan), Krusty's Fun House (USA, Europe)
+    {.vramHash1 = 0x3df0ffd6, .vramHash2 = 0x6f1bc0ab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL",            }, // Pinball - 66hiki no Wani Daikoushin! (Japan)
+    {.vramHash1 = 0xe4535ff8, .vramHash2 = 0x6f481bdc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPACE INVADERS",     }, // Space Invaders (Europe), Space Invaders (USA)
+    {.vramHash1 = 0x79a8da88, .vramHash2 = 0x6f50d684, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JET PACK",           }, // Jet Pack (USA, Europe) (Beta)
+    {.vramHash1 = 0x0001a000, .vramHash2 = 0x6f58d000, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOKORO JR",          }, // Tokoro's Mahjong Jr. (Japan)
+    {.vramHash1 = 0x540c197d, .vramHash2 = 0x6f844a1b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB CULT ULTRAM",     }, // Cult Master - Ultraman ni Miserarete (Japan)
+    {.vramHash1 = 0xd8e7ba79, .vramHash2 = 0x6f914165, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TUROK BATTLE O",     }, // Turok - Battle of the Bionosaurs (Japan), Turok - Battle of the Bionosaurs (USA, Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0x92d3181b, .vramHash2 = 0x6fcba1a5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JUDGE DREDD",        }, // Judge Dredd (Japan), Judge Dredd (USA, Europe)
+    {.vramHash1 = 0x4291747d, .vramHash2 = 0x6fefe6f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPOT COOL ADV",      }, // Spot - The Cool Adventure (Japan), Spot - The Cool Adventure (USA)
+    {.vramHash1 = 0xb2329eee, .vramHash2 = 0x7001be82, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLE BOBBLE",      }, // Bubble Bobble (Japan)
+    {.vramHash1 = 0x265b40e3, .vramHash2 = 0x700a57bc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TAACHIYAN  ",     }, // Jungle no Ouja Tar-chan (Japan)
+    {.vramHash1 = 0xfabcf770, .vramHash2 = 0x70379205, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JURASSIC PARK",      }, // Jurassic Park (Europe) (En,Fr,De,Es,It), Jurassic Park (USA)
+    {.vramHash1 = 0xf579ab5b, .vramHash2 = 0x7094e7bc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER SNAKEY",       }, // Super Snakey (Japan)
+    {.vramHash1 = 0x7e4166ba, .vramHash2 = 0x712c320f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GANBARUGA",          }, // Genki Bakuhatsu Gambaruger (Japan), Mani 4 in 1 (China) (DMG-603 CHN)
+    {.vramHash1 = 0x1d7f62ce, .vramHash2 = 0x716d8a08, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASINO FUNPAK",      }, // Casino FunPak (USA, Europe)
+    {.vramHash1 = 0x4e6bf541, .vramHash2 = 0x719052d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRINCE OF PERS",     }, // Prince of Persia (Europe) (En,Fr,De,Es,It)
+    {.vramHash1 = 0x06b23794, .vramHash2 = 0x720d114f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER RC PRO-A",     }, // Super R.C. Pro-Am (USA, Europe)
+    {.vramHash1 = 0xde2c3213, .vramHash2 = 0x7233da57, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZEN",                }, // Zen - Intergalactic Ninja (USA)
+    {.vramHash1 = 0xde2c3214, .vramHash2 = 0x7233dace, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZEN",                }, // Zen - Intergalactic Ninja (Europe)
+    {.vramHash1 = 0xb841d610, .vramHash2 = 0x723a934f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE PINGPON",     }, // Battle Pingpong (Japan)
+    {.vramHash1 = 0xc74d1a26, .vramHash2 = 0x72777553, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CYBER FORMULA",      }, // Shinseiki GPX Cyber Formula (Japan)
+    {.vramHash1 = 0xcd0bcd87, .vramHash2 = 0x727f2628, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "IRON MAN X-O",       }, // Iron Man X-O Manowar in Heavy Metal (USA, Europe)
+    {.vramHash1 = 0xff71df21, .vramHash2 = 0x72f30682, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NIHONSHI 201 G",     }, // Goukaku Boy Series - Nihonshi Target 201 (Japan)
+    {.vramHash1 = 0x53ce536c, .vramHash2 = 0x733b293f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB JIDAIGEKI",       }, // Kunio-kun no Jidaigeki Da yo Zenin Shuugou! (Japan)
+    {.vramHash1 = 0x7f63f6bf, .vramHash2 = 0x733c0aa0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BURNING PAPER",      }, // Burning Paper (Japan)
+    {.vramHash1 = 0x520b8362, .vramHash2 = 0x7347f082, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DLAIR LEGEND U",     }, // Dragon's Lair - The Legend (Europe)
+    {.vramHash1 = 0x25d2f33e, .vramHash2 = 0x734f2a32, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TALE SPIN",          }, // TaleSpin (Europe)
+    {.vramHash1 = 0x79c16f89, .vramHash2 = 0x735c05c0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN5",           }, // Mega Man V (USA)
+    {.vramHash1 = 0x049737c1, .vramHash2 = 0x73be67b4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHINCOGAIDEN",     }, // Pachinko Monogatari Gaiden (Japan)
+    {.vramHash1 = 0x27a699a9, .vramHash2 = 0x73cb112d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REALBOUTSPECIA",     }, // Nettou Real Bout Garou Densetsu Special (Japan)
+    {.vramHash1 = 0xb2093e00, .vramHash2 = 0x73da6703, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZKAIJUKUGO1017",     }, // Goukaku Boy Series - Z Kai Kyuukyoku no Eijukugo 1017 (Japan)
+    {.vramHash1 = 0xc91839ca, .vramHash2 = 0x73f1479c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RED OCTOBER",        }, // Hunt for Red October, The (USA, Europe)
+    {.vramHash1 = 0x29774450, .vramHash2 = 0x740677a6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLEVANIA AD",     }, // Castlevania - The Adventure (Europe)
+    {.vramHash1 = 0x3f45f5ec, .vramHash2 = 0x7448c955, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUZZNIC",            }, // Puzznic (Japan)
+    {.vramHash1 = 0x06ee590b, .vramHash2 = 0x74e02aa0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROGER RABBIT",       }, // Who Framed Roger Rabbit (Europe)
+    {.vramHash1 = 0x70603ec5, .vramHash2 = 0x7526b341, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZKAIEIGOKOBUN2",     }, // Goukaku Boy Series - Z Kai Kyuukyoku no Eigo Koubun 285 (Japan)
+    {.vramHash1 = 0xa8062ada, .vramHash2 = 0x7571b1be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMI GOLF",        }, // Konami Golf (Europe)
+    {.vramHash1 = 0xa626f1f2, .vramHash2 = 0x7584b451, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KARAMUCHO ZIKE",     }, // Karamuchou no Daijiken (Japan)
+    {.vramHash1 = 0x6df74e1a, .vramHash2 = 0x7596fd12, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MON RACE OTHER",     }, // Monster Race Okawari (Japan)
+    {.vramHash1 = 0x2a25da24, .vramHash2 = 0x7598ac4f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRAVEL GUIDE",       }, // InfoGenius Productivity Pak - Frommer's Travel Guide (USA)
+    {.vramHash1 = 0x1b116ce2, .vramHash2 = 0x75cf9ce0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS",            }, // Nemesis (Japan)
+    {.vramHash1 = 0xf1cc330a, .vramHash2 = 0x760c5f35, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RANMA 1/2",          }, // Ranma 1-2 (Japan)
+    {.vramHash1 = 0x853f751f, .vramHash2 = 0x766edcbf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHANGHAI POCKE",     }, // Shanghai Pocket (Japan)
+    {.vramHash1 = 0x0c05fa7a, .vramHash2 = 0x76b7a823, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMB JACK",          }, // Bomb Jack (Europe)
+    {.vramHash1 = 0x016af74e, .vramHash2 = 0x76dda57b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIGHTING SOCCE",     }, // J.League Fighting Soccer - The King of Ace Strikers (Japan)
+    {.vramHash1 = 0xb097aefb, .vramHash2 = 0x76e11e32, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALLERY1",           }, // Namco Gallery Vol.1 (Japan)
+    {.vramHash1 = 0xff39cd2a, .vramHash2 = 0x7714b5cc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEYS CHASE",      }, // Mickey's Chase (Japan)
+    {.vramHash1 = 0xc2c0cf57, .vramHash2 = 0x7730d7a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CTANGO 1700",        }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Chuugaku Eitango 1700 (Japan)
+    {.vramHash1 = 0xf50ad40e, .vramHash2 = 0x7757d55c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIDE POCKET",        }, // Side Pocket (World)
+    {.vramHash1 = 0x97890331, .vramHash2 = 0x775a46d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMNT 2",             }, // Teenage Mutant Ninja Turtles 2 (Japan), Teenage Mutant Ninja Turtles II - Back from the Sewers (USA)
+    {.vramHash1 = 0x33d48544, .vramHash2 = 0x77622b28, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPELL CHECKER ",     }, // InfoGenius Productivity Pak - Spell Checker and Calculator (USA)
+    {.vramHash1 = 0xd73d61b8, .vramHash2 = 0x7762e096, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD SOCCER G",     }, // World Soccer GB (Japan)
+    {.vramHash1 = 0xd6bc01c4, .vramHash2 = 0x777fa9b9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAKENOH TV",         }, // Bakenou TV '94 (Japan)
+    {.vramHash1 = 0x992577f3, .vramHash2 = 0x779f9d33, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BZONE SBREAKOU",     }, // Arcade Classics - Battlezone & Super Breakout (USA, Europe)
+    {.vramHash1 = 0xc4dbf056, .vramHash2 = 0x77bb7f14, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MIGRAIN ACCLAI",     }, // Migrain (Japan)
+    {.vramHash1 = 0xb77940d0, .vramHash2 = 0x77c2f852, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENERATIONS",        }, // Star Trek Generations - Beyond the Nexus (USA)
+    {.vramHash1 = 0xe79f0d6b, .vramHash2 = 0x7836353a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BOMBLISS",     }, // Super Bombliss (Japan)
+    {.vramHash1 = 0x5462408e, .vramHash2 = 0x7875fe2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOTOCROSSMANIA",     }, // Motocross Maniacs (Japan)
+    {.vramHash1 = 0xe7c679cd, .vramHash2 = 0x787b53d7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "B.C.KID       ",     }, // B.C. Kid (Europe)
+    {.vramHash1 = 0x546b697e, .vramHash2 = 0x788dddd9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR STACKER",       }, // Kirby's Star Stacker (USA, Europe)
+    {.vramHash1 = 0x904c1f03, .vramHash2 = 0x789f156b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KWIRK",              }, // Kwirk - He's A-maze-ing! (USA, Europe)
+    {.vramHash1 = 0x963fd904, .vramHash2 = 0x78b617cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI",                }, // Kinin Koumaroku Oni (Japan)
+    {.vramHash1 = 0x4f69941d, .vramHash2 = 0x78ea99fa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEW CHESSMASTE",     }, // Chessmaster, The (DMG-EM) (Japan)
+    {.vramHash1 = 0xd12e22c4, .vramHash2 = 0x7905e8cf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-PANIC",          }, // Pac-Panic (Europe)
+    {.vramHash1 = 0xb536ca49, .vramHash2 = 0x793bd46d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CARD GAME",          }, // Card Game (Japan)
+    {.vramHash1 = 0x674c87f4, .vramHash2 = 0x7988391c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAMPART_GB",         }, // Rampart (USA, Europe)
+    {.vramHash1 = 0x7e854a61, .vramHash2 = 0x79e2ac65, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL QUARTERBAC",     }, // NFL Quarterback Club (Japan)
+    {.vramHash1 = 0xc1b3c076, .vramHash2 = 0x79fba435, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Trump Boy",          }, // Trump Boy (Japan)
+    {.vramHash1 = 0x4a98f7d9, .vramHash2 = 0x7a25674e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DONKEY KONG",        }, // Donkey Kong (Japan, USA), Donkey Kong (World) (Rev A)
+    {.vramHash1 = 0xf96ce60c, .vramHash2 = 0x7a44aedc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEETHOVEN",          }, // Beethoven (Europe)
+    {.vramHash1 = 0x02f2db50, .vramHash2 = 0x7a4fd4a8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "P-MAN",              }, // P-Man GB (Japan)
+    {.vramHash1 = 0xd6e387d4, .vramHash2 = 0x7ac9e7f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = true, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PREHISTORIK MA",     }, // Prehistorik Man (USA, Europe)
+    {.vramHash1 = 0x62b9e936, .vramHash2 = 0x7ae10f20, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SKATE OR DIE B",     }, // Skate or Die - Bad 'N Rad (Europe)
+    {.vramHash1 = 0xeb0b1cdf, .vramHash2 = 0x7b2a8257, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DEADHEATSCRAMB",     }, // Dead Heat Scramble (Japan)
+    {.vramHash1 = 0x34e50bbb, .vramHash2 = 0x7b50539a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SKATE OR DIE B",     }, // Skate or Die - Bad 'N Rad (USA)
+    {.vramHash1 = 0xa3cfe1b9, .vramHash2 = 0x7b914378, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPER BB 95",        }, // Hyper Black Bass '95 (Japan) (En,Ja)
+    {.vramHash1 = 0xd2ef7a7a, .vramHash2 = 0x7bb1e012, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADVENTURE ISLA",     }, // Adventure Island (USA, Europe)
+    {.vramHash1 = 0xbd213f15, .vramHash2 = 0x7be9a464, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JOE AND MAC",        }, // Joe & Mac (USA)
+    {.vramHash1 = 0xf5ad26c3, .vramHash2 = 0x7c283539, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAST BIBLE",         }, // Megami Tensei Gaiden - Last Bible (Japan)
+    {.vramHash1 = 0x9b646cae, .vramHash2 = 0x7c3bde7c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINBALL FANTAS",     }, // Pinball Fantasies (USA, Europe)
+    {.vramHash1 = 0xa45e0a2c, .vramHash2 = 0x7c8a5bdb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHALVO55",           }, // Chalvo 55 - Super Puzzle Action (Japan)
+    {.vramHash1 = 0xc3567002, .vramHash2 = 0x7cad177e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QUARTH",             }, // Quarth (USA, Europe)
+    {.vramHash1 = 0x09213694, .vramHash2 = 0x7cf77393, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINTIN AU TIBE",     }, // Tintin in Tibet (Europe) (En,Fr,De,Nl)
+    {.vramHash1 = 0x507a6cbb, .vramHash2 = 0x7d3cf55c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET BASS FI",     }, // Pocket Bass Fishing (Japan)
+    {.vramHash1 = 0x4c785b76, .vramHash2 = 0x7d595d9a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE CRUSHER",     }, // Battle Crusher (Japan)
+    {.vramHash1 = 0x57ce2cb4, .vramHash2 = 0x7d777feb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET STADIUM",     }, // Pocket Stadium (Japan)
+    {.vramHash1 = 0x23b6d393, .vramHash2 = 0x7d826827, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PLAT JEOPARDY!",     }, // Jeopardy! - Platinum Edition (USA)
+    {.vramHash1 = 0x31a21f79, .vramHash2 = 0x7d826e7d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER MOMOTETU",     }, // Super Momotarou Dentetsu II (Japan)
+    {.vramHash1 = 0xe4253618, .vramHash2 = 0x7da4d83e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONOPOLY",           }, // Monopoly (Japan)
+    {.vramHash1 = 0x622352c8, .vramHash2 = 0x7dd1c1e5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KILLER TOMATOE",     }, // Attack of the Killer Tomatoes (USA, Europe)
+    {.vramHash1 = 0xe5cf93cc, .vramHash2 = 0x7e022890, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NITINOU SANSUU",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Suuji de Asobou Sansuu Hen (Japan) (Rev A), Goukaku Boy Series - Shikakui Atama o Maruku Suru - Suuji de Asobou Sansuu Hen (Japan)
+    {.vramHash1 = 0x7f31a84a, .vramHash2 = 0x7e036be3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLARSTRIKER",       }, // SolarStriker (World)
+    {.vramHash1 = 0xa8e69d5c, .vramHash2 = 0x7e11ff98, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAPUWAKUNN",         }, // Nangoku Shounen Papuwa-kun - Ganmadan no Yabou (Japan)
+    {.vramHash1 = 0x7e448108, .vramHash2 = 0x7e42b604, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET BATTLE",      }, // Pocket Battle (Japan)
+    {.vramHash1 = 0x2ad09cf7, .vramHash2 = 0x7e7b38b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLE GHOST",       }, // Bubble Ghost (USA, Europe)
+    {.vramHash1 = 0x6943e7aa, .vramHash2 = 0x7e7e7b8b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES",         }, // DuckTales (Japan)
+    {.vramHash1 = 0x2ad09fec, .vramHash2 = 0x7e837e16, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLE GHOST",       }, // Bubble Ghost (Japan)
+    {.vramHash1 = 0xb54053f1, .vramHash2 = 0x7eae713d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJA BOY",          }, // Ninja Boy (USA, Europe)
+    {.vramHash1 = 0x56303a43, .vramHash2 = 0x7ef6529b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMIC SPORTS",     }, // Konamic Sports in Barcelona (Japan)
+    {.vramHash1 = 0x3eccc00b, .vramHash2 = 0x7f82b4d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ODDWORLD ADVEN",     }, // Oddworld Adventures (USA, Europe)
+    {.vramHash1 = 0x091a7b73, .vramHash2 = 0x7fd891a1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EARTHWORM JIM",      }, // Earthworm Jim (Europe), Earthworm Jim (USA)
+    {.vramHash1 = 0x23da665c, .vramHash2 = 0x80368144, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARASORU HEMBE",     }, // Parasol Henbee (Japan)
+    {.vramHash1 = 0x0b371933, .vramHash2 = 0x80f45b1b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPULOUS",           }, // Populous (Europe), Populous (Japan)
+    {.vramHash1 = 0x30957497, .vramHash2 = 0x81009149, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TALE SPIN",          }, // TaleSpin (USA)
+    {.vramHash1 = 0x09adfeb3, .vramHash2 = 0x81111afc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKKOKUGOBF3",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Kokugo Battle Hen (Japan) (Special Edition)
+    {.vramHash1 = 0xdc68678a, .vramHash2 = 0x811168e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZAS",                }, // Chikyuu Kaihou Gun ZAS (Japan)
+    {.vramHash1 = 0x1ce00eb1, .vramHash2 = 0x81126fe0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TASMANIA STORY",     }, // Tasmania Story (USA)
+    {.vramHash1 = 0xcca5fbd0, .vramHash2 = 0x8125c773, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRO SOCCER",         }, // Pro Soccer (Japan)
+    {.vramHash1 = 0x584057e3, .vramHash2 = 0x8134e2b6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOY STORY",          }, // Toy Story (Europe), Toy Story (USA) (Rev A), Toy Story (USA)
+    {.vramHash1 = 0x964829ec, .vramHash2 = 0x8134fdd3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUGS BUNNY",         }, // Bugs Bunny Crazy Castle, The (USA, Europe)
+    {.vramHash1 = 0x400d3346, .vramHash2 = 0x813ca3c9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FURAINO SIREN ",     }, // Fushigi no Dungeon - Fuurai no Shiren GB - Tsukikage Mura no Kaibutsu (Japan)
+    {.vramHash1 = 0x8a0b72db, .vramHash2 = 0x81489ae2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MR.DO!",             }, // Mr. Do! (Europe)
+    {.vramHash1 = 0xdbfa23dd, .vramHash2 = 0x816dbef1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ATHENANOHATENA",     }, // Quiz Nihon Mukashibanashi - Athena no Hatena (Japan)
+    {.vramHash1 = 0xdcdaebc4, .vramHash2 = 0x819635b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIMPSONS3",          }, // Simpsons, The - Bart & the Beanstalk (USA, Europe), Simpsons, The - Bart no Jack to Mame no Ki (Japan)
+    {.vramHash1 = 0xeb62ac9b, .vramHash2 = 0x829b1d03, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CUTTHROAT ISLA",     }, // CutThroat Island (USA, Europe)
+    {.vramHash1 = 0x54e3a5ba, .vramHash2 = 0x82d3c9e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLEVANIA",        }, // Castlevania Legends (USA, Europe)
+    {.vramHash1 = 0x17c8aff8, .vramHash2 = 0x82e481ed, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMHT - Foot Clan",   }, // Teenage Mutant Hero Turtles - Fall of the Foot Clan (Europe)
+    {.vramHash1 = 0xa8e07a43, .vramHash2 = 0x82eb5545, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Blue",       }, // Pokemon - Blaue Edition (Germany), Pokemon - Edicion Azul (Spain), Pokemon - Version Bleue (France), Pokemon - Versione Blu (Italy)
+    {.vramHash1 = 0xdc30dd6c, .vramHash2 = 0x8340e0a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TASMANIA STORY",     }, // Tasmania Monogatari (Japan)
+    {.vramHash1 = 0x0b0fd1a5, .vramHash2 = 0x83455867, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KUREYON SHI",     }, // Crayon Shin-chan 3 - Ora no Gokigen Athletic (Japan)
+    {.vramHash1 = 0xc3f9e000, .vramHash2 = 0x839e7840, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GOURMET PARADI",     }, // Mr. Chin's Gourmet Paradise (USA)
+    {.vramHash1 = 0x79d2c70e, .vramHash2 = 0x83c713b8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JLEAGUE",            }, // Nihon Daihyou Team France de Ganbare! - J.League Supporter Soccer (Japan)
+    {.vramHash1 = 0xcd510a85, .vramHash2 = 0x84643fb6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENSANQ",            }, // Kizuchi da Quiz da Gen-san da! (Japan)
+    {.vramHash1 = 0x9a616e5a, .vramHash2 = 0x84774512, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Dr.MARIO",           }, // Dr. Mario (World) (Beta)
+    {.vramHash1 = 0xd14561a2, .vramHash2 = 0x8488c451, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSSY NO COOKI",     }, // Yoshi no Cookie (Japan)
+    {.vramHash1 = 0xc058cf89, .vramHash2 = 0x84ae6ef3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WPGB",               }, // Wedding Peach - Jamapii Panic (Japan)
+    {.vramHash1 = 0x3aa64f8e, .vramHash2 = 0x84dab7e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAIJINOU",           }, // Zettai Muteki Raijin-Oh (Japan)
+    {.vramHash1 = 0xcb002c42, .vramHash2 = 0x84e84877, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANIMAL BREEDER",     }, // Animal Breeder 2 (Japan)
+    {.vramHash1 = 0x6dc6a299, .vramHash2 = 0x850c68c7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FOREMAN FOR RE",     }, // Foreman for Real (Japan)
+    {.vramHash1 = 0xf4df4eca, .vramHash2 = 0x8526be10, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RETRIEVE",           }, // Bakuchou Retrieve Master (Japan)
+    {.vramHash1 = 0x89e3e9f4, .vramHash2 = 0x8574336e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GLKSRAD",            }, // Gluecksrad (Germany)
+    {.vramHash1 = 0xe0498868, .vramHash2 = 0x8619de40, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Wario Land",         }, // Wario Land - Super Mario Land 3 (World)
+    {.vramHash1 = 0x10f7a717, .vramHash2 = 0x86669ff2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORAEMON2",          }, // Doraemon 2 - Animal Planet Densetsu (Japan)
+    {.vramHash1 = 0x25b48813, .vramHash2 = 0x8685e80d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHANGHAI",           }, // Shanghai (USA)
+    {.vramHash1 = 0x54a9d81f, .vramHash2 = 0x86b6ec75, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "REAL GHOSTBUST",     }, // Real Ghostbusters, The (USA)
+    {.vramHash1 = 0x16630bec, .vramHash2 = 0x8727ccf3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRAGONHEART",        }, // DragonHeart (France), DragonHeart (USA, Europe)
+    {.vramHash1 = 0xab6d5c44, .vramHash2 = 0x873bb069, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NHL HOCKEY 95",      }, // NHL Hockey '95 (USA, Europe)
+    {.vramHash1 = 0x3fb17081, .vramHash2 = 0x873f7b2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL QUARTERBAC",     }, // NFL Quarterback Club II (USA, Europe)
+    {.vramHash1 = 0x1e157e12, .vramHash2 = 0x877c71e1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOPGUN 2",           }, // Top Gun - Guts & Glory (USA, Europe)
+    {.vramHash1 = 0xc7ccb9aa, .vramHash2 = 0x87850ca9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAGING FIGHTER",     }, // Raging Fighter (USA, Europe)
+    {.vramHash1 = 0xc08e868c, .vramHash2 = 0x88ebcfab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPEEDY GONZALE",     }, // Speedy Gonzales (USA, Europe)
+    {.vramHash1 = 0xc08e868e, .vramHash2 = 0x88ebcfd1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPEEDY GONZALE",     }, // Soreyuke! Speedy Gonzales (Japan)
+    {.vramHash1 = 0x0f296fa0, .vramHash2 = 0x8940c102, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANYOUKU",           }, // Goukaku Boy Series - Gakken - Kanyouku Kotowaza 210 (Japan)
+    {.vramHash1 = 0x7501d84a, .vramHash2 = 0x895f82a4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EUROMONOPOLY",       }, // Monopoly (Europe) (En,Fr,De)
+    {.vramHash1 = 0xc87af993, .vramHash2 = 0x89931e28, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLE",             }, // Pachio-kun - Puzzle Castle (Japan)
+    {.vramHash1 = 0xfeb27bee, .vramHash2 = 0x8a0ec0d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALFRED CHICKEN",     }, // Alfred Chicken (Europe), Alfred Chicken (USA)
+    {.vramHash1 = 0x6f1d267c, .vramHash2 = 0x8a596845, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Jordan vs Bird",     }, // Jordan vs Bird - One on One (Japan), Jordan vs Bird - One on One (USA, Europe)
+    {.vramHash1 = 0x9f1c0ad6, .vramHash2 = 0x8a83a4fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SDGUNDAMKUNITO",     }, // SD Gundam - SD Sengokuden - Kunitori Monogatari (Japan)
+    {.vramHash1 = 0x9ea5f440, .vramHash2 = 0x8aa7018a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB 3TAMA",           }, // 3 Choume no Tama - Tama and Friends - 3 Choume Obake Panic!! (Japan)
+    {.vramHash1 = 0x9a616e5a, .vramHash2 = 0x8af02148, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR.MARIO",           }, // Dr. Mario (World) (Rev A), Dr. Mario (World)
+    {.vramHash1 = 0x6347082f, .vramHash2 = 0x8b301b29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB ULTRAMANCLU",     }, // Ultraman Club - Tekikaijuu o Hakken seyo! (Japan)
+    {.vramHash1 = 0x5ddaac73, .vramHash2 = 0x8b4a05f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKMANWORLD4",      }, // Rockman World 4 (Japan)
+    {.vramHash1 = 0x179ce655, .vramHash2 = 0x8b5841f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHOPLIFTER 2",       }, // Choplifter II (Japan)
+    {.vramHash1 = 0xac4700e1, .vramHash2 = 0x8b67e58b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZEOTH",              }, // Battle Unit Zeoth (Japan)
+    {.vramHash1 = 0x192cc6c3, .vramHash2 = 0x8b984e7e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPER BLACKBAS",     }, // Black Bass - Lure Fishing (USA)
+    {.vramHash1 = 0x3fca11c9, .vramHash2 = 0x8bd1845b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SEASIDE VOLLEY",     }, // Seaside Volley (Japan)
+    {.vramHash1 = 0x01f3917a, .vramHash2 = 0x8c31a21d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NASCARFASTTRAC",     }, // Bill Elliott's NASCAR Fast Tracks (USA)
+    {.vramHash1 = 0xe1ed04ed, .vramHash2 = 0x8c562aaa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY 4",           }, // Mickey Mouse IV (Japan)
+    {.vramHash1 = 0x8e7e4756, .vramHash2 = 0x8c821091, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QBILLION",           }, // Q Billion (Japan)
+    {.vramHash1 = 0xfa17d0ba, .vramHash2 = 0x8c854a29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TORPEDO RANGE",      }, // Torpedo Range (USA)
+    {.vramHash1 = 0x376ddcab, .vramHash2 = 0x8cb93c15, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINOCCHIO",          }, // Pinocchio (USA)
+    {.vramHash1 = 0x89fa669b, .vramHash2 = 0x8cd04623, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB PINGU 1",         }, // Pingu - Sekai de 1ban Genki na Penguin (Japan)
+    {.vramHash1 = 0xfd7a94e1, .vramHash2 = 0x8cd7b64d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Micro machines 2",   }, // Micro Machines 2 - Turbo Tournament (Europe)
+    {.vramHash1 = 0x21e8f206, .vramHash2 = 0x8d0a1062, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS",            }, // Nemesis (Europe)
+    {.vramHash1 = 0x9a72dc58, .vramHash2 = 0x8d0e60a3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HARIMANADA",         }, // Aa Harimanada (Japan)
+    {.vramHash1 = 0x5a0d1e2c, .vramHash2 = 0x8d39992e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OLYMPIC GAMES",      }, // Olympic Summer Games (USA, Europe)
+    {.vramHash1 = 0x6efc296c, .vramHash2 = 0x8d3b5358, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPEED BALL 2",       }, // Speedball 2 - Brutal Deluxe (USA, Europe)
+    {.vramHash1 = 0x95398e2a, .vramHash2 = 0x8d75539c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLIPULL",            }, // Flipull (Japan)
+    {.vramHash1 = 0x2f0651c1, .vramHash2 = 0x8da7e7c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI-PACHINKOTE",     }, // Onigashima Pachinkoten (Japan)
+    {.vramHash1 = 0x9e01f78e, .vramHash2 = 0x8dde51f3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARASOL STARS",      }, // Parasol Stars - Rainbow Islands II (Europe)
+    {.vramHash1 = 0x228731e5, .vramHash2 = 0x8e522fcf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CONTRA",             }, // Contra (Japan)
+    {.vramHash1 = 0x2e740367, .vramHash2 = 0x8e59c378, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY BLOCKBAL",     }, // Kirby no Block Ball (Japan)
+    {.vramHash1 = 0xe6d7dc29, .vramHash2 = 0x8e6ade06, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA2",              }, // Sa-Ga 2 - Hihou Densetsu (Japan) (Rev A), Sa-Ga 2 - Hihou Densetsu (Japan)
+    {.vramHash1 = 0x10a02ea6, .vramHash2 = 0x8eba7b4b, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMNT",               }, // Teenage Mutant Ninja Turtles (Japan)
+    {.vramHash1 = 0x5bf353da, .vramHash2 = 0x8edfc3f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB BEACHVOLLEY",     }, // World Beach Volley - 1991 GB Cup (Japan)
+    {.vramHash1 = 0x2e850e36, .vramHash2 = 0x8ee1e622, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATMAN FOREVER",     }, // Batman Forever (USA, Europe)
+    {.vramHash1 = 0xeb59d0cc, .vramHash2 = 0x8f28dcaa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASPER",             }, // Casper (Europe), Casper (USA)
+    {.vramHash1 = 0x15f28040, .vramHash2 = 0x8f830b72, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPLITZ",             }, // Splitz (Europe), Splitz - Nigaoe 15 Game (Japan)
+    {.vramHash1 = 0xe1b55301, .vramHash2 = 0x8f97fabb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Legend of Zelda",    }, // Legend of Zelda, The - Link's Awakening (Germany)
+    {.vramHash1 = 0xe1b5534f, .vramHash2 = 0x8f9b088c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Legend of Zelda",    }, // Legend of Zelda, The - Link's Awakening (USA, Europe) (Rev A), Legend of Zelda, The - Link's Awakening (USA, Europe) (Rev B), Legend of Zelda, The - Link's Awakening (USA, Europe)
+    {.vramHash1 = 0xe1b55357, .vramHash2 = 0x8f9b5808, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Legend of Zelda",    }, // Zelda no Densetsu - Yume o Miru Shima (Japan) (Rev A), Zelda no Densetsu - Yume o Miru Shima (Japan)
+    {.vramHash1 = 0xe1b554df, .vramHash2 = 0x8fb13d7e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Legend of Zelda",    }, // Legend of Zelda, The - Link's Awakening (Canada), Legend of Zelda, The - Link's Awakening (France)
+    {.vramHash1 = 0xbe28c656, .vramHash2 = 0x8fc34c21, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPANKY'S QUEST",     }, // Spanky's Quest (USA)
+    {.vramHash1 = 0xf5a50666, .vramHash2 = 0x8fc466a2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAPERBOY",           }, // Paperboy (USA, Europe)
+    {.vramHash1 = 0xbe28c979, .vramHash2 = 0x8fc8417c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LUCKY MONKEY",       }, // Lucky Monkey (Japan)
+    {.vramHash1 = 0x16b0a4f5, .vramHash2 = 0x8ff26ff2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUZZLE BOY2",        }, // Puzzle Boy II (Japan)
+    {.vramHash1 = 0xe0f6335a, .vramHash2 = 0x90550272, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHOOT",              }, // Aoki Densetsu Shoot! (Japan)
+    {.vramHash1 = 0x4c94df5a, .vramHash2 = 0x905a32d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAMSE",              }, // Bamse (Sweden)
+    {.vramHash1 = 0x7b44d4ca, .vramHash2 = 0x9066106b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL BALL",          }, // Cool Ball (USA)
+    {.vramHash1 = 0x326bd130, .vramHash2 = 0x90934844, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AYAKASI NO SIR",     }, // Ayakashi no Shiro (Japan)
+    {.vramHash1 = 0x0c11c189, .vramHash2 = 0x90a60914, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL HAND",          }, // Cool Hand (Europe)
+    {.vramHash1 = 0xa69905be, .vramHash2 = 0x90d4b660, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERROBOTWAR ",     }, // Dai-2-ji Super Robot Taisen G (Japan)
+    {.vramHash1 = 0xfb85e49f, .vramHash2 = 0x910a3a23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROADSTER",           }, // Roadster (Japan)
+    {.vramHash1 = 0xa23f896a, .vramHash2 = 0x9123b1fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATAILLE NAVAL",     }, // Bataille Navale (France) (En,Fr,De,Es)
+    {.vramHash1 = 0xc2764260, .vramHash2 = 0x912e1916, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KOI WA KAKEHIK",     }, // Koi wa Kakehiki (Japan)
+    {.vramHash1 = 0xdae0c1bf, .vramHash2 = 0x9148145d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUZZLE BOY",         }, // Puzzle Boy (Japan)
+    {.vramHash1 = 0x24f074c8, .vramHash2 = 0x9193cf40, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HIT THE ICE",        }, // Hit the Ice - VHL - The Official Video Hockey League (USA, Europe)
+    {.vramHash1 = 0xfcef76c9, .vramHash2 = 0x91b94676, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VELIOUS",            }, // Velious - Roland no Majuu (Japan)
+    {.vramHash1 = 0x0f249dfb, .vramHash2 = 0x91effe8d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ESPARKS",            }, // Miracle Adventure of Esparks - Ushinawareta Seiseki Perivron (Japan)
+    {.vramHash1 = 0x7af93d05, .vramHash2 = 0x926ada11, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERDONKEYKON",     }, // Super Donkey Kong GB (Japan)
+    {.vramHash1 = 0x59adfd6b, .vramHash2 = 0x9281d109, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BANISHING RACE",     }, // Banishing Racer (Japan)
+    {.vramHash1 = 0xf44f7a19, .vramHash2 = 0x92aaaca8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUI S BAT",      }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Sansuu Battle Hen (Japan)
+    {.vramHash1 = 0x44334e16, .vramHash2 = 0x93393dab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6 Golden Coins (USA, Europe) (Rev B)
+    {.vramHash1 = 0xa2fcbd30, .vramHash2 = 0x9388c6ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY'S PINBAL",     }, // Kirby's Pinball Land (USA, Europe)
+    {.vramHash1 = 0x19ad51d9, .vramHash2 = 0x93dc51c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIO & YOSHI",      }, // Mario & Yoshi (Europe)
+    {.vramHash1 = 0x205e1ac1, .vramHash2 = 0x93e894ee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARTS COLLECTI",     }, // Medarot - Parts Collection (Japan)
+    {.vramHash1 = 0xca0da1d1, .vramHash2 = 0x940d3767, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTARODENGEK",     }, // Momotarou Dengeki 2 (Japan)
+    {.vramHash1 = 0x874796c6, .vramHash2 = 0x9437a5d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BALLOON KID",        }, // Balloon Kid (USA, Europe)
+    {.vramHash1 = 0x553c562f, .vramHash2 = 0x9473f0f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAMPART_GB (JP",     }, // Rampart (Japan)
+    {.vramHash1 = 0x61efe440, .vramHash2 = 0x9474afde, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOSHINOKA-BI",       }, // Hoshi no Kirby (Japan) (Rev A), Hoshi no Kirby (Japan)
+    {.vramHash1 = 0x77c99546, .vramHash2 = 0x94882d48, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KEIBA KIZOKU",       }, // Kachiuma Yosou Keiba Kizoku (Japan)
+    {.vramHash1 = 0x40fc9955, .vramHash2 = 0x94a7fd00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEMMINGS",           }, // Lemmings (Europe)
+    {.vramHash1 = 0x65582db4, .vramHash2 = 0x96487f60, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET MAHJAN",      }, // Pocket Mahjong (Japan)
+    {.vramHash1 = 0x5a7b61f2, .vramHash2 = 0x96866554, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BATTLETA",     }, // Super Battletank (Europe)
+    {.vramHash1 = 0x57b384bb, .vramHash2 = 0x969c88c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE SPACE",       }, // Battle Space (Japan)
+    {.vramHash1 = 0x9a2fa533, .vramHash2 = 0x971adb73, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TUBASA VS",          }, // Captain Tsubasa VS (Japan)
+    {.vramHash1 = 0x504643aa, .vramHash2 = 0x97345741, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "F1RACE",             }, // F-1 Race (World) (Rev A), F-1 Race (World)
+    {.vramHash1 = 0x45b5bf7c, .vramHash2 = 0x97d9f106, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUJOSIKBJ3",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Joushiki no Sho (Japan)
+    {.vramHash1 = 0x8b75312a, .vramHash2 = 0x9806a1c7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE LION KING",      }, // Lion King, The (Europe), Lion King, The (USA)
+    {.vramHash1 = 0x4f8fd0dd, .vramHash2 = 0x9823e2f6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRINCE VALIANT",     }, // Legend of Prince Valiant, The (Europe) (En,Fr,De)
+    {.vramHash1 = 0x3ad2227e, .vramHash2 = 0x986977c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Jurassic Park 2",    }, // Jurassic Park Part 2 - The Chaos Continues (USA, Europe) (En,Fr,De,It)
+    {.vramHash1 = 0x390aa93d, .vramHash2 = 0x98997542, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SI GOLF CLASSI",     }, // Sports Illustrated - Golf Classic (USA)
+    {.vramHash1 = 0x4e74d446, .vramHash2 = 0x989a95bb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SENSIBLE SOCCE",     }, // Sensible Soccer - European Champions (Europe)
+    {.vramHash1 = 0xc41bd617, .vramHash2 = 0x98f2499b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRUE LIES",          }, // True Lies (USA, Europe)
+    {.vramHash1 = 0x6667f111, .vramHash2 = 0x990362ab, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SNOW BROS.JR",       }, // Snow Bros. Jr. (USA)
+    {.vramHash1 = 0xb6a82b3c, .vramHash2 = 0x9907118a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOUGAROU2",       }, // Nettou Garou Densetsu 2 - Aratanaru Tatakai (Japan)
+    {.vramHash1 = 0xbdad6da1, .vramHash2 = 0x991fdc33, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SD HIRYUNOKEN2",     }, // SD Hiryuu no Ken Gaiden 2 (Japan)
+    {.vramHash1 = 0x9e121060, .vramHash2 = 0x99503e91, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MADDEN 96",          }, // Madden '96 (USA, Europe)
+    {.vramHash1 = 0xc366527d, .vramHash2 = 0x99bb117c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLEVANIA2 B",     }, // Castlevania II - Belmont's Revenge (USA, Europe)
+    {.vramHash1 = 0x3be815f5, .vramHash2 = 0x99cb21c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKU RIKAAE8",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Rika Battle Hen (Japan)
+    {.vramHash1 = 0x71aabeb9, .vramHash2 = 0x99e5a5f7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTARO DENGE",     }, // Momotarou Dengeki (Japan)
+    {.vramHash1 = 0x138f82c1, .vramHash2 = 0x9a8492cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIFA SOCCER 96",     }, // FIFA Soccer '96 (USA, Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0x186103c9, .vramHash2 = 0x9af6dc5f, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMNT - Foot Clan",   }, // Teenage Mutant Ninja Turtles - Fall of the Foot Clan (USA)
+    {.vramHash1 = 0x1e95db79, .vramHash2 = 0x9afe81c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mystic Quest",       }, // Mystic Quest (Germany)
+    {.vramHash1 = 0x365e9854, .vramHash2 = 0x9b64c858, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAZ-MANIA",          }, // Taz-Mania (USA, Europe)
+    {.vramHash1 = 0x024859b7, .vramHash2 = 0x9b79eb56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BA.TOSHINDEN",       }, // Battle Arena Toshinden (Europe)
+    {.vramHash1 = 0x6f662413, .vramHash2 = 0x9ba38021, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE OFKINGD",     }, // Battle of Kingdom (Japan)
+    {.vramHash1 = 0xb74c03cb, .vramHash2 = 0x9bd3db17, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAVY SEALS",         }, // Navy SEALs (USA, Europe)
+    {.vramHash1 = 0x4ab23fac, .vramHash2 = 0x9c60f0db, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR SWEEP",         }, // Star Sweep (Japan)
+    {.vramHash1 = 0x1d6a3379, .vramHash2 = 0x9c88a943, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GO! GO! KID",        }, // Soreyuke!! Kid (Japan)
+    {.vramHash1 = 0xbdc0b872, .vramHash2 = 0x9cbe423e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TECMO BOWL",         }, // Tecmo Bowl (USA)
+    {.vramHash1 = 0x87573c7c, .vramHash2 = 0x9ce0cba8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA3",              }, // Sa-Ga 3 - Jikuu no Hasha (Japan)
+    {.vramHash1 = 0xf56937f1, .vramHash2 = 0x9d0bc4be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GAMERA DAIKAIJ",     }, // Gamera - Daikaijuu Kuuchuu Kessen (Japan)
+    {.vramHash1 = 0x89529bf3, .vramHash2 = 0x9d1ca5fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HONG KONG",          }, // Hong Kong (Japan)
+    {.vramHash1 = 0xf1077375, .vramHash2 = 0x9d3c41c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mystic Quest",       }, // Mystic Quest (Europe)
+    {.vramHash1 = 0xc6e3326b, .vramHash2 = 0x9d82ee86, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINER 2049ER",       }, // Miner 2049er Starring Bounty Bob (USA)
+    {.vramHash1 = 0xa26f63b8, .vramHash2 = 0x9d9d8b4c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBCOLLECTION 3",     }, // Konami GB Collection Vol.3 (Japan)
+    {.vramHash1 = 0x6f4cf4ba, .vramHash2 = 0x9dd92fae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BLADES OF STEE",     }, // Blades of Steel (Europe)
+    {.vramHash1 = 0x9695c12d, .vramHash2 = 0x9df12376, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER ROBOT WA",     }, // Super Robot Taisen (Japan)
+    {.vramHash1 = 0x75f47e2e, .vramHash2 = 0x9e0e122f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GO GO TANK",         }, // Go! Go! Tank (USA)
+    {.vramHash1 = 0xf32c1798, .vramHash2 = 0x9e14033c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE HUMANS",         }, // Humans, The (Europe) (En,Fr,De,Es,It), Humans, The (USA)
+    {.vramHash1 = 0x02674ab5, .vramHash2 = 0x9e167331, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RTYPE",              }, // R-Type (Japan), R-Type (USA, Europe)
+    {.vramHash1 = 0x9738cc10, .vramHash2 = 0x9e5b270e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NYANTOWONDERFU",     }, // Itsudemo! Nyan to Wonderful (Japan)
+    {.vramHash1 = 0x40bed7eb, .vramHash2 = 0x9e9ed5ff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBWARS",             }, // Game Boy Wars (Japan)
+    {.vramHash1 = 0x983f61b6, .vramHash2 = 0x9e9fc1f7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "INDIANA JONES",      }, // Indiana Jones - Saigo no Seisen (Japan)
+    {.vramHash1 = 0xd148546d, .vramHash2 = 0x9ea89ecb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTARODENGEK",     }, // Momotarou Collection 2 (Japan)
+    {.vramHash1 = 0x971e4ef5, .vramHash2 = 0x9edd0218, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAMATO",             }, // Uchuu Senkan Yamato (Japan)
+    {.vramHash1 = 0xbd196a6a, .vramHash2 = 0x9f0b4c09, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJA RYUKENDE",     }, // Ninja Ryuuken Den - Matenrou Kessen (Japan)
+    {.vramHash1 = 0xc06371bd, .vramHash2 = 0x9f0c5892, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NBA JAM TE",         }, // NBA Jam - Tournament Edition (Japan), NBA Jam - Tournament Edition (USA, Europe)
+    {.vramHash1 = 0x97284cad, .vramHash2 = 0x9f460179, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JAMES POND",         }, // Super James Pond (Europe)
+    {.vramHash1 = 0x2e3c12d9, .vramHash2 = 0x9f526a9b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HUGO",               }, // Hugo (Europe)
+    {.vramHash1 = 0xf665b2eb, .vramHash2 = 0x9f81fde2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "King James Bible",   }, // King James Bible (USA) (Unl), NIV Bible & the 20 Lost Levels of Joshua (USA) (Unl)
+    {.vramHash1 = 0x8532ad14, .vramHash2 = 0x9fb3cbc9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRACULA",            }, // Bram Stoker's Dracula (USA, Europe)
+    {.vramHash1 = 0x710c65b3, .vramHash2 = 0x9fe34c16, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "J.LEAGUE LIVE ",     }, // J.League Live '95 (Japan)
+    {.vramHash1 = 0x0372efa1, .vramHash2 = 0xa009e485, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BILL AND TED",       }, // Bill & Ted's Excellent Game Boy Adventure (USA, Europe)
+    {.vramHash1 = 0x4e844e04, .vramHash2 = 0xa0172139, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIRE FIGHTER",       }, // Fire Fighter (Europe)
+    {.vramHash1 = 0xc853e01d, .vramHash2 = 0xa02d512c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NOBUNAGA",           }, // Nobunaga no Yabou - Game Boy Ban (Japan)
+    {.vramHash1 = 0x13b9d8df, .vramHash2 = 0xa094e958, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CASTLEVANIA AD",     }, // Castlevania - The Adventure (USA)
+    {.vramHash1 = 0x21f9c575, .vramHash2 = 0xa09bad23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOM AND JERRY",      }, // Tom and Jerry - Frantic Antics! (USA, Europe)
+    {.vramHash1 = 0x0fd8ecc4, .vramHash2 = 0xa0c1f11c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER CHASE H.",     }, // Super Chase H.Q. (USA, Europe)
+    {.vramHash1 = 0x68ab2bfc, .vramHash2 = 0xa0e8260e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TARURU-TO 1",     }, // Magical Taruruuto-kun (Japan)
+    {.vramHash1 = 0x05cd3179, .vramHash2 = 0xa110fa3b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY 5",           }, // Mickey Mouse V (Japan)
+    {.vramHash1 = 0x63f13401, .vramHash2 = 0xa112615e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BLADES OF STEE",     }, // Blades of Steel (USA)
+    {.vramHash1 = 0xd4c4bc8c, .vramHash2 = 0xa1577627, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKMANWORLD3",      }, // Rockman World 3 (Japan)
+    {.vramHash1 = 0xa581668b, .vramHash2 = 0xa1759098, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBD1",               }, // Game Boy Datenlogger 1 (Germany) (v1.0) (GBD1) (Unl)
+    {.vramHash1 = 0x7b8faa2a, .vramHash2 = 0xa1b7421b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOCOL",            }, // Momotarou Collection (Japan)
+    {.vramHash1 = 0x4105f94f, .vramHash2 = 0xa1c78841, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris ATTACK",      }, // Tetris Attack (USA), Tetris Attack (USA, Europe) (Rev A)
+    {.vramHash1 = 0x744996b8, .vramHash2 = 0xa1d78433, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WILDSNAKE",          }, // Wild Snake (USA)
+    {.vramHash1 = 0x52e3a68a, .vramHash2 = 0xa2066fee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "G1KING",             }, // GI King! - Sanbiki no Yosouya (Japan)
+    {.vramHash1 = 0xe1890046, .vramHash2 = 0xa26bed5a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALLERY3",           }, // Namco Gallery Vol.3 (Japan)
+    {.vramHash1 = 0xd7164abb, .vramHash2 = 0xa28ef455, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKY BULLWINK",     }, // Adventures of Rocky and Bullwinkle and Friends, The (USA)
+    {.vramHash1 = 0xc8b2f5f4, .vramHash2 = 0xa2d8a651, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA3",              }, // Final Fantasy Legend III (USA)
+    {.vramHash1 = 0x0f5a176e, .vramHash2 = 0xa2f9789d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RADARMISSION",       }, // Radar Mission (Japan), Radar Mission (USA, Europe)
+    {.vramHash1 = 0xd298a1e5, .vramHash2 = 0xa330b903, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NONTAN",             }, // Nontan to Issho - Kurukuru Puzzle (Japan)
+    {.vramHash1 = 0xa38baae1, .vramHash2 = 0xa3451b4c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN",            }, // Mega Man - Dr. Wily's Revenge (USA)
+    {.vramHash1 = 0xb85c82f4, .vramHash2 = 0xa39c167c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SCOTLANDYARD",       }, // Scotland Yard (Japan)
+    {.vramHash1 = 0x9f784904, .vramHash2 = 0xa3d38a4c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PIT FIGHTER",        }, // Pit Fighter (USA, Europe)
+    {.vramHash1 = 0x07b77ec8, .vramHash2 = 0xa3dbee8a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MIKENEKO HOLME",     }, // Mikeneko Holmes no Kishidou (Japan)
+    {.vramHash1 = 0x75a83cc0, .vramHash2 = 0xa3e1afe4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POP'N TWINBEE",      }, // Pop'n TwinBee (Europe)
+    {.vramHash1 = 0x789b4efc, .vramHash2 = 0xa3e6084c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FOREMAN FOR RE",     }, // Foreman for Real (USA, Europe)
+    {.vramHash1 = 0xb5c5a731, .vramHash2 = 0xa406ce9c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBSY II",           }, // Bubsy II (USA)
+    {.vramHash1 = 0xd1c952e9, .vramHash2 = 0xa458ce2a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BLACK BA",     }, // Super Black Bass (USA)
+    {.vramHash1 = 0x94aea104, .vramHash2 = 0xa49eb3bb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ATARUKUN",           }, // Pachinko Data Card - Chou Ataru-kun (Japan)
+    {.vramHash1 = 0xc293e21a, .vramHash2 = 0xa4ddf40f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CLIFFHANGER",        }, // Cliffhanger (USA, Europe)
+    {.vramHash1 = 0xe2976b0d, .vramHash2 = 0xa4e4afdc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKETSONAR",        }, // Pocket Sonar (Japan)
+    {.vramHash1 = 0x06cc2770, .vramHash2 = 0xa5d1abb5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIROU",             }, // Spirou (Europe) (En,Fr,De,Es) (Beta), Spirou (Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0x0e626f0b, .vramHash2 = 0xa5dac33a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET PUYOPUY",     }, // Pocket Puyo Puyo Tsuu (Japan)
+    {.vramHash1 = 0x43885fe6, .vramHash2 = 0xa5df24d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARODIUS",           }, // Parodius (Europe)
+    {.vramHash1 = 0x5ddc4ba3, .vramHash2 = 0xa61051a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OUT OF GAS",         }, // Out of Gas (USA)
+    {.vramHash1 = 0x9ecbc668, .vramHash2 = 0xa645d2e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Heavyweight Boxing", }, // Heavyweight Championship Boxing (USA)
+    {.vramHash1 = 0x2a7bf4a4, .vramHash2 = 0xa6930509, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EMPIRE STRIKES",     }, // Star Wars - The Empire Strikes Back (Europe), Star Wars - The Empire Strikes Back (USA)
+    {.vramHash1 = 0xbb5b153f, .vramHash2 = 0xa6c6eadd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UOOZU",              }, // Uoozu (Japan)
+    {.vramHash1 = 0x6742cbc9, .vramHash2 = 0xa739e031, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI4BOY2",          }, // Mini 4 Boy II - Final Evolution (Japan)
+    {.vramHash1 = 0x2aa4c225, .vramHash2 = 0xa73b7e30, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AMIDA",              }, // Amida (Japan)
+    {.vramHash1 = 0x2622c609, .vramHash2 = 0xa77429a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KAERUNOTAMENI",      }, // Kaeru no Tame ni Kane wa Naru (Japan)
+    {.vramHash1 = 0xcea31e2d, .vramHash2 = 0xa7db1ac0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LINGO",              }, // Lingo (Europe) (En,Fr,De,Nl)
+    {.vramHash1 = 0x02fa2057, .vramHash2 = 0xa7ff6038, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENSAIBAKABON",      }, // Heisei Tensai Bakabon (Japan)
+    {.vramHash1 = 0xb7798793, .vramHash2 = 0xa8645ca1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WATER WORLD",        }, // Water World (Europe)
+    {.vramHash1 = 0x9ea45574, .vramHash2 = 0xa86b771c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KINTARO RPG",        }, // Masakari Densetsu - Kintarou RPG Hen (Japan)
+    {.vramHash1 = 0x6fddb7a4, .vramHash2 = 0xa8ff1554, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EIZYUKUGO 1000",     }, // Goukaku Boy Series - Eijukugo Target 1000 (Japan)
+    {.vramHash1 = 0xddf43507, .vramHash2 = 0xa9219765, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Donkey Kong Land 3", }, // Donkey Kong Land III (USA, Europe) (Beta), Donkey Kong Land III (USA, Europe) (Rev A), Donkey Kong Land III (USA, Europe)
+    {.vramHash1 = 0x92380bab, .vramHash2 = 0xa95c0bea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FLIPULL",            }, // Flipull (USA)
+    {.vramHash1 = 0x9f3709e1, .vramHash2 = 0xa9733ab1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BLUES",        }, // Blues Brothers, The - Jukebox Adventure (Europe)
+    {.vramHash1 = 0x48271894, .vramHash2 = 0xa9b95a1e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUBBLE SAVER 2",     }, // Rubble Saver II (Japan)
+    {.vramHash1 = 0x6b91fe32, .vramHash2 = 0xa9e596f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SDSENGOKUDEN2",      }, // SD Sengokuden 2 - Tenka Touitsu Hen (Japan)
+    {.vramHash1 = 0x23c0e2b5, .vramHash2 = 0xaa765508, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATMAN FOREVER",     }, // Batman Forever (Japan)
+    {.vramHash1 = 0xca5c8913, .vramHash2 = 0xaa7921a6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHISENSYO",          }, // Shisenshou - Match-Mania (Japan)
+    {.vramHash1 = 0x6e39293e, .vramHash2 = 0xaafcc111, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KOKIATSUBOY",        }, // Koukiatsu Boy (Japan)
+    {.vramHash1 = 0x0d4529ed, .vramHash2 = 0xab0e636e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUNANMNBD4",     }, // Goukaku Boy GOLD - Shikakui Atama o Maruku Suru - Nanmon no Sho (Japan)
+    {.vramHash1 = 0xf7bd088b, .vramHash2 = 0xab33ebfb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADDAMS FAMILY",      }, // Addams Family, The (Europe) (En,Fr,De)
+    {.vramHash1 = 0xf92fcb29, .vramHash2 = 0xab6b1408, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FRANK THOMAS B",     }, // Frank Thomas Big Hurt Baseball (USA, Europe)
+    {.vramHash1 = 0xca17170f, .vramHash2 = 0xab77c7f2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAESARS PALACE",     }, // Caesars Palace (Europe) (En,Fr,De,Es,It)
+    {.vramHash1 = 0x325b520e, .vramHash2 = 0xabc3cbc5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHASE HQ",           }, // Chase H.Q. (USA, Europe)
+    {.vramHash1 = 0x505bef60, .vramHash2 = 0xabc64bd0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PROBOTECTOR",        }, // Probotector (Europe)
+    {.vramHash1 = 0xdb31b60d, .vramHash2 = 0xabcd9c9b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POWER RACER",        }, // Power Racer (Europe), Power Racer (USA)
+    {.vramHash1 = 0x7743cbb7, .vramHash2 = 0xabd3d412, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "METALJACK",          }, // Kikou Keisatsu Metal Jack (Japan)
+    {.vramHash1 = 0x89c32a62, .vramHash2 = 0xac25c88a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KEIBAKIZOKU EX",     }, // Kachiuma Yosou Keiba Kizoku EX '94 (Japan), Kachiuma Yosou Keiba Kizoku EX '95 (Japan)
+    {.vramHash1 = 0x7b67ffb6, .vramHash2 = 0xac2e6404, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIRBY BLOCKBAL",     }, // Kirby's Block Ball (USA, Europe)
+    {.vramHash1 = 0x0f42d36b, .vramHash2 = 0xad01e2b0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HOME ALONE",         }, // Home Alone (Japan)
+    {.vramHash1 = 0x321f4a23, .vramHash2 = 0xad769d0c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BASE BALL KIDS",     }, // Baseball Kids (Japan)
+    {.vramHash1 = 0x3ab23d91, .vramHash2 = 0xad79d664, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "J.CUP SOCCER",       }, // Jaleco J.Cup Soccer (Japan)
+    {.vramHash1 = 0x7b98c38e, .vramHash2 = 0xad8076d4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HERCULES",           }, // Hercules (USA, Europe)
+    {.vramHash1 = 0x0399a17a, .vramHash2 = 0xad8f0a6d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMISTA3",           }, // Famista 3 (Japan)
+    {.vramHash1 = 0xb028d211, .vramHash2 = 0xada3636e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UNO2SMALL WORL",     }, // Uno 2 - Small World (Japan)
+    {.vramHash1 = 0xe93bd253, .vramHash2 = 0xae70f4f7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB DBZ GOKOU 2",     }, // Dragon Ball Z - Gokuu Gekitouden (Japan)
+    {.vramHash1 = 0x3241803a, .vramHash2 = 0xaecf0057, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OBELIX",             }, // Asterix & Obelix (Europe) (Fr,De)
+    {.vramHash1 = 0x1f6e009c, .vramHash2 = 0xafb38657, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEACH_VOLLEY",       }, // Nekketsu! Beach Volley Da yo Kunio-kun (Japan)
+    {.vramHash1 = 0x31639ff0, .vramHash2 = 0xafd1a6d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTHELLO",            }, // Othello (Europe)
+    {.vramHash1 = 0x00fed806, .vramHash2 = 0xaffdd739, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LAST ACTION HE",     }, // Last Action Hero (USA, Europe)
+    {.vramHash1 = 0xb229999b, .vramHash2 = 0xb03b6c6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FIFA SOCCER 97",     }, // FIFA Soccer '97 (USA, Europe)
+    {.vramHash1 = 0xb25ab0c7, .vramHash2 = 0xb0eb4130, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KINGYOTYUUI",     }, // Kingyo Chuuihou! - Wapiko no Wakuwaku Stamp Rally! (Japan)
+    {.vramHash1 = 0xe1e85c1d, .vramHash2 = 0xb14ca8f0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU KOF 96",      }, // Nettou The King of Fighters '96 (Japan)
+    {.vramHash1 = 0x10300283, .vramHash2 = 0xb19376ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOPRANKINGTENN",     }, // Top Ranking Tennis (Europe)
+    {.vramHash1 = 0x8a6d48a1, .vramHash2 = 0xb1a6593c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET LOVE",        }, // Pocket Love (Japan)
+    {.vramHash1 = 0xa79475a5, .vramHash2 = 0xb1e5bcef, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DOUBLEYAKUMAN",      }, // Double Yakuman (Japan)
+    {.vramHash1 = 0x3f26dc81, .vramHash2 = 0xb21f736e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KORODICE",           }, // Koro Dice (Japan)
+    {.vramHash1 = 0x35860a1b, .vramHash2 = 0xb230ef2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUST A MOVE 2",      }, // Bust-A-Move 2 - Arcade Edition (USA, Europe)
+    {.vramHash1 = 0x08bb76b0, .vramHash2 = 0xb25036d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SEIKEN DENSETS",     }, // Final Fantasy Adventure (USA)
+    {.vramHash1 = 0xafa23911, .vramHash2 = 0xb28f6fc6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CATRAP",             }, // Catrap (USA)
+    {.vramHash1 = 0x2e9e2303, .vramHash2 = 0xb2c74ec1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BASES LOADED G",     }, // Bases Loaded for Game Boy (USA)
+    {.vramHash1 = 0xde3a946c, .vramHash2 = 0xb2e362aa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGA MAN 2",         }, // Mega Man II (Europe)
+    {.vramHash1 = 0xf2b5def4, .vramHash2 = 0xb31776bc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SPIRIT OF ",     }, // Spirit of F-1, The (Europe)
+    {.vramHash1 = 0x7d065504, .vramHash2 = 0xb38866a0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VIRTUAL WARS",       }, // Virtual Wars (Japan)
+    {.vramHash1 = 0x3ab4fc47, .vramHash2 = 0xb3a76ac5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORAKYURADENSE",     }, // Dracula Densetsu (Japan)
+    {.vramHash1 = 0x3ffb5da5, .vramHash2 = 0xb3c0f628, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE BULL",        }, // Battle Bull (Japan), Battle Bull (USA)
+    {.vramHash1 = 0xcdb2ec5d, .vramHash2 = 0xb3c7c12a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "URUSEIYATSURA",      }, // Urusei Yatsura - Miss Tomobiki o Sagase! (Japan)
+    {.vramHash1 = 0xdfa2a52b, .vramHash2 = 0xb3ce6026, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Burai Senshi",       }, // Burai Senshi Deluxe (Japan)
+    {.vramHash1 = 0x74dc8131, .vramHash2 = 0xb3f66178, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUUYUU-2",           }, // Yu Yu Hakusho Dai-2-dan - Ankoku Bujutsukai Hen (Japan)
+    {.vramHash1 = 0x50892617, .vramHash2 = 0xb409bd29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DENNIS",             }, // Dennis (Europe)
+    {.vramHash1 = 0x508928eb, .vramHash2 = 0xb40cf605, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DENNIS",             }, // Dennis the Menace (USA)
+    {.vramHash1 = 0xeca3e879, .vramHash2 = 0xb4878acb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENSAN",             }, // Daiku no Gen-san - Ghost Building Company (Japan)
+    {.vramHash1 = 0xeca3e8a0, .vramHash2 = 0xb48896d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENSAN",             }, // Hammerin' Harry - Ghost Building Company (Europe)
+    {.vramHash1 = 0x4c0318d7, .vramHash2 = 0xb4c61077, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTHELLO",            }, // Othello (Japan)
+    {.vramHash1 = 0xd71175a0, .vramHash2 = 0xb4f0d1c4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERCHINESELA",     }, // Super Chinese Land (Japan)
+    {.vramHash1 = 0x7d427f80, .vramHash2 = 0xb52e079a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISLO GB",        }, // Pachi-Slot Hisshou Guide GB (Japan)
+    {.vramHash1 = 0xfa518d69, .vramHash2 = 0xb5473c2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "XENON 2",            }, // Xenon 2 - Megablast (Japan)
+    {.vramHash1 = 0x32b4118b, .vramHash2 = 0xb56891e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKSYAKAIBE3",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Shakai Battle Hen (Japan) (Special Edition)
+    {.vramHash1 = 0x18d644d3, .vramHash2 = 0xb59af815, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE FIDGETTS",       }, // Fidgetts, The (USA, Europe) (En,Fr,De,Es,It,Nl,Sv)
+    {.vramHash1 = 0xe1dc8ea8, .vramHash2 = 0xb59f9646, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOJIJUKUGO",         }, // Goukaku Boy Series - Gakken - Yojijukugo 288 (Japan) (Rev A), Goukaku Boy Series - Gakken - Yojijukugo 288 (Japan)
+    {.vramHash1 = 0x3af8b8d2, .vramHash2 = 0xb5aa1d71, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANGEL MARLOWE",      }, // Taiyou no Tenshi Marlowe - Ohanabatake wa Dai-panic (Japan)
+    {.vramHash1 = 0x3f614bae, .vramHash2 = 0xb5bebee6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RUBBLESA",           }, // Rubble Saver (Japan)
+    {.vramHash1 = 0x5eabf7d6, .vramHash2 = 0xb5f41e75, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROLANS CURSE",       }, // Rolan's Curse (USA)
+    {.vramHash1 = 0xcb86185b, .vramHash2 = 0xb6106c6a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR TREK",          }, // Star Trek - 25th Anniversary (USA, Europe)
+    {.vramHash1 = 0x0828a799, .vramHash2 = 0xb64e9673, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LUNA LANDER",        }, // Lunar Lander (Japan)
+    {.vramHash1 = 0x20f0fddc, .vramHash2 = 0xb64f6563, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHOPLIFTER 2",       }, // Choplifter II - Rescue & Survive (Europe)
+    {.vramHash1 = 0xde873536, .vramHash2 = 0xb70f2bfb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSSY NO TAMAG",     }, // Yoshi (USA)
+    {.vramHash1 = 0x178a558d, .vramHash2 = 0xb712d447, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPARTAN X",          }, // Kung-Fu Master (USA, Europe)
+    {.vramHash1 = 0x3cd85003, .vramHash2 = 0xb7163ae4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALLEY WAY",          }, // Alleyway (World)
+    {.vramHash1 = 0x487e4f4e, .vramHash2 = 0xb73c34bb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBGENJIN2",          }, // GB Genjin 2 (Japan)
+    {.vramHash1 = 0x4b03996b, .vramHash2 = 0xb7b3d026, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHIPPO DE BUN",      }, // Shippo de Bun (Japan)
+    {.vramHash1 = 0xdd34f009, .vramHash2 = 0xb8122d0f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAINTERMOMOPIE",     }, // Painter Momopie (Japan)
+    {.vramHash1 = 0xf948ad3f, .vramHash2 = 0xb81efd2d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BA.TOSHINDEN",       }, // Battle Arena Toshinden (USA)
+    {.vramHash1 = 0x932159a5, .vramHash2 = 0xb82bef00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GAME GALLERY",       }, // Pachio-kun - Game Gallery (Japan)
+    {.vramHash1 = 0x148cdcd9, .vramHash2 = 0xb84b07b8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL QB CLUB 96",     }, // NFL Quarterback Club '96 (USA, Europe)
+    {.vramHash1 = 0xb83a54e3, .vramHash2 = 0xb8929798, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TURI SENSEI V1",     }, // Tsuri Sensei (Japan)
+    {.vramHash1 = 0x91c8da3d, .vramHash2 = 0xb8af9218, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MR.DO!",             }, // Mr. Do! (USA)
+    {.vramHash1 = 0x4b140fef, .vramHash2 = 0xb8dbb79e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET KYOROCH",     }, // Pocket Kyoro-chan (Japan)
+    {.vramHash1 = 0x51515d9e, .vramHash2 = 0xb90d6657, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-IN-TIME",        }, // Pac-In-Time (Europe)
+    {.vramHash1 = 0x66022b35, .vramHash2 = 0xb92a6f99, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6-tsu no Kinka (Japan) (Rev 1)
+    {.vramHash1 = 0xa9f839e4, .vramHash2 = 0xb934d3cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD BOWLING",      }, // World Bowling (USA)
+    {.vramHash1 = 0x191d038d, .vramHash2 = 0xb9584fae, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POPEYE",             }, // Popeye (Japan)
+    {.vramHash1 = 0x58feb1e2, .vramHash2 = 0xb959e302, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Blaster Master",     }, // Blaster Master Boy (USA), Blaster Master Jr. (Europe), Bomber King - Scenario 2 (Japan)
+    {.vramHash1 = 0x86c2e310, .vramHash2 = 0xb976f001, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MONSTER MAKER",      }, // Monster Maker - Barcode Saga (Japan)
+    {.vramHash1 = 0x75fdd3a0, .vramHash2 = 0xb9b4a6e0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOGURANYA",          }, // Moguranya (Japan)
+    {.vramHash1 = 0xa6a74dc9, .vramHash2 = 0xb9e34f9f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEW CHESSMASTE",     }, // New Chessmaster, The (Japan) (En,Ja)
+    {.vramHash1 = 0x338f9c87, .vramHash2 = 0xb9e8e8b9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DROPZONE",           }, // Dropzone (Europe)
+    {.vramHash1 = 0xc82a3e23, .vramHash2 = 0xba1a95d7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BAKENOUZ",           }, // DX Bakenou Z (Japan) (Rev A), DX Bakenou Z (Japan)
+    {.vramHash1 = 0x71f393e5, .vramHash2 = 0xbaac49a8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AVENGING SPIRI",     }, // Avenging Spirit (USA, Europe)
+    {.vramHash1 = 0xad0db4ac, .vramHash2 = 0xbacdf771, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHASE HQ",           }, // Taito Chase H.Q. (Japan)
+    {.vramHash1 = 0x34ecfbe5, .vramHash2 = 0xbada17f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINESWEEPER",        }, // Minesweeper - Soukaitei (Japan)
+    {.vramHash1 = 0x6604be14, .vramHash2 = 0xbb1c9bb5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6-tsu no Kinka (Japan)
+    {.vramHash1 = 0x57b43bb0, .vramHash2 = 0xbb2c2ef7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEMESIS 2",          }, // Nemesis II (Japan)
+    {.vramHash1 = 0xb7c0f34e, .vramHash2 = 0xbb30e5dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB CRAYON 2",        }, // Crayon Shin-chan 2 - Ora to Wanpaku Gokko Dazo (Japan)
+    {.vramHash1 = 0x6a022ce7, .vramHash2 = 0xbb5b0569, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR FRANKEN",         }, // Dr. Franken (Europe) (En,Fr,De,Es,It,Nl,Sv)
+    {.vramHash1 = 0x236d025d, .vramHash2 = 0xbb7d37d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMIC BASKET",     }, // Konamic Basket (Japan)
+    {.vramHash1 = 0x3b21299e, .vramHash2 = 0xbb8752c6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SHINRI GAM",     }, // Shinri Game 2, The - Oosaka Hen (Japan)
+    {.vramHash1 = 0x3841b5e6, .vramHash2 = 0xbbb8b6ff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NFL FOOTBALL",       }, // NFL Football (USA)
+    {.vramHash1 = 0x6da5175a, .vramHash2 = 0xbbc815d4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER OFF ROAD",     }, // Super Off Road (USA, Europe)
+    {.vramHash1 = 0x95ddd866, .vramHash2 = 0xbbd0b695, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RED ARREMER",        }, // Red Arremer - Makai Mura Gaiden (Japan)
+    {.vramHash1 = 0x164ea5b7, .vramHash2 = 0xbbdd0442, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER HUNCHBAC",     }, // Super Hunchback (Europe), Super Hunchback (Japan), Super Hunchback (USA)
+    {.vramHash1 = 0xdb2035ae, .vramHash2 = 0xbc243a40, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRAX",               }, // Trax (USA, Europe)
+    {.vramHash1 = 0x7aed576c, .vramHash2 = 0xbc54c652, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FISH DUDE",          }, // Fish Dude (USA)
+    {.vramHash1 = 0xd400ca48, .vramHash2 = 0xbc5b450a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DINO2         ",     }, // Dino Breeder 2 (Japan)
+    {.vramHash1 = 0x5a66cfdc, .vramHash2 = 0xbc6d4100, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ARETHA",             }, // Aretha (Japan)
+    {.vramHash1 = 0x00686b9d, .vramHash2 = 0xbc9ac236, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WINNER'S HORSE",     }, // Winner's Horse (Japan)
+    {.vramHash1 = 0x4faa2cee, .vramHash2 = 0xbc9ca918, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MADDEN '97",         }, // Madden '97 (USA)
+    {.vramHash1 = 0xb54a120b, .vramHash2 = 0xbca2d561, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-AAJ",            }, // Ponta to Hinako no Chindouchuu - Yuujou Hen (Japan)
+    {.vramHash1 = 0x79077fa7, .vramHash2 = 0xbcef1f02, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR FRANKEN 2",       }, // Dr. Franken II (USA, Europe) (En,Fr,De,Es,It,Nl,Sv)
+    {.vramHash1 = 0xd467c47d, .vramHash2 = 0xbd07ae98, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOM AND JERRY ",     }, // Tom to Jerry (Japan)
+    {.vramHash1 = 0xe11da1f5, .vramHash2 = 0xbd0e824e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHOU HYPER FIS",     }, // Bakuchou Retsuden Shou - Hyper Fishing (Japan)
+    {.vramHash1 = 0xbe8f4f69, .vramHash2 = 0xbd47e104, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMISTA",            }, // Famista (Japan)
+    {.vramHash1 = 0x7131a2c5, .vramHash2 = 0xbd585223, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEETLEJUICE",        }, // Beetlejuice (USA)
+    {.vramHash1 = 0xb48eee85, .vramHash2 = 0xbd59f4f5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU KOF 95",      }, // King of Fighters '95, The (USA)
+    {.vramHash1 = 0x9fe911f7, .vramHash2 = 0xbd60f061, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LUCKY LUKE",         }, // Lucky Luke (Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0xf1cde395, .vramHash2 = 0xbdeb20d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RTYPE 2",            }, // Mani 4 in 1 (China) (DMG-604 CHN), R-Type II (Europe), R-Type II (Japan)
+    {.vramHash1 = 0xecb23652, .vramHash2 = 0xbdf3e5fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SUPERBIKKUR",     }, // Super Bikkuriman - Densetsu no Sekiban (Japan)
+    {.vramHash1 = 0xed3c7a64, .vramHash2 = 0xbe15b6f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JANSHIRO2",          }, // Janshirou II - Sekai Saikyou no Janshi (Japan)
+    {.vramHash1 = 0xe4b4245a, .vramHash2 = 0xbeae091d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KONAMIC GOLF",       }, // Konamic Golf (Japan)
+    {.vramHash1 = 0xd6fc6a06, .vramHash2 = 0xbf2e1129, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DETECTIVE CONA",     }, // Meitantei Conan - Chika Yuuenchi Satsujin Jiken (Japan)
+    {.vramHash1 = 0x73c3add9, .vramHash2 = 0xbf2fcf83, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOTAL CARNAGE",      }, // Total Carnage (USA, Europe)
+    {.vramHash1 = 0x470f0e3a, .vramHash2 = 0xbf7e38d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DEFENDER/JOUST",     }, // Arcade Classic No. 4 - Defender & Joust (USA, Europe)
+    {.vramHash1 = 0xbd8c2303, .vramHash2 = 0xbfd58113, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MACH GO",            }, // Mach Go Go Go (Japan)
+    {.vramHash1 = 0x3b1fda0a, .vramHash2 = 0xbff06975, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FRISKY TOM",         }, // Frisky Tom (Japan)
+    {.vramHash1 = 0x342cab43, .vramHash2 = 0xbff31f0d, .dmaFix = 0xff95, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Alien vs Predator",  }, // Alien vs Predator - The Last of His Clan (USA)
+    {.vramHash1 = 0xc4489e72, .vramHash2 = 0xc00fae8b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHIOKUN 3",        }, // Pachio-kun 3 (Japan)
+    {.vramHash1 = 0x2aa7a1fd, .vramHash2 = 0xc020c3f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JANTAKUBOY",         }, // Jantaku Boy (Japan)
+    {.vramHash1 = 0x18799283, .vramHash2 = 0xc037baeb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ARETHA3",            }, // Aretha III (Japan)
+    {.vramHash1 = 0xafe7b9f4, .vramHash2 = 0xc038c351, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ELEVATOR ACTIO",     }, // Elevator Action (Japan), Elevator Action (USA, Europe)
+    {.vramHash1 = 0x2d9c5489, .vramHash2 = 0xc0ec037c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NIGEL MANSELL",      }, // Nigel Mansell's World Championship (Europe)
+    {.vramHash1 = 0x2d9c5491, .vramHash2 = 0xc0ec03d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MANSELL",            }, // Nigel Mansell's World Championship Racing (Europe)
+    {.vramHash1 = 0xf91e5034, .vramHash2 = 0xc115193d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "XENON 2",            }, // Xenon 2 - Megablast (USA, Europe)
+    {.vramHash1 = 0x99c7b23f, .vramHash2 = 0xc1275436, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTOGI BANASI T",     }, // Otogibanashi Taisen (Japan)
+    {.vramHash1 = 0xd6346db6, .vramHash2 = 0xc1377f07, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DINO          ",     }, // Dino Breeder (Japan) (Rev A), Dino Breeder (Japan)
+    {.vramHash1 = 0x4c11d435, .vramHash2 = 0xc1417140, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER BATTLETA",     }, // Super Battletank - War in the Gulf (USA)
+    {.vramHash1 = 0x98f88dd9, .vramHash2 = 0xc1479baa, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JEOPARDY",           }, // Jeopardy! (USA)
+    {.vramHash1 = 0xb4ab8857, .vramHash2 = 0xc151afb3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SI KIDS",            }, // Sports Illustrated for Kids - The Ultimate Triple Dare! (USA)
+    {.vramHash1 = 0x5bd1761c, .vramHash2 = 0xc16dadbc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PIPE DREAM",         }, // Pipe Dream (USA)
+    {.vramHash1 = 0xe49640ba, .vramHash2 = 0xc176f093, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSSY NO PANEP",     }, // Yoshi no Panepon (Japan)
+    {.vramHash1 = 0xf11daffa, .vramHash2 = 0xc17c9d94, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ADVENTUREISLAN",     }, // Adventure Island II - Aliens in Paradise (USA, Europe)
+    {.vramHash1 = 0x45985a6b, .vramHash2 = 0xc1908b0a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE SHIP",        }, // Battleship (USA, Europe)
+    {.vramHash1 = 0x42ac5ed9, .vramHash2 = 0xc1940bcf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Donkey Kong Land",   }, // Donkey Kong Land (Japan)
+    {.vramHash1 = 0x777a95b1, .vramHash2 = 0xc198b10c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Donkey Kong Land",   }, // Donkey Kong Land (USA, Europe)
+    {.vramHash1 = 0xeb701b5d, .vramHash2 = 0xc1e491d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIBIMARUKO4",       }, // Chibi Maruko-chan 4 - Kore ga Nihon Da yo! Ouji-sama (Japan)
+    {.vramHash1 = 0xe290b394, .vramHash2 = 0xc20737ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB LUCKYMAN",        }, // Tottemo! Lucky Man - Lucky Cookie Minna Daisuki!! (Japan)
+    {.vramHash1 = 0x8c89aa47, .vramHash2 = 0xc27852d7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KASEKI REBORN",      }, // Kaseki Sousei Reborn (Japan)
+    {.vramHash1 = 0x0d9025ae, .vramHash2 = 0xc28b3c9d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRA3",             }, // America Oudan Ultra Quiz Part 3 - Champion Taikai (Japan)
+    {.vramHash1 = 0x70ab89fd, .vramHash2 = 0xc2b6a9df, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OTHELLO WORLD",      }, // Othello World (Japan)
+    {.vramHash1 = 0x4d33bb9a, .vramHash2 = 0xc3008894, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Ninja Gaiden",       }, // Ninja Gaiden Shadow (USA), Shadow Warriors (Europe)
+    {.vramHash1 = 0x044952ba, .vramHash2 = 0xc30685c0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINKU 2",            }, // Ninku Dai-2-dan - Ninku Sensou Hen (Japan)
+    {.vramHash1 = 0x763e12ea, .vramHash2 = 0xc34e8b31, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKU RIKABH4",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Rika Battle Hen (Japan) (Special Edition)
+    {.vramHash1 = 0x385b8d41, .vramHash2 = 0xc370ad2c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PANG",               }, // Pang (Europe)
+    {.vramHash1 = 0xa7ff4b9f, .vramHash2 = 0xc3718eb0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINJA BOY 2",        }, // Ninja Boy 2 (USA, Europe)
+    {.vramHash1 = 0xb790e60c, .vramHash2 = 0xc3d43c4e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEST OF THE BE",     }, // Best of the Best - Championship Karate (Europe)
+    {.vramHash1 = 0x3fa7ed06, .vramHash2 = 0xc3debf55, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENJINKAISEN",       }, // Tenjin Kaisen (Japan)
+    {.vramHash1 = 0x00a75c60, .vramHash2 = 0xc40a4335, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ALTERED SPACE",      }, // Altered Space - A 3-D Alien Adventure (Europe)
+    {.vramHash1 = 0x47823887, .vramHash2 = 0xc4103bbb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OUT TO LUNCH",       }, // Pierre le Chef Is... Out to Lunch (Europe)
+    {.vramHash1 = 0x2b55f9bf, .vramHash2 = 0xc4309fe5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL SPOT",          }, // Cool Spot (Europe)
+    {.vramHash1 = 0x5d0da17a, .vramHash2 = 0xc4581ca4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB BEACHVOLLEY",     }, // World Beach Volley - 1992 GB Cup (Europe)
+    {.vramHash1 = 0x51d0a9e3, .vramHash2 = 0xc47289ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-SJJ",            }, // Snow Bros. Jr. (Japan)
+    {.vramHash1 = 0x807121a1, .vramHash2 = 0xc47fec22, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP 98",       }, // World Cup 98 (USA, Europe)
+    {.vramHash1 = 0x39ce1bea, .vramHash2 = 0xc49f36c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "J CONNORS TENN",     }, // Jimmy Connors Tennis (USA, Europe)
+    {.vramHash1 = 0x7f69d047, .vramHash2 = 0xc4a2900a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINTAMA PUZZLE",     }, // Puzzle Nintama Rantarou (Japan)
+    {.vramHash1 = 0x45092441, .vramHash2 = 0xc4da4db1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RACE DAYS",          }, // Race Days (Europe), Race Days (USA)
+    {.vramHash1 = 0x22b15d30, .vramHash2 = 0xc4dbb3e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MYSTERIUM",          }, // Mysterium (Japan), Mysterium (USA)
+    {.vramHash1 = 0x5e91b260, .vramHash2 = 0xc4fdae41, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG GARIBA-BOU",     }, // Kuusou Kagaku Sekai Gulliver Boy - Kuusou Kagaku Puzzle Purittopon!! (Japan)
+    {.vramHash1 = 0x7e437672, .vramHash2 = 0xc4fef73a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SWAMP THING",        }, // Swamp Thing (USA, Europe)
+    {.vramHash1 = 0xc3aa54d8, .vramHash2 = 0xc519bf22, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DESERT STRIKE",      }, // Desert Strike - Return to the Gulf (USA)
+    {.vramHash1 = 0xe0000800, .vramHash2 = 0xc5760400, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAYEARTH2",          }, // Magic Knight Rayearth 2nd. - The Missing Colors (Japan)
+    {.vramHash1 = 0xe613b8a2, .vramHash2 = 0xc5874c90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKSYAKAIAK8",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Shakai Battle Hen (Japan)
+    {.vramHash1 = 0xf77b5e0c, .vramHash2 = 0xc5a47568, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENCOL",             }, // Genjin Collection (Japan)
+    {.vramHash1 = 0xd491d32f, .vramHash2 = 0xc5bcc6cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UNO-SMALL WORL",     }, // Uno - Small World (Japan)
+    {.vramHash1 = 0x45cac450, .vramHash2 = 0xc623b1b1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "J CONNORS TENN",     }, // Jimmy Connors no Pro Tennis Tour (Japan)
+    {.vramHash1 = 0x475db67e, .vramHash2 = 0xc632a1b2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RACE DRIVIN'",       }, // Race Drivin' (USA, Europe)
+    {.vramHash1 = 0xe962808b, .vramHash2 = 0xc6719093, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOXING",             }, // Boxing (Japan)
+    {.vramHash1 = 0xfff39000, .vramHash2 = 0xc721c800, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mick & Mack",        }, // Mick & Mack as the Global Gladiators (USA) (Proto)
+    {.vramHash1 = 0xb0ffd454, .vramHash2 = 0xc79ab341, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SHOUGI SAIK",     }, // Shougi Saikyou (Japan) (Rev A), Shougi Saikyou (Japan)
+    {.vramHash1 = 0x0341ddc0, .vramHash2 = 0xc7c87ff1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR FRANKEN",         }, // Dr. Franken (USA)
+    {.vramHash1 = 0x0341de5e, .vramHash2 = 0xc7c88307, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DR FRANKEN",         }, // Dr. Franken (Japan)
+    {.vramHash1 = 0x425f8e11, .vramHash2 = 0xc808c29f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6 Golden Coins (USA, Europe) (Rev A)
+    {.vramHash1 = 0xdd3e15dc, .vramHash2 = 0xc830c642, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Exodus",             }, // Exodus - Journey to the Promised Land (USA) (Unl)
+    {.vramHash1 = 0xda93eb6b, .vramHash2 = 0xc83fc9d9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPIDER-MAN 2",       }, // Spider-Man 2 (USA, Europe)
+    {.vramHash1 = 0x7034fe80, .vramHash2 = 0xc887f1c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAGNETIC SOCCE",     }, // Magnetic Soccer (Europe)
+    {.vramHash1 = 0x316a20d6, .vramHash2 = 0xc89a692c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPANKY'S QUEST",     }, // Spanky's Quest (Europe)
+    {.vramHash1 = 0x04c50825, .vramHash2 = 0xc89fee5e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PROWRES",            }, // Pro Wrestling (Japan)
+    {.vramHash1 = 0x8a2b0065, .vramHash2 = 0xc8be0df7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHONENASHIBE",       }, // Shounen Ashibe - Yuuenchi Panic (Japan)
+    {.vramHash1 = 0xd7f33e80, .vramHash2 = 0xc8f2671c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAEDALIAN OPUS",     }, // Daedalian Opus (USA)
+    {.vramHash1 = 0x1931ce76, .vramHash2 = 0xc912c82b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "S-PACHINKO WAR",     }, // Super Pachinko Taisen (Japan)
+    {.vramHash1 = 0xe000f800, .vramHash2 = 0xc9367c00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGAIA",             }, // Mani 4 in 1 (China) (DMG-602 CHN), Sagaia (Japan), Taito Variety Pack (Japan)
+    {.vramHash1 = 0xe001f800, .vramHash2 = 0xc936fc00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WARIOLAND2",         }, // Wario Land II (USA, Europe)
+    {.vramHash1 = 0x4b33b7dd, .vramHash2 = 0xc9f693f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {{.jumpAddress = 0x309d, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x20, .notTakenMethod = and, .notTakenValue = 0xdf}, {.jumpAddress = 0x30a2, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, {.jumpAddress = 0x3131, .fixTarget = 0xff90, .takenMethod = or, .takenValue = 0x40, .notTakenMethod = and, .notTakenValue = 0xbf}, }, .writeRegistersDuringDMA = {}, .title = "Battletoads Ragn.",  }, // Battletoads in Ragnarok's World (Europe), Battletoads in Ragnarok's World (USA)
+    {.vramHash1 = 0x4262226b, .vramHash2 = 0xc9fc1270, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6 Golden Coins (USA, Europe)
+    {.vramHash1 = 0x24328224, .vramHash2 = 0xca6345a3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PINOCCHIO",          }, // Pinocchio (Europe)
+    {.vramHash1 = 0xf2262595, .vramHash2 = 0xca73ea6d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SELECTION",          }, // Selection - Erabareshi Mono (Japan)
+    {.vramHash1 = 0xa0425786, .vramHash2 = 0xcab6da85, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POWER MISSION",      }, // Power Mission (Japan) (Rev A), Power Mission (Japan), Power Mission (USA)
+    {.vramHash1 = 0xfc165c30, .vramHash2 = 0xcace585f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WHEEL OF FORTU",     }, // Wheel of Fortune (USA)
+    {.vramHash1 = 0x462388ba, .vramHash2 = 0xcada51fb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WAVERACE",           }, // Wave Race (USA, Europe)
+    {.vramHash1 = 0x725856cc, .vramHash2 = 0xcaea3b65, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MINI PUTT",          }, // Mini Putt (Japan)
+    {.vramHash1 = 0x1cf52ec6, .vramHash2 = 0xcaf62b9d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GANBARE GOEMON",     }, // Ganbare Goemon - Sarawareta Ebisumaru (Japan)
+    {.vramHash1 = 0xdc972106, .vramHash2 = 0xcaf63a10, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRAPPERS TENGO",     }, // Trappers Tengoku - Spy vs Spy (Japan)
+    {.vramHash1 = 0xaa39e0e6, .vramHash2 = 0xcb10822f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TITUS THE FOX",      }, // Titus the Fox to Marrakech and Back (USA, Europe)
+    {.vramHash1 = 0x07fa637e, .vramHash2 = 0xcb2c18fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NINTAMA RANTAR",     }, // Nintama Rantarou GB (Japan)
+    {.vramHash1 = 0x0c3bb89b, .vramHash2 = 0xcb4bec66, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATTLE DODGEBA",     }, // Battle Dodge Ball (Japan)
+    {.vramHash1 = 0x310bb5f9, .vramHash2 = 0xcb4c45e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOUSE TRAP HOT",     }, // Mouse Trap Hotel (USA)
+    {.vramHash1 = 0x1770b02b, .vramHash2 = 0xcb5d1aba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KID NIKI",           }, // Ganso!! Yancha Maru (Japan)
+    {.vramHash1 = 0x148f0ea2, .vramHash2 = 0xcbaeddbc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Red",        }, // Pokemon - Edicion Roja (Spain), Pokemon - Rote Edition (Germany), Pokemon - Version Rouge (France), Pokemon - Versione Rossa (Italy)
+    {.vramHash1 = 0xdb133c41, .vramHash2 = 0xcc053e2b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Z KAI KOBUN   ",     }, // Goukaku Boy Series - Z Kai (Reibun de Oboeru) Kyuukyoku no Kobun Tango (Japan)
+    {.vramHash1 = 0xe1604bf0, .vramHash2 = 0xcc413a3e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HUNCHBACK",          }, // Hunchback of Notre Dame, The - 5 Foolishly Fun Topsy Turvy Games (USA, Europe)
+    {.vramHash1 = 0xe8fb7028, .vramHash2 = 0xcc482c2f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DEXTERITY",          }, // Dexterity (USA, Europe)
+    {.vramHash1 = 0xaada3149, .vramHash2 = 0xcc48c35b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN4",           }, // Mega Man IV (Europe)
+    {.vramHash1 = 0x2f303476, .vramHash2 = 0xcc81ad27, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD CUP USA ",     }, // World Cup USA 94 (Europe) (En,Fr,De,Es,It,Nl,Pt,Sv)
+    {.vramHash1 = 0x9f3e1294, .vramHash2 = 0xccbc1b95, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMCOL",             }, // Bomber Man Collection (Japan)
+    {.vramHash1 = 0x74d80bc5, .vramHash2 = 0xccf33d77, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCAHONTAS",         }, // Pocahontas (USA, Europe)
+    {.vramHash1 = 0x9981d535, .vramHash2 = 0xcd8d434d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB POWER MOVIE",     }, // Mighty Morphin Power Rangers - The Movie (USA, Europe)
+    {.vramHash1 = 0xed344939, .vramHash2 = 0xcda904c3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA",               }, // Final Fantasy Legend, The (USA)
+    {.vramHash1 = 0x9ebd1011, .vramHash2 = 0xcdea80fd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARBLE MADNESS",     }, // Marble Madness (USA, Europe)
+    {.vramHash1 = 0x9826b15a, .vramHash2 = 0xcdebf5f1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIE MAUS",           }, // Maus, Die (Europe) (En,Fr,De,Es)
+    {.vramHash1 = 0xf7bf13f7, .vramHash2 = 0xce94a749, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Batman Animated",    }, // Batman - The Animated Series (USA, Europe)
+    {.vramHash1 = 0xbb213f7f, .vramHash2 = 0xcec0a0b1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMILY JOCKEY2",     }, // Family Jockey 2 - Meiba no Kettou (Japan)
+    {.vramHash1 = 0x30702e88, .vramHash2 = 0xcec713f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MUHAMMAD ALI",       }, // Muhammad Ali Heavyweight Boxing (USA, Europe)
+    {.vramHash1 = 0x0260625f, .vramHash2 = 0xcec9672a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JELLY BOY",          }, // Jelly Boy (Europe)
+    {.vramHash1 = 0x727b85a9, .vramHash2 = 0xceed3f49, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG-UQJ",            }, // America Oudan Ultra Quiz (Japan)
+    {.vramHash1 = 0x12c6a6e1, .vramHash2 = 0xcef96664, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAKAIMURAGAIDE",     }, // Makai Mura Gaiden - The Demon Darkness (Japan)
+    {.vramHash1 = 0x6dfeb287, .vramHash2 = 0xcf13b402, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES",         }, // DuckTales (USA)
+    {.vramHash1 = 0xfdbc2709, .vramHash2 = 0xcf369377, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIMPSONS 2",         }, // Simpsons, The - Bart vs. the Juggernauts (USA, Europe)
+    {.vramHash1 = 0x4aba1bcc, .vramHash2 = 0xcfad5319, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BO JACKSON",         }, // Bo Jackson - Two Games in One (USA)
+    {.vramHash1 = 0xd0bc56b1, .vramHash2 = 0xcfd2d831, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI 2",              }, // Oni II - Innin Densetsu (Japan)
+    {.vramHash1 = 0xb3212f2e, .vramHash2 = 0xd02ca400, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAVY BLUE",          }, // Kaisen Game - Navy Blue (Japan)
+    {.vramHash1 = 0xd88334a3, .vramHash2 = 0xd03ef286, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE KICK BOXIN",     }, // Kick Boxing, The (Japan)
+    {.vramHash1 = 0xea02bba6, .vramHash2 = 0xd03f057e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SWORD OFHO",     }, // Sword of Hope, The (USA)
+    {.vramHash1 = 0xe874609b, .vramHash2 = 0xd08313dc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGA MAN 2",         }, // Mega Man II (USA)
+    {.vramHash1 = 0x3cd4abf9, .vramHash2 = 0xd0846350, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEKICHU RUSH",       }, // Tekichuu Rush (Japan)
+    {.vramHash1 = 0x170abb20, .vramHash2 = 0xd111ce4f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE RIVER KING",     }, // Legend of the River King GB (USA)
+    {.vramHash1 = 0xf3b34622, .vramHash2 = 0xd13b6c36, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VS BATTLER",         }, // VS Battler (Japan)
+    {.vramHash1 = 0x3c9826d0, .vramHash2 = 0xd13c8c39, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SI SPORTS",          }, // Sports Illustrated - Football & Baseball (USA)
+    {.vramHash1 = 0xcb9acfbc, .vramHash2 = 0xd1423798, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHOBAISHOBAI",       }, // Quiz Sekai wa Show by Shoubai!! (Japan)
+    {.vramHash1 = 0x430035df, .vramHash2 = 0xd150ffd1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAX",                }, // Max (Europe)
+    {.vramHash1 = 0x04fa7613, .vramHash2 = 0xd1621798, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOXXLE2",            }, // Boxxle II (USA, Europe)
+    {.vramHash1 = 0xdea18375, .vramHash2 = 0xd16c4259, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KINGDOM CRUSAD",     }, // Kingdom Crusade (USA)
+    {.vramHash1 = 0xc1c8a954, .vramHash2 = 0xd18a3512, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL WORLD",         }, // Cool World (USA, Europe)
+    {.vramHash1 = 0x674b3c37, .vramHash2 = 0xd1a1684f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMNT3",              }, // Teenage Mutant Ninja Turtles 3 - Turtles Kikiippatsu (Japan), Teenage Mutant Ninja Turtles III - Radical Rescue (USA)
+    {.vramHash1 = 0xad9b1df4, .vramHash2 = 0xd1a77637, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RIDDICK BOWE",       }, // Riddick Bowe Boxing (Europe)
+    {.vramHash1 = 0x830c99d5, .vramHash2 = 0xd1c8a2ed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MANSELL",            }, // Nigel Mansell's World Championship (USA)
+    {.vramHash1 = 0x774dcf2a, .vramHash2 = 0xd205f596, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MERCENARY FORC",     }, // Mercenary Force (USA, Europe)
+    {.vramHash1 = 0x16cd02bc, .vramHash2 = 0xd20fa691, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISLOT KIDS",     }, // Pachi-Slot Kids (Japan)
+    {.vramHash1 = 0x4ec13550, .vramHash2 = 0xd24d3e7f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BERUTOMOKURABU",     }, // Nikkan Berutomo Club (Japan)
+    {.vramHash1 = 0xbcbbe004, .vramHash2 = 0xd26d17f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUBBLEBOBBLEJR",     }, // Bubble Bobble Junior (Japan)
+    {.vramHash1 = 0xcfe20ae4, .vramHash2 = 0xd27e60d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JINSEI",             }, // Jinsei Game Densetsu (Japan)
+    {.vramHash1 = 0x39d2c97a, .vramHash2 = 0xd2aac65c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLOMON'S CLUB",     }, // Solomon's Club (USA)
+    {.vramHash1 = 0x39d2c9b7, .vramHash2 = 0xd2aad704, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLOMON'S CLUB",     }, // Solomon's Club (Europe)
+    {.vramHash1 = 0xa538ed5f, .vramHash2 = 0xd31110eb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIG DUG",            }, // Dig Dug (Europe)
+    {.vramHash1 = 0xa538ed63, .vramHash2 = 0xd31111cd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DIG DUG",            }, // Dig Dug (USA)
+    {.vramHash1 = 0x9d8b8dd7, .vramHash2 = 0xd3385375, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TENJIN KAISEN ",     }, // Yomihon Yumegoyomi - Tenjin Kaisen 2 (Japan)
+    {.vramHash1 = 0xe0038000, .vramHash2 = 0xd357c000, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTETSU JR.",      }, // Momotarou Dentetsu jr. - Zenkoku Ramen Meguri no Maki (Japan)
+    {.vramHash1 = 0xabeffe2f, .vramHash2 = 0xd3888501, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENSAN2",            }, // Daiku no Gen-san - Robot Teikoku no Yabou (Japan)
+    {.vramHash1 = 0x99e568d0, .vramHash2 = 0xd38d7b56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PURIKURA POCKE",     }, // Purikura Pocket - Fukanzen Joshikousei Manual (Japan)
+    {.vramHash1 = 0x4f3acb9b, .vramHash2 = 0xd3d92cbf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MATTHIAS SAMME",     }, // Matthias Sammer Soccer (Germany)
+    {.vramHash1 = 0x37925ae4, .vramHash2 = 0xd3df7091, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COLLECTION POC",     }, // Collection Pocket (Japan)
+    {.vramHash1 = 0x6d3adec9, .vramHash2 = 0xd3ece96a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SWORD OF HOPE ",     }, // Sword of Hope II, The (USA)
+    {.vramHash1 = 0xade74511, .vramHash2 = 0xd43227a1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE JETSONS",        }, // Jetsons, The - Robot Panic (USA, Europe)
+    {.vramHash1 = 0x977f3578, .vramHash2 = 0xd43b17c0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CJYUKUGO 350",       }, // Goukaku Boy Series - Koukou Nyuushi Derujun - Chuugaku Eijukugo 350 (Japan)
+    {.vramHash1 = 0xb6c13df5, .vramHash2 = 0xd4fbfa70, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROAD RASH",          }, // Road Rash (USA, Europe) (Beta), Road Rash (USA, Europe)
+    {.vramHash1 = 0x5847aba7, .vramHash2 = 0xd51123d1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR TREK",          }, // Star Trek - The Next Generation (USA, Europe)
+    {.vramHash1 = 0x98cf9132, .vramHash2 = 0xd5ad99c5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DRACURA2",           }, // Dracula Densetsu II (Japan)
+    {.vramHash1 = 0xcea66cfd, .vramHash2 = 0xd5b6c797, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Y NOAH TENNIS",      }, // Yannick Noah Tennis (France)
+    {.vramHash1 = 0x08dc4e6c, .vramHash2 = 0xd623a8f9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PERSONAL ORGAN",     }, // InfoGenius Productivity Pak - Personal Organizer and Phone Book (USA)
+    {.vramHash1 = 0x1f8d6782, .vramHash2 = 0xd65f1e29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VEEDIOTS",           }, // Ren & Stimpy Show, The - Veediots! (USA, Europe)
+    {.vramHash1 = 0x9b1492dc, .vramHash2 = 0xd6771e19, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KINTARO ACG",        }, // Masakari Densetsu - Kintarou Action Hen (Japan)
+    {.vramHash1 = 0xb36d4710, .vramHash2 = 0xd6afa6de, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KAWANUSHI3    ",     }, // Kawa no Nushi Tsuri 3 (Japan)
+    {.vramHash1 = 0x31ee16a6, .vramHash2 = 0xd6f21028, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORAEMONDX10",       }, // Doraemon no Game Boy de Asobouyo Deluxe 10 (Japan)
+    {.vramHash1 = 0x37fcf4ca, .vramHash2 = 0xd72b94c2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MCDONALDLAND",       }, // McDonaldland (Europe)
+    {.vramHash1 = 0x33b6d0d2, .vramHash2 = 0xd72ca0b6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROLAN'S CURSE ",     }, // Rolan's Curse II (USA)
+    {.vramHash1 = 0x283fb1e9, .vramHash2 = 0xd760da1c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TEEN JEOPARDY!",     }, // Jeopardy! - Teen Tournament (USA)
+    {.vramHash1 = 0x48b17536, .vramHash2 = 0xd78aafdd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AFTER BURST",        }, // After Burst (Japan)
+    {.vramHash1 = 0x4f9d0687, .vramHash2 = 0xd7ab827c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BRAIN DRAIN",        }, // Brain Drain (Europe)
+    {.vramHash1 = 0x20f7ac1a, .vramHash2 = 0xd7c31c04, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWF SUPERSTARS",     }, // WWF Superstars (Japan)
+    {.vramHash1 = 0x0d92e1e1, .vramHash2 = 0xd7ded45d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MASTER KARATEK",     }, // Master Karateka (Japan)
+    {.vramHash1 = 0xea20b333, .vramHash2 = 0xd7f00afd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DOUBLEYAKUMAN2",     }, // Double Yakuman II (Japan)
+    {.vramHash1 = 0xe7a835f6, .vramHash2 = 0xd7f04443, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris SET",         }, // Mani 4 in 1 (China) (DMG-601 CHN)
+    {.vramHash1 = 0x6cf177be, .vramHash2 = 0xd80cc32d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Trump Boy 2",        }, // Trump Boy II (Japan)
+    {.vramHash1 = 0x5a3366b3, .vramHash2 = 0xd831169e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DODGEDANPEI   ",     }, // Honoo no Toukyuuji - Dodge Danpei (Japan)
+    {.vramHash1 = 0xc1e3cbe9, .vramHash2 = 0xd8a1b56f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "X",                  }, // X (Japan)
+    {.vramHash1 = 0xc1bb65de, .vramHash2 = 0xd8a3c69f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOMOTETU",           }, // Super Momotarou Dentetsu (Japan)
+    {.vramHash1 = 0xfc76e71b, .vramHash2 = 0xd8eb1888, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OUT BURST",          }, // Outburst (Japan)
+    {.vramHash1 = 0x445da6c6, .vramHash2 = 0xd94bc100, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MICKEY MOUSE",       }, // Mickey Mouse (Europe)
+    {.vramHash1 = 0x686104ea, .vramHash2 = 0xd956a443, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mortal Combat",      }, // Mortal Kombat (Japan), Mortal Kombat (USA, Europe)
+    {.vramHash1 = 0xb739864b, .vramHash2 = 0xd958dfeb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMGMOGUMOGUGOM",     }, // Mogu Mogu Gombo (Japan)
+    {.vramHash1 = 0x0ce54b67, .vramHash2 = 0xd99dd5e7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "QBILLION",           }, // Q Billion (USA)
+    {.vramHash1 = 0x4b5c9da9, .vramHash2 = 0xd9c8e39f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SANRIO CARNIVA",     }, // Sanrio Carnival 2 (Japan)
+    {.vramHash1 = 0xb50fe5fb, .vramHash2 = 0xd9cb5699, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NEW CHESSMASTE",     }, // New Chessmaster, The (USA, Europe)
+    {.vramHash1 = 0x59b1dddc, .vramHash2 = 0xda021cb2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COOL SPOT",          }, // Cool Spot (USA)
+    {.vramHash1 = 0x69d590e9, .vramHash2 = 0xda3d4db0, .dmaFix = 0x0000, .useImmediateIRQ = true, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MOGURANYA",          }, // Mole Mania (USA, Europe)
+    {.vramHash1 = 0x6131f904, .vramHash2 = 0xda8a33b2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GURANDERMUSASH",     }, // Grander Musashi RV (Japan)
+    {.vramHash1 = 0xfc4b9281, .vramHash2 = 0xdb15714c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RENTAIOU",           }, // Rentaiou (Japan)
+    {.vramHash1 = 0xb13f36b1, .vramHash2 = 0xdb5e4d9a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Mortal Combat II",   }, // Mortal Kombat II (USA, Europe), Mortal Kombat II - Kyuukyoku Shinken (Japan)
+    {.vramHash1 = 0x541d09d7, .vramHash2 = 0xdb7bd913, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TERMINATOR 2 T",     }, // T2 - The Arcade Game (Japan), T2 - The Arcade Game (USA, Europe)
+    {.vramHash1 = 0x8eeb32cf, .vramHash2 = 0xdbda424d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SDSENGOKUDEN3",      }, // SD Sengokuden 3 - Chijou Saikyou Hen (Japan)
+    {.vramHash1 = 0x3059f474, .vramHash2 = 0xdbf3eb81, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRIPRI",             }, // Pri Pri - Primitive Princess! (Japan)
+    {.vramHash1 = 0x15a405c8, .vramHash2 = 0xdbfc1506, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WIZARDS WARRIO",     }, // Wizards & Warriors Chapter X - The Fortress of Fear (USA, Europe)
+    {.vramHash1 = 0x6fed33e7, .vramHash2 = 0xdc37615a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SHAQ FU",            }, // Shaq Fu (USA)
+    {.vramHash1 = 0xad8d1936, .vramHash2 = 0xdc7e1c82, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MS.PAC-MAN",         }, // Ms. Pac-Man (Europe), Ms. Pac-Man (USA)
+    {.vramHash1 = 0xe2082b43, .vramHash2 = 0xdc83108e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOLO2",              }, // Adventures of Lolo (Europe)
+    {.vramHash1 = 0x7103dd6d, .vramHash2 = 0xdcd10170, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ROCKMAN WORLD",      }, // Rockman World (Japan)
+    {.vramHash1 = 0x56f84be9, .vramHash2 = 0xdcd4fdc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ar",                 }, // GameShark (USA)
+    {.vramHash1 = 0xc89f05fd, .vramHash2 = 0xdd273589, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRIP WORLD",         }, // Trip World (Europe), Trip World (Japan)
+    {.vramHash1 = 0x16150dcd, .vramHash2 = 0xdd86ba50, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOUKENJIMA2",        }, // Takahashi Meijin no Bouken-jima II (Japan)
+    {.vramHash1 = 0x0e65cbcd, .vramHash2 = 0xddacdf56, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GEMGEM",             }, // Gem Gem (Japan)
+    {.vramHash1 = 0x62dad1a4, .vramHash2 = 0xddec1a90, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris",             }, // Tetris (World) (Rev A)
+    {.vramHash1 = 0xcb3dd788, .vramHash2 = 0xde0bf323, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = " ROCKMAN WORLD",     }, // Rockman World 2 (Japan)
+    {.vramHash1 = 0xf24eb67c, .vramHash2 = 0xde3ccdd2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DEADHEATSCRAMB",     }, // Dead Heat Scramble (USA)
+    {.vramHash1 = 0x864ecdc6, .vramHash2 = 0xdf142bb0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TSUMEGO 01",         }, // Ishida Yoshio Tsumego Paradise (Japan)
+    {.vramHash1 = 0x4a997d84, .vramHash2 = 0xdf1d37ba, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPOT",               }, // Spot (Europe)
+    {.vramHash1 = 0x7084c68f, .vramHash2 = 0xe005002f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NAVY BLUE 98",       }, // Navy Blue 98 (Japan)
+    {.vramHash1 = 0x96f0b010, .vramHash2 = 0xe01a884c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TMHT BACK FROM",     }, // Teenage Mutant Hero Turtles II - Back from the Sewers (Europe)
+    {.vramHash1 = 0x6800bc00, .vramHash2 = 0xe0235e00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ANOTHER BIBLE ",     }, // Another Bible (Japan)
+    {.vramHash1 = 0x44f8e739, .vramHash2 = 0xe052471b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EIKEN2KYUEIKAI",     }, // Goukaku Boy Series - Eiken 2kyuu Level no Kaiwa Hyougen 333 (Japan)
+    {.vramHash1 = 0x04224979, .vramHash2 = 0xe0563a6c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "AKAZUKIN-CHACH",     }, // Akazukin Chacha (Japan)
+    {.vramHash1 = 0xb6f8d44f, .vramHash2 = 0xe05a4e7f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WINNING GOAL",       }, // J.League Winning Goal (Japan)
+    {.vramHash1 = 0x68011800, .vramHash2 = 0xe0db8c00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YAKUMAN",            }, // Yakuman (Japan) (Rev A), Yakuman (Japan)
+    {.vramHash1 = 0xbe4bbb7b, .vramHash2 = 0xe1159504, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAY THUNDER",        }, // Ray-Thunder (Japan)
+    {.vramHash1 = 0xe0f2ec0d, .vramHash2 = 0xe144b9b0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GALAGA&GALAXIA",     }, // Galaga & Galaxian (Japan)
+    {.vramHash1 = 0x788c8638, .vramHash2 = 0xe18f973e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIKI RACE GB",      }, // Chiki Chiki Machine Mou Race (Japan)
+    {.vramHash1 = 0x2b03a9a5, .vramHash2 = 0xe19e008c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGALIT",            }, // Megalit (Japan)
+    {.vramHash1 = 0x74c2aa7b, .vramHash2 = 0xe1ae1f96, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SWORD OFHO",     }, // Sword of Hope, The (Spain)
+    {.vramHash1 = 0xb0460f53, .vramHash2 = 0xe1b1971a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FUNPAK 4IN1 - ",     }, // 4-in-1 Fun Pak Volume II (USA, Europe)
+    {.vramHash1 = 0xcf10c026, .vramHash2 = 0xe2357776, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLITAIRE FUNP",     }, // Solitaire FunPak (USA, Europe)
+    {.vramHash1 = 0xc3b849c6, .vramHash2 = 0xe28dba00, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE INDIAN",      }, // Indien dans la Ville, Un (France)
+    {.vramHash1 = 0x7b14f063, .vramHash2 = 0xe29474d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GHOSTBUSTERS 2",     }, // Ghostbusters II (Japan)
+    {.vramHash1 = 0x28333061, .vramHash2 = 0xe2b40ca6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SERPENT",            }, // Serpent (USA)
+    {.vramHash1 = 0x035174ea, .vramHash2 = 0xe2c8068b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VOLLEY FIRE",        }, // Volley Fire (Japan)
+    {.vramHash1 = 0xc0f2f312, .vramHash2 = 0xe30ae1d7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POP UP",             }, // Pop Up (Europe)
+    {.vramHash1 = 0x55b18a2a, .vramHash2 = 0xe366f7b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Q*BERT II",          }, // Q-bert for Game Boy (Japan), Q-bert for Game Boy (USA, Europe)
+    {.vramHash1 = 0x3d32fbeb, .vramHash2 = 0xe387ebdb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JUNGLE BOOK",        }, // Jungle Book, The (USA, Europe)
+    {.vramHash1 = 0x401d5500, .vramHash2 = 0xe3a3c96c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TURRICAN",           }, // Turrican (USA, Europe)
+    {.vramHash1 = 0x7ce34c03, .vramHash2 = 0xe3d0d2a8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPER CHINESE ",     }, // Super Chinese Land 3 (Japan)
+    {.vramHash1 = 0xd077f3bf, .vramHash2 = 0xe421f221, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ABYSS NO TOU",       }, // Chachamaru Boukenki 3 - Abyss no Tou (Japan)
+    {.vramHash1 = 0x13a148e2, .vramHash2 = 0xe4b8b6e5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "POCKET DENSYA",      }, // Pocket Densha (Japan)
+    {.vramHash1 = 0x1b8ed415, .vramHash2 = 0xe4db3119, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOLOMON'S CLUB",     }, // Solomon's Club (Japan)
+    {.vramHash1 = 0xa63626a6, .vramHash2 = 0xe4ec680f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CYRAID",             }, // Cyraid (USA)
+    {.vramHash1 = 0x69decc47, .vramHash2 = 0xe4eead0c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BATMAN ROJ",         }, // Batman - Return of the Joker (Japan), Batman - Return of the Joker (USA, Europe)
+    {.vramHash1 = 0xe6a9712b, .vramHash2 = 0xe50c975b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BOMBERMAN GB",       }, // Bomber Man GB (Japan)
+    {.vramHash1 = 0x9c0962be, .vramHash2 = 0xe56b3fb0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JANKENMAN",          }, // Jankenman (Japan)
+    {.vramHash1 = 0xfcd40ea1, .vramHash2 = 0xe5d32245, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FOOTBALL INT'L",     }, // Football International (Europe)
+    {.vramHash1 = 0x6a443e27, .vramHash2 = 0xe5e99742, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB GARMS 1",         }, // SD Command Gundam - G-Arms (Japan)
+    {.vramHash1 = 0x408c7343, .vramHash2 = 0xe5ee0c0d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "S S BASKET BAL",     }, // Super Street Basketball 2 (Japan)
+    {.vramHash1 = 0xc299b627, .vramHash2 = 0xe61e8442, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SAGA2",              }, // Final Fantasy Legend II (USA)
+    {.vramHash1 = 0x84a348d2, .vramHash2 = 0xe63a5a95, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TURN AND BURN",      }, // Turn and Burn (USA)
+    {.vramHash1 = 0xccd35c60, .vramHash2 = 0xe6bd529d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FAMILYJOCKEY",       }, // Family Jockey (Japan)
+    {.vramHash1 = 0x0a0bfd38, .vramHash2 = 0xe6f6f1e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARUKODXSIATA",      }, // Chibi Maruko-chan - Maruko Deluxe Theater (Japan)
+    {.vramHash1 = 0x17a341c7, .vramHash2 = 0xe73b9adb, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE RIVER KING",     }, // Legend of the River King GB (Australia)
+    {.vramHash1 = 0xa45cf6de, .vramHash2 = 0xe7c0e1e6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WORLD BOWLING",      }, // World Bowling (Japan)
+    {.vramHash1 = 0xeec964da, .vramHash2 = 0xe7e21ae4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHIBIMARUKO3",       }, // Chibi Maruko-chan 3 - Mezase! Game Taishou no Maki (Japan)
+    {.vramHash1 = 0x97ab01ac, .vramHash2 = 0xe89b6bbd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WAYNE'S WORLD",      }, // Wayne's World (USA)
+    {.vramHash1 = 0x4f6b3792, .vramHash2 = 0xe8e64e8a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TATSUJINTECHO",      }, // Bass Fishing Tatsujin Techou (Japan)
+    {.vramHash1 = 0xf409fd7d, .vramHash2 = 0xe8f12a80, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JEOPARDY SPORT",     }, // Jeopardy! - Sports Edition (USA)
+    {.vramHash1 = 0x5f7d179f, .vramHash2 = 0xe8f7afc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB MASKRIDER S",     }, // Kamen Rider SD - Hashire! Mighty Riders (Japan)
+    {.vramHash1 = 0x600f46e4, .vramHash2 = 0xe9155ac1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CAPTAIN AMERIC",     }, // Captain America and the Avengers (USA)
+    {.vramHash1 = 0x07bbfcce, .vramHash2 = 0xe9f634f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHINKO GENSA",     }, // Pachinko CR Daiku no Gen-san GB (Japan)
+    {.vramHash1 = 0x4e667720, .vramHash2 = 0xea94427a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI 3",              }, // Oni III - Kuro no Hakaishin (Japan)
+    {.vramHash1 = 0x189099b3, .vramHash2 = 0xeaa05cca, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SELECTION 1&2",      }, // Selection I & II (Japan)
+    {.vramHash1 = 0x9c3bebcb, .vramHash2 = 0xead6b05c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OLYMPUS",            }, // Battle of Olympus, The (Europe) (En,Fr,De,Es,It)
+    {.vramHash1 = 0x2a3324ad, .vramHash2 = 0xeaeaaa89, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PARTSCOLLECTIO",     }, // Medarot - Parts Collection 2 (Japan)
+    {.vramHash1 = 0x86fe5d97, .vramHash2 = 0xeb083c6e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "XERD!!",             }, // Zerd no Densetsu 2 - Xerd!! Gishin no Ryouiki (Japan)
+    {.vramHash1 = 0xe2606508, .vramHash2 = 0xeb0cb939, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SPY VS SPY",         }, // Spy vs Spy - Operation Boobytrap (USA)
+    {.vramHash1 = 0x7b4e62e8, .vramHash2 = 0xeb444b5c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB LACROANHERO",     }, // SD Gundam Gaiden - Lacroan' Heroes (Japan)
+    {.vramHash1 = 0x8938170b, .vramHash2 = 0xeb62f04d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CRASH DUMMIES",      }, // Incredible Crash Dummies, The (USA, Europe)
+    {.vramHash1 = 0x3e8cd8f9, .vramHash2 = 0xebb27372, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EXCHANGER GB",       }, // Money Idol Exchanger (Japan)
+    {.vramHash1 = 0xd74d05c1, .vramHash2 = 0xec538645, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TAIL GATOR",         }, // Tail 'Gator (USA, Europe)
+    {.vramHash1 = 0xafa75779, .vramHash2 = 0xec6ad1ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LETHAL WEAPON",      }, // Lethal Weapon (USA, Europe)
+    {.vramHash1 = 0xba31df74, .vramHash2 = 0xec76109d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB IRON LEAGUE",     }, // Shippuu! Iron Leaguer (Japan)
+    {.vramHash1 = 0x2550dab2, .vramHash2 = 0xec7923dd, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SELECTION 2",        }, // Selection II - Ankoku no Fuuin (Japan)
+    {.vramHash1 = 0x7e9bbfc8, .vramHash2 = 0xec9fc5ce, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRA GOLF",         }, // Ultra Golf (USA)
+    {.vramHash1 = 0x59358f2c, .vramHash2 = 0xecbedb0e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SANRIO CARNIVA",     }, // Sanrio Carnival (Japan)
+    {.vramHash1 = 0xc19db03b, .vramHash2 = 0xeccf6ecf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JIKUUSENKI-MU",      }, // Jikuu Senki Mu (Japan)
+    {.vramHash1 = 0xe40234e5, .vramHash2 = 0xed1fcc8f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WARIO BLAST",        }, // Wario Blast featuring Bomberman! (USA, Europe)
+    {.vramHash1 = 0x7b360167, .vramHash2 = 0xed3f96e8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HEIANKYO ALIEN",     }, // Heiankyo Alien (USA), Heiankyou Alien (Japan)
+    {.vramHash1 = 0xfd298ba3, .vramHash2 = 0xed4fb15c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE MERMAID",     }, // Little Mermaid, The (USA)
+    {.vramHash1 = 0xd191f283, .vramHash2 = 0xed5555d8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Game Boy Gallery 2", }, // Game Boy Gallery 2 (Australia)
+    {.vramHash1 = 0xd47a8b7b, .vramHash2 = 0xed884aa7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOGIS GOLDRUSH",     }, // Yogi Bear in Yogi Bear's Goldrush (USA)
+    {.vramHash1 = 0x04dd2480, .vramHash2 = 0xedb91dcc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN3",           }, // Mega Man III (USA)
+    {.vramHash1 = 0x04dd2488, .vramHash2 = 0xedb91e26, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN3",           }, // Mega Man III (Europe)
+    {.vramHash1 = 0xaeb3ff8f, .vramHash2 = 0xee5f477c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KITCHIN PANIC",      }, // Kitchen Panic (Japan)
+    {.vramHash1 = 0x9d30efd7, .vramHash2 = 0xee7c183c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PRINCE OF PERS",     }, // Prince of Persia (USA)
+    {.vramHash1 = 0x1d3cf92f, .vramHash2 = 0xee8f5554, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KATTOBI ROAD",       }, // Kattobi Road (Japan)
+    {.vramHash1 = 0x052a4e84, .vramHash2 = 0xeeb3786d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISURO WC'9",     }, // Pachi-Slot World Cup '94 (Japan)
+    {.vramHash1 = 0x38a0f135, .vramHash2 = 0xeed56ea8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DYNABLASTER",        }, // Dynablaster (Europe)
+    {.vramHash1 = 0x78400be0, .vramHash2 = 0xeed8dbf0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB SLAM DUNK",       }, // From TV Animation Slam Dunk - Gakeppuchi no Kesshou League (Japan)
+    {.vramHash1 = 0xf3379c50, .vramHash2 = 0xeedf2fbe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DAFFY DUCK",         }, // Daffy Duck (USA, Europe), Looney Tunes Series - Daffy Duck (Japan)
+    {.vramHash1 = 0x5be7e8f4, .vramHash2 = 0xef308a0c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {{.jumpAddress = 0x0c5a, .fixTarget = 0xffa0, .takenMethod = and, .takenValue = 0xdf, .notTakenMethod = or, .notTakenValue = 0x20}, }, .writeRegistersDuringDMA = {}, .title = "Bonk's Adventure",   }, // Bonk's Adventure (USA)
+    {.vramHash1 = 0x67d5eb3a, .vramHash2 = 0xef42c211, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MARIOLAND2",         }, // Super Mario Land 2 - 6-tsu no Kinka (Japan) (Rev 2)
+    {.vramHash1 = 0x713fbb86, .vramHash2 = 0xef5bc196, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUST A MOVE 2 ",     }, // Puzzle Bobble GB (Japan)
+    {.vramHash1 = 0xaeed614e, .vramHash2 = 0xef8601f4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB KUREYON SHI",     }, // Crayon Shin-chan 4 - Ora no Itazura Daihenshin (Japan)
+    {.vramHash1 = 0xd3d52dc8, .vramHash2 = 0xef979242, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HAYAOSI KUIZU",      }, // Hayaoshi Quiz - Ouza Ketteisen (Japan)
+    {.vramHash1 = 0x6b703160, .vramHash2 = 0xefab6bc4, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "UNIVERSALSOLDI",     }, // Universal Soldier (USA, Europe)
+    {.vramHash1 = 0x6249d956, .vramHash2 = 0xefb76e94, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOOPZ",              }, // Loopz (World)
+    {.vramHash1 = 0x88b8b7ce, .vramHash2 = 0xefcbea81, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DORAEMON",           }, // Doraemon - Taiketsu HimitsuDougu!! (Japan)
+    {.vramHash1 = 0xd660d750, .vramHash2 = 0xefed6c60, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB GODZILLA",        }, // Kaijuu Ou Gojira (Japan)
+    {.vramHash1 = 0x0133923a, .vramHash2 = 0xf0157052, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ONI 4",              }, // Oni IV - Kijin no Ketsuzoku (Japan)
+    {.vramHash1 = 0x2eb3aac7, .vramHash2 = 0xf020dcad, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB TARURU-TO 2",     }, // Magical Taruruuto-kun 2 - Raibaa Zone Panic!! (Japan)
+    {.vramHash1 = 0x75002295, .vramHash2 = 0xf03c6201, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WWF: WARZONE",       }, // WWF War Zone (USA, Europe)
+    {.vramHash1 = 0x44839841, .vramHash2 = 0xf077a32b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB CULT JUMP",       }, // Cult Jump (Japan)
+    {.vramHash1 = 0x4e2fd7da, .vramHash2 = 0xf07b1396, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUGIOU",             }, // Yu-Gi-Oh! Duel Monsters (Japan)
+    {.vramHash1 = 0x91125c8d, .vramHash2 = 0xf0935694, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HYPER DUNK",         }, // Hyper Dunk (Europe)
+    {.vramHash1 = 0xf8e6a308, .vramHash2 = 0xf0d44349, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FUNNY FIELD",        }, // Funny Field (Japan)
+    {.vramHash1 = 0x8d166437, .vramHash2 = 0xf13b4f29, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR WARS-NOA",      }, // Star Wars (USA, Europe) (Rev A)
+    {.vramHash1 = 0xe64eac6b, .vramHash2 = 0xf17c4185, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB MUSASHIROAD",     }, // Karakuri Kengou Den Musashi Lord (Japan)
+    {.vramHash1 = 0xb375915c, .vramHash2 = 0xf1daef23, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GODZILLA",           }, // Gojira-kun (Japan)
+    {.vramHash1 = 0x1ceb3a9c, .vramHash2 = 0xf1e62a63, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CHOPLIFTER 2",       }, // Choplifter II - Rescue & Survive (USA)
+    {.vramHash1 = 0xb9317519, .vramHash2 = 0xf1f8afd0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FROGGER",            }, // Frogger (USA)
+    {.vramHash1 = 0x962947bd, .vramHash2 = 0xf2b610cc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GEORGE F. BOXI",     }, // George Foreman's KO Boxing (USA, Europe)
+    {.vramHash1 = 0x97ec779c, .vramHash2 = 0xf31316bf, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NETTOU SAMURAI",     }, // Nettou Samurai Spirits (Japan) (Rev A), Nettou Samurai Spirits (Japan)
+    {.vramHash1 = 0x815f7dfb, .vramHash2 = 0xf37950a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "VIKING CHILD 1",     }, // Prophecy - The Viking Child (Europe) (En,Fr,De,Es,It)
+    {.vramHash1 = 0x0273d66c, .vramHash2 = 0xf3cb6146, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE FLINTSTONE",     }, // Flintstones, The (USA, Europe)
+    {.vramHash1 = 0xd600736a, .vramHash2 = 0xf3ddc8d2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Monster Maker 2",    }, // Monster Maker 2 - Uru no Hiken (Japan)
+    {.vramHash1 = 0x0434069d, .vramHash2 = 0xf3de8341, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "WIZARDRY SOD",       }, // Wizardry Gaiden 3 - Yami no Seiten (Japan)
+    {.vramHash1 = 0xdff3fe1e, .vramHash2 = 0xf3f2e57e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GENERATIONS",        }, // Star Trek Generations - Beyond the Nexus (Europe)
+    {.vramHash1 = 0x03c3f77d, .vramHash2 = 0xf42c65de, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ON THE TILES",       }, // Franky, Joe & Dirk... On the Tiles (Europe) (En,Fr,De,Es,It,Nl)
+    {.vramHash1 = 0x4af60597, .vramHash2 = 0xf48bb2f8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LITTLE MERMAID",     }, // Little Mermaid, The (Europe)
+    {.vramHash1 = 0x5f1417d2, .vramHash2 = 0xf48f8ab1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "COSMO TANK",         }, // Cosmo Tank (Japan)
+    {.vramHash1 = 0xeadc822e, .vramHash2 = 0xf4c4f7ec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MYSTICAL NINJA",     }, // Mystical Ninja Starring Goemon (Europe), Mystical Ninja Starring Goemon (USA)
+    {.vramHash1 = 0x9f1d0af7, .vramHash2 = 0xf4cc7c6a, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "RAYEARTH1",          }, // Magic Knight Rayearth (Japan)
+    {.vramHash1 = 0xdf63f801, .vramHash2 = 0xf5340400, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRAMAN BALL",      }, // Ultraman Ball (Japan)
+    {.vramHash1 = 0x3beade2f, .vramHash2 = 0xf59d721f, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YOSSY NO TAMAG",     }, // Yoshi no Tamago (Japan)
+    {.vramHash1 = 0xfb8059b0, .vramHash2 = 0xf5ae2aed, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JANSHIRO",           }, // Janshirou (Japan)
+    {.vramHash1 = 0xa898cf55, .vramHash2 = 0xf5da39ec, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB OTOKOJYUKU ",     }, // Sakigake!! Otoko Juku - Meioutou Kessen (Japan)
+    {.vramHash1 = 0x445b32c4, .vramHash2 = 0xf5e40245, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANKI-TUMESHOG",     }, // Tsumeshougi - Kanki Godan (Japan) (Beta)
+    {.vramHash1 = 0x135a5d81, .vramHash2 = 0xf5f032be, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZCHUGAKUEITANG",     }, // Goukaku Boy Series - Z Kai (Reibun de Oboeru) Chuugaku Eitango 1132 (Japan)
+    {.vramHash1 = 0x7b17c09b, .vramHash2 = 0xf5f7061c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ZENNICHI JET",       }, // Zen-Nihon Pro Wrestling Jet (Japan)
+    {.vramHash1 = 0x8c2822aa, .vramHash2 = 0xf5f76f45, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES 2",       }, // DuckTales 2 (Japan)
+    {.vramHash1 = 0xa3159545, .vramHash2 = 0xf624bff5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BABY TREX",          }, // Baby T-Rex (Europe)
+    {.vramHash1 = 0x41fb9e63, .vramHash2 = 0xf650f0af, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEGEND",             }, // Legend (Japan)
+    {.vramHash1 = 0x942b3319, .vramHash2 = 0xf67cf3f8, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LOLO",               }, // Lolo no Daibouken (Japan)
+    {.vramHash1 = 0xa09025cb, .vramHash2 = 0xf67e47df, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Pokemon Blue",       }, // Pokemon - Blue Version (USA, Europe)
+    {.vramHash1 = 0x412f75ac, .vramHash2 = 0xf68bc73b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GAME&WATCH",         }, // Game Boy Gallery - 5 Games in One (Europe)
+    {.vramHash1 = 0xe7df069a, .vramHash2 = 0xf69d3d18, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBWARST",            }, // Game Boy Wars Turbo - Famitsu Version (Japan)
+    {.vramHash1 = 0xc144bcab, .vramHash2 = 0xf6c2c0ee, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "HINSYUTU EIBUN",     }, // Goukaku Boy Series - Kirihara Shoten Hinshutsu Eibunpou Gohou Mondai 1000 (Japan)
+    {.vramHash1 = 0xa865b989, .vramHash2 = 0xf6d1d4d6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TOKIO SENKI",        }, // Tokio Senki - Eiyuu Retsuden (Japan)
+    {.vramHash1 = 0xaa279014, .vramHash2 = 0xf73cf7fc, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CADILLAC2",          }, // Cadillac II (Japan)
+    {.vramHash1 = 0x50ecc0fe, .vramHash2 = 0xf790d43b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "FERRARI G-PRIX",     }, // Ferrari (Japan)
+    {.vramHash1 = 0x8fd4488e, .vramHash2 = 0xf7d3fab0, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SUPERWWF",           }, // WWF Superstars 2 (Japan), WWF Superstars 2 (USA, Europe)
+    {.vramHash1 = 0xd1c0dedd, .vramHash2 = 0xf816af0d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DMG FOOTBALL",       }, // Play Action Football (USA)
+    {.vramHash1 = 0xe6a1256d, .vramHash2 = 0xf829d741, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PAC-MAN",            }, // Pac-Man (USA)
+    {.vramHash1 = 0x8b2feedd, .vramHash2 = 0xf84108e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ISHIDO USA VER",     }, // Ishido - The Way of Stones (USA)
+    {.vramHash1 = 0x76670844, .vramHash2 = 0xf88f6ced, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THE SWORD OFHO",     }, // Sword of Hope, The (Germany)
+    {.vramHash1 = 0xd3c0b963, .vramHash2 = 0xf8f19043, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SANGOKUSHI",         }, // Sangokushi - Game Boy Ban (Japan)
+    {.vramHash1 = 0xb772428b, .vramHash2 = 0xf9303d37, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ARETHA2",            }, // Aretha II (Japan)
+    {.vramHash1 = 0x0f563e18, .vramHash2 = 0xf93edff6, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KILLER TOMATOE",     }, // Attack of the Killer Tomatoes (Japan)
+    {.vramHash1 = 0xe304ca7d, .vramHash2 = 0xf9afca79, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "JEEP JAMBOREE",      }, // Jeep Jamboree (USA)
+    {.vramHash1 = 0xed158d85, .vramHash2 = 0xf9c523a9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "IREM FIGHTER",       }, // Shuyaku Sentai Irem Fighter (Japan)
+    {.vramHash1 = 0xc926b969, .vramHash2 = 0xfa00d6da, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PUZZLE ROAD",        }, // Bouken! Puzzle Road (Japan)
+    {.vramHash1 = 0x7b231841, .vramHash2 = 0xfa155033, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TINY TOON 2",        }, // Tiny Toon Adventures 2 (Japan)
+    {.vramHash1 = 0x5f925a45, .vramHash2 = 0xfa6c6ac7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "EXTRA BASES!",       }, // Extra Bases! (USA)
+    {.vramHash1 = 0x59b76840, .vramHash2 = 0xfa90e40d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KANKI-TUMESHOG",     }, // Tsumeshougi - Kanki Godan (Japan)
+    {.vramHash1 = 0x8e639fef, .vramHash2 = 0xfaf20aa1, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STAR TREK",          }, // Star Trek - The Next Generation (Germany), Star Trek - The Next Generation (Spain)
+    {.vramHash1 = 0x1544118b, .vramHash2 = 0xfb4891e3, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SIKAKUI S BBB4",     }, // Goukaku Boy Series - Shikakui Atama o Maruku Suru - Sansuu Battle Hen (Japan) (Special Edition)
+    {.vramHash1 = 0x42c367f9, .vramHash2 = 0xfb6093e2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "ULTRA2",             }, // America Oudan Ultra Quiz Part 2 (Japan)
+    {.vramHash1 = 0x96f39f1e, .vramHash2 = 0xfb85f549, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "NANONOTE",           }, // Nanonote (Japan)
+    {.vramHash1 = 0x844e51fe, .vramHash2 = 0xfb8ea2b9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BEACH,VOLLEYBA",     }, // Malibu Beach Volleyball (USA)
+    {.vramHash1 = 0x10429394, .vramHash2 = 0xfb9e63fe, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PURIKURA POCKE",     }, // Purikura Pocket 2 - Kareshi Kaizou Daisakusen (Japan)
+    {.vramHash1 = 0x2906eb74, .vramHash2 = 0xfbf13c0b, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GBCOLLECTION 4",     }, // Konami GB Collection Vol.4 (Japan)
+    {.vramHash1 = 0x91bccf9a, .vramHash2 = 0xfc01726e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "SOCCER",             }, // Soccer (Japan)
+    {.vramHash1 = 0x485d757e, .vramHash2 = 0xfc131af2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KIWAME-GB",          }, // Pro Mahjong Kiwame GB (Japan)
+    {.vramHash1 = 0x508c9175, .vramHash2 = 0xfc28f1ea, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "LEMMINGS",           }, // Lemmings (Japan)
+    {.vramHash1 = 0xfba74f1f, .vramHash2 = 0xfc51a3d5, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "CENTIPEDE",          }, // Centipede (USA, Europe)
+    {.vramHash1 = 0x718305f9, .vramHash2 = 0xfc6256a2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "STARHAWK",           }, // Star Hawk (Europe)
+    {.vramHash1 = 0x2118b876, .vramHash2 = 0xfca35a08, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MAHJONGYOSHIMO",     }, // Nichibutsu Mahjong - Yoshimoto Gekijou (Japan)
+    {.vramHash1 = 0x656f0c5d, .vramHash2 = 0xfd11428d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "MEGAMAN",            }, // Mega Man - Dr. Wily's Revenge (Europe)
+    {.vramHash1 = 0x1b5acbd3, .vramHash2 = 0xfdafe8a2, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TSUMESHOUGI",        }, // Tsumeshougi - Mondai Teikyou Shougi Sekai (Japan)
+    {.vramHash1 = 0x87518ed5, .vramHash2 = 0xfdd3856d, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "TRACK MEET",         }, // Litti's Summer Sports (Germany)
+    {.vramHash1 = 0xa2ce601e, .vramHash2 = 0xfdd98469, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "YUUYUU-1",           }, // Yu Yu Hakusho (Japan)
+    {.vramHash1 = 0x38d9ec72, .vramHash2 = 0xff0a713e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "OBELIX",             }, // Asterix & Obelix (Europe) (En,Es)
+    {.vramHash1 = 0xe60d832d, .vramHash2 = 0xff30e20e, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BLUES BROTHERS",     }, // Blues Brothers, The (USA, Europe)
+    {.vramHash1 = 0x97730a2d, .vramHash2 = 0xff371d07, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "Tetris PLUS",        }, // Tetris Plus (Japan), Tetris Plus (USA, Europe)
+    {.vramHash1 = 0xdf2792c0, .vramHash2 = 0xff37d653, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "GB UNDOUKAI",        }, // Downtown - Nekketsu Koushinkyoku - Dokodemo Daiundoukai (Japan)
+    {.vramHash1 = 0x79ad4a76, .vramHash2 = 0xff53deff, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "BUGS COLLECTIO",     }, // Bugs Bunny Collection (Japan) (Rev A), Bugs Bunny Collection (Japan)
+    {.vramHash1 = 0xfdd27b70, .vramHash2 = 0xff568593, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "THEGAMEOFHARMO",     }, // Game of Harmony, The (USA)
+    {.vramHash1 = 0xa8f91961, .vramHash2 = 0xff9ea01c, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PACHISLOT JR 0",     }, // GB Pachi-Slot Hisshouhou! Jr (Japan)
+    {.vramHash1 = 0x09ab898a, .vramHash2 = 0xffa349b7, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "KINGOFTHEZOO",       }, // King of the Zoo (Europe)
+    {.vramHash1 = 0xe06debfe, .vramHash2 = 0xffa757e9, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "PERSONAL ORGAN",     }, // InfoGenius Systems - Personal Organizer with Phone Book (Europe)
+    {.vramHash1 = 0x98bf45f0, .vramHash2 = 0xffb1ba64, .dmaFix = 0x0000, .useImmediateIRQ = false, .disableStatSyncs = false, .disableLySyncs = false, .windowLineAlwaysPauses = false, .accurateRendering = false, .branchBasedFixes = {}, .writeRegistersDuringDMA = {}, .title = "DUCK TALES 2",       }, // DuckTales 2 (USA)
 };
 
 uint16_t gameInfoDirectory[257] = {
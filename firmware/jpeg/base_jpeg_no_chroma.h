@@ -1,913 +0,0 @@
-unsigned char __in_flash("jpeg") base_jpeg_no_chroma[] = {
- 0xff, 0xd8, 0xff, 0xe0, 0x00, 0x11, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x01, 0x00, 0x48,
- 0x00, 0x48, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
- 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
- 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
- 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
- 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x04,
- 0x80, 0x05, 0x00, 0x01, 0x01, 0x22, 0x00, 0xff, 0xc4, 0x00, 0x17, 0x00, 0x01, 0x01, 0x01, 0x01,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00,
- 0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00,
- 0x87, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39,
- 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce,
- 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
- 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c,
- 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
- 0x39, 0xce, 0x73, 0x9c, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad,
- 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b,
- 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40,
- 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5,
- 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0x35,
- 0xad, 0x6b, 0x40, 0xe5, 0x35, 0xad, 0x6b, 0x40, 0xe5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68,
- 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a,
- 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5,
- 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5,
- 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad,
- 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc5, 0xb5, 0xad, 0x68, 0x1a, 0xc2, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92,
- 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35,
- 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad,
- 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03,
- 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a, 0x92, 0x35, 0xad, 0x03, 0x5a,
- 0x92, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5,
- 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0,
- 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b,
- 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a,
- 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82, 0xb5, 0xa0, 0x6b, 0x5a, 0x82,
- 0xb5, 0xa0, 0x6b, 0x5a, 0x83, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d,
- 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b,
- 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a,
- 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33,
- 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x34,
- 0x0d, 0x6b, 0x5a, 0x33, 0x34, 0x0d, 0x6b, 0x5a, 0x33, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b,
- 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a,
- 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23,
- 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81,
- 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad,
- 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x23, 0x81, 0xad, 0x6b, 0x5a, 0x27, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17,
- 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35,
- 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad,
- 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b,
- 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a, 0x17, 0x35, 0xad, 0x6b, 0x5a,
- 0xff, 0xd9,
-};
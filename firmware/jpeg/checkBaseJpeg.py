@@ -0,0 +1,217 @@
+#This script checks that common JPEG decoders on the host accept the frames we are sending, which is not a given as we use unusual sampling factors.
+#Run it on the output directory of generateBaseJpeg.py, for example via "make check_base_jpeg" in the build directory. It uses Pillow (libjpeg) and PyAV (ffmpeg, used by OBS and most players) if they are installed.
+#Both are rather forgiving, so the frames also go through a strict decoder that follows the baseline process of the JPEG specification (ITU T.81) and rejects anything it does not allow,
+#which is the best we can do here for the decoders of Windows (Media Foundation) and macOS (AVFoundation).
+#Pixel data and chroma offset are the same as in the base JPEG, so this covers the plain frames as well as the green color mode.
+
+import os
+import re
+import sys
+
+directory = sys.argv[1] if len(sys.argv) > 1 else "."
+with open(os.path.join(directory, "base_jpeg_layout.h")) as f:
+    layout = {name: int(value) for name, value in re.findall(r"#define (\w+) (\d+)", f.read())}
+DATA_SIZE = 160 * 144 * 5 // 8
+FRAME_SIZE = layout["JPEG_HEADER_SIZE"] + DATA_SIZE + layout["JPEG_END_SIZE"]
+JPEG_CHROMA_OFFSET = layout["JPEG_HEADER_SIZE"] + DATA_SIZE + layout["JPEG_CHROMA_SOS_SIZE"]
+NATIVE_SIZE = layout["JPEG_NATIVE_HEADER_SIZE"] + layout["JPEG_NATIVE_BASE_DATA_SIZE"] + layout["JPEG_NATIVE_END_SIZE"]
+NATIVE_CHROMA_OFFSET = layout["JPEG_NATIVE_HEADER_SIZE"] + layout["JPEG_NATIVE_BASE_DATA_SIZE"] + layout["JPEG_CHROMA_SOS_SIZE"]
+
+#USB full speed bulk transfers can move at most 19 packets of 64 bytes per millisecond. In practice hosts get a bit less than that.
+USB_BYTES_PER_SECOND = 19 * 64 * 1000
+
+def variants():
+    with open(os.path.join(directory, "base.jpg"), "rb") as f:
+        base = bytearray(f.read())
+    green = bytearray(base)
+    green[JPEG_CHROMA_OFFSET] = layout["JPEG_CHROMA_DMG_GREEN"]
+    with open(os.path.join(directory, "base_native.jpg"), "rb") as f:
+        native = bytearray(f.read())
+    nativeGreen = bytearray(native)
+    nativeGreen[NATIVE_CHROMA_OFFSET] = layout["JPEG_CHROMA_DMG_GREEN"]
+    #Name, data, expected size and dimensions and a check of the color of a pixel near the center
+    return [("base.jpg", base, FRAME_SIZE, (1280, 1152), lambda r, g, b: abs(r - g) <= 2 and abs(g - b) <= 2),
+            ("base.jpg green", green, FRAME_SIZE, (1280, 1152), lambda r, g, b: g > r + 32 and g > b + 32),
+            ("base_native.jpg", native, NATIVE_SIZE, (160, 144), lambda r, g, b: abs(r - g) <= 2 and abs(g - b) <= 2),
+            ("base_native.jpg green", nativeGreen, NATIVE_SIZE, (160, 144), lambda r, g, b: g > r + 32 and g > b + 32)]
+
+def decodePillow(data):
+    import io
+    from PIL import Image
+    return Image.open(io.BytesIO(data)).convert("RGB")
+
+def decodeFFmpeg(data):
+    import av
+    codec = av.CodecContext.create("mjpeg", "r")
+    return codec.decode(av.Packet(bytes(data)))[0].to_image()
+
+class ReferenceImage:
+    #DC values of every block, which is all the color check needs
+    def __init__(self, size, components):
+        self.size = size
+        self.components = components #Per component: horizontal and vertical sampling, blocks per line and the mean sample of each block
+        self.notes = [] #Deviations that decoders usually tolerate
+
+    def getpixel(self, position):
+        hMax = max(c[0] for c in self.components)
+        vMax = max(c[1] for c in self.components)
+        y, cb, cr = [samples[(position[1] * v // vMax // 8) * width + position[0] * h // hMax // 8] for h, v, width, samples in self.components]
+        clamp = lambda value: max(0, min(255, round(value)))
+        return (clamp(y + 1.402 * (cr - 128)), clamp(y - 0.344136 * (cb - 128) - 0.714136 * (cr - 128)), clamp(y + 1.772 * (cb - 128)))
+
+def decodeReference(data):
+    #Strict baseline decoder (T.81 Annex B, C, F and G), raises an exception for anything a baseline decoder does not have to accept
+    def check(condition, message):
+        if not condition:
+            raise ValueError(message)
+
+    check(data[0:2] == b"\xff\xd8", "No SOI")
+    quantization, huffman, frame, scans, notes, scanCount = {}, {}, None, set(), [], 0
+    i = 2
+    while True:
+        check(data[i] == 0xff, "No marker at " + str(i))
+        marker = data[i+1]
+        if marker == 0xd9:
+            check(i + 2 == len(data), "Data after EOI")
+            break
+        length = (data[i+2] << 8) | data[i+3]
+        segment = data[i+4:i+2+length]
+        check(len(segment) == length - 2, "Segment beyond the end of the file")
+        if marker == 0xdb: #DQT
+            check(length == 67 and segment[0] >> 4 == 0 and segment[0] & 0x0f < 4, "Only one 8bit quantization table per DQT")
+            quantization[segment[0]] = segment[1:65]
+        elif marker == 0xc4: #DHT
+            check(length == 3 + 16 + sum(segment[1:17]) and segment[0] >> 4 < 2 and segment[0] & 0x0f < 2, "Baseline Huffman tables have class 0 or 1 and destination 0 or 1")
+            codes, code, values = {}, 0, segment[17:]
+            for bits in range(1, 17):
+                for n in range(segment[bits]):
+                    codes[(bits, code)] = values[len(codes)]
+                    code += 1
+                check(code < (1 << bits), "Huffman table uses a code of all ones") #C.2: No code may consist of ones only
+                code <<= 1
+            check(all(value <= 11 for value in values) if segment[0] >> 4 == 0 else all(value & 0x0f <= 10 for value in values), "Huffman values beyond the baseline categories")
+            huffman[segment[0]] = codes
+        elif marker == 0xc0: #SOF0, the only frame type we may use
+            check(frame is None and segment[0] == 8, "One baseline frame with 8bit samples")
+            height, width, count = (segment[1] << 8) | segment[2], (segment[3] << 8) | segment[4], segment[5]
+            check(count == len(set(segment[6 + 3 * n] for n in range(count))), "Component ids are not unique")
+            frame = {segment[6 + 3 * n]: (segment[7 + 3 * n] >> 4, segment[7 + 3 * n] & 0x0f, segment[8 + 3 * n]) for n in range(count)}
+            check(all(1 <= h <= 4 and 1 <= v <= 4 and q in quantization for h, v, q in frame.values()), "Sampling factors have to be 1 to 4 and the quantization table has to be defined")
+            hMax, vMax = max(h for h, v, q in frame.values()), max(v for h, v, q in frame.values())
+            blocksW = {c: ((width * h + hMax - 1) // hMax + 7) // 8 for c, (h, v, q) in frame.items()}
+            blocksH = {c: ((height * v + vMax - 1) // vMax + 7) // 8 for c, (h, v, q) in frame.items()}
+            dcs = {c: [None] * (blocksW[c] * blocksH[c]) for c in frame}
+        elif marker == 0xda: #SOS, followed by the entropy coded data
+            check(frame is not None, "SOS before SOF")
+            count = segment[0]
+            components = [(segment[1 + 2 * n], segment[2 + 2 * n] >> 4, segment[2 + 2 * n] & 0x0f) for n in range(count)]
+            check(1 <= count <= 4 and all(c in frame and c not in scans for c, dc, ac in components), "Scan components have to be in the frame and in no other scan")
+            check(all((0x00 | dc) in huffman and (0x10 | ac) in huffman for c, dc, ac in components), "Scan uses an undefined Huffman table")
+            check(segment[1 + 2 * count:4 + 2 * count] == b"\x00\x3f\x00", "Baseline scans have Ss 0, Se 63 and no successive approximation")
+            order = [c for c in frame if c in [s[0] for s in components]]
+            check([c for c, dc, ac in components] == order, "Scan components are not in frame order")
+            if count > 1:
+                check(sum(frame[c][0] * frame[c][1] for c, dc, ac in components) <= 10, "More than 10 blocks per MCU") #B.2.3
+            scans.update(c for c, dc, ac in components)
+            scanCount += 1
+
+            #Remove the byte stuffing up to the next marker
+            i += 2 + length
+            entropy = bytearray()
+            while not (data[i] == 0xff and data[i+1] != 0x00):
+                entropy.append(data[i])
+                i += 2 if data[i] == 0xff else 1
+            bits = "".join(format(b, "08b") for b in entropy)
+            position = 0
+
+            def read(n):
+                nonlocal position
+                check(position + n <= len(bits), "Scan data ends in the middle of a block")
+                position += n
+                return bits[position-n:position]
+
+            def decodeHuffman(table):
+                code = ""
+                while len(code) < 16:
+                    code += read(1)
+                    value = huffman[table].get((len(code), int(code, 2)))
+                    if value is not None:
+                        return value
+                raise ValueError("Invalid Huffman code")
+
+            def extend(s):
+                if s == 0:
+                    return 0
+                v = int(read(s), 2)
+                return v if v >= 1 << (s - 1) else v - (1 << s) + 1
+
+            previous = {c: 0 for c, dc, ac in components}
+            def decodeBlock(c, dc, ac, index):
+                previous[c] += extend(decodeHuffman(dc))
+                dcs[c][index] = 128 + previous[c] * quantization[frame[c][2]][0] / 8
+                k = 1
+                while k < 64:
+                    rs = decodeHuffman(0x10 | ac)
+                    if rs & 0x0f == 0:
+                        if rs != 0xf0:
+                            break
+                        k += 16
+                    else:
+                        k += (rs >> 4)
+                        extend(rs & 0x0f)
+                        k += 1
+                check(k <= 64, "Block with more than 64 coefficients")
+
+            if count == 1: #Non-interleaved: The blocks of the component itself, A.2.2
+                c, dc, ac = components[0]
+                for index in range(blocksW[c] * blocksH[c]):
+                    decodeBlock(c, dc, ac, index)
+            else: #Interleaved: Whole MCUs, A.2.3
+                for mcuY in range((height + 8 * vMax - 1) // (8 * vMax)):
+                    for mcuX in range((width + 8 * hMax - 1) // (8 * hMax)):
+                        for c, dc, ac in components:
+                            h, v = frame[c][0], frame[c][1]
+                            for by in range(v):
+                                for bx in range(h):
+                                    x, y = mcuX * h + bx, mcuY * v + by
+                                    if x < blocksW[c] and y < blocksH[c]:
+                                        decodeBlock(c, dc, ac, y * blocksW[c] + x)
+            #F.1.2.3: Only the last byte may have unused bits, which are ones. The chroma scans end with a spare byte that leaves room for the DC of the green color mode (see generateData_chrominance),
+            #so without it, that byte is extraneous. libjpeg only warns about such bytes and every decoder that has been used with the Interceptor so far ignores them.
+            left = len(bits) - position
+            check(set(bits[position:position + left % 8]) <= {"1"}, "Scan " + str(scanCount) + " is not padded with ones")
+            if left >= 8:
+                notes.append("scan " + str(scanCount) + " has " + str(left // 8) + " extraneous byte" + ("s" if left >= 16 else ""))
+            continue
+        else:
+            check(0xe0 <= marker <= 0xef or marker == 0xfe, "Unexpected marker " + hex(marker))
+        i += 2 + length
+
+    check(frame is not None and scans == set(frame), "Not every component has been decoded")
+    image = ReferenceImage((width, height), [(frame[c][0], frame[c][1], blocksW[c], dcs[c]) for c in frame])
+    image.notes = notes
+    return image
+
+failed = False
+for name, data, size, dimensions, checkColor in variants():
+    print(name + ": " + str(len(data)) + " bytes, " + str(len(data) * 60 // 1000) + " kB/s at 60fps (" + str(len(data) * 60 * 100 // USB_BYTES_PER_SECOND) + "% of USB full speed)")
+    if len(data) != size:
+        print("    Size does not match base_jpeg_layout.h")
+        failed = True
+    for decoder, decode in [("Pillow", decodePillow), ("ffmpeg", decodeFFmpeg), ("T.81 reference", decodeReference)]:
+        try:
+            image = decode(data)
+        except ImportError:
+            print("    " + decoder + ": not installed, skipped")
+            continue
+        except Exception as e:
+            print("    " + decoder + ": FAILED (" + str(e) + ")")
+            failed = True
+            continue
+        center = image.getpixel((image.size[0] // 2 + 4, image.size[1] // 2 + 4))
+        ok = image.size == dimensions and checkColor(*center)
+        notes = getattr(image, "notes", [])
+        print("    " + decoder + ": " + ("OK " if ok else "FAILED ") + str(image.size) + " " + str(center) + ("" if not notes else " (" + ", ".join(notes) + ")"))
+        failed = failed or not ok
+
+exit(1 if failed else 0)
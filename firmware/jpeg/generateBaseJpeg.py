@@ -1,6 +1,21 @@
-#This is a simple Python script that creates a JPEG file in the desired format and creates a header file with the data.
-#Note that I do not expect any changes here, so this is mostly here for reference and not properly automated.
-#If you change anything, you will very likely need to change offsets in the Pico code.
+#This is a simple Python script that creates the base JPEGs in the desired formats and header files with their data and layout.
+#It is run by CMake for every build, so the headers in the build directory always match this script and its parameters (see CMakeLists.txt).
+#The firmware takes all offsets from base_jpeg_layout.h. Before writing anything, the script checks that the JPEGs have the layout the firmware expects.
+
+import argparse
+import os
+
+#Parameters, set from the command line
+LUMA_SAMPLING = 0x42 #Sampling factors of the luminance in the 8x frames, so each chrominance block covers 4x2 luminance blocks. That halves the chroma scan compared to the common 0x22.
+NATIVE_QUANTIZATION = 8 #Same value for all coefficients of the native resolution
+DMG_GREEN = (-1, -1) #DC values of Cb and Cr for the green DMG color mode
+QUANTIZATION = 0xff #All coefficients of the 8x frames and the chroma of the native frames
+
+#The 8x frames are sent at up to 60fps and have to fit USB full speed (19 packets of 64 bytes per 1ms frame) with some room for the other transfers
+USB_BYTES_PER_SECOND = 19 * 64 * 1000
+USB_VIDEO_SHARE = 0.9
+#Sampling factors that keep the chroma scan small enough for that and that common decoders accept (ffmpeg refuses 0x44)
+LUMA_SAMPLINGS = [0x22, 0x42, 0x24]
 
 def generateSOI():
     return bytearray([0xff, 0xd8])
@@ -15,22 +30,11 @@ def generateAPP0():
     data.extend([0x00, 0x00])               #Thumbnail 0x0
     return data
 
-def generateAPP0NoChroma():
-    data = bytearray([0xff, 0xe0])
-    data.extend([0x00, 0x11])               #length 17
-    data.extend(b"JFIF\x00")                #JFIF
-    data.extend([0x01, 0x01])               #Version 1.1
-    data.extend([0x01])                     #Units DPI
-    data.extend([0x00, 0x48, 0x00, 0x48])   #Density 72x72
-    data.extend([0x00, 0x00])               #Thumbnail 0x0
-    data.extend([0x00])                     #No meaning, we just need to pad it, so that the data block aligns with a multiple of 32bit
-    return data
-
-def generateDQT(destination):
+def generateDQT(destination, value = QUANTIZATION):
     data = bytearray([0xff, 0xdb])
     data.extend([0x00, 0x43])               #Length 67
     data.extend([destination])              #destination
-    data.extend([0xff]*64)                  #QUantization table entirely filled with 0xff
+    data.extend([value]*64)                 #QUantization table entirely filled with 0xff (or value)
     return data
 
 def generateSOF():
@@ -40,19 +44,21 @@ def generateSOF():
     data.extend([0x04, 0x80])               #height 8*144
     data.extend([0x05, 0x00])               #width 8*160
     data.extend([0x03])                     #Components
-    data.extend([0x01, 0x22, 0x00])         #Luminance channel setup
+    data.extend([0x01, LUMA_SAMPLING, 0x00]) #Luminance channel setup, horizontal and vertical luminance blocks per chrominance block
     data.extend([0x02, 0x11, 0x00])         #Chrominance Cb channel setup
     data.extend([0x03, 0x11, 0x00])         #Chrominance Cr channel setup
     return data
 
-def generateSOFNoChroma():
+def generateSOFNative():
     data = bytearray([0xff, 0xc0])
-    data.extend([0x00, 0x0b])               #Length 11
+    data.extend([0x00, 0x11])               #Length 17
     data.extend([0x08])                     #Precision
-    data.extend([0x04, 0x80])               #height 8*144
-    data.extend([0x05, 0x00])               #width 8*160
-    data.extend([0x01])                     #Components
-    data.extend([0x01, 0x22, 0x00])         #Luminance channel setup
+    data.extend([0x00, 0x90])               #height 144
+    data.extend([0x00, 0xa0])               #width 160
+    data.extend([0x03])                     #Components
+    data.extend([0x01, 0x22, 0x00])         #Luminance channel setup, quantization table 0. Same sampling as the default of the 8x frames, the chroma scan is tiny anyway
+    data.extend([0x02, 0x11, 0x01])         #Chrominance Cb channel setup, quantization table 1 like the 0xff of the other variants, so the green color mode looks the same
+    data.extend([0x03, 0x11, 0x01])         #Chrominance Cr channel setup
     return data
 
 def generateDHT_DC():
@@ -81,16 +87,42 @@ def generateDHT_DC_chrominance():
 
     return data
 
-def generateDHT_AC():
+def generateDHT_AC(destination = 0x00):
     data = bytearray([0xff, 0xc4])
     data.extend([0x00, 0x14])               #Length 20
-    data.extend([0x10])                     #AC Huffman table, destination 0
+    data.extend([0x10 | destination])       #AC Huffman table, destination 0 (or destination)
 
     #Huffman table
     data.extend([0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00])
 
     return data
 
+#The native resolution needs real AC coefficients, so it uses the example tables from the JPEG specification (Annex K.3), which every decoder handles well.
+#The firmware derives its codes from these DHT segments in the base JPEG.
+STANDARD_DC_BITS = [0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]
+STANDARD_DC_VALUES = [0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b]
+STANDARD_AC_BITS = [0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d]
+STANDARD_AC_VALUES = [
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa]
+
+def generateDHT_standard(tableClass, bits, values):
+    data = bytearray([0xff, 0xc4])
+    data.extend((3 + len(bits) + len(values)).to_bytes(2, "big")) #Length
+    data.extend([tableClass << 4])          #DC (0) or AC (1) Huffman table, destination 0
+    data.extend(bits)
+    data.extend(values)
+    return data
+
 def generateSOS():
     data = bytearray([0xff, 0xda])
     data.extend([0x00, 0x08])               #Length 8
@@ -100,12 +132,12 @@ def generateSOS():
     data.extend([0x00])                     #successive approx
     return data
 
-def generateSOS_chrominance():
+def generateSOS_chrominance(tables = 0x10):
     data = bytearray([0xff, 0xda])
     data.extend([0x00, 0x0a])               #Length 10
     data.extend([0x02])                     #Components: 2
-    data.extend([0x02, 0x10])               #Component two uses tables 1/0
-    data.extend([0x03, 0x10])               #Component three uses tables 1/0
+    data.extend([0x02, tables])             #Component two uses tables 1/0 (or tables)
+    data.extend([0x03, tables])             #Component three uses tables 1/0 (or tables)
     data.extend([0x00, 0x3f])               #Spectral select
     data.extend([0x00])                     #successive approx
     return data
@@ -133,12 +165,43 @@ def generateData():
                 pixelData[byteOffset+1] |= ((code << (11-bitOffset)) & 0xff)
     return pixelData
 
-def generateData_chrominance():
-    last = 0
-    pixelData = [0x00]*(160*144*2*2//8//4+1) #160 * 144 pixels, 2 channels, one bit for DC and AC entry each, 8 bit per byte, 4 pixels per entry due to undersampling plus 1 byte that is not always used, but leaves headroom to set a DC offset in the beginning for green color mode
-    #pixelData[0] = 0b10001000 #Set entire DC offset to make the image green
+def generateData_native():
+    #White frame, which also is the blank frame in native resolution: The first block sets the DC value to 8 * 96 / 8 (mean sample, quantization), all others repeat it.
+    #Category 7 for 96 is 11110 + 1100000, EOB is 1010 and a difference of zero is 00.
+    bits = "11110" + "1100000" + "1010" + ("00" + "1010") * (20*18 - 1)
+    bits += "1" * (-len(bits) % 8)
+    return [int(bits[i:i+8], 2) for i in range(0, len(bits), 8)] #Never produces 0xff, so no stuffing needed
+
+def generateData_chrominance(lumaBlocks = 160*144, sampling = None):
+    sampling = LUMA_SAMPLING if sampling is None else sampling
+    pixelData = [0x00]*(lumaBlocks*2*2//(sampling >> 4)//(sampling & 0x0f)//8+1) #160 * 144 luminance blocks (or 20 * 18 at native resolution), 2 channels, one bit for DC and AC entry each, 8 bit per byte, one entry per sampling factors luminance blocks plus 1 byte that is not always used, but leaves headroom to set a DC offset in the beginning for green color mode
+    pixelData[-1] = 0x0f #The DC of the green color mode pushes the last four zero bits into this byte, so its padding has to be ones
     return pixelData
 
+def generateChromaDC(cb, cr):
+    #Replaces the first byte of the chroma scan to set the DC value of the entire frame. Values of -1 and +1 (category 1) fit into that byte.
+    bits = ""
+    for dc in [cb, cr]:
+        bits += "0" if dc == 0 else "10" + ("1" if dc > 0 else "0")
+        bits += "0" #EOB
+    assert len(bits) <= 8 and all(dc in [-1, 0, 1] for dc in [cb, cr]), "Chroma DC does not fit into one byte"
+    return int(bits.ljust(8, "0"), 2)
+
+def rawChromaDC(dc):
+    #Chroma sample of a frame that only has this DC value, which is what the decoder gets from the JPEG frames. NV12 has no DC values, so it needs the sample itself.
+    return round(128 + dc * QUANTIZATION / 8)
+
+def nativeMaxBlockSize():
+    #Bytes of the largest block the firmware can write in the native frames: Every AC coefficient with the longest code and its largest value plus the DC difference, twice for byte stuffing.
+    #Our samples are in [-96..96], so the DCT cannot produce any coefficient beyond 8 * 96 (a checkerboard of these for the AC, the flat block for the DC). One more for rounding.
+    largest = 8 * 96 // NATIVE_QUANTIZATION + 1
+    acCategory = largest.bit_length()
+    dcCategory = (2 * largest).bit_length()
+    acCodeLength = max(length + 1 for length in range(16) if STANDARD_AC_BITS[length])
+    dcCodeLength = 1 + max(length for length in range(16) for i in range(sum(STANDARD_DC_BITS[:length]), sum(STANDARD_DC_BITS[:length+1])) if STANDARD_DC_VALUES[i] == dcCategory)
+    bits = dcCodeLength + dcCategory + 63 * (acCodeLength + acCategory)
+    return 2 * ((bits + 7) // 8)
+
 def generateEOI():
     return bytearray([0xff, 0xd9])
 
@@ -158,24 +221,82 @@ def baseJpeg():
     data.extend(generateEOI())
     return data
 
-def baseJpegNoChroma():
+def baseJpegNative():
     data = bytearray()
     data.extend(generateSOI())
-    data.extend(generateAPP0NoChroma())
-    data.extend(generateDQT(0x00)) #DQT
-    data.extend(generateSOFNoChroma())
-    data.extend(generateDHT_DC())
-    data.extend(generateDHT_AC())
+    data.extend(generateAPP0())
+    data.extend(generateDQT(0x00, NATIVE_QUANTIZATION))
+    data.extend(generateDQT(0x01))
+    data.extend(generateSOFNative())
+    data.extend(generateDHT_standard(0, STANDARD_DC_BITS, STANDARD_DC_VALUES))
+    data.extend(generateDHT_standard(1, STANDARD_AC_BITS, STANDARD_AC_VALUES))
+    data.extend(generateDHT_DC_chrominance())
+    data.extend(generateDHT_AC(0x01))
     data.extend(generateSOS())
-    data.extend(generateData())
+    data.extend(generateData_native())
+    data.extend(generateSOS_chrominance(0x11))
+    data.extend(generateData_chrominance(20*18, 0x22))
     data.extend(generateEOI())
     return data
 
-def generateFiles(jpg, h, var, data):
-    with open(jpg, "wb") as f:
+def segments(data):
+    #Marker and position of the segments up to the first SOS
+    i = 2
+    while i < len(data):
+        assert data[i] == 0xff, "No marker at " + str(i)
+        yield data[i+1], i
+        if data[i+1] == 0xda:
+            return
+        i += 2 + ((data[i+2] << 8) | data[i+3])
+
+def checkScan(name, data, start, size):
+    #The SOS at start has to be followed by size bytes of entropy coded data without any marker (or 0xff that would need stuffing)
+    assert data[start:start+2] == b"\xff\xda", name + ": No SOS at " + str(start)
+    scanStart = start + 2 + ((data[start+2] << 8) | data[start+3])
+    assert 0xff not in data[scanStart:scanStart+size], name + ": Marker in scan data"
+    return scanStart + size
+
+def headerSize(data):
+    marker, position = list(segments(data))[-1]
+    return position + 2 + ((data[position+2] << 8) | data[position+3])
+
+def checkLayout(jpeg, native, layout):
+    #Everything the firmware relies on, so a change here cannot silently break the frames
+    dataSize = 160*144*5//8
+    assert layout["JPEG_HEADER_SIZE"] % 4 == 0, "The encoder writes the data with 32bit alignment"
+    end = checkScan("base.jpg", jpeg, layout["JPEG_HEADER_SIZE"] - len(generateSOS()), dataSize)
+    end = checkScan("base.jpg chroma", jpeg, end, len(generateData_chrominance()))
+    assert end - layout["JPEG_HEADER_SIZE"] - dataSize == layout["JPEG_CHROMA_SOS_SIZE"] + len(generateData_chrominance()), "Chroma scan does not start right after the data"
+    assert jpeg[end:] == generateEOI() and len(jpeg) == layout["JPEG_HEADER_SIZE"] + dataSize + layout["JPEG_END_SIZE"], "base.jpg: Unexpected size"
+    end = checkScan("base_native.jpg", native, layout["JPEG_NATIVE_HEADER_SIZE"] - len(generateSOS()), layout["JPEG_NATIVE_BASE_DATA_SIZE"])
+    end = checkScan("base_native.jpg chroma", native, end, layout["JPEG_NATIVE_END_SIZE"] - layout["JPEG_CHROMA_SOS_SIZE"] - 2)
+    assert native[end:] == generateEOI(), "base_native.jpg: Unexpected size"
+    assert len(jpeg) * 60 <= USB_BYTES_PER_SECOND * USB_VIDEO_SHARE, "base.jpg: " + str(len(jpeg)) + " bytes at 60fps do not fit USB"
+    assert DMG_GREEN[0] == DMG_GREEN[1], "NV12 frames use the same value for Cb and Cr"
+    for marker, position in segments(native): #The firmware derives its Huffman codes from the DHT segments, but the quantization is a constant
+        if marker == 0xdb and native[position+4] == 0x00:
+            assert set(native[position+5:position+69]) == {layout["JPEG_NATIVE_QUANTIZATION"]}, "Native quantization table does not match"
+
+def generateLayout(jpeg, native):
+    chromaSOS = len(generateSOS_chrominance())
+    return {
+        "JPEG_HEADER_SIZE": headerSize(jpeg),
+        "JPEG_END_SIZE": chromaSOS + len(generateData_chrominance()) + len(generateEOI()),
+        "JPEG_CHROMA_SOS_SIZE": chromaSOS,
+        "JPEG_CHROMA_DMG_GREEN": generateChromaDC(*DMG_GREEN),
+        "JPEG_NATIVE_HEADER_SIZE": headerSize(native),
+        "JPEG_NATIVE_BASE_DATA_SIZE": len(generateData_native()),
+        "JPEG_NATIVE_END_SIZE": chromaSOS + len(generateData_chrominance(20*18, 0x22)) + len(generateEOI()),
+        "JPEG_NATIVE_QUANTIZATION": NATIVE_QUANTIZATION,
+        "JPEG_NATIVE_MAX_BLOCK_SIZE": nativeMaxBlockSize(),
+        "RAW_CHROMA_DMG_GREEN": rawChromaDC(DMG_GREEN[0]),
+    }
+
+def generateFiles(directory, jpg, h, var, data):
+    with open(os.path.join(directory, jpg), "wb") as f:
         f.write(data)
 
-    with open(h, "w") as f:
+    with open(os.path.join(directory, h), "w") as f:
         f.write("unsigned char __in_flash(\"jpeg\") " + var + "[] = {")
         for i in range(len(data)):
             if i % 16 == 0:
@@ -183,5 +304,28 @@ def generateFiles(jpg, h, var, data):
             f.write(' 0x{:02x},'.format(data[i]))
         f.write("\n};\n")
 
-generateFiles("base.jpg", "base_jpeg.h", "base_jpeg", baseJpeg())
-generateFiles("base_no_chroma.jpg", "base_jpeg_no_chroma.h", "base_jpeg_no_chroma", baseJpegNoChroma())
+def generateLayoutFile(directory, layout):
+    with open(os.path.join(directory, "base_jpeg_layout.h"), "w") as f:
+        f.write("//Generated by generateBaseJpeg.py, do not edit\n")
+        for name, value in layout.items():
+            f.write("#define " + name + " " + str(value) + "\n")
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generates the base JPEGs and their layout for the firmware.")
+    parser.add_argument("--output", default=".", help="Directory for the JPEGs and headers")
+    parser.add_argument("--luma-sampling", type=lambda x: int(x, 0), default=LUMA_SAMPLING, help="Sampling factors of the luminance in the 8x frames, for example 0x42")
+    parser.add_argument("--native-quantization", type=int, default=NATIVE_QUANTIZATION, help="Quantization of the native resolution frames")
+    args = parser.parse_args()
+    assert args.luma_sampling in LUMA_SAMPLINGS, "Luminance sampling has to be one of " + ", ".join(hex(s) for s in LUMA_SAMPLINGS)
+    assert 1 <= args.native_quantization <= 255, "Quantization has to fit into a byte"
+    LUMA_SAMPLING = args.luma_sampling
+    NATIVE_QUANTIZATION = args.native_quantization
+
+    jpeg, native = baseJpeg(), baseJpegNative()
+    layout = generateLayout(jpeg, native)
+    checkLayout(jpeg, native, layout)
+
+    os.makedirs(args.output, exist_ok=True)
+    generateFiles(args.output, "base.jpg", "base_jpeg.h", "base_jpeg", jpeg)
+    generateFiles(args.output, "base_native.jpg", "base_jpeg_native.h", "base_jpeg_native", native)
+    generateLayoutFile(args.output, layout)
@@ -1,251 +1,796 @@
 #include "jpeg/jpeg.h"
+#include "jpeg/base_jpeg_native.h"
 #include "ppu.h"
 
-#include "jpeg_prepare.pio.h"
 #include "jpeg_encoding.pio.h"
 
 #include "osd.h"
+#include "telemetry.h"
 
 #include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/structs/systick.h"
 
 #include <stdio.h>
+#include <string.h>
 
 //The JPEG data uses a Huffman table that is designed such that every pixel can be
 //encoded in 5 bit (see https://github.com/Staacks/gbinterceptor/issues/17).
 
-//jpeg encoding is prepared by two parallel PIO state machines (CPU feeds them in an alternating pattern)
-//Then two chained DMA channels per SM distributes the results to four state machines that encode in parallel
-//The output is then put back together by a DMA channel that chains with a controling DMA channel iterating over the four outputs of the encoding SMs
+//The CPU only blends the frames and calculates the differences between neighbouring pixels. These are stored as 4bit values in encodeInput, exactly as the encode SMs expect them (see jpeg_encoding.pio).
+//Once a quarter of a frame has been prepared, DMA feeds it to one of four encoding state machines and collects its output without further help from the CPU. A DMA interrupt makes the frame the new readyBuffer when all of them have finished.
+//Frames from the PPU are encoded while they are being rendered: Each line is prepared as soon as the PPU has moved on to the next one, so the JPEG is complete a few lines into vblank instead of a whole frame later.
 
 /*
-                    encode SM AA
-                   /
-      prepare SM A
-     /             \
-    /               encode SM AB
-CPU
-    \               encode SM BA
-     \             /
-      prepare SM B
-                   \
-                    encode SM BB
+                 encode SM AA => lines   0 to  35
+                /
+               /  encode SM AB => lines  36 to  71
+encodeInput  --
+               \  encode SM BA => lines  72 to 107
+                \
+                 encode SM BB => lines 108 to 143
 */
 
-//For this to work we have to take into account multiples of the five bit encoded data and 32bit input data with 8bit pixel.
+//Every pixel results in exactly 5 bits of output, so each quarter of the frame is encoded to exactly a quarter of the JPEG data and every SM can write its output to a fixed range of the encodeBuffer:
 
 /*
-                                                        8 pixels / 32bit => encode SM AA => 8 pixels / 40bit
-                                                       /                                                    \
-16 pixels / 128bit => prepare SM A => 16 pixels / 64bit                                                      16 pixels / 80 bit
-                                                       \                                                    /
-                                                        8 pixels / 32bit => encode SM AB => 8 pixels / 40bit
-
-So:
-1. The CPU has to write two 32bit blocks representing 16 pixels to alternating prepare state machines.
-2. The DMA channels between the SMs need to alternate each 32bit output from a prepare SM to the encode SM, writing 8 pixels with a single 32bit write to each encode SM
-3. The output DMA channel needs to pick up five 8bit blocks from each encode SM before moving on to the next.
-
-Therefore, pixels are distributed as follows:
+8 pixels / 32bit from encodeInput => encode SM => 8 pixels / 40bit => 5 8bit reads and consecutive writes to its quarter of the encodeBuffer
+*/
 
-8 pixels => 2 32bit writes to prepare SM A => 1 32bit transfer to encode SM AA => 5 8bit reads and consecutive writes to target memory
-8 pixels => 2 32bit writes to prepare SM A => 1 32bit transfer to encode SM AB => 5 8bit reads and consecutive writes to target memory
-8 pixels => 2 32bit writes to prepare SM B => 1 32bit transfer to encode SM BA => 5 8bit reads and consecutive writes to target memory
-8 pixels => 2 32bit writes to prepare SM B => 1 32bit transfer to encode SM BB => 5 8bit reads and consecutive writes to target memory
+//As the first pixel of each quarter is encoded relative to the last pixel of the previous quarter in encodeInput, the four parts just form one continuous stream.
 
-So, 32 pixels (8 32bit blocks) should always be started in one go.
+//With CPU_JPEG_ENCODER, core0 replaces the encode SMs and their DMA channels, so PIO1 is free for other uses: Once a quarter would be handed to its SM, each call of continueBackbufferToJPEG
+//packs one line of it, looking up two pixels at once in packTable. The telemetry shows the cycles this takes per frame. test/cpu_encoder_bench.c checks that the result matches the encode SMs.
 
-*/
-
-#define PREPARE_PIO pio0
 #define ENCODE_PIO pio1
-#define PREPARE_SM_A 1 //Do not use SM0 on PIO0, that one is used to capture the memory bus
-#define PREPARE_SM_B 2
-#define ENCODE_SM_AA 0
-#define ENCODE_SM_AB 1
-#define ENCODE_SM_BA 2
-#define ENCODE_SM_BB 3
+#define ENCODE_SMS 4 //Using all SMs of PIO1
+#define ENCODE_WORDS_PER_SM (SCREEN_SIZE / 8 / ENCODE_SMS)
+#define ENCODE_BYTES_PER_SM (JPEG_DATA_SIZE / ENCODE_SMS)
+#define ENCODE_DMA_IRQ DMA_IRQ_0
+
+//One DMA channel per SM feeding encodeInput to the SM and one channel per SM writing its output to the encodeBuffer
+int dmaChannelsToEncode[ENCODE_SMS], dmaChannelsFromEncode[ENCODE_SMS];
+dma_channel_config dmaConfigToEncode[ENCODE_SMS], dmaConfigFromEncode[ENCODE_SMS];
+uint encodeProgramOffset;
+volatile uint encodersBusy = 0; //One bit per SM whose output has not been completely written yet
 
-#define ENCODE_OUT_STALL_MASK 0x0000000f //output from encode SMs stalled in fdebug register
-#define ENCODE_IN_EMPTY_MASK 0x0f000000 //Input to encode SMs empty in fstat register 
+uint8_t volatile * encodeTarget; //The encodeBuffer when the encoding started, USB might already be sending it
 
+#ifdef CPU_JPEG_ENCODER
+//The 5bit codes the encode SMs produce for each 4bit value, see jpeg_encoding.pio (0b0111 is never used)
+const uint8_t encodeCodes[16] = {0b00000, 0b00010, 0b00100, 0b00110, 0b10000, 0b10010, 0b11000, 0b11100, 0b11100, 0b11010, 0b10100, 0b10110, 0b01000, 0b01010, 0b01100, 0b01110};
+uint16_t packTable[256]; //Two 4bit values to their 10bit output, first pixel in the most significant bits
+uint packIndex; //Next word of encodeInput to be packed
+uint packLimit; //End of the quarters that have been started
+#endif
 
-//DMA channel connecting the jpegPIO out FIFO to the readyBuffer
-int dmaChannelToEncodeAA, dmaChannelToEncodeAB, dmaChannelToEncodeBA, dmaChannelToEncodeBB, dmaChannelFromEncode, dmaChannelFromEncodeSource;
-dma_channel_config dmaConfigToEncodeAA, dmaConfigToEncodeAB, dmaConfigToEncodeBA, dmaConfigToEncodeBB, dmaConfigFromEncode, dmaConfigFromEncodeSource;
-uint32_t volatile const * dmaFromEncodeSourceAddresses[4];
+uint32_t encodeInput[SCREEN_SIZE / 8]; //Prepared differential values of the whole frame, 4bit per pixel with the first pixel in the most significant bits
 
 int jpegPreviousDC;
 
-uint32_t * backIterator = NULL;
-uint32_t * lastIterator = NULL;
-uint encodeIndex; //Position in backbuffer copy process in multiples of four bytes (we copy 32bit at once)
+uint8_t volatile * historyIterator[FRAME_HISTORY]; //One per frame in the history, all pointing to the same buffer if we do not blend
+uint8_t volatile * encodeFrames[FRAME_HISTORY]; //Where the iterators started, for the palettes of each line
+uint encodeIndex; //Position in backbuffer copy process in pixels (we prepare one line at once)
+bool encodePipelined; //The PPU is still rendering the newest frame, so we may only prepare the lines it has finished
 uint osdIndex; //index at which the backbuffer transfer should copy the osdBuffer instead
 
+//Lines that have not changed since the last complete encoding are not prepared again. Their values in encodeInput are still the same, so the encoder produces the same output for them.
+uint encodeFrame;   //frameCount of the newest frame in the current encoding
+uint encodedFrame;  //frameCount of the newest frame in the last complete encoding
+uint encodeOsdPosition, encodedOsdPosition;
+bool encodeReusable, encodedFrameValid = false;
+enum BlendMode encodeBlendMode, encodedBlendMode;
+uint reuseFrame;    //encodedFrame of the frame we can reuse lines from
+uint reuseLines;    //Only lines above this can be reused, the ones below have been covered by the OSD
+//If not a single line has changed, the encoder would produce exactly the JPEG we have already handed to USB. To find out before running it, the encoders of quarters without changes
+//are only started once a line of a later quarter turns out to be different. If that never happens, the frame is dropped without encoding it, so USB does not send it again either.
+bool encodeChanged; //A line of the current frame had to be prepared again
+uint pendingEncoders; //Quarters that have been prepared, but whose encoder has not been started
+
+//Streaming: Once three quarters of a pipelined frame have been encoded, USB may start sending the frame right away, but it must never read the part that is still being encoded.
+//TinyUSB copies one payload of the frame at a time in tud_task(), the first one when the transfer starts and each further one only after the previous one has been sent. Full speed moves
+//at most 19 bulk packets of 64 bytes per 1ms frame, so USB cannot have read more than one payload plus what the wire could have carried since then. While that bound reaches the quarter that
+//is still being encoded, usbMayRead() holds back tud_task(), so a late encoder only delays the transfer. If the frame has still not been encoded when the next one starts, it is finished
+//right away instead of being dropped, as the PPU has rendered all of its lines by then. Only when the emulation stops or the host changes the format in the middle of a streamed frame,
+//USB sends it unfinished, after which we only send complete frames for a while.
+#define STREAM_START_QUARTERS 0x07 //Bits in encodersBusy that have to be cleared before the frame can be streamed
+#define STREAM_RETRY_FRAMES 300 //Complete frames to send after an unfinished one before streaming again
+#define USB_MAX_BYTES_PER_MS (19 * 64)
+uint streamingPause = 0; //Remaining complete frames before streaming again
+volatile bool encodeStreamed; //USB is already sending the frame we are encoding
+volatile bool streamedFrameComplete = true;
+uint64_t streamStart; //When USB started sending the frame we are encoding
+bool streamStalled; //usbMayRead() has already held back USB for this frame
+
+//Raw frames: There is only room for one rawFrame, so the encoder waits while USB sends it. A frame that has not been completed by the next one is dropped.
+volatile bool rawFrameSending = false;
+
+//Native resolution: Every 8x8 block of Game Boy pixels becomes a real JPEG block, so the frame is only 160x144 and the host does not have to decode and scale 23040 blocks.
+//This needs a DCT and variable length codes, which the encode SMs cannot do, so the CPU encodes these frames: Each call of continueBackbufferToJPEG either blends one line into nativeLines or,
+//once eight lines are complete, encodes one block. The size of a native frame depends on its content. Typical screens need 4 to 7kB, but a frame full of noise would not fit into our buffers, so
+//once we run out of space, the remaining blocks only get their DC value.
+enum OutputFormat outputFormat = format8x;
+enum OutputFormat encodeFormat = format8x; //Format of the frame in progress, the host might switch in between
+#define NATIVE_BLOCKS_W (SCREEN_W / 8)
+uint32_t nativeLines[8][SCREEN_W / 4]; //Blended pixels of the current row of blocks, one byte per pixel
+uint nativeBlock = NATIVE_BLOCKS_W; //Next block of the row to be encoded, NATIVE_BLOCKS_W while we are blending lines
+uint8_t volatile * nativeOutput;
+uint8_t volatile * nativeOutputLimit; //Blocks starting beyond this only get their DC value
+uint32_t nativeBits; //Bits that have not been written yet, right aligned
+uint nativeBitCount;
+uint32_t nativeFrameCycles; //Cycles core0 spent on the native frame in progress
+int nativePreviousDC;
+
+//Huffman codes of the luminance, derived from the DHT segments of the base JPEG
+uint16_t nativeDCCodes[16], nativeACCodes[256];
+uint8_t nativeDCLengths[16], nativeACLengths[256];
+
+const uint8_t zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+uint8_t chromaDC = 0x00; //First byte of the chroma scan, which is appended to every native frame
+
+//While the LCD is off, the Game Boy shows a blank screen. We encode a white frame once at startup and only keep its first line and one other line as all lines after the first one are identical.
+uint8_t blankLines[2][JPEG_LINE_SIZE];
+
+//Frame blending: Each frame in the history contributes its pixels with a weight in quarters. The weights of a mode add up to 8, so the blend covers the same range [0..6] as simply adding two frames, which is what our Huffman table is made for.
+//Frames that are not needed by a mode get a weight of zero, so the blend does not need to branch.
+#ifdef BASE_VIDEO_MODE
+enum BlendMode blendMode = blendOff;
+#else
+enum BlendMode blendMode = blendTwoFrames;
+#endif
+const uint8_t blendWeights[BLEND_MODES][FRAME_HISTORY] = {
+    {8, 0, 0}, //blendOff
+    {4, 4, 0}, //blendTwoFrames
+    {4, 2, 2}, //blendThreeFrames, for games that multiplex sprites over three frames
+    {5, 2, 1}, //blendPersistence, roughly an exponential decay like the slow LCD of the DMG
+};
+
+//Byte of two pixels to one byte per pixel times the blend weight of each frame, leftmost pixel in the lowest byte. In RAM as it is read for every two pixels.
+//The tables resolve the palette indices with the palettes of the line, so they are rebuilt whenever a line has other palettes than the one before (usually only at the first line of a frame).
+#define NO_PALETTES 0xffffffff //Line palettes only use the lower 24 bit
+uint16_t blendTables[FRAME_HISTORY][256];
+uint32_t blendTablesPalettes[FRAME_HISTORY];
+enum BlendMode blendTablesMode;
+
+uint8_t static inline resolvePixel(uint8_t pixel, uint32_t palettes) {
+    if ((pixel & PIXEL_DIRECT) == PIXEL_DIRECT)
+        return pixel & 0x03;
+    //The source selects the palette register within palettes, the index the color within the register
+    return (~palettes >> (((pixel & 0x0c) << 1) | ((pixel & 0x03) << 1))) & 0x03;
+}
+
+void setupBlendTables() { //Called when the blend mode changes, frames with a weight of zero keep their empty tables
+    memset(blendTables, 0, sizeof(blendTables));
+    for (uint frame = 0; frame < FRAME_HISTORY; frame++)
+        blendTablesPalettes[frame] = NO_PALETTES;
+    blendTablesMode = blendMode;
+}
+
+void buildBlendTable(uint frame, uint32_t palettes) {
+    const uint16_t weight = blendWeights[blendTablesMode][frame];
+    uint16_t shades[16];
+    for (uint i = 0; i < 16; i++)
+        shades[i] = weight * resolvePixel(i, palettes);
+    for (uint i = 0; i < 256; i++)
+        blendTables[frame][i] = shades[i >> 4] | (shades[i & 0x0f] << 8);
+    blendTablesPalettes[frame] = palettes;
+}
+
+void static inline setupLineBlendTables(uint line) {
+    for (uint frame = 0; frame < FRAME_HISTORY; frame++) {
+        const uint32_t palettes = LINE_PALETTES(encodeFrames[frame])[line];
+        if (blendWeights[blendTablesMode][frame] && palettes != blendTablesPalettes[frame])
+            buildBlendTable(frame, palettes);
+    }
+}
+
+uint32_t static inline blendPixels(int offset) { //Four pixels of all frames in the history at once
+    uint32_t v = 0x02020202; //Rounding
+    for (uint frame = 0; frame < FRAME_HISTORY; frame++)
+        v += blendTables[frame][historyIterator[frame][2 * offset]] | ((uint32_t)blendTables[frame][historyIterator[frame][2 * offset + 1]] << 16);
+    return (v >> 2) & 0x07070707;
+}
+
 void setupJpegPIO() {
-    uint offsetPrepare = pio_add_program(PREPARE_PIO, &jpegPrepare_program);
-    uint offsetEncode = pio_add_program(ENCODE_PIO, &jpegEncoding_program);
+    encodeProgramOffset = pio_add_program(ENCODE_PIO, &jpegEncoding_program);
+    for (uint sm = 0; sm < ENCODE_SMS; sm++)
+        jpegEncoding_program_init(ENCODE_PIO, sm, encodeProgramOffset);
+}
+
+void static inline publishFrame(uint8_t volatile * frame) { //The newest frame replaces the one in the readyBuffer, even if USB has not picked that one up yet
+    if (readyBufferIsNew)
+        telemetry.droppedFrames++;
+    if (outputFormat != formatNV12) { //There only is one raw frame, USB simply sends it again. It starts where the first JPEG buffer does, so the pointer does not tell.
+        encodeBuffer = readyBuffer;
+        readyBuffer = frame;
+    }
+    readyBufferIsNew = true;
+}
 
-    jpegPrepare_program_init(PREPARE_PIO, PREPARE_SM_A, offsetPrepare);
-    pio_sm_set_enabled(PREPARE_PIO, PREPARE_SM_A, true);
-    jpegPrepare_program_init(PREPARE_PIO, PREPARE_SM_B, offsetPrepare);
-    pio_sm_set_enabled(PREPARE_PIO, PREPARE_SM_B, true);
+void static inline finishEncoding(bool unchanged) {
+    if (unchanged)
+        telemetry.unchangedFrames++; //The previous frame is still in the readyBuffer or has already been sent
+    else if (encodeStreamed)
+        streamedFrameComplete = true; //The frame is already being sent
+    else
+        publishFrame(encodeTarget);
+    encodedFrameValid = encodeReusable;
+    encodedFrame = encodeFrame;
+    encodedOsdPosition = encodeOsdPosition;
+    encodedBlendMode = encodeBlendMode;
+}
 
-    jpegEncoding_program_init(ENCODE_PIO, ENCODE_SM_AA, offsetEncode);
-    pio_sm_set_enabled(ENCODE_PIO, ENCODE_SM_AA, true);
-    jpegEncoding_program_init(ENCODE_PIO, ENCODE_SM_AB, offsetEncode);
-    pio_sm_set_enabled(ENCODE_PIO, ENCODE_SM_AB, true);
-    jpegEncoding_program_init(ENCODE_PIO, ENCODE_SM_BA, offsetEncode);
-    pio_sm_set_enabled(ENCODE_PIO, ENCODE_SM_BA, true);
-    jpegEncoding_program_init(ENCODE_PIO, ENCODE_SM_BB, offsetEncode);
-    pio_sm_set_enabled(ENCODE_PIO, ENCODE_SM_BB, true);
+void encodeDMAHandler() {
+    for (uint sm = 0; sm < ENCODE_SMS; sm++) {
+        if (dma_channel_get_irq0_status(dmaChannelsFromEncode[sm])) {
+            dma_channel_acknowledge_irq0(dmaChannelsFromEncode[sm]);
+            if (encodersBusy & (1u << sm)) { //Ignore channels that have been aborted
+                encodersBusy &= ~(1u << sm);
+                if (!encodersBusy)
+                    finishEncoding(false);
+            }
+        }
+    }
+}
+
+#ifdef CPU_JPEG_ENCODER
+void setupCPUEncoder() {
+    encodeIndex = SCREEN_SIZE; //Reset transfer state to "end"
+    for (uint i = 0; i < 256; i++)
+        packTable[i] = (encodeCodes[i >> 4] << 5) | encodeCodes[i & 0x0f];
 }
 
+void static inline packLineForCpuEncoder() { //One line of encodeInput to the encodeTarget, exactly like the encode SMs would
+    const uint32_t start = systick_hw->cvr;
+    const uint32_t * input = encodeInput + packIndex;
+    uint8_t volatile * output = encodeTarget + JPEG_HEADER_SIZE + packIndex * 5;
+    for (uint i = 0; i < SCREEN_W / 8; i++) { //Eight pixels, 32bit of input to 40bit of output
+        const uint32_t v = input[i];
+        const uint32_t high = (packTable[v >> 24] << 10) | packTable[(v >> 16) & 0xff];
+        const uint32_t low = (packTable[(v >> 8) & 0xff] << 10) | packTable[v & 0xff];
+        output[0] = high >> 12;
+        output[1] = high >> 4;
+        output[2] = (high << 4) | (low >> 16);
+        output[3] = low >> 8;
+        output[4] = low;
+        output += 5;
+    }
+    packIndex += SCREEN_W / 8;
+    telemetry.encodeCycles += (start - systick_hw->cvr) & 0x00FFFFFF; //SysTick counts down
+    if (packIndex % ENCODE_WORDS_PER_SM == 0) {
+        encodersBusy &= ~(1u << (packIndex / ENCODE_WORDS_PER_SM - 1));
+        if (!encodersBusy) {
+            telemetry.packedFrames++;
+            finishEncoding(false);
+        }
+    }
+}
+#endif
+
 void setupJpegDMA() {
     encodeIndex = SCREEN_SIZE; //Reset transfer state to "end"
 
-    //dmaChannelToEncodeAA
-    dmaChannelToEncodeAA = dma_claim_unused_channel(true);
-    dmaConfigToEncodeAA = dma_channel_get_default_config(dmaChannelToEncodeAA);
-    channel_config_set_transfer_data_size(&dmaConfigToEncodeAA, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaConfigToEncodeAA, false);
-    channel_config_set_write_increment(&dmaConfigToEncodeAA, false);
-    channel_config_set_dreq(&dmaConfigToEncodeAA, pio_get_dreq(PREPARE_PIO, PREPARE_SM_A, false));
-
-    //dmaChannelToEncodeAB
-    dmaChannelToEncodeAB = dma_claim_unused_channel(true);
-    dmaConfigToEncodeAB = dma_channel_get_default_config(dmaChannelToEncodeAB);
-    channel_config_set_transfer_data_size(&dmaConfigToEncodeAB, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaConfigToEncodeAB, false);
-    channel_config_set_write_increment(&dmaConfigToEncodeAB, false);
-    channel_config_set_dreq(&dmaConfigToEncodeAB, pio_get_dreq(PREPARE_PIO, PREPARE_SM_A, false));
-
-    //Chaining AA <-> AB
-    channel_config_set_chain_to(&dmaConfigToEncodeAA, dmaChannelToEncodeAB);
-    channel_config_set_chain_to(&dmaConfigToEncodeAB, dmaChannelToEncodeAA);
-
-    //dmaChannelToEncodeBA
-    dmaChannelToEncodeBA = dma_claim_unused_channel(true);
-    dmaConfigToEncodeBA = dma_channel_get_default_config(dmaChannelToEncodeBA);
-    channel_config_set_transfer_data_size(&dmaConfigToEncodeBA, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaConfigToEncodeBA, false);
-    channel_config_set_write_increment(&dmaConfigToEncodeBA, false);
-    channel_config_set_dreq(&dmaConfigToEncodeBA, pio_get_dreq(PREPARE_PIO, PREPARE_SM_B, false));
-
-    //dmaChannelToEncodeBB
-    dmaChannelToEncodeBB = dma_claim_unused_channel(true);
-    dmaConfigToEncodeBB = dma_channel_get_default_config(dmaChannelToEncodeBB);
-    channel_config_set_transfer_data_size(&dmaConfigToEncodeBB, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaConfigToEncodeBB, false);
-    channel_config_set_write_increment(&dmaConfigToEncodeBB, false);
-    channel_config_set_dreq(&dmaConfigToEncodeBB, pio_get_dreq(PREPARE_PIO, PREPARE_SM_B, false));
-
-    //Chaining BA <-> BB
-    channel_config_set_chain_to(&dmaConfigToEncodeBA, dmaChannelToEncodeBB);
-    channel_config_set_chain_to(&dmaConfigToEncodeBB, dmaChannelToEncodeBA);
-
-    //dmaChannelFromEncode
-    dmaChannelFromEncode = dma_claim_unused_channel(true);
-    dmaConfigFromEncode = dma_channel_get_default_config(dmaChannelFromEncode);
-    channel_config_set_transfer_data_size(&dmaConfigFromEncode, DMA_SIZE_8);
-    channel_config_set_read_increment(&dmaConfigFromEncode, false);
-    channel_config_set_write_increment(&dmaConfigFromEncode, true);
-
-    //dmaChannelFromEncodeSource
-    dmaChannelFromEncodeSource = dma_claim_unused_channel(true);
-    dmaConfigFromEncodeSource = dma_channel_get_default_config(dmaChannelFromEncodeSource);
-    channel_config_set_transfer_data_size(&dmaConfigFromEncodeSource, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaConfigFromEncodeSource, true);
-    channel_config_set_write_increment(&dmaConfigFromEncodeSource, false);
-    dmaFromEncodeSourceAddresses[0] = &ENCODE_PIO->rxf[ENCODE_SM_AA];
-    dmaFromEncodeSourceAddresses[1] = &ENCODE_PIO->rxf[ENCODE_SM_AB];
-    dmaFromEncodeSourceAddresses[2] = &ENCODE_PIO->rxf[ENCODE_SM_BA];
-    dmaFromEncodeSourceAddresses[3] = &ENCODE_PIO->rxf[ENCODE_SM_BB];
-    dmaFromEncodeSourceAddresses[4] = 0; //Do not trigger again
-
-    //Chaining
-    channel_config_set_chain_to(&dmaConfigFromEncode, dmaChannelFromEncodeSource);
+    for (uint sm = 0; sm < ENCODE_SMS; sm++) {
+        //dmaChannelsToEncode: encodeInput to the SM whenever its input FIFO has space
+        dmaChannelsToEncode[sm] = dma_claim_unused_channel(true);
+        dmaConfigToEncode[sm] = dma_channel_get_default_config(dmaChannelsToEncode[sm]);
+        channel_config_set_transfer_data_size(&dmaConfigToEncode[sm], DMA_SIZE_32);
+        channel_config_set_read_increment(&dmaConfigToEncode[sm], true);
+        channel_config_set_write_increment(&dmaConfigToEncode[sm], false);
+        channel_config_set_dreq(&dmaConfigToEncode[sm], pio_get_dreq(ENCODE_PIO, sm, true));
+
+        //dmaChannelsFromEncode: Output of the SM to the encodeBuffer whenever there is a byte in its output FIFO
+        dmaChannelsFromEncode[sm] = dma_claim_unused_channel(true);
+        dmaConfigFromEncode[sm] = dma_channel_get_default_config(dmaChannelsFromEncode[sm]);
+        channel_config_set_transfer_data_size(&dmaConfigFromEncode[sm], DMA_SIZE_8);
+        channel_config_set_read_increment(&dmaConfigFromEncode[sm], false);
+        channel_config_set_write_increment(&dmaConfigFromEncode[sm], true);
+        channel_config_set_dreq(&dmaConfigFromEncode[sm], pio_get_dreq(ENCODE_PIO, sm, false));
+        dma_channel_set_irq0_enabled(dmaChannelsFromEncode[sm], true);
+    }
+
+    irq_set_exclusive_handler(ENCODE_DMA_IRQ, encodeDMAHandler);
+    irq_set_enabled(ENCODE_DMA_IRQ, true);
+}
 
+void setupNativeHuffmanTables() {
+    uint i = 2; //Segments after SOI
+    while (i < JPEG_NATIVE_HEADER_SIZE) {
+        const uint8_t * segment = base_jpeg_native + i;
+        if (segment[1] == 0xc4 && (segment[4] & 0x0f) == 0) { //DHT of destination 0, the tables of the luminance
+            const bool ac = segment[4] & 0x10;
+            const uint8_t * values = segment + 5 + 16;
+            uint code = 0;
+            for (uint length = 1; length <= 16; length++) {
+                for (uint n = segment[4 + length]; n > 0; n--) {
+                    (ac ? nativeACCodes : nativeDCCodes)[*values] = code++;
+                    (ac ? nativeACLengths : nativeDCLengths)[*values] = length;
+                    values++;
+                }
+                code <<= 1;
+            }
+        }
+        i += 2 + ((segment[2] << 8) | segment[3]);
+    }
+}
+
+void prepareBlankFrame() {
+    memset((uint8_t *)backBuffer, DIRECT_PIXEL_PAIR(0x03), SCREEN_BYTES);
+    startBackbufferToJPEG(false);
+    while (!readyBufferIsNew)
+        continueBackbufferToJPEG();
+    readyBufferIsNew = false;
+    memcpy(blankLines[0], (uint8_t *)readyBuffer + JPEG_HEADER_SIZE, JPEG_LINE_SIZE);
+    memcpy(blankLines[1], (uint8_t *)readyBuffer + JPEG_HEADER_SIZE + JPEG_LINE_SIZE, JPEG_LINE_SIZE);
 }
 
 void prepareJpegEncoding() {
+    systick_hw->rvr = 0x00FFFFFF; //Free running at the system clock to measure the encoding on core0, core1 has its own SysTick
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;
+    setupBlendTables();
+    #ifdef CPU_JPEG_ENCODER
+    setupCPUEncoder();
+    #else
     setupJpegPIO();
     setupJpegDMA();
+    #endif
+    setupNativeHuffmanTables();
+    prepareBlankFrame();
 }
 
-void inline startBackbufferToJPEG(bool allowFrameBlend) {
-    backIterator = (uint32_t *) (backBuffer);
-    if (frameBlending && allowFrameBlend)
-        lastIterator = (uint32_t *) (lastBuffer);
-    else
-        lastIterator = backIterator; //If frame blending is disabled, we simply blend the newest frame with itself.
+void static stopEncoder() { //Aborts a frame in progress without marking the readyBuffer as new
+    encodersBusy = 0;
+    #ifdef CPU_JPEG_ENCODER
+    packIndex = 0;
+    packLimit = 0;
+    #else
+    for (uint sm = 0; sm < ENCODE_SMS; sm++) {
+        //An aborted channel may still raise its completion interrupt (RP2040-E13)
+        dma_channel_set_irq0_enabled(dmaChannelsFromEncode[sm], false);
+        dma_channel_abort(dmaChannelsToEncode[sm]);
+        dma_channel_abort(dmaChannelsFromEncode[sm]);
+        dma_channel_acknowledge_irq0(dmaChannelsFromEncode[sm]);
+        dma_channel_set_irq0_enabled(dmaChannelsFromEncode[sm], true);
+    }
+    #endif
+}
+
+void static inline startEncoder(uint sm) { //The quarter of the frame for this SM has been prepared
+    #ifdef CPU_JPEG_ENCODER
+    packLimit = (sm + 1) * ENCODE_WORDS_PER_SM; //Quarters are always started in order, packLineForCpuEncoder does the rest
+    #else
+    dma_channel_configure(dmaChannelsFromEncode[sm], &dmaConfigFromEncode[sm], encodeTarget + JPEG_HEADER_SIZE + sm * ENCODE_BYTES_PER_SM, &ENCODE_PIO->rxf[sm], ENCODE_BYTES_PER_SM, true);
+    dma_channel_configure(dmaChannelsToEncode[sm], &dmaConfigToEncode[sm], &ENCODE_PIO->txf[sm], encodeInput + sm * ENCODE_WORDS_PER_SM, ENCODE_WORDS_PER_SM, true);
+    #endif
+}
+
+void static inline startPendingEncoders() {
+    for (uint sm = 0; pendingEncoders; sm++) {
+        if (pendingEncoders & (1u << sm)) {
+            pendingEncoders &= ~(1u << sm);
+            startEncoder(sm);
+        }
+    }
+}
+
+void static finishStreamedFrame() { //Encodes the rest of a frame USB is already sending at once, it waits for it in usbMayRead()
+    if (!encodeStreamed || !encodersBusy)
+        return;
+    encodePipelined = false; //Only called once the PPU is done with this frame
+    while (encodersBusy)
+        continueBackbufferToJPEG();
+}
+
+//If pipelined, the backBuffer is the frame the PPU has just started to render and is blended with the history. Otherwise the complete backBuffer is encoded on its own, which is used for the fallback screens.
+void inline startBackbufferToJPEG(bool pipelined) {
+    if (encodeFormat == formatNV12 && encodeIndex < SCREEN_SIZE)
+        telemetry.droppedFrames++; //USB has been sending the rawFrame for too long
+    if (pipelined)
+        finishStreamedFrame(); //The PPU has rendered the last line of the frame in progress, which has not been swapped out yet
+    stopEncoder(); //Before looking at encodedFrame, which is updated by the DMA interrupt
+
+    if (blendMode != blendTablesMode) //Only changes between frames
+        setupBlendTables();
+    for (uint frame = 0; frame < FRAME_HISTORY; frame++) {
+        encodeFrames[frame] = (pipelined && frame > 0) ? frameHistory[frame - 1] : backBuffer; //Fallback screens are written directly to the backBuffer
+        historyIterator[frame] = encodeFrames[frame];
+    }
     animateOSD();
     osdIndex = osdPosition * SCREEN_W;
     encodeIndex = 0;
 
-    //Reset all PIOs and DMA channels to avoid starting in an unknown state if a frame has been aborted
+    reuseFrame = encodedFrame;
+    reuseLines = (encodedFrameValid && pipelined && blendMode == encodedBlendMode) ? (osdPosition < encodedOsdPosition ? osdPosition : encodedOsdPosition) : 0; //Fallback screens are written without tracking changes
+    encodedFrameValid = false; //We are about to overwrite encodeInput
+    encodeFrame = frameCount;
+    encodeOsdPosition = osdPosition;
+    encodeFormat = outputFormat;
+    encodeReusable = pipelined && encodeFormat == format8x; //Other formats do not use encodeInput
+    encodePipelined = pipelined;
+    encodeTarget = encodeFormat == formatNV12 ? rawFrame : encodeBuffer;
+    encodeStreamed = false;
+    encodeChanged = !encodeReusable || reuseLines < SCREEN_H; //Frames that cannot reuse every line are always encoded
+    pendingEncoders = 0;
+    encodersBusy = encodeFormat == format8x ? (1u << ENCODE_SMS) - 1 : 0; //Only marked as done when all quarters have been encoded. Other formats are never streamed: The size of native frames is not known in advance and raw frames are always sent from the same buffer.
+    encodeBlendMode = blendMode;
+
+    nativeBlock = NATIVE_BLOCKS_W;
+    nativeOutput = encodeTarget + JPEG_NATIVE_HEADER_SIZE; //The header is already in the buffer, see fillBufferWithNativeBaseJpeg
+    nativeOutputLimit = encodeTarget + JPEG_NATIVE_MAX_SIZE - JPEG_NATIVE_END_SIZE - JPEG_NATIVE_MAX_BLOCK_SIZE - 2; //Two more bytes for the padding of the last byte
+    nativeBits = 0;
+    nativeBitCount = 0;
+    nativePreviousDC = 0;
+    nativeFrameCycles = 0;
+
+    //Reset the SMs to avoid starting in an unknown state if a frame has been aborted
+    #ifndef CPU_JPEG_ENCODER
+    for (uint sm = 0; sm < ENCODE_SMS; sm++) {
+        pio_sm_set_enabled(ENCODE_PIO, sm, false);
+        pio_sm_clear_fifos(ENCODE_PIO, sm);
+        pio_sm_restart(ENCODE_PIO, sm);
+        pio_sm_exec(ENCODE_PIO, sm, pio_encode_jmp(encodeProgramOffset));
+        pio_sm_set_enabled(ENCODE_PIO, sm, true);
+    }
+    #endif
 
-    pio_sm_clear_fifos(PREPARE_PIO, PREPARE_SM_A);
-    pio_sm_restart(PREPARE_PIO, PREPARE_SM_A);
-    pio_sm_clear_fifos(PREPARE_PIO, PREPARE_SM_B);
-    pio_sm_restart(PREPARE_PIO, PREPARE_SM_B);
-    pio_sm_clear_fifos(ENCODE_PIO, ENCODE_SM_AA);
-    pio_sm_restart(ENCODE_PIO, ENCODE_SM_AA);
-    pio_sm_clear_fifos(ENCODE_PIO, ENCODE_SM_AB);
-    pio_sm_restart(ENCODE_PIO, ENCODE_SM_AB);
-    pio_sm_clear_fifos(ENCODE_PIO, ENCODE_SM_BA);
-    pio_sm_restart(ENCODE_PIO, ENCODE_SM_BA);
-    pio_sm_clear_fifos(ENCODE_PIO, ENCODE_SM_BB);
-    pio_sm_restart(ENCODE_PIO, ENCODE_SM_BB);
+    jpegPreviousDC = 3; //We map all colors to -3, -2, -1, 0, +1, +2, +3. Thanks to the differential encoding, we can keep using unsigned integers [0..6] and only need to make sure that the first value is encoded correctly. To achieve this we initialize the "previous" DC value to the new equivalent to zero, which in this case is 3 in the middle of [0..6]
 
-    ENCODE_PIO->fdebug = 0xffffffff; //Clear encode debug register (no need to be specific - all SMs are working on encoding)
+}
 
-    dma_channel_configure(dmaChannelToEncodeAB, &dmaConfigToEncodeAB, &ENCODE_PIO->txf[ENCODE_SM_AB], &PREPARE_PIO->rxf[PREPARE_SM_A], 1, false);
-    dma_channel_configure(dmaChannelToEncodeAA, &dmaConfigToEncodeAA, &ENCODE_PIO->txf[ENCODE_SM_AA], &PREPARE_PIO->rxf[PREPARE_SM_A], 1, true);
+uint32_t static inline prepareEncodeInput() { //Eight pixels as 4bit values for an encode SM
+    //Take care when looking at the following calculations: We expand four packed pixels (two bytes) to a 32bit integer for performance reasons. But since the rp2040 is little-endian, they are represented in reverse byte order here.
 
-    dma_channel_configure(dmaChannelToEncodeBB, &dmaConfigToEncodeBB, &ENCODE_PIO->txf[ENCODE_SM_BB], &PREPARE_PIO->rxf[PREPARE_SM_B], 1, false);
-    dma_channel_configure(dmaChannelToEncodeBA, &dmaConfigToEncodeBA, &ENCODE_PIO->txf[ENCODE_SM_BA], &PREPARE_PIO->rxf[PREPARE_SM_B], 1, true);
+    uint32_t input = 0;
+    for (uint i = 0; i < 2; i++) {
+        uint32_t v = blendPixels(i); //Map colors indices of -3, -1, +1, +3 and blends can reach -3, -2, -1, 0, +1, +2, +3
+        uint32_t d = (v | 0x08080808) - (v << 8) - jpegPreviousDC; //Differences plus eight, so no byte can borrow from the next one
+        jpegPreviousDC = v >> 24;
+        d -= 0x01010101 - ((d >> 3) & 0x01010101); //Subtract one from the negative differences, see jpeg_encoding.pio
+        input = (input << 16) | ((d << 12) & 0xf000) | (d & 0x0f00) | ((d >> 12) & 0x00f0) | (d >> 24); //First pixel to the most significant bits
+    }
+    for (uint frame = 0; frame < FRAME_HISTORY; frame++)
+        historyIterator[frame] += 4;
+    return input;
+}
 
-    dma_channel_configure(dmaChannelFromEncode, &dmaConfigFromEncode, readyBuffer + JPEG_HEADER_SIZE, NULL, 5, false); //Source will be set later by dmaChannelFromEncodeSource
-    dma_channel_configure(dmaChannelFromEncodeSource, &dmaConfigFromEncodeSource, &dma_hw->ch[dmaChannelFromEncode].al3_read_addr_trig, &dmaFromEncodeSourceAddresses[0], 1, false);
+void static inline advanceEncodeIndex(uint pixels) {
+    encodeIndex += pixels;
+    if (encodeIndex == osdIndex) {
+        for (uint frame = 0; frame < FRAME_HISTORY; frame++)
+            historyIterator[frame] = osdBuffer;
+    }
+}
 
-    jpegPreviousDC = 3; //We map all colors to -3, -2, -1, 0, +1, +2, +3. Thanks to the differential encoding, we can keep using unsigned integers [0..6] and only need to make sure that the first value is encoded correctly. To achieve this we initialize the "previous" DC value to the new equivalent to zero, which in this case is 3 in the middle of [0..6]
+bool static inline lineCanBeReused(uint line) {
+    //encodeInput blends the frames up to reuseFrame, so the line must not have changed since the oldest of them. The same goes for the line above as the first pixel is encoded relative to its last one.
+    return line < reuseLines && (int)(reuseFrame - lineChangedFrame[line]) >= FRAME_HISTORY - 1 && (line == 0 || (int)(reuseFrame - lineChangedFrame[line - 1]) >= FRAME_HISTORY - 1);
+}
 
+//Integer forward DCT after Loeffler, Ligtenberg and Moschytz as in jfdctint.c of the IJG. Rows first, then columns, the results are scaled up by 8.
+#define DCT_CONST_BITS 13
+#define DCT_PASS1_BITS 2
+#define DCT_DESCALE(x, n) (((x) + (1 << ((n) - 1))) >> (n))
+#define FIX_0_298631336 2446
+#define FIX_0_390180644 3196
+#define FIX_0_541196100 4433
+#define FIX_0_765366865 6270
+#define FIX_0_899976223 7373
+#define FIX_1_175875602 9633
+#define FIX_1_501321110 12299
+#define FIX_1_847759065 15137
+#define FIX_1_961570560 16069
+#define FIX_2_053119869 16819
+#define FIX_2_562915447 20995
+#define FIX_3_072711026 25172
+
+void static inline fdctPass(int * d, uint stride, bool columns) {
+    const int tmp0 = d[0] + d[7 * stride], tmp7 = d[0] - d[7 * stride];
+    const int tmp1 = d[stride] + d[6 * stride], tmp6 = d[stride] - d[6 * stride];
+    const int tmp2 = d[2 * stride] + d[5 * stride], tmp5 = d[2 * stride] - d[5 * stride];
+    const int tmp3 = d[3 * stride] + d[4 * stride], tmp4 = d[3 * stride] - d[4 * stride];
+
+    //Even part
+    const int tmp10 = tmp0 + tmp3, tmp13 = tmp0 - tmp3;
+    const int tmp11 = tmp1 + tmp2, tmp12 = tmp1 - tmp2;
+    const uint shift = columns ? DCT_CONST_BITS + DCT_PASS1_BITS : DCT_CONST_BITS - DCT_PASS1_BITS;
+    d[0] = columns ? DCT_DESCALE(tmp10 + tmp11, DCT_PASS1_BITS) : (tmp10 + tmp11) << DCT_PASS1_BITS;
+    d[4 * stride] = columns ? DCT_DESCALE(tmp10 - tmp11, DCT_PASS1_BITS) : (tmp10 - tmp11) << DCT_PASS1_BITS;
+    const int z = (tmp12 + tmp13) * FIX_0_541196100;
+    d[2 * stride] = DCT_DESCALE(z + tmp13 * FIX_0_765366865, shift);
+    d[6 * stride] = DCT_DESCALE(z - tmp12 * FIX_1_847759065, shift);
+
+    //Odd part
+    const int z5 = (tmp4 + tmp5 + tmp6 + tmp7) * FIX_1_175875602;
+    const int z1 = -(tmp4 + tmp7) * FIX_0_899976223;
+    const int z2 = -(tmp5 + tmp6) * FIX_2_562915447;
+    const int z3 = z5 - (tmp4 + tmp6) * FIX_1_961570560;
+    const int z4 = z5 - (tmp5 + tmp7) * FIX_0_390180644;
+    d[7 * stride] = DCT_DESCALE(tmp4 * FIX_0_298631336 + z1 + z3, shift);
+    d[5 * stride] = DCT_DESCALE(tmp5 * FIX_2_053119869 + z2 + z4, shift);
+    d[3 * stride] = DCT_DESCALE(tmp6 * FIX_3_072711026 + z2 + z3, shift);
+    d[stride] = DCT_DESCALE(tmp7 * FIX_1_501321110 + z1 + z4, shift);
 }
 
-void inline pushPixelsToJpegPIO(int sm) {
-    //Take care when looking at the following calculations: We read the sequential data as 32bit integer for performance reasons. But since the rp2040 is little-endian, they are represented in reverse byte order here.
+int static inline quantizeNative(int value) { //Rounds to the nearest multiple of the quantization (times 8 for the scaling of the DCT)
+    const int divisor = 8 * JPEG_NATIVE_QUANTIZATION;
+    return value >= 0 ? (value + divisor / 2) / divisor : -((divisor / 2 - value) / divisor);
+}
 
-    uint32_t v = *backIterator + *lastIterator; //Map colors indices of -3, -1, +1, +3 and blends can reach -3, -2, -1, 0, +1, +2, +3
-    PREPARE_PIO->txf[sm] = (v | 0x08080808) - (v << 8) - jpegPreviousDC;
-    jpegPreviousDC = v >> 24;
-    backIterator++;
-    lastIterator++;
+void static inline putNativeBits(uint32_t bits, uint count) { //At most 16 bits at once
+    nativeBits = (nativeBits << count) | bits;
+    nativeBitCount += count;
+    while (nativeBitCount >= 8) {
+        nativeBitCount -= 8;
+        const uint8_t byte = nativeBits >> nativeBitCount;
+        *(nativeOutput++) = byte;
+        if (byte == 0xff)
+            *(nativeOutput++) = 0x00; //Byte stuffing, so the decoder does not mistake it for a marker
+    }
 }
 
-void inline continueBackbufferToJPEG() {
-    ENCODE_PIO->fdebug = 0xffffffff; //Clear encode debug register (no need to be specific - all SMs are working on encoding)
-    if ((ENCODE_PIO->fdebug & ENCODE_OUT_STALL_MASK) == ENCODE_OUT_STALL_MASK) {
-        //Data from last pixel push needs to be written to the ready buffer
-        dma_hw->ch[dmaChannelFromEncodeSource].al3_read_addr_trig = (uint32_t)&dmaFromEncodeSourceAddresses[0];    //Restart DMA
-        if (encodeIndex == SCREEN_SIZE) {
-            //This was the last data set.
-            readyBufferIsNew = true; //Note: At this point the we have written our pixels to the jpegPIO, but they may still be processed and pushed through DMA. However, this should be extremely fast and even if USB would start transferring the frame before DMA has compelte (which I highly doubt even happens), there is no way the transfer reaches the last bytes before DMA completes, so there is no reason to stall here.
+void static inline putNativeValue(int value, uint category) { //Huffman code for the category followed by the value itself, negative values in one's complement
+    putNativeBits((value < 0 ? value - 1 : value) & ((1u << category) - 1), category);
+}
+
+uint static inline nativeCategory(int value) { //Number of bits of the absolute value
+    return value ? 32 - __builtin_clz(value < 0 ? -value : value) : 0;
+}
+
+void static encodeNativeBlock(uint block) {
+    int coefficients[64];
+    const uint8_t * pixels = (uint8_t *)nativeLines + block * 8;
+    bool flat = true;
+    for (uint i = 0; i < 64; i++) {
+        coefficients[i] = (pixels[(i / 8) * SCREEN_W + i % 8] << 5) - 96; //Blends [0..6] to the same brightness as in the 8x frames
+        flat &= coefficients[i] == coefficients[0];
+    }
+    int dc;
+    if (flat) //Backgrounds are often a single shade, so we can skip the DCT
+        dc = quantizeNative(coefficients[0] * 64);
+    else {
+        for (uint i = 0; i < 64; i += 8)
+            fdctPass(coefficients + i, 1, false);
+        for (uint i = 0; i < 8; i++)
+            fdctPass(coefficients + i, 8, true);
+        dc = quantizeNative(coefficients[0]);
+    }
+
+    uint category = nativeCategory(dc - nativePreviousDC);
+    putNativeBits(nativeDCCodes[category], nativeDCLengths[category]);
+    putNativeValue(dc - nativePreviousDC, category);
+    nativePreviousDC = dc;
+
+    uint run = 0;
+    if (!flat && nativeOutput < nativeOutputLimit) {
+        for (uint i = 1; i < 64; i++) {
+            const int value = quantizeNative(coefficients[zigzag[i]]);
+            if (value == 0) {
+                run++;
+                continue;
+            }
+            for (; run >= 16; run -= 16)
+                putNativeBits(nativeACCodes[0xf0], nativeACLengths[0xf0]); //Sixteen zeros
+            category = nativeCategory(value);
+            putNativeBits(nativeACCodes[(run << 4) | category], nativeACLengths[(run << 4) | category]);
+            putNativeValue(value, category);
+            run = 0;
         }
+    } else
+        run = 63;
+    if (run)
+        putNativeBits(nativeACCodes[0x00], nativeACLengths[0x00]); //End of block
+}
+
+void static finishNativeFrame() {
+    if (nativeBitCount)
+        putNativeBits((1u << (8 - nativeBitCount)) - 1, 8 - nativeBitCount); //Pad the last byte with ones
+    memcpy((uint8_t *)nativeOutput, base_jpeg_native + JPEG_NATIVE_HEADER_SIZE + JPEG_NATIVE_BASE_DATA_SIZE, JPEG_NATIVE_END_SIZE);
+    nativeOutput[JPEG_CHROMA_SOS_SIZE] = chromaDC;
+    const uint length = nativeOutput + JPEG_NATIVE_END_SIZE - encodeTarget;
+    encodeTarget[FRAME_SIZE - 2] = (uint8_t)(length & 0xff);
+    encodeTarget[FRAME_SIZE - 1] = (uint8_t)(length >> 8);
+    telemetryNativeFrame(nativeFrameCycles);
+    finishEncoding(false);
+}
+
+void static inline countNativeCycles(uint32_t start) {
+    nativeFrameCycles += (start - systick_hw->cvr) & 0x00FFFFFF; //SysTick counts down
+}
+
+void static inline continueNativeJPEG() {
+    const uint32_t start = systick_hw->cvr;
+    if (nativeBlock < NATIVE_BLOCKS_W) {
+        encodeNativeBlock(nativeBlock++);
+        countNativeCycles(start);
+        if (nativeBlock == NATIVE_BLOCKS_W && encodeIndex == SCREEN_SIZE)
+            finishNativeFrame();
+        return;
+    }
+    if (encodeIndex == SCREEN_SIZE)
+        return; //Frame complete
+    const uint line = encodeIndex / SCREEN_W;
+    if (encodePipelined && (int)line >= y)
+        return; //The PPU has not finished this line yet
+    setupLineBlendTables(line);
+    for (uint i = 0; i < SCREEN_W / 4; i++)
+        nativeLines[line % 8][i] = blendPixels(i); //Leftmost pixel in the lowest byte, so the bytes are in the right order
+    for (uint frame = 0; frame < FRAME_HISTORY; frame++)
+        historyIterator[frame] += SCREEN_LINE_BYTES;
+    advanceEncodeIndex(SCREEN_W);
+    if (line % 8 == 7)
+        nativeBlock = 0; //A row of blocks is complete
+    countNativeCycles(start);
+}
+
+void static inline continueRawFrame() {
+    if (encodeIndex == SCREEN_SIZE)
+        return; //Frame complete
+    if (rawFrameSending)
+        return; //Writing now would mix two frames in the one USB is sending
+    const uint line = encodeIndex / SCREEN_W;
+    if (encodePipelined && (int)line >= y)
+        return; //The PPU has not finished this line yet
+    setupLineBlendTables(line);
+    uint32_t * target = (uint32_t *)rawFrame + encodeIndex / 4;
+    for (uint i = 0; i < SCREEN_W / 4; i++)
+        target[i] = blendPixels(i) * RAW_Y_STEP + RAW_Y_BLACK * 0x01010101; //Four pixels at once, no byte can overflow into the next one
+    for (uint frame = 0; frame < FRAME_HISTORY; frame++)
+        historyIterator[frame] += SCREEN_LINE_BYTES;
+    advanceEncodeIndex(SCREEN_W);
+    if (encodeIndex == SCREEN_SIZE)
+        finishEncoding(false);
+}
+
+void inline continueBackbufferToJPEG() {
+    if (encodeFormat == formatNative) {
+        continueNativeJPEG();
+        return;
+    }
+    if (encodeFormat == formatNV12) {
+        continueRawFrame();
+        return;
+    }
+    #ifdef CPU_JPEG_ENCODER
+    if (packIndex < packLimit) { //Packing comes first, so the frame is done as soon as possible
+        packLineForCpuEncoder();
+        return;
     }
-    if (encodeIndex < SCREEN_SIZE && (ENCODE_PIO->fstat & ENCODE_IN_EMPTY_MASK) == ENCODE_IN_EMPTY_MASK) {
-        pushPixelsToJpegPIO(PREPARE_SM_A);
-        pushPixelsToJpegPIO(PREPARE_SM_A);
-        pushPixelsToJpegPIO(PREPARE_SM_A);
-        pushPixelsToJpegPIO(PREPARE_SM_A);
-        pushPixelsToJpegPIO(PREPARE_SM_B);
-        pushPixelsToJpegPIO(PREPARE_SM_B);
-        pushPixelsToJpegPIO(PREPARE_SM_B);
-        pushPixelsToJpegPIO(PREPARE_SM_B);
-        encodeIndex += 8*4; //Bytes
-        if (encodeIndex == osdIndex) {
-            backIterator = (uint32_t *)osdBuffer;
-            lastIterator = (uint32_t *)osdBuffer;
+    #endif
+    if (encodeIndex == SCREEN_SIZE)
+        return; //Everything has been handed to the encoder
+    const uint line = encodeIndex / SCREEN_W;
+    if (encodePipelined && (int)line >= y)
+        return; //The PPU has not finished this line yet
+    setupLineBlendTables(line);
+    if (lineCanBeReused(line)) {
+        for (uint frame = 0; frame < FRAME_HISTORY; frame++)
+            historyIterator[frame] += SCREEN_LINE_BYTES;
+        jpegPreviousDC = blendPixels(-1) >> 24; //For the first pixel of the next line
+    } else {
+        uint32_t * input = encodeInput + encodeIndex / 8;
+        for (uint i = 0; i < SCREEN_W / 8; i++)
+            input[i] = prepareEncodeInput();
+        encodeChanged = true;
+        startPendingEncoders();
+    }
+    advanceEncodeIndex(SCREEN_W);
+    if (encodeIndex % (SCREEN_SIZE / ENCODE_SMS) == 0) {
+        pendingEncoders |= 1u << (encodeIndex / (SCREEN_SIZE / ENCODE_SMS) - 1);
+        if (encodeChanged)
+            startPendingEncoders();
+        else if (encodeIndex == SCREEN_SIZE) { //Same frame as before
+            encodersBusy = 0;
+            finishEncoding(true);
         }
     }
 }
 
+void fillBufferWithNativeBaseJpeg(uint8_t volatile * target) { //The base JPEG of the native resolution is a white frame
+    memcpy((uint8_t *)target, base_jpeg_native, sizeof(base_jpeg_native));
+    target[JPEG_NATIVE_HEADER_SIZE + JPEG_NATIVE_BASE_DATA_SIZE + JPEG_CHROMA_SOS_SIZE] = chromaDC;
+    const uint length = sizeof(base_jpeg_native);
+    target[FRAME_SIZE - 2] = (uint8_t)(length & 0xff);
+    target[FRAME_SIZE - 1] = (uint8_t)(length >> 8);
+}
+
+void fillRawChroma() { //The constant plane of the raw frame, the encoder only writes the luminance
+    memset(rawFrame + SCREEN_SIZE, chromaDC ? RAW_CHROMA_DMG_GREEN : RAW_CHROMA_NEUTRAL, RAW_FRAME_SIZE - SCREEN_SIZE);
+}
+
+void showBlankFrame() { //Replaces any frame in progress with the blank frame without running the encoder
+    finishStreamedFrame(); //The PPU has blanked the lines it is not going to render, see turnLcdOff
+    stopEncoder();
+    encodeIndex = SCREEN_SIZE;
+    nativeBlock = NATIVE_BLOCKS_W;
+    encodedFrameValid = false; //The blank frame is not in the history, so its lines cannot be reused
+    uint8_t volatile * frame = encodeBuffer;
+    if (outputFormat == formatNative)
+        fillBufferWithNativeBaseJpeg(frame);
+    else if (outputFormat == formatNV12) {
+        frame = rawFrame;
+        memset(rawFrame, RAW_Y_BLACK + 6 * RAW_Y_STEP, SCREEN_SIZE);
+    } else {
+        uint8_t * data = (uint8_t *)frame + JPEG_HEADER_SIZE;
+        memcpy(data, blankLines[0], JPEG_LINE_SIZE);
+        for (uint line = 1; line < SCREEN_H; line++)
+            memcpy(data + line * JPEG_LINE_SIZE, blankLines[1], JPEG_LINE_SIZE);
+    }
+    publishFrame(frame);
+}
+
+void setOutputFormat(enum OutputFormat format) { //Drops the frame in progress, the buffers have to be filled with the matching base frame afterwards
+    if (format == outputFormat)
+        return;
+    stopEncoder();
+    encodeIndex = SCREEN_SIZE;
+    nativeBlock = NATIVE_BLOCKS_W;
+    encodedFrameValid = false;
+    readyBufferIsNew = false;
+    outputFormat = format;
+}
+
+void setChromaDC(uint8_t dc) { //Also changes the frames that are already waiting to be sent
+    chromaDC = dc;
+    if (outputFormat == formatNV12)
+        fillRawChroma();
+    else if (outputFormat == formatNative) {
+        //The chroma scan follows the data of the frame. The encodeBuffer gets the new value when the frame is complete.
+        frontBuffer[JPEG_NATIVE_LENGTH(frontBuffer) - JPEG_NATIVE_END_SIZE + JPEG_CHROMA_SOS_SIZE] = dc;
+        readyBuffer[JPEG_NATIVE_LENGTH(readyBuffer) - JPEG_NATIVE_END_SIZE + JPEG_CHROMA_SOS_SIZE] = dc;
+    } else {
+        frontBuffer[JPEG_CHROMA_OFFSET] = dc;
+        readyBuffer[JPEG_CHROMA_OFFSET] = dc;
+        encodeBuffer[JPEG_CHROMA_OFFSET] = dc;
+    }
+}
+
+bool startStreaming() { //True if USB may start sending the encodeBuffer before it is complete
+    if (streamingPause || !encodePipelined || encodeStreamed || encodersBusy == 0 || (encodersBusy & STREAM_START_QUARTERS))
+        return false;
+    streamedFrameComplete = false;
+    encodeStreamed = true; //Called with interrupts disabled, so the encoder cannot complete the frame in the meantime
+    streamStart = time_us_64();
+    streamStalled = false;
+    return true;
+}
+
+bool usbMayRead(uint payloadSize) { //False while tud_task() might let USB read beyond the encoded part of the frame it is streaming
+    if (!encodeStreamed || !encodersBusy)
+        return true;
+    uint encoded = JPEG_HEADER_SIZE;
+    for (uint sm = 0; sm < ENCODE_SMS && !(encodersBusy & (1u << sm)); sm++)
+        encoded += ENCODE_BYTES_PER_SM;
+    //One more payload in case the one on the wire completes while tud_task() is running. Reading a third one would need tud_task() to run for a whole payload (1.7ms for 2kB).
+    const uint64_t sent = (time_us_64() - streamStart) * USB_MAX_BYTES_PER_MS / 1000;
+    if (sent + 2 * payloadSize <= encoded)
+        return true;
+    if (!streamStalled) {
+        streamStalled = true;
+        telemetry.stalledFrames++;
+    }
+    return false;
+}
+
+void streamingFinished() { //USB has sent a frame
+    if (!streamedFrameComplete) { //The frame was aborted while USB was sending it
+        streamingPause = STREAM_RETRY_FRAMES;
+        telemetry.overtakenFrames++;
+    } else if (streamingPause)
+        streamingPause--;
+    streamedFrameComplete = true;
+}
+
+void setRawFrameSending(bool sending) { //USB started or stopped reading the rawFrame
+    rawFrameSending = sending;
+}
+
+void resetStreaming() {
+    streamingPause = 0;
+}
@@ -3,19 +3,45 @@
 
 #include "pico/stdlib.h"
 #include "ppu.h"
+#include "jpeg/base_jpeg_layout.h" //Sizes and offsets of the base JPEGs, generated at build time by generateBaseJpeg.py
 
 #define JPEG_DATA_SIZE (SCREEN_SIZE * 5 / 8) //5bit per pixel, see https://github.com/Staacks/gbinterceptor/issues/17
-#define JPEG_HEADER_SIZE 188
-#define JPEG_HEADER_SIZE_NO_CHROMA 160
-#define JPEG_END_SIZE 2895
-#define JPEG_END_SIZE_NO_CHROMA 2
+#define JPEG_LINE_SIZE (SCREEN_W * 5 / 8) //Every line starts at a byte boundary
+//JPEG_END_SIZE covers the SOS of the chroma scan, the chroma data and EOI. With the default 4x2 sampling, the full frame needs 963kB/s at 60fps, 79% of what USB full speed can move at most (1216kB/s)
 #define FRAME_SIZE (JPEG_DATA_SIZE + JPEG_HEADER_SIZE + JPEG_END_SIZE)
-#define FRAME_SIZE_NO_CHROMA (JPEG_DATA_SIZE + JPEG_HEADER_SIZE_NO_CHROMA + JPEG_END_SIZE_NO_CHROMA)
 
-#define JPEG_CHROMA_OFFSET (JPEG_HEADER_SIZE + JPEG_DATA_SIZE + 12)
+#define JPEG_CHROMA_OFFSET (JPEG_HEADER_SIZE + JPEG_DATA_SIZE + JPEG_CHROMA_SOS_SIZE) //JPEG_CHROMA_DMG_GREEN replaces the first byte of the chroma scan for the green DMG color mode
+
+//Native resolution: Every 8x8 block of Game Boy pixels is a real JPEG block, encoded by the CPU with a variable size (see base_jpeg_native.h)
+#define JPEG_NATIVE_MAX_SIZE (FRAME_SIZE - 2) //Native frames are shorter than the buffers and store their length in the last two bytes
+#define JPEG_NATIVE_LENGTH(buffer) ((buffer)[FRAME_SIZE - 2] | ((buffer)[FRAME_SIZE - 1] << 8))
+
+//Uncompressed NV12 at native resolution: One byte of luminance per pixel followed by a plane of chrominance at a quarter of the resolution, which is the same for all pixels.
+//34560 bytes at 30fps need 1037kB/s, so unlike YUY2 (46080 bytes, 1382kB/s) it fits USB full speed. The frame does not fit any of our JPEG buffers, so it takes their place.
+#define RAW_FRAME_SIZE (SCREEN_SIZE * 3 / 2)
+#define RAW_Y_BLACK 44 //Limited range luminance of the darkest shade, the same brightness as in the JPEG frames
+#define RAW_Y_STEP 27  //Luminance per step of the blended shades [0..6]
+#define RAW_CHROMA_NEUTRAL 128 //RAW_CHROMA_DMG_GREEN is generated from the DC of the green DMG color mode, so both formats show the same green
+
+enum OutputFormat {format8x = 0, formatNative, formatNV12};
+extern enum OutputFormat outputFormat;
+
+enum BlendMode {blendOff = 0, blendTwoFrames, blendThreeFrames, blendPersistence};
+#define BLEND_MODES 4
+extern enum BlendMode blendMode;
 
 void prepareJpegEncoding();
-void startBackbufferToJPEG(bool allowFrameBlend);
+void setOutputFormat(enum OutputFormat format);
+void setChromaDC(uint8_t dc);
+void fillBufferWithNativeBaseJpeg(uint8_t volatile * target);
+void fillRawChroma();
+void startBackbufferToJPEG(bool pipelined);
 void continueBackbufferToJPEG();
+void showBlankFrame();
+bool startStreaming();
+bool usbMayRead(uint payloadSize);
+void streamingFinished();
+void resetStreaming();
+void setRawFrameSending(bool sending);
 
 #endif
\ No newline at end of file
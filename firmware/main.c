@@ -10,35 +10,37 @@
 #include "tusb.h"
 #include "usb_descriptors.h"
 #include "hardware/clocks.h"
-#include "hardware/dma.h"
 
 #include "cpubus.h"
+#include "checkpoint.h"
 #include "ppu.h"
 #include "osd.h"
 #include "debug.h"
+#include "telemetry.h"
 #include "gamedb/game_detection.h"
 
 #include "jpeg/base_jpeg.h"
-#include "jpeg/base_jpeg_no_chroma.h"
 
 #include "screens/default.h"
 #include "screens/off.h"
 #include "screens/error.h"
 
 bool frameSending = false;
+bool frameSwapped = false; //A new frame has been handed to USB since the last vblank
 
 bool modeButtonDebounce = true;
 
 uint fallbackFrameIndex = 0;
 enum FallbackScreenType {FST_NONE = 0, FST_DEFAULT, FST_OFF, FST_ERROR} fallbackScreenType = FST_NONE;  
 
-int dmaChannel;
-dma_channel_config dmaConfig;
 
 bool dmgColorMode = false;
 
-bool includeChroma = true;
-bool is30fpsFrame = true;
+uint frameRateDivider = 2; //Derived from the frame interval the host asked for, 1 sends every frame at 60fps, 2 every second one at 30fps and so on
+uint skippedFrames = 0;
+//Frames in which nothing has changed are not encoded again (see jpeg.c), so a static screen is not sent at all. Every now and then, we send the previous frame again, so the host does not consider the stream stalled.
+#define UNCHANGED_RESEND_FRAMES 30
+uint lastSentFrame = 0; //frameCount when a frame was last sent
 
 void setupGPIO() {
     gpio_init(GBSENSE_PIN);
@@ -59,19 +61,20 @@ void ledOff() {
     gpio_set_dir(LED_SWITCH_PIN, GPIO_IN);
 }
 
+const char * blendModeNames[BLEND_MODES] = {"Blending OFF", "Blending 2 frames", "Blending 3 frames", "LCD persistence"};
+
 void checkModeSwitch() {
     #ifndef BASE_VIDEO_MODE
     if (gpio_get(LED_SWITCH_PIN)) {
         if (!modeButtonDebounce) {
             modeButtonDebounce = true;
             //Button pressed, switch mode
-            frameBlending = !frameBlending;
-            if (frameBlending) {
+            blendMode = (blendMode + 1) % BLEND_MODES;
+            if (blendMode == blendTwoFrames) {
                 dmgColorMode = !dmgColorMode;
-                frontBuffer[JPEG_CHROMA_OFFSET] = dmgColorMode ? 0b10001000 : 0x00;
-                readyBuffer[JPEG_CHROMA_OFFSET] = dmgColorMode ? 0b10001000 : 0x00;
+                setChromaDC(dmgColorMode ? JPEG_CHROMA_DMG_GREEN : 0x00);
             }
-            renderOSD(frameBlending ? "Blending ON" : "Blending OFF", 0x03, 0x00, MODE_INFO_DURATION);
+            renderOSD(blendModeNames[blendMode], 0x03, 0x00, MODE_INFO_DURATION);
         }
     } else if (modeButtonDebounce) {
         modeButtonDebounce = false;
@@ -83,37 +86,55 @@ bool static inline isGameBoyOn() {
     return gpio_get(GBSENSE_PIN);
 }
 
-void setupDMA() {
-    dmaChannel = dma_claim_unused_channel(true);
-    dmaConfig = dma_channel_get_default_config(dmaChannel);
-    channel_config_set_read_increment(&dmaConfig, true);
-    channel_config_set_write_increment(&dmaConfig, true);
-}
-
 void loadFallbackScreen(uint8_t * screen, enum FallbackScreenType type) {
     osdPosition = SCREEN_H;
-    dma_channel_configure(dmaChannel, &dmaConfig, backBuffer, screen, SCREEN_SIZE / 4, true);
-    while (dma_channel_is_busy(dmaChannel)) {
-        tud_task();
+    //The screens are stored with 2 bit per pixel, each byte of four pixels becomes two bytes of direct pixels
+    for (uint i = 0; i < SCREEN_BYTES / 2; i++) {
+        backBuffer[2 * i] = DIRECT_PIXEL_PAIR(0) | ((screen[i] >> 2) & 0x30) | ((screen[i] >> 4) & 0x03);
+        backBuffer[2 * i + 1] = DIRECT_PIXEL_PAIR(0) | ((screen[i] << 2) & 0x30) | (screen[i] & 0x03);
     }
     fallbackScreenType = type;
     renderText(VERSION, 0x00, 0x03, (uint8_t *)backBuffer, SCREEN_W-(sizeof(VERSION)-1)*8, 1);
 }
 
+void sendFrontbuffer() {
+    lastSentFrame = frameCount;
+    frameSending = true;
+    if (outputFormat == formatNV12) {
+        setRawFrameSending(true);
+        tud_video_n_frame_xfer(0, 0, rawFrame, RAW_FRAME_SIZE);
+    }
+    else if (outputFormat == formatNative)
+        tud_video_n_frame_xfer(0, 0, (void*)frontBuffer, JPEG_NATIVE_LENGTH(frontBuffer));
+    else
+        tud_video_n_frame_xfer(0, 0, (void*)frontBuffer, FRAME_SIZE);
+}
+
 bool usbSendFrame() {
     if (tud_video_n_streaming(0, 0)) {
         if (!frameSending) {
-            if (swapFrontbuffer()) {
-                is30fpsFrame = !is30fpsFrame; //If clock is determined by the Game Boy and if we include Chroma, we only send every second frame (i.e. 30fps)
-                if (is30fpsFrame || !includeChroma || !running) {
-                    frameSending = true;
-                    tud_video_n_frame_xfer(0, 0, (void*)(frontBuffer + (includeChroma || !running ? 0 : JPEG_HEADER_SIZE - JPEG_HEADER_SIZE_NO_CHROMA)), includeChroma || !running ? FRAME_SIZE : FRAME_SIZE_NO_CHROMA);
+            const bool sendThisFrame = skippedFrames + 1 >= frameRateDivider; //If clock is determined by the Game Boy and if the host wants a lower frame rate, we only send every n-th frame
+            bool newFrame;
+            if (outputFormat == formatNV12) { //There is only one raw frame, so there is nothing to swap
+                newFrame = readyBufferIsNew;
+                readyBufferIsNew = false;
+            } else
+                newFrame = swapFrontbuffer(sendThisFrame); //Only stream frames we are going to send
+            if (newFrame) {
+                frameSwapped = true;
+                skippedFrames++;
+                if (sendThisFrame || !running) {
+                    skippedFrames = 0;
+                    sendFrontbuffer();
                 }
                 return true;
-            }
+            } else if (running && outputFormat == format8x && frameCount - lastSentFrame >= UNCHANGED_RESEND_FRAMES)
+                sendFrontbuffer(); //Still the last frame we have encoded
+
         }
     } else {
         frameSending = false;
+        setRawFrameSending(false);
     }
     return false;
 }
@@ -124,28 +145,33 @@ void updateFallbackScreen() {
         fallbackFrameIndex = 0;
     for (int x = 0; x < SCREEN_W/2; x++) {
         if (x < fallbackFrameIndex && x + 80 > fallbackFrameIndex) {
-            backBuffer[63*SCREEN_W + 80 + x] = 0x03;
-            backBuffer[63*SCREEN_W + 79 - x] = 0x03;
+            SET_PACKED_PIXEL(backBuffer, 80 + x, 63, 0x03)
+            SET_PACKED_PIXEL(backBuffer, 79 - x, 63, 0x03)
         } else {
-            backBuffer[63*SCREEN_W + 80 + x] = 0x00;
-            backBuffer[63*SCREEN_W + 79 - x] = 0x00;
+            SET_PACKED_PIXEL(backBuffer, 80 + x, 63, 0x00)
+            SET_PACKED_PIXEL(backBuffer, 79 - x, 63, 0x00)
         }
     }
 }
 
-void fillBufferWithBaseJpeg(uint8_t * target, bool includeChroma) {
-    int chromaOffset = (includeChroma ? 0 : JPEG_HEADER_SIZE - JPEG_HEADER_SIZE_NO_CHROMA);
-    int headerSize = (includeChroma ? JPEG_HEADER_SIZE : JPEG_HEADER_SIZE_NO_CHROMA);
-    for (int i = 0; i < headerSize; i++)
-        target[i + chromaOffset] = (includeChroma ? base_jpeg : base_jpeg_no_chroma)[i];
-    int fullSize = (includeChroma ? FRAME_SIZE : FRAME_SIZE_NO_CHROMA);
-    for (int i = JPEG_DATA_SIZE + headerSize; i < fullSize; i++)
-        target[i + chromaOffset] = (includeChroma ? base_jpeg : base_jpeg_no_chroma)[i];
+void fillBufferWithBaseJpeg(uint8_t * target) {
+    for (int i = 0; i < JPEG_HEADER_SIZE; i++)
+        target[i] = base_jpeg[i];
+    for (int i = JPEG_DATA_SIZE + JPEG_HEADER_SIZE; i < FRAME_SIZE; i++)
+        target[i] = base_jpeg[i];
 }
 
-void updateIncludeChroma() {
-    fillBufferWithBaseJpeg((uint8_t *)frontBuffer, includeChroma || !running);
-    fillBufferWithBaseJpeg((uint8_t *)readyBuffer, includeChroma || !running);
+void fillBaseFrames() {
+    if (outputFormat == formatNative) {
+        fillBufferWithNativeBaseJpeg(frontBuffer);
+        fillBufferWithNativeBaseJpeg(readyBuffer);
+        fillBufferWithNativeBaseJpeg(encodeBuffer);
+    } else if (outputFormat == format8x) { //The raw frame has no base, its color plane is set by setChromaDC
+        fillBufferWithBaseJpeg((uint8_t *)frontBuffer);
+        fillBufferWithBaseJpeg((uint8_t *)readyBuffer);
+        fillBufferWithBaseJpeg((uint8_t *)encodeBuffer);
+    }
+    setChromaDC(dmgColorMode ? JPEG_CHROMA_DMG_GREEN : 0x00);
     fallbackScreenType = FST_NONE;
 }
 
@@ -153,7 +179,6 @@ int main(void) {
     set_sys_clock_khz(250000, true);
 
     board_init();
-    setupDMA();
     setUniqueSerial();
     tud_init(BOARD_TUD_RHPORT);
     stdio_init_all();
@@ -165,14 +190,14 @@ int main(void) {
     while (1) {
 
         printf("Waiting for game.\n");
-        updateIncludeChroma();
+        fillBaseFrames();
         uint lastFrame = timer_hw->timerawl;
         while (!running) {
             if (isGameBoyOn()) {
                 if (fallbackScreenType == FST_NONE || fallbackScreenType == FST_OFF) {
                     loadFallbackScreen(default_raw, FST_DEFAULT);
                     renderText("Waiting for game...", 0x03, 0x00, (uint8_t *)backBuffer, 5, 79);
-                    if (!includeChroma)
+                    if (frameRateDivider == 1)
                         renderText("   60 fps mode.\nSwitch to 30fps if\nthere are problems.", 0x03, 0x00, (uint8_t *)backBuffer, 5, 100);
                     readyBufferIsNew = false;
                     startBackbufferToJPEG(false);
@@ -181,13 +206,13 @@ int main(void) {
                 if (fallbackScreenType == FST_NONE || fallbackScreenType == FST_DEFAULT || fallbackScreenType == FST_ERROR) {
                     loadFallbackScreen(off_raw, FST_OFF);
                     renderText("The Game Boy\nis turned off", 0x03, 0x00, (uint8_t *)backBuffer, 40, 79);
-                    if (!includeChroma)
+                    if (frameRateDivider == 1)
                         renderText("   60 fps mode.\nSwitch to 30fps if\nthere are problems.", 0x03, 0x00, (uint8_t *)backBuffer, 5, 100);
                     readyBufferIsNew = false;
                     startBackbufferToJPEG(false);
                 }
             }
-            if (readyBufferIsNew && (!includeChroma || ((uint)(timer_hw->timerawl - lastFrame) > 33333))) {
+            if (readyBufferIsNew && (frameRateDivider == 1 || ((uint)(timer_hw->timerawl - lastFrame) >= frameRateDivider * 16667))) {
                 if (usbSendFrame()) {
                     lastFrame = timer_hw->timerawl;
                     updateFallbackScreen();
@@ -200,11 +225,15 @@ int main(void) {
 
         ledOn();
         printf("Game started. Cycle ratio: %d\n", cycleRatio);
-        updateIncludeChroma();
+        fillBaseFrames();
         ppuInit();
+        resetTelemetry();
 
         uint lastCycle = cycleIndex;
+        uint lastResyncCount = resyncCount;
+        uint lastSoftResetCount = softResetCount;
         uint8_t vblank = false;
+        int frameCorrection = 0; //Sum of the vblankOffset corrections applied during this frame
         #ifdef DEBUG_PPU_TIMING
             uint lastPPUTimingRequest = timer_hw->timerawl;
         #endif
@@ -218,17 +247,25 @@ int main(void) {
                 #endif
             #else
                 uint steps = (uint)(cycleIndex - lastCycle);
-                lastCycle += steps;
+                if (doubleSpeed) { //The PPU does not care about the GBC's double speed, so it only advances every second CPU cycle. Any odd cycle is left for the next step.
+                    steps >>= 1;
+                    lastCycle += steps << 1;
+                } else
+                    lastCycle += steps;
+                telemetryStep(steps);
                 DEBUG_MARK_VBLANK_ADJUST
                 int adjust = vblankOffset; //We work with a copy as another thread may change this at any time
                 if (adjust >= 0) {
                     if (adjust > 10) //Limit the amount of catching up per step to avoid to unpleasant results
                         adjust = 10;
                     vblankOffset -= adjust; //Yes, there might be a race condition here, but if another thread has calculated a new value for vblank in the meantime, it used the old state of the PPU, so it still should be adjusted and if it wrote this value between reading and decrementing, then we still only make a mistake of a few cycles which we will eventually fix anyway
+                    ppuBusCycle = lastCycle;
                     ppuStep(steps + adjust);
+                    frameCorrection += adjust;
                 } else {
                     //else do not perform step to wait for the real Game Boy
                     vblankOffset += steps;
+                    frameCorrection -= steps;
                 }
 
                 #ifdef DEBUG_PPU_TIMING
@@ -249,6 +286,28 @@ int main(void) {
                             renderOSD(gameInfo.title, 0x00, 0x03, GAME_DETECTED_INFO_DURATION);
                         }
                     }
+                    if (resyncCount != lastResyncCount) {
+                        lastResyncCount = resyncCount;
+                        printf("Resynchronized after: %s\n", desyncReason);
+                    }
+                    if (softResetCount != lastSoftResetCount) {
+                        lastSoftResetCount = softResetCount;
+                        printf("Game has been reset.\n");
+                    }
+                    telemetryFrame(frameCorrection);
+                    frameCorrection = 0;
+                    if (!frameSwapped && tud_video_n_streaming(0, 0))
+                        telemetry.repeatedFrames++;
+                    frameSwapped = false;
+                    switch (getchar_timeout_us(0)) { //Only polled once per frame to keep the serial handling out of the rest of the loop
+                        case 't':
+                            printTelemetry();
+                            break;
+                        case 'r':
+                            resetTelemetry();
+                            printf("Telemetry reset.\n");
+                            break;
+                    }
                 } else if (vblank) {
                     if (y < SCREEN_H) {
                         vblank = false;
@@ -257,7 +316,8 @@ int main(void) {
                     }
                 }
 
-                tud_task();
+                if (usbMayRead(CFG_TUD_VIDEO_STREAMING_EP_BUFSIZE)) //TinyUSB copies the next payload of the frame in tud_task()
+                    tud_task();
                 if (renderState == done) {
                     usbSendFrame();
                 }
@@ -304,16 +364,27 @@ void tud_resume_cb(void) {
 void tud_video_frame_xfer_complete_cb(uint_fast8_t ctl_idx, uint_fast8_t stm_idx) {
     (void)ctl_idx; (void)stm_idx;
     frameSending = false;
+    setRawFrameSending(false);
+    streamingFinished();
 }
 
 int tud_video_commit_cb(uint_fast8_t ctl_idx, uint_fast8_t stm_idx, video_probe_and_commit_control_t const *parameters) {
     (void)ctl_idx; (void)stm_idx;
     #ifdef BASE_VIDEO_MODE
-    includeChroma = true;
+    frameRateDivider = 2;
     #else
-    includeChroma = parameters->dwFrameInterval > 200000 /*slower than 50fps*/;
+    frameRateDivider = (parameters->dwFrameInterval + 83333) / 166667; //Interval in 100ns units, rounded to the nearest multiple of a Game Boy frame
+    if (frameRateDivider < 1)
+        frameRateDivider = 1;
+    else if (frameRateDivider > 4)
+        frameRateDivider = 4;
     #endif
-    updateIncludeChroma();
+    skippedFrames = 0;
+    if (parameters->bFormatIndex == FORMAT_INDEX_NV12)
+        setOutputFormat(formatNV12);
+    else
+        setOutputFormat(parameters->bFrameIndex == FRAME_INDEX_NATIVE ? formatNative : format8x);
+    fillBaseFrames();
     return VIDEO_ERROR_NONE;
 }
 
@@ -1,6 +1,8 @@
 #include "opcodes.h"
 
 #include "cpubus.h"
+#include "checkpoint.h"
+#include "timer.h"
 #include "ppu.h"
 #include "debug.h"
 #include "gamedb/game_detection.h"
@@ -63,19 +65,43 @@ void toMemory(uint16_t address, uint8_t data) {
 
     if ((address & 0xe000) == 0x8000) { //Writing to VRAM
         VRAM_HASH(address, data); //Calculate hash for game detection if we are writing to VRAM
+        if (address >= 0x9800)
+            tileMapStamp[(address - 0x9800) >> 5] = ppuLineCount;
+    } else if ((address & 0xff00) == 0xfe00) { //OAM, the PPU needs to update its sprite buckets
+        oamChanged = true;
     } else if (address >= 0xff00) { //Handle some IO registers
+        if (gameInfo.accurateRendering && IS_LOGGED_REGISTER(address)) {
+            LOG_REGISTER_WRITE(address, data)
+        }
         switch (address) {
             case 0xff04: //Reset DIV register
-                div = cycleIndex;
+                writeDIV();
+                break;
+            case 0xff05: //TIMA
+                writeTIMA(data);
+                break;
+            case 0xff06: //TMA
+                writeTMA(data);
+                break;
+            case 0xff07: //TAC
+                writeTAC(data);
+                break;
+            case 0xff0f: //IF, we only care about the timer interrupt
+                writeIF(data);
                 break;
             case 0xff40: //LCDC
                 bgAndWindowDisplay = (data & 0x01) != 0;
                 objEnable = (data & 0x02) != 0;
-                objSize = ((data & 0x04) != 0 ? 16 : 8);
+                if (objSize != ((data & 0x04) != 0 ? 16 : 8)) {
+                    objSize = ((data & 0x04) != 0 ? 16 : 8);
+                    oamChanged = true;
+                }
                 bgTileMap9C00 = (data & 0x08) != 0;
                 tileData8000 = (data & 0x10) != 0;
                 windowEnable = (data & 0x20) != 0;
                 windowTileMap9C00 = (data & 0x40) != 0;
+                if ((data & 0x80) && !lcdAndPpuEnable)
+                    lcdEnableCycle = cycleIndex; //The PPU starts at line 0 from here
                 lcdAndPpuEnable = (data & 0x80) != 0;
                 break;
             case 0xff41: //STAT
@@ -86,39 +112,51 @@ void toMemory(uint16_t address, uint8_t data) {
                 if ((data & 0x80) != 0 && ((data & 0xe0) != 0xa0)) {
                     //OAM from our RAM copy
                     dmaToOAM((uint16_t)(data) << 8);
+                    oamChanged = true;
                 } else {
                     //OAM from the cartridge (ROM or external RAM)
                     cartridgeDMAsrc = (uint)(data) << 8;
                     cartridgeDMAdst = 0xfe00;
+                    cartridgeDMAlength = 0xa0;
                     cartridgeDMA = true;
                 }
                 ignoreCycles = 161;
+                retSyncAfterDMA = true;
+                break;
+            case 0xff4d: //KEY1, GBC double speed mode switch. This only arms the switch, which happens on the next STOP instruction.
+                if (enableCgbMode())
+                    data = (memory[0xff4d] & 0x80) | (data & 0x01);
                 break;
-            case 0xff47: //BG Palette
-                paletteBG[0] = (~data & 0x03);
-                paletteBG[1] = ((~data >> 2) & 0x03);
-                paletteBG[2] = ((~data >> 4) & 0x03);
-                paletteBG[3] = ((~data >> 6) & 0x03);
+            case 0xff4f: //VBK, GBC VRAM bank
+                if (enableCgbMode())
+                    setVramBank(data);
                 break;
-            case 0xff48: //OBP0 Palette
-                //Lowest bit is transparent and therefore ignored
-                paletteOBP0[1] = ((~data >> 2) & 0x03);
-                paletteOBP0[2] = ((~data >> 4) & 0x03);
-                paletteOBP0[3] = ((~data >> 6) & 0x03);
+            case 0xff55: //HDMA5, GBC VRAM DMA
+                if (enableCgbMode())
+                    dmaToVRAM(data);
                 break;
-            case 0xff49: //OBP1 Palette
-                //Lowest bit is transparent and therefore ignored
-                paletteOBP1[1] = ((~data >> 2) & 0x03);
-                paletteOBP1[2] = ((~data >> 4) & 0x03);
-                paletteOBP1[3] = ((~data >> 6) & 0x03);
+            case 0xff69: //BCPD, GBC background palette data
+            case 0xff6b: //OCPD, GBC object palette data
+                if (enableCgbMode()) {
+                    const uint16_t specification = address - 1; //BCPS or OCPS
+                    const uint8_t index = (memory[specification] & 0x3f) | (address == 0xff6b ? 0x40 : 0x00);
+                    writeCgbPalette(index, data);
+                    if (memory[specification] & 0x80) { //Auto increment
+                        memory[specification] = 0x80 | ((memory[specification] + 1) & 0x3f);
+                    }
+                }
+                break;
+            case 0xff70: //SVBK, GBC WRAM bank
+                if (enableCgbMode())
+                    setWramBank(data);
                 break;
-            case 0xff4d: //KEY1, GBC double speed mode switch
-                if (data & 0x01)
-                    stop("Game Boy Color\ngames are not\nsupported.");
-                break; 
         }
     }
+    address = MAPPED_ADDRESS(address); //Banked VRAM and WRAM on the GBC
     memory[address] = data;
+    if (IS_TILE_DATA(address)) {
+        TILE_CACHE_MARK(address)
+    }
 }
 
 //Read from memory, memory substitutions are already done in getNextFromBus, but the DMG sometimes shows the wrong address on the bus if data is loaded from an address pointed to by a register.
@@ -128,6 +166,7 @@ uint8_t static inline fromMemory(uint16_t addr) {
     DEBUG_TRIGGER_BREAKPOINT_AT_READ_FROM_ADDRESS
     switch (addr) {
         case 0xff04: return (uint8_t)((uint)(cycleIndex - div) >> 8); //DIV register
+        case 0xff05: return readTIMA();
         case 0xff41:
                     //STAT register. Since this is usually only used for conditional jumps done in the real Game Boy, emulating the correct value is not ciritcally here.
                     //Instead we use it to synchronize our PPU to the real one:
@@ -158,9 +197,12 @@ uint8_t static inline fromMemory(uint16_t addr) {
                         syncReferenceCycle = cycleIndex;
                     }
                     return y;
+        case 0xff55: return 0xff; //HDMA5, we do all GBC VRAM DMA transfers at once, so they are always done
+        case 0xff69: return cgbPaletteRAM[memory[0xff68] & 0x3f]; //BCPD
+        case 0xff6b: return cgbPaletteRAM[0x40 | (memory[0xff6a] & 0x3f)]; //OCPD
     }
     if (*address != addr && ((addr & 0xe000) == 0x8000)) {
-        return memory[addr]; //Data from memory usually has already been replaced in the bus data, but unfortunately, the DMG shows the wrong address when reading from VRAM, so we get it from our RAM copy instead
+        return memory[MAPPED_ADDRESS(addr)]; //Data from memory usually has already been replaced in the bus data, but unfortunately, the DMG shows the wrong address when reading from VRAM, so we get it from our RAM copy instead
     }
     return *opcode; //By default we fetch data from the address that the Game Boy fetches (which has been filled from our copy of memory if neccessary). The reason is that sometimes addresses are calculated from not exactly emulated registers (for example in Zelda) and this is obviously is the exact address
 }
@@ -375,7 +417,7 @@ void call6() {
     getNextFromBus();
     getNextFromBus();
     if (*address != sp && ((sp & 0xe000) != 0x8000)) {//Only verify consistency of the SP address if it is not pointing at VRAM, because the DMG may show wrong addresses in that case
-        stop("SP desynchronized.");
+        desync("SP desynchronized.");
     }
     getNextFromBus();
 }
@@ -394,7 +436,7 @@ void call3_6() {
         getNextFromBus();                 
         getNextFromBus();
         if (*address != sp && ((sp & 0xe000) != 0x8000)) {//Only verify consistency of the SP address if it is not pointing at VRAM, because the DMG may show wrong addresses in that case
-            stop("SP desynchronized.");
+            desync("SP desynchronized.");
         }
         getNextFromBus();
     } else
@@ -590,6 +632,21 @@ void halt() {
         getNextFromBus();
 }
 
+// STOP //
+
+void stop0() {
+    //On the GBC, STOP switches between normal and double speed if armed via KEY1. Otherwise, it is rarely used and we can treat it like a halt.
+    //STOP is two bytes long (0x10 0x00). The CPU fetches the second one, but does not execute it, so we must not take it for a NOP.
+    const uint16_t addr = *address;
+    if (cgbMode && (memory[0xff4d] & 0x01))
+        setDoubleSpeed(!doubleSpeed);
+    getNextFromBus();
+    if (*address == (uint16_t)(addr + 1))
+        getNextFromBus();
+    if ((uint16_t)history[(uint8_t)(*historyIndex+1)] == *address) //Like after a halt, we may see the next opcode twice
+        getNextFromBus();
+}
+
 // INC //
 
 #define GENERATE_INC_R(REGISTER)  \
@@ -1021,7 +1078,7 @@ void pop_r16() {
     uint32_t whichOpcode = rawBusData & 0x00300000;
     getNextFromBus();
     if (*address != sp && ((sp & 0xe000) != 0x8000)) {//Only verify consistency of the SP address if it is not pointing at VRAM, because the DMG may show wrong addresses in that case
-        stop("SP desynchronized.");
+        desync("SP desynchronized.");
     }
     uint16_t v = fromMemory(sp);
     sp++;
@@ -1073,7 +1130,7 @@ void push_r16() {
     getNextFromBus();
     getNextFromBus();
     if (*address != sp && ((sp & 0xe000) != 0x8000)) {//Only verify consistency of the SP address if it is not pointing at VRAM, because the DMG may show wrong addresses in that case
-        stop("SP desynchronized.");
+        desync("SP desynchronized.");
     }
     getNextFromBus();
 }
@@ -1083,7 +1140,7 @@ void push_r16() {
 void ret4() {
     getNextFromBus();
     if (*address != sp && ((sp & 0xe000) != 0x8000)) {//Only verify consistency of the SP address if it is not pointing at VRAM, because the DMG may show wrong addresses in that case
-        stop("SP desynchronized.");
+        desync("SP desynchronized.");
     }
     getNextFromBus();
     getNextFromBus();
@@ -1094,7 +1151,7 @@ void ret4() {
 void reti4() {
     getNextFromBus();
     if (*address != sp && ((sp & 0xe000) != 0x8000)) {//Only verify consistency of the SP address if it is not pointing at VRAM, because the DMG may show wrong addresses in that case
-        stop("SP desynchronized.");
+        desync("SP desynchronized.");
     }
     getNextFromBus();
     getNextFromBus();
@@ -1111,7 +1168,7 @@ void ret2_5() {
     if (nextPC != *address) { //If these are equal, a jump was not taken but the next code was fetched.
         //If not equal, burn three more cycles and pop the sp register.
         if (*address != sp && ((sp & 0xe000) != 0x8000)) {//Only verify consistency of the SP address if it is not pointing at VRAM, because the DMG may show wrong addresses in that case
-            stop("SP desynchronized.");
+            desync("SP desynchronized.");
         }
         getNextFromBus();
         getNextFromBus();
@@ -1534,14 +1591,14 @@ void xCB() {
 // UNKNOWN / ERROR STATE //
 
 void unknown() {
-    stop("Unknown opcode.");
+    desync("Unknown opcode.");
     errorOpcode = *opcode;
 }
 
 void (*opcodes[256])() = {
       /*  ..0       ..1       ..2       ..3       ..4       ..5       ..6       ..7         ..8       ..9       ..a       ..b       ..c       ..d       ..e       ..f */
 /*0..*/    noop1, ld_r_d16, ld_mem_A,  inc_r16,    inc_b,    dec_b,  ld_b_d8,     rlca,  ld_a16_SP, add_HL_r, ld_A_mem,  dec_r16,    inc_c,    dec_c,  ld_c_d8,     rrca,
-/*1..*/  unknown, ld_r_d16, ld_mem_A,  inc_r16,    inc_d,    dec_d,  ld_d_d8,      rla,      noop3, add_HL_r, ld_A_mem,  dec_r16,    inc_e,    dec_e,  ld_e_d8,      rra,
+/*1..*/    stop0, ld_r_d16, ld_mem_A,  inc_r16,    inc_d,    dec_d,  ld_d_d8,      rla,      noop3, add_HL_r, ld_A_mem,  dec_r16,    inc_e,    dec_e,  ld_e_d8,      rra,
 /*2..*/    jr_nz, ld_r_d16, ld_mem_A,  inc_r16,    inc_h,    dec_h,  ld_h_d8,      daa,       jr_z, add_HL_r, ld_A_mem,  dec_r16,    inc_l,    dec_l,  ld_l_d8,      cpl,
 /*3..*/  jr_cond, ld_r_d16, ld_mem_A,  inc_r16,   inc_HL,   dec_HL, ld_HL_d8,      scf,    jr_cond, add_HL_r, ld_A_mem,  dec_r16,    inc_a,    dec_a,  ld_a_d8,      ccf,
 /*4..*/    noop1,   ld_b_c,   ld_b_d,   ld_b_e,   ld_b_h,   ld_b_l,  ld_b_HL,   ld_b_a,     ld_c_b,    noop1,   ld_c_d,   ld_c_e,   ld_c_h,   ld_c_l,  ld_c_HL,   ld_c_a,
@@ -6,4 +6,7 @@
 extern void (*opcodes[])();
 void toMemory(uint16_t address, uint8_t data);
 
+extern int syncOffset;
+void setOffsetToLine(uint8_t line);
+
 #endif
\ No newline at end of file
@@ -4,7 +4,7 @@
 
 #include "font/font8x8_basic.h"
 
-uint8_t osdBuffer[OSD_HEIGHT * SCREEN_W];
+uint8_t osdBuffer[OSD_HEIGHT * SCREEN_LINE_BYTES] __attribute__((aligned(4)));
 
 uint osdPosition = SCREEN_H;
 uint timeRemaining = 0;
@@ -12,27 +12,23 @@ uint timeRemaining = 0;
 void inline renderOSDCharacter(char i, uint x, uint y, volatile uint8_t * targetBuffer, uint8_t fgColor, uint8_t bgColor) {
     for (uint yi = 0; yi < 8; yi++) {
         char line = font8x8_basic[i][yi];
-        uint8_t volatile * bufferindex = targetBuffer + (y + yi) * SCREEN_W + x;
         uint8_t mask = 0x01;
-        for (uint xi = 0; xi < 8; xi++) {
-            if (line & mask)
-                *bufferindex = fgColor;
-            else
-                *bufferindex = bgColor;
+        for (uint xi = x; xi < x + 8; xi++) {
+            if (line & mask) {
+                SET_PACKED_PIXEL(targetBuffer, xi, y + yi, fgColor)
+            } else {
+                SET_PACKED_PIXEL(targetBuffer, xi, y + yi, bgColor)
+            }
             mask <<= 1;
-            bufferindex++;
         }
     }
 }
 
 void renderOSDFillLine(uint fromX, uint toX, uint y0, volatile uint8_t * targetBuffer, uint8_t color) {
-    uint8_t volatile * bufferindex = targetBuffer + y0 * SCREEN_W + fromX;
     for (uint y = y0; y < y0 + 8; y++) {
         for (uint x = fromX; x < toX; x++) {
-            *bufferindex = color;
-            bufferindex++;
+            SET_PACKED_PIXEL(targetBuffer, x, y, color)
         }
-        bufferindex += SCREEN_W - toX + fromX;
     }
 }
 
@@ -71,8 +67,8 @@ uint renderText(const char * text, uint8_t fgColor, uint8_t bgColor, uint8_t * b
 void renderOSD(const char * text, uint8_t fgColor, uint8_t bgColor, uint duration) {
     //Padding
     uint8_t volatile * topborder = osdBuffer;
-    for (uint i = 0; i < SCREEN_W; i++) {
-        *topborder = bgColor;
+    for (uint i = 0; i < SCREEN_LINE_BYTES; i++) {
+        *topborder = DIRECT_PIXEL_PAIR(bgColor); //Two pixels at once
         topborder++;
     }
 
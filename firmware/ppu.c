@@ -3,35 +3,36 @@
 #include "cpubus.h"
 #include "jpeg/jpeg.h"
 #include "debug.h"
+#include "telemetry.h"
 
-#include "hardware/interp.h"
+#include "hardware/sync.h"
 
 #include <stdio.h>
+#include <string.h>
 
 #include "gamedb/game_detection.h"
 
-//The following buffer1 to buffer4 are just place holders and their meanings change as the pointers frontBuffer, readyBuffer, backBuffer and lastBuffer point to them.
-//The PPU renders into the backBuffer in one byte per pixel format. When a frame has been completed, the backBuffer data is converted to JPEG and written to the readyBuffer.
-//If frame blending is enabled, the backBuffer data is mixed with the lastBuffer in the same step whlie creating the JPEG data.
-//When next rendering starts, backBuffer and lastBuffer are swapped, so we can keep a copy of the last frame for frame blending.
-//Whenever a new USB frame is to be sent, frontBuffer and readyBuffer are swapped and the frontBuffer is sent. This way a new frame can be converted to JPEG while USB is still sending data.
-uint8_t buffer1[FRAME_SIZE];
-uint8_t buffer2[FRAME_SIZE];
-uint8_t buffer3[SCREEN_SIZE];
-uint8_t buffer4[SCREEN_SIZE];
-uint8_t volatile * frontBuffer = buffer1; //Data that is currently (or just has been) transmitted via USB, complete JPEG file
-uint8_t volatile * readyBuffer = buffer2; //Ready to start next USB transfer while we are still rendering to the backbuffer, complete JPEG file
-uint8_t volatile * backBuffer = buffer3;  //We render into this one
-uint8_t volatile * lastBuffer = buffer4;  //Copy of last back buffer for frame blending
-
-uint8_t * backBufferLine = buffer3;
-bool readyBufferIsNew = false;
-
-#ifdef BASE_VIDEO_MODE
-bool frameBlending = false;
-#else
-bool frameBlending = true;
-#endif
+//The following buffers are just place holders and their meanings change as the pointers frontBuffer, readyBuffer, encodeBuffer, backBuffer and frameHistory point to them.
+//The PPU renders each line in one byte per pixel format and then packs it into the backBuffer with 4 bit per pixel (palette index and its source, see ppu.h). When a frame has been completed, it becomes the newest entry of the frameHistory
+//and the oldest entry becomes the next backBuffer. The encoder blends each line of the backBuffer with the newest frames of the history according to the blend mode as soon as the line has been rendered and writes the JPEG to the readyBuffer.
+//It never reads a line of the backBuffer we are still rendering into, as it waits for the PPU to move on to the next line.
+//The JPEG files are triple buffered: The encoder always writes to the encodeBuffer. A completed frame is swapped with the readyBuffer, replacing any older frame USB has not picked up yet.
+//Whenever a new USB frame is to be sent, frontBuffer and readyBuffer are swapped and the frontBuffer is sent. This way neither side ever waits for the other and USB always gets the newest frame.
+//Uncompressed frames are too large for this, so they use the space of all three JPEG buffers for a single rawFrame. The encoder waits while USB sends it, so a frame is never mixed with the next one.
+uint8_t jpegBuffers[3][FRAME_SIZE] __attribute__((aligned(4)));
+uint8_t * const rawFrame = (uint8_t *)jpegBuffers;
+uint8_t frameBuffers[FRAME_HISTORY][FRAME_BUFFER_SIZE] __attribute__((aligned(4)));
+uint8_t volatile * frontBuffer = jpegBuffers[0]; //Data that is currently (or just has been) transmitted via USB, complete JPEG file
+uint8_t volatile * readyBuffer = jpegBuffers[1]; //Newest completed frame, sent next if readyBufferIsNew
+uint8_t volatile * encodeBuffer = jpegBuffers[2]; //The encoder writes the next frame to this one
+uint8_t volatile * backBuffer = frameBuffers[0];  //We render into this one
+uint8_t volatile * frameHistory[FRAME_HISTORY - 1] = {frameBuffers[1], frameBuffers[2]}; //Completed frames for frame blending, newest first
+
+uint8_t backBufferLine[SCREEN_W] __attribute__((aligned(4))); //The line we are rendering, one byte per pixel with the same 4 bit as in the frame buffers
+uint8_t volatile * packedBackBufferLine = frameBuffers[0]; //Where this line ends up in the backBuffer
+volatile bool readyBufferIsNew = false; //Also set by the DMA interrupt of the JPEG encoder
+
+bool wholeLineRendering = true; //Render each line in one pass at the end of mode 2 instead of in steps of eight pixels while time passes. Much faster, but register changes during mode 3 are not picked up. DMG only.
 
 uint lineCycle = 0;
 int x = 0;  //LX
@@ -49,141 +50,254 @@ uint volatile objSize;
 bool volatile objEnable;
 bool volatile bgAndWindowDisplay;
 bool volatile lcdAndPpuEnable;
+uint volatile lcdEnableCycle; //Bus cycle at which LCDC bit 7 was last set, written by core1
+bool lcdOff = false; //The PPU has noticed that the LCD is off and shows the blank frame
 
-uint8_t volatile paletteBG[4];
-uint8_t volatile paletteOBP0[4];
-uint8_t volatile paletteOBP1[4];
+//On the DMG, pixels only get the source of their palette. The colors are picked when encoding, using the palettes stored for each line.
+const uint8_t sourceBGP[4] = {PIXEL_BGP, PIXEL_BGP | 1, PIXEL_BGP | 2, PIXEL_BGP | 3};
+const uint8_t sourceOBP0[4] = {PIXEL_OBP0, PIXEL_OBP0 | 1, PIXEL_OBP0 | 2, PIXEL_OBP0 | 3};
+const uint8_t sourceOBP1[4] = {PIXEL_OBP1, PIXEL_OBP1 | 1, PIXEL_OBP1 | 2, PIXEL_OBP1 | 3};
+
+uint8_t volatile cgbPaletteRAM[0x80]; //GBC palette RAM as written by the game, background palettes followed by object palettes, two bytes per color
+uint8_t volatile cgbPalette[0x40]; //The same palettes converted to our four shades as direct pixels, background palettes followed by object palettes, one byte per color
 
 uint8_t scx;
 uint8_t pixelSourceOnLine[SCREEN_W]; //Tracks the source of the current color. Usually the index of the background palette, but can also be set to PIXEL_IS_SPRITE if the pixel was drawn by a sprite.
 #define PIXEL_IS_SPRITE 0xff
+#define PIXEL_BG_PRIORITY 0x04 //GBC only: The BG map attributes give this pixel priority over sprites
 
 #define SPRITES_IN_MEMORY 40
 #define MAX_SPRITES_ON_LINE 10
 uint nSpritesOnLine; //Number of sprites found on the current scanline
-uint scanIndex;      //index of sprite in memory while scanning for sprites on scanline
-struct SpriteAttribute * spritesOnLine[MAX_SPRITES_ON_LINE]; //The up to ten sprites on the current scanline
+uint8_t * spritesOnLine; //OAM offsets of the up to ten sprites on the current scanline, points into spriteBuckets
 uint currentSpriteOnLine; //Index of the first sprite that has not yet been passed on the current scanline
 
-//Different interpolator configs that we need to switch between
-interp_config cfgMasked0, cfgUnmasked0, cfgMasked1, cfgUnmasked1;
-
-void prepareInterpolatorConfigs() {
-    //Setup interpolators to shift and mask bits from tile data
-
-    cfgMasked0 = interp_default_config();
-    interp_config_set_mask(&cfgMasked0, 0, 0);
-    interp_config_set_cross_input(&cfgMasked0, true);
+//Instead of searching OAM on every line, we sort the sprites into one bucket per line whenever OAM or the sprite size changes (usually once per frame after the OAM DMA).
+uint8_t spriteBuckets[SCREEN_H][MAX_SPRITES_ON_LINE]; //OAM offsets (index * 4) of the sprites on each line
+uint8_t spriteBucketSize[SCREEN_H];
+bool volatile oamChanged = true; //Set by core1
+bool spriteBucketsPartial = false; //The last update happened mid-frame and skipped the lines above
+uint32_t spriteLineOAM[SCREEN_H][MAX_SPRITES_ON_LINE]; //The four OAM bytes of the sprites in each bucket at the last update, unused entries are 0xffffffff (y = 0xff is never on screen)
+uint spriteLineStamp[SCREEN_H]; //Line count of the last update that changed the sprites on each line
+
+//Dirty line tracking for whole line rendering: If nothing a line depends on has changed since the last frame, we take it from the newest frame in the history instead of rendering it again.
+//The JPEG encoding uses lineChangedFrame to also reuse the encoded data of lines that did not change.
+uint volatile ppuLineCount = 0;
+uint volatile tileStamp[2 * TILE_CACHE_BANK_SIZE / 8];
+uint volatile tileMapStamp[0x800 / 32];
+uint volatile ppuDirtyStamp = 0;
+uint frameCount = 0;
+uint lineChangedFrame[SCREEN_H];
+
+enum LineState {lineInvalid = 0, lineRendered, lineUnchanged};
+enum LineState lineState[SCREEN_H];
+uint8_t lineUnchangedFrames[SCREEN_H]; //Number of consecutive frames a line has been found unchanged, up to FRAME_HISTORY - 1
+uint lineStamp[SCREEN_H]; //Line count at which each line was last rendered or found unchanged
+uint32_t lineRegisters[SCREEN_H][3]; //Registers each line has been rendered with
+
+//Accurate rendering for games with mid-line effects: At the end of each line, we check the register log for writes that happened during mode 3. Only if there are any,
+//the line is rendered again pixel by pixel, following the pixel FIFO timing of the DMG and applying each write at the pixel that was output when it happened.
+//The penalties of sprites and the window are approximations of the real fetcher behavior, but close enough for palette and scroll effects.
+//As the palettes may change within the line, these lines resolve their colors right away and use direct pixels.
+#define ACCURATE_FIRST_PIXEL_DOT 92 //80 dots of mode 2 plus 12 for the first tile fetch
+#define ACCURATE_MODE_3_MAX_CYCLES 73 //289 dots, the longest mode 3 possible
+struct RegisterWrite volatile registerLog[REGISTER_LOG_SIZE];
+uint volatile registerLogWritten = 0; //Written by core1
+uint registerLogRead = 0;
+uint8_t accurateRegisters[0x0c]; //0xff40 to 0xff4b as they were at the position within the line we are rendering
+bool accurateRegistersValid = false;
+uint ppuBusCycle;
+uint lineStartCycle; //Bus cycle at which the current line started
+uint8_t spritePixelsOnLine[SCREEN_W]; //Palette index of the sprite pixel on top and its attributes (priority and palette), zero if there is none
+
+//Decoded tile cache, so rendering does not need to pick apart bit planes. Core1 marks the tiles it writes to and we decode them before rendering the next line.
+uint16_t volatile tileCache[2 * TILE_CACHE_BANK_SIZE];
+uint8_t volatile tileWritten[TILES] __attribute__((aligned(4))); //Read as words to skip four tiles at once
+bool volatile tilesWritten = false;
+
+//Spreads the eight bits of one bit plane to every second bit, so the two bit planes of a tile row combine into eight 2 bit palette indices
+#define SPREAD_BITS(B) (((B) & 0x01) | (((B) & 0x02) << 1) | (((B) & 0x04) << 2) | (((B) & 0x08) << 3) | (((B) & 0x10) << 4) | (((B) & 0x20) << 5) | (((B) & 0x40) << 6) | (((B) & 0x80) << 7))
+#define SPREAD_BITS_4(B) SPREAD_BITS(B), SPREAD_BITS((B)+1), SPREAD_BITS((B)+2), SPREAD_BITS((B)+3)
+#define SPREAD_BITS_16(B) SPREAD_BITS_4(B), SPREAD_BITS_4((B)+4), SPREAD_BITS_4((B)+8), SPREAD_BITS_4((B)+12)
+#define SPREAD_BITS_64(B) SPREAD_BITS_16(B), SPREAD_BITS_16((B)+16), SPREAD_BITS_16((B)+32), SPREAD_BITS_16((B)+48)
+const uint16_t tileRowSpread[256] = {SPREAD_BITS_64(0), SPREAD_BITS_64(64), SPREAD_BITS_64(128), SPREAD_BITS_64(192)};
+
+//Tile data written by a DMA channel (GBC VRAM DMA) bypasses toMemory. Core1 queues these ranges and we decode them here once the transfer is done.
+#define TILE_CACHE_REQUESTS 8
+uint16_t volatile tileCacheRequestAddress[TILE_CACHE_REQUESTS];
+uint16_t volatile tileCacheRequestLength[TILE_CACHE_REQUESTS];
+uint volatile tileCacheRequestsQueued = 0;
+uint tileCacheRequestsDone = 0;
+bool volatile tileCacheRebuildAll = false;
+
+void requestTileCacheUpdate(uint16_t address, uint length) { //Called from core1
+    if (tileCacheRequestsQueued - tileCacheRequestsDone >= TILE_CACHE_REQUESTS) {
+        tileCacheRebuildAll = true;
+        return;
+    }
+    tileCacheRequestAddress[tileCacheRequestsQueued % TILE_CACHE_REQUESTS] = address;
+    tileCacheRequestLength[tileCacheRequestsQueued % TILE_CACHE_REQUESTS] = length;
+    tileCacheRequestsQueued++;
+}
 
-    cfgUnmasked0 = interp_default_config();
-    interp_config_set_shift(&cfgUnmasked0, 1);
+void updateTileCacheRange(uint16_t address, uint length) {
+    for (uint i = 0; i < length; i += 2) {
+        const uint16_t rowAddress = address + i;
+        if (IS_TILE_DATA(rowAddress)) {
+            tileCache[TILE_CACHE_INDEX(rowAddress)] = tileRowSpread[memory[rowAddress & 0xfffe]] | (tileRowSpread[memory[rowAddress | 0x0001]] << 1);
+            tileStamp[TILE_CACHE_INDEX(rowAddress) >> 3] = ppuLineCount;
+        }
+    }
+}
 
-    cfgMasked1 = interp_default_config();
-    interp_config_set_mask(&cfgMasked1, 1, 1);
-    interp_config_set_cross_input(&cfgMasked1, true);
+void updateWrittenTiles() {
+    if (!tilesWritten)
+        return;
+    tilesWritten = false; //Cleared before looking at the tiles, so a write in the meantime sets it again
+    const uint32_t volatile * words = (const uint32_t volatile *)tileWritten;
+    for (uint i = 0; i < TILES / 4; i++) {
+        if (!words[i])
+            continue;
+        for (uint tile = i * 4; tile < i * 4 + 4; tile++) {
+            if (tileWritten[tile]) {
+                tileWritten[tile] = 0; //Before decoding, so a write in between marks the tile again
+                updateTileCacheRange(tile < TILES / 2 ? 0x8000 + (tile << 4) : CGB_VRAM_BANK1 + ((tile - TILES / 2) << 4), 16);
+            }
+        }
+    }
+}
 
-    cfgUnmasked1 = interp_default_config();
-    interp_config_set_shift(&cfgUnmasked1, 1);
+void serviceTileCacheRequests() {
+    updateWrittenTiles();
+    if (vramDmaBusy())
+        return;
+    if (tileCacheRebuildAll) {
+        tileCacheRebuildAll = false;
+        updateTileCacheRange(0x8000, 0x1800);
+        updateTileCacheRange(CGB_VRAM_BANK1, 0x1800);
+        tileCacheRequestsDone = tileCacheRequestsQueued;
+    }
+    while (tileCacheRequestsDone != tileCacheRequestsQueued) {
+        updateTileCacheRange(tileCacheRequestAddress[tileCacheRequestsDone % TILE_CACHE_REQUESTS], tileCacheRequestLength[tileCacheRequestsDone % TILE_CACHE_REQUESTS]);
+        tileCacheRequestsDone++;
+    }
 }
 
-void ppuInit() {
-    prepareInterpolatorConfigs();
-    interp_set_config(interp0, 0, &cfgMasked0);
-    interp_set_config(interp0, 1, &cfgUnmasked0);
-    interp_set_config(interp1, 0, &cfgMasked1);
-    interp_set_config(interp1, 1, &cfgUnmasked1);
+void writeCgbPalette(uint8_t index, uint8_t data) {
+    //Our JPEG data only carries brightness (the chroma is the same for the whole frame), so the best we can do with GBC colors is to map them to our four shades by their luma.
+    index &= 0x7f;
+    cgbPaletteRAM[index] = data;
+    const uint16_t color = cgbPaletteRAM[index & 0x7e] | ((uint16_t)cgbPaletteRAM[index | 0x01] << 8);
+    const uint luma = ((color & 0x1f) * 77 + ((color >> 5) & 0x1f) * 150 + ((color >> 10) & 0x1f) * 29) >> 8; //0 to 31
+    cgbPalette[index >> 1] = PIXEL_DIRECT | (luma >> 3);
+}
 
-    readyBufferIsNew = false;
-    renderState = start;
-    y = 0;
-    x = 0;
-    lineCycle = 0;
+void static inline renderTileRow(const uint16_t mapAddress, uint8_t tileY) {
+    const uint8_t tileIndex = memory[mapAddress];
+    uint8_t attributes = 0x00;
+    const uint8_t volatile * palette = sourceBGP;
+    if (cgbMode) {
+        attributes = memory[CGB_VRAM_BANK1 | (mapAddress & 0x1fff)];
+        palette = &cgbPalette[(attributes & 0x07) << 2];
+        if (attributes & 0x40) //Vertical flip
+            tileY ^= 0x07;
+    }
+    const uint tileNumber = (tileData8000 || tileIndex > 0x7f) ? tileIndex : 0x100 + tileIndex;
+    uint16_t tileRow = tileCache[((attributes & 0x08) ? TILE_CACHE_BANK_SIZE : 0) + (tileNumber << 3) + (tileY & 0x07)];
+    const uint8_t priority = (attributes & 0x80) ? PIXEL_BG_PRIORITY : 0x00;
+
+    if (attributes & 0x20) { //Horizontal flip, the rightmost pixel of the tile comes first
+        for (int xi = x; xi <= x + 7 && xi < SCREEN_W; xi++, tileRow >>= 2) {
+            if (xi >= 0) {
+                const uint8_t index = tileRow & 0x03;
+                pixelSourceOnLine[xi] = index | priority;
+                backBufferLine[xi] = palette[index];
+            }
+        }
+    } else {
+        for (int xi = x + 7; xi >= x && xi >= 0; xi--, tileRow >>= 2) {
+            if (xi < SCREEN_W) {
+                const uint8_t index = tileRow & 0x03;
+                pixelSourceOnLine[xi] = index | priority;
+                backBufferLine[xi] = palette[index];
+            }
+        }
+    }
 }
 
 void renderBGTiles() {
     const uint8_t bgX = scx + x;
     const uint8_t bgY = memory[0xff42] + y;
-    const uint8_t tileIndex = memory[(bgTileMap9C00 ? 0x9c00 : 0x9800) | (((uint16_t)bgY & 0x00f8) << 2) | (bgX >> 3)];
-    const uint16_t tileAddress = (0x8000 | (tileIndex << 4) | (tileData8000 || tileIndex > 0x7f ? 0x0000 : 0x1000)) + ((bgY << 1) & 0x0f);
-    const uint16_t lowerTileData = memory[tileAddress];
-    const uint16_t upperTileData = memory[tileAddress+1] << 1;
-
-    interp0_hw->accum[1] = lowerTileData;
-    interp1_hw->accum[1] = upperTileData;
-
-    for (int xi = x + 7; xi >= x && xi >= 0; xi--, interp0_hw->pop[1], interp1_hw->pop[1]) {
-        if (xi < SCREEN_W) {
-            pixelSourceOnLine[xi] = interp0_hw->peek[0] | interp1_hw->peek[0];
-            backBufferLine[xi] = paletteBG[pixelSourceOnLine[xi]];
-        }
-    }
+    renderTileRow((bgTileMap9C00 ? 0x9c00 : 0x9800) | (((uint16_t)bgY & 0x00f8) << 2) | (bgX >> 3), bgY);
 }
 
 void renderWindowTiles() {
     const uint8_t windowX = x + 7 - memory[0xff4B];
     const uint8_t windowY = wy - memory[0xff4A];
-    const uint8_t tileIndex = memory[(windowTileMap9C00 ? 0x9c00 : 0x9800) | (((uint16_t)windowY & 0x00f8) << 2) | (windowX >> 3)];
-    const uint16_t tileAddress = (0x8000 | (tileIndex << 4) | (tileData8000 || tileIndex > 0x7f ? 0x0000 : 0x1000)) + ((windowY << 1) & 0x0f);
-    const uint16_t lowerTileData = memory[tileAddress];
-    const uint16_t upperTileData = memory[tileAddress+1] << 1;
-
-    interp0_hw->accum[1] = lowerTileData;
-    interp1_hw->accum[1] = upperTileData;
-
-    for (int xi = x + 7; xi >= x && xi >= 0; xi--, interp0_hw->pop[1], interp1_hw->pop[1]) {
-        if (xi < SCREEN_W) {
-            pixelSourceOnLine[xi] = interp0_hw->peek[0] | interp1_hw->peek[0];
-            backBufferLine[xi] = paletteBG[pixelSourceOnLine[xi]]; //For now just the palette index as it will remain relevant when drawing sprites
-        }
-    }
+    renderTileRow((windowTileMap9C00 ? 0x9c00 : 0x9800) | (((uint16_t)windowY & 0x00f8) << 2) | (windowX >> 3), windowY);
+}
+
+bool static inline spriteIsVisible(const uint8_t spriteAttributes, const uint8_t bgPixel) {
+    //The background wins if it is not color 0 and either the sprite or (on the GBC) the BG map attributes ask for BG priority. On the GBC, LCDC bit 0 overrides all of this.
+    if ((bgPixel & 0x03) == 0 || (cgbMode && !bgAndWindowDisplay))
+        return true;
+    return !((spriteAttributes & 0x80) || (bgPixel & PIXEL_BG_PRIORITY));
 }
 
 void renderSprites() {
+    if (cgbMode && x + 8 < SCREEN_W) //On the GBC, sprite priority only depends on the OAM order and not on x, so we draw all of them at the end of the line
+        return;
+
     while (currentSpriteOnLine < nSpritesOnLine) {
-        struct SpriteAttribute* sprite = spritesOnLine[currentSpriteOnLine];
+        struct SpriteAttribute* sprite = (struct SpriteAttribute*)&memory[0xfe00 | spritesOnLine[currentSpriteOnLine]];
         
         if (x + 8 < SCREEN_W && sprite->x > x + 8) //If this sprite begins after x its end will reach into the part where no BG tiles have been drawn until now, so we do not have to consider it or the ones after this for now. Exception: If we reached the end of the line, we also need to draw the ones that reach beyond the end of the line.
             break;
 
         uint8_t yOffset;
-        uint16_t baseAddress;
+        uint tileNumber;
         if ((sprite->attributes & 0x40) != 0) //Vertical flip
             yOffset = (y + 16 - sprite->y) ^ (objSize-1);
         else
             yOffset = (y + 16 - sprite->y);
         if (objSize == 16)
-            baseAddress = ((uint16_t)((sprite->tileIndex & 0xfe) | (yOffset >= 8 ? 0x01 : 0x00)) << 4);
+            tileNumber = (sprite->tileIndex & 0xfe) | (yOffset >= 8 ? 0x01 : 0x00);
         else
-            baseAddress = ((uint16_t)sprite->tileIndex << 4);
-        
-        const uint16_t spriteTileAddress = (0x8000 | baseAddress | ((yOffset & 0x07) << 1));
+            tileNumber = sprite->tileIndex;
+
+        uint bank = 0;
+        const uint8_t volatile * palette;
+        if (cgbMode) {
+            palette = &cgbPalette[CGB_OBJ_PALETTES + ((sprite->attributes & 0x07) << 2)];
+            if (sprite->attributes & 0x08) //Tile data from VRAM bank 1
+                bank = TILE_CACHE_BANK_SIZE;
+        } else
+            palette = (sprite->attributes & 0x10) ? sourceOBP1 : sourceOBP0;
 
-        interp0_hw->accum[1] = memory[spriteTileAddress];
-        interp1_hw->accum[1] = memory[spriteTileAddress+1] << 1;
+        uint16_t tileRow = tileCache[bank + (tileNumber << 3) + (yOffset & 0x07)];
 
-        uint16_t lowerTileData, upperTileData;
         if (sprite->attributes & 0x20) { //Horizontal flip
-            for (int xi = sprite->x - 8; xi < sprite->x && xi < SCREEN_W; xi++, interp0_hw->pop[1], interp1_hw->pop[1]) {
+            for (int xi = sprite->x - 8; xi < sprite->x && xi < SCREEN_W; xi++, tileRow >>= 2) {
                 if (xi < 0 || pixelSourceOnLine[xi] == PIXEL_IS_SPRITE) //Already set by previous sprite
                     continue;
             
-                uint8_t spritePixel = interp0_hw->peek[0] | interp1_hw->peek[0];
+                uint8_t spritePixel = tileRow & 0x03;
                 if (spritePixel != 0) { // We have our pixel. Fetch the color and break the loop
-                    if (!(sprite->attributes & 0x80 && pixelSourceOnLine[xi] != 0)) { // Not: Flag for BG1-3 priority set and background is in fact index 1-3
-                        backBufferLine[xi] = (sprite->attributes & 0x10) ? paletteOBP1[spritePixel] : paletteOBP0[spritePixel];
+                    if (spriteIsVisible(sprite->attributes, pixelSourceOnLine[xi])) {
+                        backBufferLine[xi] = palette[spritePixel];
                     }
                     pixelSourceOnLine[xi] = 0xff; //Mark as pixel found
                 }  // Else: Transparent pixel, try again for the next sprite or don't draw anything
             }
         } else {
-            for (int xi = sprite->x - 1; xi >= sprite->x-8 && xi >= 0; xi--, interp0_hw->pop[1], interp1_hw->pop[1]) {
+            for (int xi = sprite->x - 1; xi >= sprite->x-8 && xi >= 0; xi--, tileRow >>= 2) {
                 if (xi >= SCREEN_W || pixelSourceOnLine[xi] == PIXEL_IS_SPRITE) //Already set by previous sprite
                     continue;
             
-                uint8_t spritePixel = interp0_hw->peek[0] | interp1_hw->peek[0];
+                uint8_t spritePixel = tileRow & 0x03;
                 if (spritePixel != 0) { // We have our pixel. Fetch the color and break the loop
-                    if (!(sprite->attributes & 0x80 && pixelSourceOnLine[xi] != 0)) { // Not: Flag for BG1-3 priority set and background is in fact index 1-3
-                        backBufferLine[xi] = (sprite->attributes & 0x10) ? paletteOBP1[spritePixel] : paletteOBP0[spritePixel];
+                    if (spriteIsVisible(sprite->attributes, pixelSourceOnLine[xi])) {
+                        backBufferLine[xi] = palette[spritePixel];
                     }
                     pixelSourceOnLine[xi] = 0xff; //Mark as pixel found
                 }  // Else: Transparent pixel, try again for the next sprite or don't draw anything
@@ -193,13 +307,150 @@ void renderSprites() {
     }
 }
 
+//Whole line rendering works on pairs of pixels: A nibble of a decoded tile row holds two pixels and maps to two bytes of output via this table.
+//As background pixels are just their palette index, the same bytes serve as the color and as the source for the sprite priority.
+const uint16_t indexPixelPairs[16] = {0x0000, 0x0100, 0x0200, 0x0300, 0x0001, 0x0101, 0x0201, 0x0301, 0x0002, 0x0102, 0x0202, 0x0302, 0x0003, 0x0103, 0x0203, 0x0303};
+
+//Tiles are first staged aligned to their own grid and then copied to the line with the fine scroll offset. 21 tiles cover the visible part of a line at any offset.
+#define STAGED_TILES 21
+uint32_t stagedIndices[STAGED_TILES * 2];
+
+void static inline stageTiles(const uint16_t mapRow, uint8_t tileX, const uint8_t tileY, const uint count) {
+    uint32_t * indices = stagedIndices;
+    for (uint i = 0; i < count; i++, tileX++) {
+        const uint8_t tileIndex = memory[mapRow | (tileX & 0x1f)];
+        const uint tileNumber = (tileData8000 || tileIndex > 0x7f) ? tileIndex : 0x100 + tileIndex;
+        const uint16_t tileRow = tileCache[(tileNumber << 3) + tileY];
+        //Leftmost pixel is in the highest bits of the tile row, but goes into the lowest byte of a little endian word
+        *indices++ = indexPixelPairs[tileRow >> 12] | ((uint32_t)indexPixelPairs[(tileRow >> 8) & 0x0f] << 16);
+        *indices++ = indexPixelPairs[(tileRow >> 4) & 0x0f] | ((uint32_t)indexPixelPairs[tileRow & 0x0f] << 16);
+    }
+}
+
+void static inline copyStagedTiles(const uint stagedOffset, const uint lineOffset) {
+    memcpy(backBufferLine + lineOffset, (uint8_t *)stagedIndices + stagedOffset, SCREEN_W - lineOffset);
+    memcpy(pixelSourceOnLine + lineOffset, (uint8_t *)stagedIndices + stagedOffset, SCREEN_W - lineOffset);
+}
+
+void renderLine() { //Renders the whole line at once
+    if (bgAndWindowDisplay) {
+        scx = memory[0xff43];
+        const uint8_t bgY = memory[0xff42] + y;
+        stageTiles((bgTileMap9C00 ? 0x9c00 : 0x9800) | (((uint16_t)bgY & 0x00f8) << 2), scx >> 3, bgY & 0x07, STAGED_TILES);
+        copyStagedTiles(scx & 0x07, 0);
+
+        const int windowStart = memory[0xff4b] - 7;
+        if (windowEnable && y >= memory[0xff4a] && windowStart < SCREEN_W) {
+            const uint8_t windowY = wy - memory[0xff4a];
+            const uint stagedOffset = windowStart < 0 ? -windowStart : 0;
+            const uint lineOffset = windowStart < 0 ? 0 : windowStart;
+            stageTiles((windowTileMap9C00 ? 0x9c00 : 0x9800) | (((uint16_t)windowY & 0x00f8) << 2), 0, windowY & 0x07, (SCREEN_W - lineOffset + stagedOffset + 7) >> 3);
+            copyStagedTiles(stagedOffset, lineOffset);
+        }
+    } else {
+        //Background and window disabled, the DMG shows white
+        memset(backBufferLine, PIXEL_DIRECT | 0x03, SCREEN_W);
+        memset(pixelSourceOnLine, 0x00, SCREEN_W);
+    }
+
+    if (objEnable) {
+        x = SCREEN_W; //Tells renderSprites that everything up to the end of the line has been drawn
+        renderSprites();
+    }
+}
+
+void packLine() {
+    //Four pixels of one byte each (leftmost in the lowest byte) become two bytes with the leftmost pixel in the high nibble
+    const uint32_t * pixels = (const uint32_t *)backBufferLine;
+    uint16_t volatile * packed = (uint16_t volatile *)packedBackBufferLine;
+    for (uint i = 0; i < SCREEN_LINE_BYTES / 2; i++) {
+        const uint32_t w = pixels[i];
+        packed[i] = ((w << 4) & 0x00f0) | ((w >> 8) & 0x000f) | ((w >> 4) & 0xf000) | ((w >> 16) & 0x0f00);
+    }
+}
+
+bool static inline stampIsNewer(uint stamp, uint since) {
+    return (int)(stamp - since) >= 0; //Same line count means we cannot tell if it happened before or after rendering
+}
+
+bool static inline tilesUnchanged(const uint16_t mapRow, uint8_t tileX, const uint count, const uint since) {
+    if (stampIsNewer(tileMapStamp[(mapRow - 0x9800) >> 5], since))
+        return false;
+    for (uint i = 0; i < count; i++, tileX++) {
+        const uint8_t tileIndex = memory[mapRow | (tileX & 0x1f)];
+        const uint tileNumber = (tileData8000 || tileIndex > 0x7f) ? tileIndex : 0x100 + tileIndex;
+        if (stampIsNewer(tileStamp[tileNumber], since))
+            return false;
+    }
+    return true;
+}
+
+bool lineIsUnchanged(const uint32_t * registers) {
+    const uint since = lineStamp[y];
+    //The newest frame in the history only holds this line if we rendered it exactly one frame ago
+    if (lineState[y] == lineInvalid || ppuLineCount - since != LINES || stampIsNewer(ppuDirtyStamp, since))
+        return false;
+    if (registers[0] != lineRegisters[y][0] || registers[1] != lineRegisters[y][1] || registers[2] != lineRegisters[y][2])
+        return false;
+
+    if (bgAndWindowDisplay) {
+        const uint8_t bgY = memory[0xff42] + y;
+        if (!tilesUnchanged((bgTileMap9C00 ? 0x9c00 : 0x9800) | (((uint16_t)bgY & 0x00f8) << 2), memory[0xff43] >> 3, STAGED_TILES, since))
+            return false;
+        if (windowEnable && y >= memory[0xff4a] && memory[0xff4b] < SCREEN_W + 7) {
+            const uint8_t windowY = wy - memory[0xff4a];
+            if (!tilesUnchanged((windowTileMap9C00 ? 0x9c00 : 0x9800) | (((uint16_t)windowY & 0x00f8) << 2), 0, STAGED_TILES, since))
+                return false;
+        }
+    }
+
+    if (objEnable) {
+        if (stampIsNewer(spriteLineStamp[y], since))
+            return false;
+        for (uint i = 0; i < nSpritesOnLine; i++) {
+            const uint tileIndex = memory[0xfe02 | spritesOnLine[i]];
+            if (stampIsNewer(tileStamp[objSize == 16 ? (tileIndex & 0xfe) : tileIndex], since) || (objSize == 16 && stampIsNewer(tileStamp[tileIndex | 0x01], since)))
+                return false;
+        }
+    }
+    return true;
+}
+
+void renderLineIfChanged() {
+    //Everything that changes the result of renderLine() and is not covered by stamps. The palettes are not, they are applied when encoding.
+    const uint32_t registers[3] = {
+        memory[0xff40] | (memory[0xff42] << 8) | (memory[0xff43] << 16), //LCDC, SCY, SCX
+        memory[0xff4a] | (memory[0xff4b] << 8), //WY, WX
+        (uint32_t)wy
+    };
+    if (lineIsUnchanged(registers)) {
+        if (lineUnchangedFrames[y] < FRAME_HISTORY - 1) { //Otherwise this line in the backBuffer is still the same from when it was last rendered into it
+            memcpy((uint8_t *)packedBackBufferLine, (uint8_t *)frameHistory[0] + y * SCREEN_LINE_BYTES, SCREEN_LINE_BYTES);
+            lineUnchangedFrames[y]++;
+        }
+        if (LINE_PALETTES(backBuffer)[y] != LINE_PALETTES(frameHistory[0])[y])
+            lineChangedFrame[y] = frameCount; //Same pixels, but the encoded line changes
+        lineState[y] = lineUnchanged;
+    } else {
+        renderLine();
+        packLine();
+        lineRegisters[y][0] = registers[0];
+        lineRegisters[y][1] = registers[1];
+        lineRegisters[y][2] = registers[2];
+        lineChangedFrame[y] = frameCount;
+        lineUnchangedFrames[y] = 0;
+        lineState[y] = lineRendered;
+    }
+    lineStamp[y] = ppuLineCount;
+}
+
 void renderStep() { //Renders eight pixels at once
     if (x == 0) { //We want to align our step to the grid of the background tiles within the current viewport
         scx = memory[0xff43];
         x -= (scx & 0x07);
     }
 
-    if (bgAndWindowDisplay) {
+    if (bgAndWindowDisplay || cgbMode) { //On the GBC, LCDC bit 0 does not disable the background but only its priority over sprites
         if (!inWindowRange)
             renderBGTiles();
         if (!inWindowRange && windowEnable && y >= memory[0xff4a] && x + 15 > memory[0xff4b]) {
@@ -215,79 +466,322 @@ void renderStep() { //Renders eight pixels at once
     x += 8;
 }
 
-void inline insertSpriteOnLine(struct SpriteAttribute * sprite) {
-    int i;
-    for (i = nSpritesOnLine; i > 0 && spritesOnLine[i-1]->x > sprite->x; i--)
-        spritesOnLine[i] = spritesOnLine[i-1];
-    spritesOnLine[i] = sprite;
-    nSpritesOnLine++;
+bool static inline cycleIsBefore(uint cycle, uint limit) {
+    return (int)(cycle - limit) < 0;
 }
 
-void oamSearch() {
-    struct SpriteAttribute * sprite;
-    while (nSpritesOnLine < MAX_SPRITES_ON_LINE && scanIndex < SPRITES_IN_MEMORY) {
-        sprite = (struct SpriteAttribute*)&memory[0xfe00 + scanIndex * sizeof(struct SpriteAttribute)];
-        if (sprite->y + objSize > y + 16 && sprite->y <= y + 16)
-            insertSpriteOnLine(sprite);
-        scanIndex++;
+bool static inline registerWritesBefore(uint cycle) {
+    return registerLogRead != registerLogWritten && cycleIsBefore(registerLog[registerLogRead % REGISTER_LOG_SIZE].cycle, cycle);
+}
+
+void static inline applyRegisterWritesBefore(uint cycle) {
+    while (registerWritesBefore(cycle)) {
+        accurateRegisters[registerLog[registerLogRead % REGISTER_LOG_SIZE].index] = registerLog[registerLogRead % REGISTER_LOG_SIZE].data;
+        registerLogRead++;
     }
 }
 
-bool inline swapFrontbuffer() {
-    if (readyBufferIsNew) {
-        volatile uint8_t * temp = readyBuffer;
-        readyBuffer = frontBuffer;
-        frontBuffer = temp;
-        readyBufferIsNew = false; //We need to track this because the PPU can be halted while the USB Video then needs to keep sending the latest frame instead of switching between two buffers.
-        return true;
+void stageSpritePixels() { //Sprites are resolved up front as their positions cannot change within the line, OBP and LCDC are applied when the pixels are mixed
+    memset(spritePixelsOnLine, 0x00, SCREEN_W);
+    for (uint i = 0; i < nSpritesOnLine; i++) { //Sorted by x, so the first sprite to set a pixel wins like on the DMG
+        const struct SpriteAttribute * sprite = (struct SpriteAttribute *)&memory[0xfe00 | spritesOnLine[i]];
+        uint8_t yOffset = y + 16 - sprite->y;
+        if (sprite->attributes & 0x40) //Vertical flip
+            yOffset ^= objSize - 1;
+        const uint tileNumber = objSize == 16 ? (sprite->tileIndex & 0xfe) | (yOffset >= 8 ? 0x01 : 0x00) : sprite->tileIndex;
+        uint16_t tileRow = tileCache[(tileNumber << 3) + (yOffset & 0x07)];
+        for (int j = 0; j < 8; j++, tileRow >>= 2) { //Rightmost pixel of the tile first
+            const int xi = (sprite->attributes & 0x20) ? sprite->x - 8 + j : sprite->x - 1 - j;
+            if (xi >= 0 && xi < SCREEN_W && (tileRow & 0x03) && !spritePixelsOnLine[xi])
+                spritePixelsOnLine[xi] = (tileRow & 0x03) | (sprite->attributes & 0x90);
+        }
+    }
+}
+
+void renderLineAccurately() {
+    stageSpritePixels();
+    const uint fineScroll = accurateRegisters[0x03] & 0x07; //Only taken into account at the start of the line, the fetcher reads the coarse part for each tile
+    uint dot = ACCURATE_FIRST_PIXEL_DOT + fineScroll; //The pixels scrolled out still take a dot each
+    uint nextSprite = 0;
+    bool inWindow = false;
+    uint windowX = 0; //WX when the window started
+    int fetchedColumn = -1;
+    uint16_t tileRow = 0;
+    for (x = 0; x < SCREEN_W; x++, dot++) {
+        applyRegisterWritesBefore(lineStartCycle + (dot >> 2) + 1);
+        const uint8_t lcdc = accurateRegisters[0x00];
+        const uint8_t wx = accurateRegisters[0x0b];
+        if (!inWindow && (lcdc & 0x20) && y >= accurateRegisters[0x0a] && (x + 7 == wx || (x == 0 && wx < 7))) {
+            inWindow = true;
+            windowX = wx;
+            fetchedColumn = -1;
+            dot += 6;
+        }
+        const uint position = inWindow ? x + 7 - windowX : x + fineScroll; //Pixel within the tiles fetched on this line
+
+        while (nextSprite < nSpritesOnLine) { //The fetcher pauses for each sprite, depending on how far it got with the current tile
+            const uint spriteX = memory[0xfe01 | spritesOnLine[nextSprite]];
+            if ((spriteX < 8 ? 0 : spriteX - 8) > x)
+                break;
+            if (lcdc & 0x02) {
+                const uint tilePixel = spriteX == 0 ? 0x07 : position & 0x07;
+                dot += 6 + (tilePixel > 2 ? tilePixel - 2 : 0);
+            }
+            nextSprite++;
+        }
+
+        if ((int)(position >> 3) != fetchedColumn) {
+            fetchedColumn = position >> 3;
+            uint16_t mapAddress;
+            uint8_t tileY;
+            if (inWindow) {
+                tileY = wy - accurateRegisters[0x0a];
+                mapAddress = ((lcdc & 0x40) ? 0x9c00 : 0x9800) | (((uint16_t)tileY & 0x00f8) << 2) | (fetchedColumn & 0x1f);
+            } else {
+                tileY = accurateRegisters[0x02] + y;
+                mapAddress = ((lcdc & 0x08) ? 0x9c00 : 0x9800) | (((uint16_t)tileY & 0x00f8) << 2) | (((accurateRegisters[0x03] >> 3) + fetchedColumn) & 0x1f);
+            }
+            const uint8_t tileIndex = memory[mapAddress];
+            const uint tileNumber = ((lcdc & 0x10) || tileIndex > 0x7f) ? tileIndex : 0x100 + tileIndex;
+            tileRow = tileCache[(tileNumber << 3) + (tileY & 0x07)];
+        }
+
+        const uint8_t bgIndex = (tileRow >> ((~position & 0x07) << 1)) & 0x03;
+        const uint8_t spritePixel = spritePixelsOnLine[x];
+        if ((lcdc & 0x02) && spritePixel && (bgIndex == 0 || !(lcdc & 0x01) || !(spritePixel & 0x80)))
+            backBufferLine[x] = PIXEL_DIRECT | ((~accurateRegisters[(spritePixel & 0x10) ? 0x09 : 0x08] >> ((spritePixel & 0x03) << 1)) & 0x03);
+        else if (lcdc & 0x01)
+            backBufferLine[x] = PIXEL_DIRECT | ((~accurateRegisters[0x07] >> (bgIndex << 1)) & 0x03);
+        else
+            backBufferLine[x] = PIXEL_DIRECT | 0x03; //Background and window disabled, the DMG shows white
+    }
+}
+
+void finishLineAccurately() { //Called at the end of each line, before y is incremented
+    if (!accurateRegistersValid || registerLogWritten - registerLogRead > REGISTER_LOG_SIZE) {
+        //We just started or core1 has overwritten entries we did not read yet, so start over with the registers as they are now
+        registerLogRead = registerLogWritten;
+        for (uint i = 0; i < sizeof(accurateRegisters); i++)
+            accurateRegisters[i] = memory[0xff40 | i];
+        accurateRegistersValid = true;
+        return;
+    }
+    const uint mode3Start = lineStartCycle + CYCLES_MODE_2;
+    applyRegisterWritesBefore(mode3Start);
+    if (y < SCREEN_H && registerWritesBefore(mode3Start + ACCURATE_MODE_3_MAX_CYCLES)) {
+        renderLineAccurately();
+        packLine();
+        lineState[y] = lineInvalid; //The registers at the start of mode 3 do not describe this line
+        lineUnchangedFrames[y] = 0;
+        lineChangedFrame[y] = frameCount;
+    }
+    applyRegisterWritesBefore(lineStartCycle + CYCLES_PER_LINE);
+}
+
+void inline insertSpriteInBucket(uint line, uint8_t offset) {
+    uint8_t * bucket = spriteBuckets[line];
+    const uint8_t spriteX = memory[0xfe01 | offset];
+    uint i;
+    for (i = spriteBucketSize[line]; i > 0 && !cgbMode && memory[0xfe01 | bucket[i-1]] > spriteX; i--) //Sorted by x on the DMG, OAM order on the GBC. Equal x keeps the OAM order.
+        bucket[i] = bucket[i-1];
+    bucket[i] = offset;
+    spriteBucketSize[line]++;
+}
+
+void buildSpriteBuckets(uint fromLine) {
+    for (uint line = fromLine; line < SCREEN_H; line++)
+        spriteBucketSize[line] = 0;
+    //Going through OAM in order, so each line gets the first ten sprites on it like on the real hardware
+    for (uint offset = 0; offset < SPRITES_IN_MEMORY * sizeof(struct SpriteAttribute); offset += sizeof(struct SpriteAttribute)) {
+        int top = (int)memory[0xfe00 | offset] - 16;
+        int bottom = top + objSize;
+        if (top < (int)fromLine)
+            top = fromLine;
+        if (bottom > SCREEN_H)
+            bottom = SCREEN_H;
+        for (int line = top; line < bottom; line++) {
+            if (spriteBucketSize[line] < MAX_SPRITES_ON_LINE)
+                insertSpriteInBucket(line, offset);
+        }
+    }
+    //Only lines whose sprites differ from the last update count as changed, so an OAM DMA that moves a few sprites does not make every line with sprites render again
+    const uint32_t volatile * oam = (const uint32_t volatile *)&memory[0xfe00]; //Aligned, the OAM DMA writes it in words as well
+    for (uint line = fromLine; line < SCREEN_H; line++) {
+        bool changed = false;
+        for (uint i = 0; i < MAX_SPRITES_ON_LINE; i++) {
+            const uint32_t sprite = i < spriteBucketSize[line] ? oam[spriteBuckets[line][i] >> 2] : 0xffffffff;
+            if (sprite != spriteLineOAM[line][i]) {
+                spriteLineOAM[line][i] = sprite;
+                changed = true;
+            }
+        }
+        if (changed)
+            spriteLineStamp[line] = ppuLineCount;
     }
-    return false;
+}
+
+void updateSpriteBuckets() { //Called whenever a new line starts
+    if (y == SCREEN_H && spriteBucketsPartial)
+        oamChanged = true; //Lines above the last change still need to be updated for the next frame
+    if (!oamChanged || oamDmaBusy())
+        return;
+    oamChanged = false; //Cleared before reading OAM, so a write while we are building triggers another update
+    const uint fromLine = y < SCREEN_H ? y : 0; //The current frame has already passed the lines above
+    buildSpriteBuckets(fromLine);
+    spriteBucketsPartial = fromLine > 0;
+}
+
+void invalidateLines() {
+    memset(lineState, lineInvalid, sizeof(lineState));
+    memset(lineUnchangedFrames, 0, sizeof(lineUnchangedFrames));
+    for (uint i = 0; i < SCREEN_H; i++)
+        lineChangedFrame[i] = frameCount;
+}
+
+void ppuInit() {
+    readyBufferIsNew = false;
+    resetStreaming();
+    lcdOff = false;
+    renderState = start;
+    y = 0;
+    x = 0;
+    lineCycle = 0;
+    lineStartCycle = cycleIndex;
+    accurateRegistersValid = false;
+    invalidateLines();
+    oamChanged = true;
+    updateSpriteBuckets();
+}
+
+void oamSearch() {
+    spritesOnLine = spriteBuckets[y];
+    nSpritesOnLine = spriteBucketSize[y];
+}
+
+bool inline swapFrontbuffer(bool allowStreaming) {
+    bool swapped = true;
+    uint32_t interrupts = save_and_disable_interrupts(); //The DMA interrupt of the encoder swaps the readyBuffer and the encodeBuffer
+    volatile uint8_t * temp = frontBuffer;
+    if (allowStreaming && startStreaming()) { //The frame in the encodeBuffer is newer than anything in the readyBuffer
+        frontBuffer = encodeBuffer;
+        encodeBuffer = temp;
+        if (readyBufferIsNew)
+            telemetry.droppedFrames++;
+        readyBufferIsNew = false;
+    } else if (readyBufferIsNew) {
+        frontBuffer = readyBuffer;
+        readyBuffer = temp;
+        readyBufferIsNew = false; //We need to track this because the PPU can be halted while the USB Video then needs to keep sending the latest frame instead of switching between two buffers.
+    } else
+        swapped = false;
+    restore_interrupts(interrupts);
+    return swapped;
 }
 
 void inline swapBackbuffer() {
-    volatile uint8_t * temp = backBuffer;
-    backBuffer = lastBuffer;
-    lastBuffer = temp;
+    //The finished frame becomes the newest one in the history and we render over the oldest one
+    volatile uint8_t * oldest = frameHistory[FRAME_HISTORY - 2];
+    for (uint i = FRAME_HISTORY - 2; i > 0; i--)
+        frameHistory[i] = frameHistory[i - 1];
+    frameHistory[0] = backBuffer;
+    backBuffer = oldest;
+}
+
+void static inline advanceWindowLine() {
+    if (windowEnable) {
+        //I could not find solid information about this, but comparing the behaviour of the banners in Samurai Shodown
+        //and the credit banners in Prehistoric Man it seems that turning the window on midframe has the same effect as
+        //if it had been all along (i.e. its internal counter equals LY). Only if it is turned off midframe and then
+        //turned on again its internal line counter falls behind LY by the number of lines it has been turned off.
+        if (wy < 0)
+            wy = y;
+        else
+            wy++;
+    }
+}
+
+void turnLcdOff() {
+    //The Game Boy shows a blank screen, which we send once instead of repeating the last frame. Rendering and encoding stop until the LCD is turned on again.
+    lcdOff = true;
+    if (y < SCREEN_H) //The rest of the frame stays blank like the lines turnLcdOn skips, USB may already be sending it
+        memset((uint8_t *)backBuffer + y * SCREEN_LINE_BYTES, DIRECT_PIXEL_PAIR(0x03), (SCREEN_H - y) * SCREEN_LINE_BYTES);
+    y = 0; //LY reads zero while the LCD is off
+    lineCycle = 0;
+    renderState = done;
+    showBlankFrame();
+}
+
+void turnLcdOn() {
+    //The PPU starts over at the beginning of line 0 the moment LCDC bit 7 is set, so we know exactly where it is without waiting for a sync
+    lcdOff = false;
+    uint sinceEnable = ppuBusCycle - lcdEnableCycle;
+    if (doubleSpeed)
+        sinceEnable >>= 1;
+    sinceEnable %= CYCLES_PER_FRAME; //If core0 was busy for a while, the PPU may already be a few lines further
+    lineCycle = sinceEnable % CYCLES_PER_LINE;
+    lineStartCycle = ppuBusCycle - lineCycle;
+    vblankOffset = 0; //Anything measured while the LCD was off is meaningless
+    x = 0;
+    y = sinceEnable / CYCLES_PER_LINE;
+    //The lines we missed stay blank like the rest of the frame after turning the LCD off
+    memset((uint8_t *)backBuffer, DIRECT_PIXEL_PAIR(0x03), (y < SCREEN_H ? y : SCREEN_H) * SCREEN_LINE_BYTES);
+    wy = gameInfo.windowLineAlwaysPauses ? 0 : -1;
+    advanceWindowLine();
+    nSpritesOnLine = 0;
+    inWindowRange = false;
+    invalidateLines(); //The lines in the history are from before the LCD was turned off
+    accurateRegistersValid = false;
+    oamChanged = true;
+    updateSpriteBuckets();
+    renderState = (y >= SCREEN_H) ? done : start;
 }
 
 void ppuStep(uint advance) { //Note that due to USB interrupts on this core we might skip a few cycles and still need to keep in sync with the Game Boy
-    if (!lcdAndPpuEnable)
+    if (!lcdAndPpuEnable) {
+        if (!lcdOff)
+            turnLcdOff();
         return;
+    }
+    if (lcdOff) {
+        turnLcdOn();
+        return; //lineCycle already includes this step
+    }
 
     lineCycle += advance;
 
     if (renderState == rendering) {
         if (x >= SCREEN_W) {
+            packLine();
             renderState = done;
             DEBUG_MARK_RENDERSTOP
-        } else
+            TELEMETRY_RENDER_STOP
+        } else {
+            DEBUG_RENDER_TIME_START
             renderStep();
+            DEBUG_RENDER_TIME_STOP
+        }
     } else {
         if (lineCycle >= CYCLES_PER_LINE) {
+            if (gameInfo.accurateRendering && !cgbMode)
+                finishLineAccurately();
             lineCycle -= CYCLES_PER_LINE;
+            lineStartCycle = ppuBusCycle - lineCycle;
             x = 0;
             nSpritesOnLine = 0;
-            scanIndex = 0;
             inWindowRange = false;
             y++;
+            ppuLineCount++;
+            serviceTileCacheRequests();
             if (y >= LINES) {
                 y = 0;
                 wy = gameInfo.windowLineAlwaysPauses ? 0 : -1;
                 DEBUG_MARK_YRESET
                 swapBackbuffer();
-                if (!readyBufferIsNew)
-                    startBackbufferToJPEG(true);
-            }
-            if (windowEnable) {
-                //I could not find solid information about this, but comparing the behaviour of the banners in Samurai Shodown
-                //and the credit banners in Prehistoric Man it seems that turning the window on midframe has the same effect as
-                //if it had been all along (i.e. its internal counter equals LY). Only if it is turned off midframe and then
-                //turned on again its internal line counter falls behind LY by the number of lines it has been turned off.
-                if (wy < 0)
-                    wy = y;
-                else
-                    wy++;
+                frameCount++;
+                startBackbufferToJPEG(true); //If USB has not picked up the last frame yet, this one replaces it
             }
+            updateSpriteBuckets();
+            advanceWindowLine();
             renderState = (y >= SCREEN_H) ? done : start;
         }
 
@@ -300,10 +794,25 @@ void ppuStep(uint advance) { //Note that due to USB interrupts on this core we m
             case oamSearchDone:
                 DEBUG_MARK_OAMSEARCHSTOP
                 if (lineCycle >= CYCLES_MODE_2) {
-                    backBufferLine = (uint8_t *)backBuffer + y * SCREEN_W;
-                    renderState = rendering;
+                    updateWrittenTiles(); //Also the ones written during mode 2 of this line
+                    packedBackBufferLine = backBuffer + y * SCREEN_LINE_BYTES;
+                    LINE_PALETTES(backBuffer)[y] = memory[0xff47] | (memory[0xff48] << 8) | (memory[0xff49] << 16);
                     currentSpriteOnLine = 0;
                     DEBUG_MARK_RENDERSTART
+                    TELEMETRY_RENDER_START
+                    if (wholeLineRendering && !cgbMode) {
+                        DEBUG_RENDER_TIME_START
+                        renderLineIfChanged();
+                        DEBUG_RENDER_TIME_STOP
+                        renderState = done;
+                        DEBUG_MARK_RENDERSTOP
+                        TELEMETRY_RENDER_STOP
+                    } else {
+                        lineState[y] = lineInvalid; //Registers may change while we render in steps
+                        lineUnchangedFrames[y] = 0;
+                        lineChangedFrame[y] = frameCount;
+                        renderState = rendering;
+                    }
                 }
                 break;
             case done:
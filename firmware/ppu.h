@@ -9,6 +9,22 @@
 #define SCREEN_H 144
 #define SCREEN_SIZE (SCREEN_W * SCREEN_H)
 
+//Frame buffers (back buffer, frame history, OSD) hold palette indices instead of colors, so palettes are only applied when the frame is encoded. Each pixel takes 4 bit: The source
+//in the upper two bits (BGP, OBP0, OBP1 or a direct shade that does not go through a palette) and the palette index in the lower two bits. Two pixels per byte with the leftmost pixel in the high nibble.
+//The palette registers of each line are stored behind the pixels of the frame, see LINE_PALETTES.
+#define SCREEN_LINE_BYTES (SCREEN_W / 2)
+#define SCREEN_BYTES (SCREEN_SIZE / 2)
+#define FRAME_BUFFER_SIZE (SCREEN_BYTES + SCREEN_H * 4)
+#define LINE_PALETTES(BUFFER) ((uint32_t volatile *)((BUFFER) + SCREEN_BYTES)) //BGP, OBP0 and OBP1 in the lower three bytes for each line
+#define PIXEL_BGP 0x00
+#define PIXEL_OBP0 0x04
+#define PIXEL_OBP1 0x08
+#define PIXEL_DIRECT 0x0c //Shades that are already resolved: GBC colors, screens and text
+#define DIRECT_PIXEL_PAIR(COLOR) (0xcc | ((COLOR) * 0x11))
+#define PACKED_PIXEL_SHIFT(X) ((~(X) & 0x01) << 2)
+#define SET_PACKED_PIXEL(BUFFER, X, Y, COLOR) \
+(BUFFER)[(Y) * SCREEN_LINE_BYTES + ((X) >> 1)] = ((BUFFER)[(Y) * SCREEN_LINE_BYTES + ((X) >> 1)] & ~(0x0f << PACKED_PIXEL_SHIFT(X))) | ((PIXEL_DIRECT | (COLOR)) << PACKED_PIXEL_SHIFT(X));
+
 #define CYCLES_PER_FRAME 17556
 #define CYCLES_PER_LINE 114
 #define CYCLES_MODE_0 51 //max, actually 87 to 204 dots
@@ -18,16 +34,18 @@
 #define CYCLES_LATEST_HBLANK (CYCLES_PER_LINE - 21) //At that point we are certainly in hblank
 #define LINES 154
 
-bool swapFrontbuffer();
+bool swapFrontbuffer(bool allowStreaming);
 void ppuInit();
 void ppuStep(uint advance);
 
 extern uint8_t volatile * frontBuffer;
 extern uint8_t volatile * readyBuffer;
+extern uint8_t volatile * encodeBuffer;
+extern uint8_t * const rawFrame;
 extern uint8_t volatile * backBuffer;
-extern uint8_t volatile * lastBuffer;
-
-extern bool frameBlending;
+#define FRAME_HISTORY 3 //Frames blended by the encoder: the backBuffer and the completed frames in frameHistory
+extern uint8_t volatile * frameHistory[];
+extern bool wholeLineRendering;
 
 enum RenderState {done = 0, start, oamSearchDone, rendering};  
 extern volatile enum RenderState renderState;
@@ -35,7 +53,7 @@ extern volatile enum RenderState renderState;
 extern uint lineCycle;
 extern int y;
 
-extern bool readyBufferIsNew;
+extern volatile bool readyBufferIsNew;
 extern int volatile vblankOffset;
 
 extern volatile bool windowTileMap9C00;
@@ -46,10 +64,53 @@ extern volatile uint objSize;
 extern volatile bool objEnable;
 extern volatile bool bgAndWindowDisplay;
 extern volatile bool lcdAndPpuEnable;
+extern volatile uint lcdEnableCycle;
+extern volatile bool oamChanged;
+
+#define CGB_OBJ_PALETTES 0x20 //Offset of the object palettes in cgbPalette
+extern volatile uint8_t cgbPaletteRAM[];
+extern volatile uint8_t cgbPalette[]; //Already combined with PIXEL_DIRECT
+void writeCgbPalette(uint8_t index, uint8_t data);
 
-extern volatile uint8_t paletteBG[];
-extern volatile uint8_t paletteOBP0[];
-extern volatile uint8_t paletteOBP1[];
+//Decoded tile rows: eight 2 bit palette indices per row with the rightmost pixel in the lowest bits.
+//Bank 0 covers 0x8000-0x97ff, bank 1 (GBC only) our copy at 0x0000-0x17ff, 384 tiles with eight rows each.
+#define TILE_CACHE_BANK_SIZE (384 * 8)
+#define TILES (2 * TILE_CACHE_BANK_SIZE / 8)
+extern volatile uint16_t tileCache[];
+#define IS_TILE_DATA(ADDR) (((ADDR) & 0x7fff) < 0x1800)
+#define TILE_CACHE_INDEX(ADDR) (((ADDR) & 0x8000 ? 0 : TILE_CACHE_BANK_SIZE) + (((ADDR) & 0x1fff) >> 1))
+//Core1 only marks the tile as written (two byte stores), core0 decodes it before rendering the next line, see updateWrittenTiles
+#define TILE_CACHE_MARK(ADDR) \
+tileWritten[TILE_CACHE_INDEX(ADDR) >> 3] = 1; \
+tilesWritten = true;
+extern volatile uint8_t tileWritten[];
+extern volatile bool tilesWritten;
+void requestTileCacheUpdate(uint16_t address, uint length);
+
+//Dirty line tracking: Writes are stamped with the line count at which they happened, so the PPU can tell if anything a line depends on has changed since it was last rendered.
+extern volatile uint ppuLineCount;
+extern volatile uint tileStamp[];    //Per tile, both banks like tileCache
+extern volatile uint tileMapStamp[]; //Per row of 32 tiles, 0x9800 to 0x9fff
+extern volatile uint ppuDirtyStamp;  //Everything rendered before this needs to be rendered again
+extern uint frameCount;
+extern uint lineChangedFrame[]; //Frame in which the content of each line last changed
+
+//Accurate rendering (per game, DMG only): Core1 logs writes to the registers that can cause mid-line effects together with their bus cycle, so the PPU can tell where within a line they happened.
+#define REGISTER_LOG_SIZE 128
+struct RegisterWrite {
+    uint cycle;
+    uint8_t index; //Address - 0xff40
+    uint8_t data;
+};
+extern struct RegisterWrite volatile registerLog[];
+extern uint volatile registerLogWritten;
+extern uint ppuBusCycle; //Bus cycle the PPU has been advanced to, set by the main loop
+#define IS_LOGGED_REGISTER(ADDR) (((ADDR) & 0xfff0) == 0xff40 && ((0x0f8d >> ((ADDR) & 0x0f)) & 0x01)) //LCDC, SCY, SCX, BGP, OBP0, OBP1, WY and WX
+#define LOG_REGISTER_WRITE(ADDR, DATA) \
+registerLog[registerLogWritten % REGISTER_LOG_SIZE].cycle = cycleIndex; \
+registerLog[registerLogWritten % REGISTER_LOG_SIZE].index = (ADDR) & 0x0f; \
+registerLog[registerLogWritten % REGISTER_LOG_SIZE].data = (DATA); \
+registerLogWritten++;
 
 struct __attribute__((__packed__)) SpriteAttribute {
 	uint8_t y;
@@ -0,0 +1,55 @@
+#include "telemetry.h"
+
+#include "hardware/clocks.h"
+
+#include <stdio.h>
+#include <string.h>
+
+struct Telemetry telemetry;
+
+void resetTelemetry() {
+    memset(&telemetry, 0, sizeof(telemetry));
+    telemetry.startMillis = to_ms_since_boot(get_absolute_time());
+}
+
+void printTelemetryHistogram(const char * name, const uint * histogram, int firstValue, uint binWidth) {
+    printf("%s:", name);
+    for (uint i = 0; i < TELEMETRY_BINS; i++)
+        printf(" %d:%u", firstValue + (int)(i * binWidth), histogram[i]);
+    printf("\n");
+}
+
+void printTelemetryLogHistogram(const char * name, const uint * histogram, uint firstBin, uint bins, bool negative) {
+    //Bins are labeled with their lowest magnitude
+    printf("%s:", name);
+    for (uint i = 0; i < bins; i++) {
+        const uint bin = negative ? firstBin - i : firstBin + i;
+        printf(" %s%u:%u", negative && i ? "-" : "", i ? 1u << (i - 1) : 0, histogram[bin]);
+    }
+    printf("\n");
+}
+
+void printTelemetry() {
+    const uint now = to_ms_since_boot(get_absolute_time());
+    printf("\nTelemetry over %u ms, %u frames\n", now - telemetry.startMillis, telemetry.frames);
+    printTelemetryHistogram("Render start (line cycle)", telemetry.renderStart, 0, 8);
+    printTelemetryHistogram("Render stop (line cycle)", telemetry.renderStop, 0, 8);
+    printTelemetryLogHistogram("PPU step (cycles)", telemetry.stepCycles, 0, TELEMETRY_BINS, false);
+    printTelemetryLogHistogram("Correction per frame (cycles)", telemetry.frameCorrection, TELEMETRY_BINS / 2, TELEMETRY_BINS / 2, false);
+    printTelemetryLogHistogram("Negative correction per frame (cycles)", telemetry.frameCorrection, TELEMETRY_BINS / 2, TELEMETRY_BINS / 2 + 1, true);
+    printf("Steps of at least %d cycles: %u, longest %u cycles, last one %u ms ago\n", TELEMETRY_SPIKE_CYCLES, telemetry.spikes, telemetry.maxStepCycles, telemetry.spikes ? now - telemetry.lastSpikeMillis : 0);
+    printf("Encoded frames dropped: %u, repeated: %u (unchanged: %u), streamed unfinished: %u, streaming waited for the encoder: %u\n", telemetry.droppedFrames, telemetry.repeatedFrames, telemetry.unchangedFrames, telemetry.overtakenFrames, telemetry.stalledFrames);
+    if (telemetry.nativeFrames) {
+        const uint cyclesPerMicro = clock_get_hz(clk_sys) / 1000000;
+        printf("Native frames encoded by core0: %u, average %u us, longest %u us of the %u us per frame\n", telemetry.nativeFrames, (uint)(telemetry.nativeCycles / telemetry.nativeFrames / cyclesPerMicro), telemetry.maxNativeCycles / cyclesPerMicro, 1000000 / 60);
+    }
+    #ifdef CPU_JPEG_ENCODER
+        printf("CPU encoder: %u frames packed, %u cycles per frame\n", telemetry.packedFrames, telemetry.packedFrames ? (uint)(telemetry.encodeCycles / telemetry.packedFrames) : 0);
+    #endif
+    printf("Lines done after hblank started:");
+    for (uint line = 0; line < SCREEN_H; line++) {
+        if (telemetry.lateLines[line])
+            printf(" %u:%u", line, telemetry.lateLines[line]);
+    }
+    printf("\n\n");
+}
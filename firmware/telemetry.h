@@ -0,0 +1,83 @@
+#ifndef GBINTERCEPTOR_TELEMETRY
+#define GBINTERCEPTOR_TELEMETRY
+
+#include "pico/stdlib.h"
+#include "ppu.h"
+
+//Unlike DEBUG_PPU_TIMING, these histograms are always recorded. Each event only costs an increment, the formatting happens when they are requested via USB serial (send 't' to print them, 'r' to reset them).
+
+#define TELEMETRY_BINS 16
+#define TELEMETRY_CYCLE_BIN(CYCLES) ((CYCLES) >= (TELEMETRY_BINS - 1) * 8 ? TELEMETRY_BINS - 1 : (CYCLES) >> 3) //Eight cycles per bin, the last one collects everything beyond
+#define TELEMETRY_SPIKE_CYCLES CYCLES_PER_LINE //A ppuStep that comes later than this means that core0 was busy for at least a whole line
+
+struct Telemetry {
+    uint renderStart[TELEMETRY_BINS];      //Line cycle at which a line has been rendered...
+    uint renderStop[TELEMETRY_BINS];       //...and at which it was done
+    uint stepCycles[TELEMETRY_BINS];       //Cycles between two calls of ppuStep in powers of two (0, 1, 2-3, 4-7, ...)
+    uint frameCorrection[TELEMETRY_BINS];  //Sum of vblankOffset corrections per frame in powers of two, negative ones in the lower half
+    uint lateLines[SCREEN_H];              //Number of times each line was done after CYCLES_LATEST_HBLANK
+    uint frames;
+    uint spikes;                           //Steps of at least TELEMETRY_SPIKE_CYCLES
+    uint lastSpikeMillis;
+    uint maxStepCycles;
+    uint droppedFrames;                    //Encoded frames replaced by a newer one before USB picked them up
+    uint repeatedFrames;                   //Frames without a new JPEG for USB, so the host keeps showing the previous one
+    uint unchangedFrames;                  //Frames that have not been encoded as nothing changed, also counted as repeated
+    uint overtakenFrames;                  //Frames USB sent unfinished as they were aborted while streaming, streaming pauses after each one
+    uint stalledFrames;                    //Streamed frames USB had to wait for, as the encoder had not finished them in time
+    uint64_t encodeCycles;                 //Cycles core0 spent on packing the JPEG data, only with CPU_JPEG_ENCODER...
+    uint packedFrames;                     //...and the frames it has packed completely, unchanged frames are not packed at all
+    uint64_t nativeCycles;                 //Cycles core0 spent on blending and encoding complete native frames...
+    uint nativeFrames;                     //...the number of these frames...
+    uint maxNativeCycles;                  //...and the most cycles one of them took
+    uint startMillis;
+};
+
+extern struct Telemetry telemetry;
+
+void resetTelemetry();
+void printTelemetry();
+
+#define TELEMETRY_RENDER_START \
+    telemetry.renderStart[TELEMETRY_CYCLE_BIN(lineCycle)]++;
+
+#define TELEMETRY_RENDER_STOP \
+    telemetry.renderStop[TELEMETRY_CYCLE_BIN(lineCycle)]++; \
+    if (lineCycle > CYCLES_LATEST_HBLANK) \
+        telemetry.lateLines[y]++;
+
+uint static inline telemetryLogBin(uint value, uint bins) { //0 for 0, otherwise 1 + floor(log2(value)), limited to the last bin
+    const uint bin = value ? 32 - __builtin_clz(value) : 0;
+    return bin < bins - 1 ? bin : bins - 1;
+}
+
+void static inline telemetryStep(uint cycles) {
+    if (!cycles) { //Most calls from the main loop, so they should not cost more than the increment
+        telemetry.stepCycles[0]++;
+        return;
+    }
+    telemetry.stepCycles[telemetryLogBin(cycles, TELEMETRY_BINS)]++;
+    if (cycles >= TELEMETRY_SPIKE_CYCLES) {
+        telemetry.spikes++;
+        telemetry.lastSpikeMillis = to_ms_since_boot(get_absolute_time());
+        if (cycles > telemetry.maxStepCycles)
+            telemetry.maxStepCycles = cycles;
+    }
+}
+
+void static inline telemetryFrame(int correction) {
+    telemetry.frames++;
+    if (correction >= 0)
+        telemetry.frameCorrection[TELEMETRY_BINS / 2 + telemetryLogBin(correction, TELEMETRY_BINS / 2)]++;
+    else
+        telemetry.frameCorrection[TELEMETRY_BINS / 2 - telemetryLogBin(-correction, TELEMETRY_BINS / 2 + 1)]++;
+}
+
+void static inline telemetryNativeFrame(uint cycles) {
+    telemetry.nativeFrames++;
+    telemetry.nativeCycles += cycles;
+    if (cycles > telemetry.maxNativeCycles)
+        telemetry.maxNativeCycles = cycles;
+}
+
+#endif
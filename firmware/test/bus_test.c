@@ -0,0 +1,265 @@
+//Feeds recorded bus traces to the opcode handlers and checks the state they leave behind.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cpubus.h"
+#include "opcodes.h"
+#include "bootrom.h"
+#include "ppu.h"
+#include "checkpoint.h"
+#include "hardware/structs/systick.h"
+
+void reset();
+extern bool cgbConsole;
+void setupPIO();
+void setupOamDMA();
+void pioGetNextFromBus(); //The real getNextFromBus from cpubus.c
+
+extern uint spriteLineStamp[SCREEN_H]; //Not in ppu.h, only the PPU uses them
+void updateSpriteBuckets();
+void updateWrittenTiles();
+
+#define READ(ADDR, DATA) (((uint32_t)(DATA) << 16) | (uint16_t)(ADDR))
+#define NOP_AT(ADDR) READ(ADDR, 0x00)
+
+const uint32_t * trace;
+uint traceLength;
+uint traceIndex;
+
+void getNextFromBus() {
+    //Put the next bus event into the RX FIFO of the bus SM and let cpubus.c pick it up like on the real thing. After the trace, the CPU keeps executing NOPs.
+    uint32_t event;
+    if (traceIndex < traceLength)
+        event = trace[traceIndex];
+    else
+        event = NOP_AT((uint16_t)trace[traceLength-1] + (traceIndex - traceLength) + 1);
+    traceIndex++;
+    *(volatile uint32_t *)&pio0->rxf[0] = event;
+    pioGetNextFromBus();
+}
+
+void startTrace(const uint32_t * events, uint length) {
+    trace = events;
+    traceLength = length;
+    traceIndex = 0;
+    for (int i = 0; i <= HISTORY_READAHEAD; i++) //Fill the read ahead until the first event is the current one
+        getNextFromBus();
+}
+
+void startGbc() {
+    reset();
+    cycleRatio = 60;
+    systick_hw->rvr = cycleRatio - 1;
+    cartridgeCgbFlag = 0x80;
+    enableCgbMode();
+}
+
+int failures = 0;
+
+#define CHECK(CONDITION) do { if (!(CONDITION)) { printf("  FAILED: %s (line %d)\n", #CONDITION, __LINE__); failures++; } } while (0)
+
+void testSpeedSwitch() {
+    printf("speed switch\n");
+    const uint32_t events[] = {
+        READ(0x0150, 0x3e), READ(0x0151, 0x01),                     //LD A, 0x01
+        READ(0x0152, 0xe0), READ(0x0153, 0x4d), READ(0xff4d, 0x01), //LDH (0x4d), A
+        READ(0x0154, 0x10), READ(0x0155, 0x00),                     //STOP
+        READ(0x0156, 0x00), READ(0x0156, 0x00),                     //The opcode after STOP shows up twice when the clock returns
+        READ(0x0157, 0x00),                                         //NOP
+    };
+    startGbc();
+    startTrace(events, sizeof(events) / sizeof(events[0]));
+
+    uint16_t boundaries[8];
+    uint count = 0;
+    while (*address < 0x0158 && count < 8) {
+        boundaries[count++] = *address;
+        (*opcodes[*opcode])();
+    }
+
+    const uint16_t expected[] = {0x0150, 0x0152, 0x0154, 0x0156, 0x0157};
+    CHECK(count == sizeof(expected) / sizeof(expected[0]));
+    CHECK(memcmp(boundaries, expected, sizeof(expected)) == 0);
+    CHECK(*a == 0x01);
+    CHECK(doubleSpeed);
+    CHECK(memory[0xff4d] == 0x80);
+    CHECK(systick_hw->rvr == cycleRatio / 2 - 1);
+}
+
+void testHdmaAcrossWramBanks() {
+    printf("HDMA from 0xcff0 across banked WRAM\n");
+    startGbc();
+    toMemory(0xff70, 0x02); //WRAM bank 2 at 0xd000
+    for (uint i = 0; i < 0x10; i++) {
+        toMemory(0xcff0 + i, 0x10 + i);
+        toMemory(0xd000 + i, 0x20 + i);
+    }
+    toMemory(0xff51, 0xcf);
+    toMemory(0xff52, 0xf0);
+    toMemory(0xff53, 0x00);
+    toMemory(0xff54, 0x00);
+    toMemory(0xff55, 0x01); //General purpose, 32 bytes
+    bool correct = true;
+    for (uint i = 0; i < 0x10; i++)
+        correct = correct && memory[0x8000 + i] == 0x10 + i && memory[0x8010 + i] == 0x20 + i;
+    CHECK(correct);
+    CHECK(ignoreCycles == 2 * 8);
+}
+
+void testHblankDmaFromCartridge() {
+    printf("HBlank DMA from the cartridge\n");
+    startGbc();
+    toMemory(0xff51, 0x40);
+    toMemory(0xff52, 0x00);
+    toMemory(0xff53, 0x00);
+    toMemory(0xff54, 0x00);
+    toMemory(0xff55, 0x81);
+    CHECK(!cartridgeDMA);
+    CHECK(ignoreCycles == 0);
+}
+
+void testRebootIntoDmgGame() {
+    printf("reboot from a GBC game in double speed into a DMG game\n");
+    startGbc();
+    cgbConsole = true;
+    toMemory(0xff70, 0x03);
+    toMemory(0xff4f, 0x01);
+    setDoubleSpeed(true);
+    cartridgeCgbFlag = 0x00; //As seen by resync while the boot rom checks the new header
+    softReset(true);
+    CHECK(!cgbMode);
+    CHECK(!doubleSpeed);
+    CHECK(memory[0xff4d] == 0x00);
+    CHECK(systick_hw->rvr == cycleRatio - 1);
+    bool unmapped = true;
+    for (uint page = 0x0; page < 0x10; page++)
+        unmapped = unmapped && memoryPageOffset[page] == 0x0000;
+    CHECK(unmapped);
+    CHECK(memory[0xff4f] == 0x00 && memory[0xff70] == 0x00);
+}
+
+bool turnOffDuringHalt() { //Returns if the emulation stopped without an error
+    running = true;
+    testGpioValue = false;
+    *(volatile uint32_t *)&pio0->fstat = busPIOemptyMask; //No more clock
+    systick_hw->csr = 0x00010000; //Stays set here, so every check counts as a missed cycle
+    for (uint i = 0; i < 3 * CYCLES_PER_FRAME && running; i++)
+        pioGetNextFromBus();
+    const bool clean = !running && error == NULL;
+    *(volatile uint32_t *)&pio0->fstat = 0;
+    systick_hw->csr = 0;
+    testGpioValue = true;
+    running = false;
+    return clean;
+}
+
+void testTurnOffDuringBootRom() {
+    printf("turning the Game Boy off during the boot logo\n");
+    reset();
+    startBootRom();
+    CHECK(turnOffDuringHalt());
+    reset();
+    startBootRom();
+    endBootRom(); //Same thing during a game is still reported
+    CHECK(!turnOffDuringHalt());
+}
+
+void testResyncKeepsMemory() {
+    printf("resync keeps the memory written after the checkpoint\n");
+    const uint32_t events[] = {
+        READ(0x0150, 0x3e), READ(0x0151, 0x5a),                                         //LD A, 0x5a
+        READ(0x0152, 0xea), READ(0x0153, 0x23), READ(0x0154, 0xc1), READ(0xc123, 0x5a), //LD (0xc123), A
+        READ(0x0155, 0x00), READ(0x0156, 0x00),                                         //Two cycles of the LD above
+        READ(0x0157, 0xd3),                                                             //Unknown opcode
+        READ(0x0158, 0x00), READ(0x0158, 0x00), READ(0xdfff, 0x01), READ(0xdffe, 0x59), READ(0x0040, 0x00), //Interrupt entry with the same sp as at the checkpoint
+    };
+    reset();
+    running = true;
+    sp = 0xdffe; //As if the main loop had just pushed the return address of the checkpointed vblank
+    *a = 0x12;
+    saveCheckpoint(0x0040);
+    startTrace(events, sizeof(events) / sizeof(events[0])); //resync() reads the bus without the trace, so the interrupt entry has to be in the read ahead when the desync happens
+
+    for (uint i = 0; i < 8 && !resyncRequested; i++)
+        (*opcodes[*opcode])();
+    CHECK(resyncRequested);
+    CHECK(*a == 0x5a);
+    resync();
+
+    CHECK(!resyncRequested);
+    CHECK(running);
+    CHECK(resyncCount == 1);
+    CHECK(memory[0xc123] == 0x5a); //Written after the checkpoint, still what the Game Boy has
+    CHECK(*a == 0x12); //The registers are back to the checkpoint
+    CHECK(sp == 0xe000); //The main loop pushes the return address again
+    running = false;
+}
+
+void testOamDmaStampsMovedSprites() {
+    printf("OAM DMA only marks the lines of sprites that moved\n");
+    reset();
+    objSize = 8;
+    for (uint i = 0; i < 0xa0; i++)
+        toMemory(0xc000 + i, 0x00); //y = 0, not on screen
+    const uint8_t sprites[] = {16 + 10, 20, 0x01, 0x00, 16 + 50, 40, 0x02, 0x00};
+    for (uint i = 0; i < sizeof(sprites); i++)
+        toMemory(0xc000 + i, sprites[i]);
+    toMemory(0xff46, 0xc0);
+    y = SCREEN_H;
+    updateSpriteBuckets();
+
+    ppuLineCount += LINES;
+    toMemory(0xc005, 41); //Second sprite one pixel to the right
+    toMemory(0xff46, 0xc0);
+    updateSpriteBuckets();
+    CHECK(spriteLineStamp[10] != ppuLineCount && spriteLineStamp[17] != ppuLineCount);
+    CHECK(spriteLineStamp[50] == ppuLineCount && spriteLineStamp[57] == ppuLineCount);
+    CHECK(spriteLineStamp[49] != ppuLineCount && spriteLineStamp[58] != ppuLineCount);
+
+    ppuLineCount += LINES;
+    toMemory(0xff46, 0xc0); //Same OAM again
+    updateSpriteBuckets();
+    CHECK(spriteLineStamp[50] != ppuLineCount);
+    y = 0;
+}
+
+void testTileWritesDecodedOnCore0() {
+    printf("tile data written on core1 is decoded by the PPU\n");
+    startGbc();
+    toMemory(0x8010, 0xff); //First row of tile 1, lower bit plane
+    toMemory(0x8011, 0x00);
+    toMemory(0xff4f, 0x01);
+    toMemory(0x8000, 0x00); //First row of tile 0 in bank 1, upper bit plane
+    toMemory(0x8001, 0xff);
+    CHECK(tilesWritten);
+    CHECK(tileCache[8] == 0x0000 && tileCache[TILE_CACHE_BANK_SIZE] == 0x0000); //Only marked so far
+    ppuLineCount += 3;
+    updateWrittenTiles();
+    CHECK(tileCache[8] == 0x5555);
+    CHECK(tileCache[TILE_CACHE_BANK_SIZE] == 0xaaaa);
+    CHECK(tileStamp[1] == ppuLineCount && tileStamp[TILES / 2] == ppuLineCount);
+    CHECK(tileStamp[0] != ppuLineCount);
+    CHECK(!tilesWritten && !tileWritten[1] && !tileWritten[TILES / 2]);
+}
+
+int main() {
+    setupPIO();
+    setupOamDMA();
+    ppuInit();
+
+    testSpeedSwitch();
+    testHdmaAcrossWramBanks();
+    testHblankDmaFromCartridge();
+    testRebootIntoDmgGame();
+    testTurnOffDuringBootRom();
+    testResyncKeepsMemory();
+    testOamDmaStampsMovedSprites();
+    testTileWritesDecodedOnCore0();
+
+    if (failures) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+//Encodes random frames with jpeg.c built with CPU_JPEG_ENCODER, checks that the result is exactly what the encode SMs make of the same input and reports the time per frame on this machine.
+//The cycles on the RP2040 are in the telemetry ('t' via USB serial) of a CPU_JPEG_ENCODER build.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppu.h"
+#include "jpeg.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+
+extern uint32_t encodeInput[SCREEN_SIZE / 8]; //Not in jpeg.h, only the encoder uses it
+
+#define FRAMES 1000
+
+uint32_t randomState = 1;
+
+uint32_t randomNumber() { //xorshift, like in ppu_bench.c
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+void randomScreen() {
+    //Random pixels from all palettes, so every difference between neighbouring pixels shows up
+    for (uint i = 0; i < SCREEN_BYTES; i++)
+        backBuffer[i] = randomNumber();
+    for (uint line = 0; line < SCREEN_H; line++)
+        LINE_PALETTES(backBuffer)[line] = randomNumber() & 0x00ffffff;
+}
+
+int toSM, fromSM;
+
+void encodeWithSM(uint8_t * output) { //encodeInput through one encode SM, see the emulation of jpeg_encoding.pio in sdk/sdk.c
+    pio_sm_clear_fifos(pio1, 0);
+    pio_sm_restart(pio1, 0);
+    dma_channel_config c = dma_channel_get_default_config(fromSM);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    dma_channel_configure(fromSM, &c, output, &pio1->rxf[0], JPEG_DATA_SIZE, true);
+    c = dma_channel_get_default_config(toSM);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(toSM, &c, &pio1->txf[0], encodeInput, SCREEN_SIZE / 8, true);
+}
+
+int main() {
+    ppuInit();
+    prepareJpegEncoding();
+    toSM = dma_claim_unused_channel(true);
+    fromSM = dma_claim_unused_channel(true);
+
+    static uint8_t expected[JPEG_DATA_SIZE];
+    uint64_t total = 0;
+    uint mismatches = 0;
+    for (uint f = 0; f < FRAMES; f++) {
+        randomScreen();
+        readyBufferIsNew = false;
+        const uint64_t start = time_us_64();
+        startBackbufferToJPEG(false);
+        while (!readyBufferIsNew)
+            continueBackbufferToJPEG();
+        total += time_us_64() - start;
+
+        encodeWithSM(expected);
+        if (memcmp((uint8_t *)readyBuffer + JPEG_HEADER_SIZE, expected, JPEG_DATA_SIZE) != 0)
+            mismatches++;
+    }
+
+    printf("CPU encoder: %llu us per frame, including the preparation of encodeInput\n", (unsigned long long)(total / FRAMES));
+    if (mismatches) {
+        printf("The CPU encoder and the encode SMs disagree on %d of %d frames.\n", mismatches, FRAMES);
+        return 1;
+    }
+    return 0;
+}
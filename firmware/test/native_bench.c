@@ -0,0 +1,96 @@
+//Encodes screens of different complexity as native 160x144 frames on the CPU, checks the result and reports how long core0 would be busy per frame on this machine. The RP2040 has to be measured with the telemetry ('t' via USB serial).
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppu.h"
+#include "jpeg.h"
+
+#define FRAMES 200
+
+uint32_t randomState = 1;
+
+uint32_t randomNumber() { //xorshift, like in ppu_bench.c
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+void whiteScreen() {
+    memset((uint8_t *)backBuffer, DIRECT_PIXEL_PAIR(0x00), SCREEN_BYTES);
+}
+
+void tiledScreen() {
+    //Like a game: the background repeats a few different tiles
+    uint8_t tiles[16][8][4];
+    for (uint i = 0; i < sizeof(tiles); i++)
+        ((uint8_t *)tiles)[i] = (randomNumber() & 0x33) | 0xcc;
+    for (uint line = 0; line < SCREEN_H; line++)
+        for (uint tile = 0; tile < SCREEN_W / 8; tile++)
+            memcpy((uint8_t *)backBuffer + line * SCREEN_LINE_BYTES + tile * 4, tiles[(line / 8 * 7 + tile * 3) % 16][line % 8], 4);
+}
+
+void noiseScreen() {
+    //Every pixel random, so every block is dense
+    for (uint i = 0; i < SCREEN_BYTES; i++)
+        backBuffer[i] = (randomNumber() & 0x33) | 0xcc;
+}
+
+void stripeScreen() {
+    //Alternating shades in every column, the highest frequency in every block without exceeding the frame size
+    for (uint line = 0; line < SCREEN_H; line++)
+        memset((uint8_t *)backBuffer + line * SCREEN_LINE_BYTES, (DIRECT_PIXEL_PAIR(0x03) & 0xf0) | (DIRECT_PIXEL_PAIR(0x00) & 0x0f), SCREEN_LINE_BYTES);
+}
+
+int failures = 0;
+
+void bench(const char * name, void (*screen)()) {
+    uint64_t total = 0, longest = 0;
+    uint calls = 0, size = 0;
+    for (uint f = 0; f < FRAMES; f++) {
+        screen();
+        readyBufferIsNew = false;
+        const uint64_t start = time_us_64();
+        startBackbufferToJPEG(false);
+        calls = 0;
+        while (!readyBufferIsNew) {
+            continueBackbufferToJPEG();
+            calls++;
+        }
+        const uint64_t time = time_us_64() - start;
+        total += time;
+        if (time > longest)
+            longest = time;
+        size = readyBuffer[FRAME_SIZE - 2] | (readyBuffer[FRAME_SIZE - 1] << 8);
+        if (size > JPEG_NATIVE_MAX_SIZE || readyBuffer[size - 2] != 0xff || readyBuffer[size - 1] != 0xd9) {
+            printf("  FAILED: %s frame %u has no valid end (%u bytes)\n", name, f, size);
+            failures++;
+            return;
+        }
+    }
+    printf("%-8s %5u bytes, %4u calls, average %4llu us, longest %4llu us per frame\n", name, size, calls, (unsigned long long)(total / FRAMES), (unsigned long long)longest);
+
+    char path[64];
+    snprintf(path, sizeof(path), "build/native_%s.jpg", name); //For a look at the last frame
+    FILE * file = fopen(path, "wb");
+    if (file) {
+        fwrite((uint8_t *)readyBuffer, 1, size, file);
+        fclose(file);
+    }
+}
+
+int main() {
+    ppuInit();
+    prepareJpegEncoding();
+    setOutputFormat(formatNative);
+    fillBufferWithNativeBaseJpeg(frontBuffer);
+    fillBufferWithNativeBaseJpeg(readyBuffer);
+    fillBufferWithNativeBaseJpeg(encodeBuffer);
+
+    bench("white", whiteScreen);
+    bench("tiles", tiledScreen);
+    bench("stripes", stripeScreen);
+    bench("noise", noiseScreen);
+    return failures ? 1 : 0;
+}
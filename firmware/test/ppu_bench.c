@@ -0,0 +1,99 @@
+//Renders the same random DMG frames with the whole line renderer and the 8 pixel step renderer, checks that both give the same result and compares their speed.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cpubus.h"
+#include "ppu.h"
+
+//Not in ppu.h, the PPU only uses them itself
+extern int x;
+extern int wy;
+extern bool inWindowRange;
+extern uint currentSpriteOnLine;
+extern uint8_t volatile * packedBackBufferLine;
+void updateTileCacheRange(uint16_t address, uint length);
+void updateSpriteBuckets();
+void oamSearch();
+void renderLine();
+void renderStep();
+void packLine();
+
+#define FRAMES 1000
+
+uint8_t frames[2][SCREEN_BYTES];
+
+uint32_t randomState = 1;
+
+uint32_t randomNumber() { //xorshift, stdlib.h does not go along with the div in cpubus.h
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+void randomScreen() {
+    //Random tiles and tile maps, 40 sprites at random positions and a window over the lower part of the screen. The worst case for both renderers.
+    for (uint i = 0x8000; i < 0xa000; i++)
+        memory[i] = randomNumber();
+    updateTileCacheRange(0x8000, 0x1800);
+    for (uint i = 0; i < 40; i++) {
+        memory[0xfe00 + i * 4] = 16 + randomNumber() % SCREEN_H;
+        memory[0xfe01 + i * 4] = randomNumber() % (SCREEN_W + 8);
+        memory[0xfe02 + i * 4] = randomNumber();
+        memory[0xfe03 + i * 4] = randomNumber() & 0xf0;
+    }
+    memory[0xff42] = randomNumber();
+    memory[0xff43] = randomNumber();
+    memory[0xff4a] = 100;
+    memory[0xff4b] = 87;
+    oamChanged = true;
+    updateSpriteBuckets();
+}
+
+uint64_t renderFrame(bool wholeLines, uint8_t * result) { //Returns the time in us
+    const uint64_t start = time_us_64();
+    for (y = 0; y < SCREEN_H; y++) {
+        wy = y;
+        x = 0;
+        inWindowRange = false;
+        currentSpriteOnLine = 0;
+        oamSearch();
+        packedBackBufferLine = result + y * SCREEN_LINE_BYTES;
+        if (wholeLines)
+            renderLine();
+        else
+            while (x < SCREEN_W)
+                renderStep();
+        packLine();
+    }
+    return time_us_64() - start;
+}
+
+int main() {
+    lcdAndPpuEnable = true;
+    bgAndWindowDisplay = true;
+    windowEnable = true;
+    objEnable = true;
+    objSize = 8;
+    tileData8000 = true;
+
+    uint64_t steps = 0, lines = 0;
+    uint mismatches = 0;
+    for (uint f = 0; f < FRAMES; f++) {
+        randomScreen();
+        steps += renderFrame(false, frames[0]);
+        lines += renderFrame(true, frames[1]);
+        if (memcmp(frames[0], frames[1], SCREEN_BYTES) != 0)
+            mismatches++;
+    }
+
+    printf("8 pixel steps: %llu ns per line\n", (unsigned long long)(steps * 1000 / FRAMES / SCREEN_H));
+    printf("Whole lines:   %llu ns per line\n", (unsigned long long)(lines * 1000 / FRAMES / SCREEN_H));
+    printf("Speedup:       %.1fx\n", (double)steps / lines);
+    if (mismatches) {
+        printf("The renderers disagree on %d of %d frames.\n", mismatches, FRAMES);
+        return 1;
+    }
+    return 0;
+}
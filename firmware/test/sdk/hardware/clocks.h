@@ -0,0 +1,9 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_CLOCKS
+#define GBINTERCEPTOR_TEST_SDK_CLOCKS
+
+#include "pico/stdlib.h"
+
+enum clock_index {clk_sys = 5};
+uint32_t clock_get_hz(enum clock_index clk_index);
+
+#endif
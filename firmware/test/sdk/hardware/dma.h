@@ -0,0 +1,25 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_DMA
+#define GBINTERCEPTOR_TEST_SDK_DMA
+
+#include "pico/stdlib.h"
+
+//Transfers between memory happen right away when they are triggered. Transfers to and from the FIFOs of PIO1 run its SMs as encoders (see jpeg_encoding.pio), so the DMA is never busy.
+
+#define NUM_DMA_CHANNELS 12
+typedef struct { bool readIncrement; bool writeIncrement; uint size; } dma_channel_config;
+enum dma_channel_transfer_size {DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2};
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(uint channel);
+void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size);
+void channel_config_set_dreq(dma_channel_config *c, uint dreq);
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr, const volatile void *read_addr, uint transfer_count, bool trigger);
+bool dma_channel_is_busy(uint channel);
+void dma_channel_wait_for_finish_blocking(uint channel);
+void dma_channel_abort(uint channel);
+void dma_channel_set_irq0_enabled(uint channel, bool enabled);
+bool dma_channel_get_irq0_status(uint channel);
+void dma_channel_acknowledge_irq0(uint channel);
+
+#endif
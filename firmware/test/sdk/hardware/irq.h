@@ -0,0 +1,12 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_IRQ
+#define GBINTERCEPTOR_TEST_SDK_IRQ
+
+#include "pico/stdlib.h"
+
+#define DMA_IRQ_0 11
+#define DMA_IRQ_1 12
+typedef void (*irq_handler_t)();
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_set_enabled(uint num, bool enabled);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_PIO
+#define GBINTERCEPTOR_TEST_SDK_PIO
+
+#include "pico/stdlib.h"
+
+typedef struct { io_rw_32 ctrl; io_ro_32 fstat; io_rw_32 fdebug; io_ro_32 flevel; io_wo_32 txf[4]; io_ro_32 rxf[4]; } pio_hw_t;
+typedef pio_hw_t *PIO;
+extern pio_hw_t *pio0, *pio1;
+#define PIO_FSTAT_RXEMPTY_LSB 8
+#define PIO_FDEBUG_RXSTALL_LSB 0
+
+typedef struct { const uint16_t *instructions; uint8_t length; int8_t origin; } pio_program_t;
+uint pio_add_program(PIO pio, const pio_program_t *program);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_sm_clear_fifos(PIO pio, uint sm);
+void pio_sm_restart(PIO pio, uint sm);
+void pio_sm_exec(PIO pio, uint sm, uint instr);
+uint pio_encode_jmp(uint addr);
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx);
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_SYSTICK
+#define GBINTERCEPTOR_TEST_SDK_SYSTICK
+
+#include "pico/stdlib.h"
+
+typedef struct { io_rw_32 csr; io_rw_32 rvr; io_rw_32 cvr; io_ro_32 calib; } systick_hw_t;
+extern systick_hw_t *systick_hw; //Plain registers, nothing counts down on the PC
+
+#endif
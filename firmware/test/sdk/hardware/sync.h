@@ -0,0 +1,6 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_HARDWARE_SYNC
+#define GBINTERCEPTOR_TEST_SDK_HARDWARE_SYNC
+
+#include "pico/sync.h"
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_JPEG_ENCODING_PIO
+#define GBINTERCEPTOR_TEST_SDK_JPEG_ENCODING_PIO
+
+#include "hardware/pio.h"
+
+//Generated by pioasm in the real build
+extern const pio_program_t jpegEncoding_program;
+void jpegEncoding_program_init(PIO pio, uint sm, uint offset);
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_MEMORY_BUS_PIO
+#define GBINTERCEPTOR_TEST_SDK_MEMORY_BUS_PIO
+
+#include "hardware/pio.h"
+
+//Generated by pioasm in the real build
+extern const pio_program_t memoryBus_program;
+void memoryBus_program_init(PIO pio, uint sm, uint offset, float div);
+
+#endif
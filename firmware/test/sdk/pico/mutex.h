@@ -0,0 +1,11 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_MUTEX
+#define GBINTERCEPTOR_TEST_SDK_MUTEX
+
+#include "pico/stdlib.h"
+
+typedef struct { int owner; } mutex_t;
+void mutex_init(mutex_t *mtx);
+void mutex_enter_blocking(mutex_t *mtx);
+void mutex_exit(mutex_t *mtx);
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_STDLIB
+#define GBINTERCEPTOR_TEST_SDK_STDLIB
+
+//Just enough of the Pico SDK to build the firmware on a PC for the tests and benchmarks in this directory. The implementations are in sdk.c.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define __in_flash(group)
+#define __not_in_flash_func(func) func
+#define __time_critical_func(func) func
+
+typedef unsigned int uint;
+typedef volatile uint32_t io_rw_32;
+typedef const volatile uint32_t io_ro_32;
+typedef volatile uint32_t io_wo_32;
+
+#define GPIO_IN 0
+#define GPIO_OUT 1
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+void gpio_pull_up(uint gpio);
+extern bool testGpioValue; //Returned by gpio_get for every pin
+
+void sleep_ms(uint32_t ms);
+
+typedef struct { io_rw_32 ctrl; io_ro_32 timehr; io_ro_32 timelr; io_ro_32 timerawh; io_ro_32 timerawl; } timer_hw_t;
+extern timer_hw_t *timer_hw;
+typedef uint64_t absolute_time_t;
+absolute_time_t get_absolute_time();
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+uint64_t time_us_64();
+extern uint64_t testTimeShift; //Added to the time, so a test can let time pass at once
+
+static inline void tight_loop_contents() {}
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef GBINTERCEPTOR_TEST_SDK_SYNC
+#define GBINTERCEPTOR_TEST_SDK_SYNC
+
+#include "pico/mutex.h"
+
+uint32_t save_and_disable_interrupts();
+void restore_interrupts(uint32_t status);
+
+#endif
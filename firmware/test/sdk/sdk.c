@@ -0,0 +1,250 @@
+#include "pico/stdlib.h"
+#include "pico/sync.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/structs/systick.h"
+#include "memory-bus.pio.h"
+#include "jpeg_encoding.pio.h"
+
+#include <string.h>
+#include <time.h>
+
+//GPIO, time and sync
+
+bool testGpioValue = true;
+
+void gpio_init(uint gpio) {}
+void gpio_set_dir(uint gpio, bool out) {}
+void gpio_put(uint gpio, bool value) {}
+bool gpio_get(uint gpio) { return testGpioValue; }
+void gpio_pull_up(uint gpio) {}
+
+void sleep_ms(uint32_t ms) {}
+
+timer_hw_t timer;
+timer_hw_t *timer_hw = &timer;
+
+uint64_t testTimeShift = 0;
+
+uint64_t time_us_64() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 + testTimeShift;
+}
+
+absolute_time_t get_absolute_time() {
+    return time_us_64();
+}
+
+void mutex_init(mutex_t *mtx) {}
+void mutex_enter_blocking(mutex_t *mtx) {}
+void mutex_exit(mutex_t *mtx) {}
+uint32_t save_and_disable_interrupts() { return 0; }
+void restore_interrupts(uint32_t status) {}
+
+uint32_t clock_get_hz(enum clock_index clk_index) { return 250000000; }
+
+systick_hw_t systick;
+systick_hw_t *systick_hw = &systick;
+
+irq_handler_t irqHandlers[32];
+bool irqEnabled[32];
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) { irqHandlers[num] = handler; }
+void irq_set_enabled(uint num, bool enabled) { irqEnabled[num] = enabled; }
+
+//PIO: Only the encoder program is emulated. Each SM of PIO1 turns the words DMA writes to its TX FIFO into bytes for the DMA that reads its RX FIFO.
+
+pio_hw_t pios[2];
+pio_hw_t *pio0 = &pios[0], *pio1 = &pios[1];
+
+const pio_program_t memoryBus_program;
+const pio_program_t jpegEncoding_program;
+void memoryBus_program_init(PIO pio, uint sm, uint offset, float div) {}
+void jpegEncoding_program_init(PIO pio, uint sm, uint offset) {}
+
+struct Encoder {
+    const uint32_t * input;
+    uint32_t osr;
+    uint osrBits;
+    uint32_t isr;
+    uint isrBits;
+    uint8_t output[0x4000]; //Bytes in the RX FIFO, which has no limit here
+    uint outputLength;
+} encoders[4];
+
+uint pio_add_program(PIO pio, const pio_program_t *program) { return 0; }
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) {}
+void pio_sm_exec(PIO pio, uint sm, uint instr) {}
+uint pio_encode_jmp(uint addr) { return addr; }
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx) { return 0; }
+
+void pio_sm_clear_fifos(PIO pio, uint sm) {
+    if (pio == pio1)
+        encoders[sm].outputLength = 0;
+}
+
+void pio_sm_restart(PIO pio, uint sm) {
+    if (pio == pio1) {
+        encoders[sm].osrBits = 0;
+        encoders[sm].isr = 0;
+        encoders[sm].isrBits = 0;
+    }
+}
+
+uint static encoderOut(struct Encoder * e) { //OUT x 1 with autopull
+    if (!e->osrBits) {
+        e->osr = *e->input++;
+        e->osrBits = 32;
+    }
+    const uint x = e->osr >> 31;
+    e->osr <<= 1;
+    e->osrBits--;
+    return x;
+}
+
+void static encoderIn(struct Encoder * e, uint x) { //IN with autopush after 8 bits
+    e->isr = (e->isr << 1) | x;
+    if (++e->isrBits == 8) {
+        e->output[e->outputLength++] = (uint8_t)e->isr;
+        e->isr = 0;
+        e->isrBits = 0;
+    }
+}
+
+void static encodePixel(struct Encoder * e) { //One pass of jpeg_encoding.pio, following its jumps literally
+    uint y = 2;
+    uint x = encoderOut(e);
+    if (!x)
+        goto codeN;
+codeP:
+    x = encoderOut(e);
+    if (!x)
+        goto morecodeP;
+    encoderIn(e, 0);
+    encoderIn(e, x);
+    if (y--)
+        goto remainder;
+    goto end;
+morecodeP:
+    encoderIn(e, 1);
+    if (y--)
+        goto codeP;
+    encoderIn(e, 0);
+    goto end;
+codeN:
+    x = encoderOut(e);
+    encoderIn(e, x);
+    if (!x)
+        goto codeDoneN;
+    if (y--)
+        goto codeN;
+codeDoneN:
+    encoderIn(e, 0);
+    if (y--)
+        goto remainder;
+    goto end;
+remainder:
+    x = encoderOut(e);
+    encoderIn(e, x);
+    if (y--)
+        goto remainder;
+end:
+    encoderIn(e, 0);
+}
+
+//DMA
+
+struct Channel {
+    dma_channel_config config;
+    volatile uint8_t * write;
+    const volatile uint8_t * read;
+    uint count;
+    bool irq0Enabled;
+} channels[NUM_DMA_CHANNELS];
+uint claimedChannels = 0;
+uint32_t irq0Status = 0;
+
+int dma_claim_unused_channel(bool required) { return claimedChannels++; }
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    dma_channel_config c = {true, false, DMA_SIZE_32};
+    return c;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr) { c->readIncrement = incr; }
+void channel_config_set_write_increment(dma_channel_config *c, bool incr) { c->writeIncrement = incr; }
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) { c->size = size; }
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) {}
+
+bool dma_channel_is_busy(uint channel) { return false; }
+void dma_channel_wait_for_finish_blocking(uint channel) {}
+void dma_channel_abort(uint channel) { channels[channel].count = 0; }
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) { channels[channel].irq0Enabled = enabled; }
+bool dma_channel_get_irq0_status(uint channel) { return irq0Status & (1u << channel); }
+void dma_channel_acknowledge_irq0(uint channel) { irq0Status &= ~(1u << channel); }
+
+void static finishTransfer(uint channel) {
+    if (channels[channel].irq0Enabled) {
+        irq0Status |= 1u << channel;
+        if (irqEnabled[DMA_IRQ_0] && irqHandlers[DMA_IRQ_0])
+            irqHandlers[DMA_IRQ_0]();
+    }
+}
+
+void static drainEncoder(uint sm) { //Hand the output of an encoder to the channel reading its RX FIFO
+    struct Encoder * e = &encoders[sm];
+    for (uint channel = 0; channel < claimedChannels; channel++) {
+        struct Channel * c = &channels[channel];
+        if (c->count && c->read == (const volatile uint8_t *)&pio1->rxf[sm] && e->outputLength) {
+            const uint n = e->outputLength < c->count ? e->outputLength : c->count;
+            memcpy((void *)c->write, e->output, n);
+            memmove(e->output, e->output + n, e->outputLength - n);
+            e->outputLength -= n;
+            c->write += n;
+            c->count -= n;
+            if (!c->count)
+                finishTransfer(channel);
+        }
+    }
+}
+
+void static runTransfer(uint channel) {
+    struct Channel * c = &channels[channel];
+    for (uint sm = 0; sm < 4; sm++) {
+        if (c->write == (volatile uint8_t *)&pio1->txf[sm]) {
+            encoders[sm].input = (const uint32_t *)c->read;
+            for (uint i = 0; i < c->count * 8; i++)
+                encodePixel(&encoders[sm]);
+            c->count = 0;
+            finishTransfer(channel);
+            drainEncoder(sm);
+            return;
+        }
+        if (c->read == (const volatile uint8_t *)&pio1->rxf[sm]) {
+            drainEncoder(sm);
+            return;
+        }
+    }
+    const uint size = 1u << c->config.size;
+    while (c->count) {
+        memcpy((void *)c->write, (const void *)c->read, size);
+        if (c->config.writeIncrement)
+            c->write += size;
+        if (c->config.readIncrement)
+            c->read += size;
+        c->count--;
+    }
+    finishTransfer(channel);
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr, const volatile void *read_addr, uint transfer_count, bool trigger) {
+    channels[channel].config = *config;
+    channels[channel].write = write_addr;
+    channels[channel].read = read_addr;
+    channels[channel].count = transfer_count;
+    if (trigger)
+        runTransfer(channel);
+}
@@ -0,0 +1,127 @@
+//Streams a frame to a host that reads as fast as USB full speed allows while the encoder falls behind and checks that the host never gets a torn frame.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppu.h"
+#include "jpeg.h"
+#include "telemetry.h"
+
+#define PAYLOAD_SIZE 2048 //CFG_TUD_VIDEO_STREAMING_EP_BUFSIZE in bulk mode
+#define USB_BYTES_PER_MS (19 * 64)
+
+int failures = 0;
+
+#define CHECK(CONDITION) do { if (!(CONDITION)) { printf("  FAILED: %s (line %d)\n", #CONDITION, __LINE__); failures++; } } while (0)
+
+uint32_t randomState = 1;
+
+uint32_t randomNumber() { //xorshift, like in ppu_bench.c
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+void randomScreen() { //The same frame in the backBuffer and the history, so blending does not change it
+    for (uint i = 0; i < SCREEN_BYTES; i++)
+        backBuffer[i] = randomNumber();
+    for (uint line = 0; line < SCREEN_H; line++)
+        LINE_PALETTES(backBuffer)[line] = randomNumber() & 0x00ffffff;
+    for (uint frame = 0; frame < FRAME_HISTORY - 1; frame++)
+        memcpy((uint8_t *)frameHistory[frame], (uint8_t *)backBuffer, FRAME_BUFFER_SIZE);
+}
+
+//The host: TinyUSB copies the first payload when the transfer starts and each further one in tud_task() once the previous one has been sent, so we take as much as full speed could have carried
+uint8_t received[FRAME_SIZE];
+uint receivedSize;
+uint64_t transferStart;
+
+void startTransfer() {
+    transferStart = time_us_64();
+    memcpy(received, (uint8_t *)frontBuffer, PAYLOAD_SIZE);
+    receivedSize = PAYLOAD_SIZE;
+}
+
+void usbTask() { //What the main loop does instead of tud_task()
+    if (!usbMayRead(PAYLOAD_SIZE))
+        return;
+    const uint64_t sent = (time_us_64() - transferStart) * USB_BYTES_PER_MS / 1000;
+    while (receivedSize < FRAME_SIZE && receivedSize <= sent) {
+        const uint size = receivedSize + PAYLOAD_SIZE <= FRAME_SIZE ? PAYLOAD_SIZE : FRAME_SIZE - receivedSize;
+        memcpy(received + receivedSize, (uint8_t *)frontBuffer + receivedSize, size);
+        receivedSize += size;
+    }
+}
+
+void passTime(uint ms) { //With the host reading all the time
+    for (uint i = 0; i < ms; i++) {
+        testTimeShift += 1000;
+        usbTask();
+    }
+}
+
+void renderLines(uint lines) { //Lets the encoder prepare everything the PPU has rendered
+    y = lines;
+    for (uint i = 0; i < 2 * SCREEN_H; i++)
+        continueBackbufferToJPEG();
+}
+
+void encodeReference(uint8_t * expected) {
+    readyBufferIsNew = false;
+    startBackbufferToJPEG(false);
+    while (!readyBufferIsNew)
+        continueBackbufferToJPEG();
+    memcpy(expected, (uint8_t *)readyBuffer, FRAME_SIZE);
+}
+
+bool streamFrame(uint lateLines, uint lateMs, bool finishedInFrame) { //Returns if the host got the complete frame
+    static uint8_t expected[FRAME_SIZE];
+    randomScreen();
+    encodeReference(expected);
+    memset((uint8_t *)encodeBuffer + JPEG_HEADER_SIZE, 0x00, JPEG_DATA_SIZE); //Whatever USB reads before it is encoded shows up as a torn frame
+    memcpy((uint8_t *)encodeBuffer, expected, JPEG_HEADER_SIZE);
+
+    readyBufferIsNew = false;
+    startBackbufferToJPEG(true);
+    renderLines(3 * SCREEN_H / 4);
+    if (!swapFrontbuffer(true)) { //Three quarters are encoded, so USB starts sending the frame
+        printf("  FAILED: the frame has not been streamed\n");
+        failures++;
+        return false;
+    }
+    startTransfer();
+    renderLines(3 * SCREEN_H / 4 + lateLines);
+    passTime(lateMs); //The encoder is late with the last quarter, while the host would have been done long ago
+    if (finishedInFrame)
+        renderLines(SCREEN_H);
+    y = 0;
+    startBackbufferToJPEG(true); //The next frame starts, the streamed one has to be finished by now
+    passTime(20);
+    streamingFinished();
+    return receivedSize == FRAME_SIZE && memcmp(received + JPEG_HEADER_SIZE, expected + JPEG_HEADER_SIZE, JPEG_DATA_SIZE) == 0;
+}
+
+int main() {
+    ppuInit();
+    prepareJpegEncoding();
+
+    printf("streaming with the encoder in time\n");
+    CHECK(streamFrame(SCREEN_H / 4, 0, true));
+    CHECK(telemetry.stalledFrames == 0);
+
+    printf("streaming while the encoder falls behind\n");
+    CHECK(streamFrame(10, 30, true));
+    CHECK(telemetry.stalledFrames == 1);
+
+    printf("streaming with the encoder a whole frame behind\n");
+    CHECK(streamFrame(0, 30, false));
+    CHECK(telemetry.stalledFrames == 2);
+    CHECK(telemetry.overtakenFrames == 0);
+
+    if (failures) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
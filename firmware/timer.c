@@ -0,0 +1,110 @@
+#include "timer.h"
+
+#include "cpubus.h"
+
+//TIMA is not emulated cycle by cycle. Instead we remember when we last knew its value and calculate how often it has been incremented since then whenever we need it.
+//Like on the real hardware, TIMA increments on the falling edge of a bit of the same internal counter that provides DIV, which is (cycleIndex - div) for us.
+//This costs nothing while the game runs and allows us to tell if a jump to 0x0050 really can be a timer interrupt.
+
+uint8_t tima;
+uint8_t tma;
+uint8_t tac;
+uint timerShift;      //log2 of the number of cycles per TIMA increment
+uint timerCycle;      //Cycle at which tima was last up to date
+uint timerOverflowCycle; //Cycle of the most recent overflow
+bool timerInterruptPending; //An overflow happened, but we have not seen the interrupt dispatch for it yet
+
+const uint timerShifts[4] = {8, 2, 4, 6}; //4096Hz, 262144Hz, 65536Hz and 16384Hz at 1048576 cycles per second
+
+void resetTimer() {
+    tima = 0x00;
+    tma = 0x00;
+    tac = 0x00;
+    timerShift = timerShifts[0];
+    timerCycle = cycleIndex;
+    timerOverflowCycle = cycleIndex;
+    timerInterruptPending = false;
+}
+
+uint static inline timerCycleOfTick(uint tick) { //Cycle at which the counter reaches the given tick, counted in TIMA increments
+    return div + (tick << timerShift);
+}
+
+void updateTimer(uint now) {
+    if ((tac & 0x04) && (int)(now - timerCycle) > 0) {
+        const uint firstTick = (timerCycle - div) >> timerShift;
+        const uint ticks = ((now - div) >> timerShift) - firstTick;
+        if (ticks >= 0x100u - tima) {
+            //At least one overflow. After the first one, TIMA counts from TMA, so it overflows every (0x100 - TMA) ticks.
+            const uint untilFirstOverflow = 0x100u - tima;
+            const uint interval = 0x100u - tma;
+            const uint afterFirstOverflow = ticks - untilFirstOverflow;
+            tima = tma + afterFirstOverflow % interval;
+            timerOverflowCycle = timerCycleOfTick(firstTick + untilFirstOverflow + afterFirstOverflow - afterFirstOverflow % interval);
+            timerInterruptPending = true;
+        } else
+            tima += ticks;
+    }
+    timerCycle = now;
+}
+
+uint8_t readTIMA() {
+    updateTimer(cycleIndex);
+    return tima;
+}
+
+void writeTIMA(uint8_t data) {
+    updateTimer(cycleIndex);
+    tima = data;
+}
+
+void writeTMA(uint8_t data) {
+    updateTimer(cycleIndex);
+    tma = data;
+}
+
+void writeTAC(uint8_t data) {
+    updateTimer(cycleIndex); //Everything up to now still counts at the old rate
+    tac = data & 0x07;
+    timerShift = timerShifts[tac & 0x03];
+}
+
+void writeDIV() {
+    updateTimer(cycleIndex);
+    div = cycleIndex;
+    timerCycle = cycleIndex;
+}
+
+void writeIF(uint8_t data) {
+    updateTimer(cycleIndex);
+    timerInterruptPending = (data & 0x04) != 0;
+}
+
+bool timerCanInterrupt() {
+    //Games usually acknowledge pending interrupts when enabling the timer, so if the timer is stopped and nothing is pending, a jump to 0x0050 cannot be a timer interrupt.
+    updateTimer(cycleIndex);
+    return (tac & 0x04) || timerInterruptPending;
+}
+
+void timerInterruptEntry(uint dispatchCycle, bool useForSync) {
+    updateTimer(dispatchCycle);
+    if (useForSync && (tac & 0x04)) {
+        //Interrupts have been enabled all along, so the overflow happened right before the dispatch. If our model disagrees, move the phase of the internal counter.
+        int error;
+        if (timerInterruptPending)
+            error = (int)(timerOverflowCycle - dispatchCycle); //Overflow too early if this is below -TIMER_INTERRUPT_MAX_LATENCY
+        else
+            error = (int)(timerCycleOfTick(((dispatchCycle - div) >> timerShift) + 0x100u - tima) - dispatchCycle); //Our next overflow is still ahead, so it is too late
+        if (error < -TIMER_INTERRUPT_MAX_LATENCY)
+            error += TIMER_INTERRUPT_MAX_LATENCY;
+        else if (error < 0)
+            error = 0; //Within the possible latency, nothing to correct
+        const int maxError = (int)(((0x100u - tma) << timerShift) >> 1); //Beyond half an overflow interval we cannot tell which overflow this was
+        if (error != 0 && error < maxError && error > -maxError) {
+            div -= error;
+            tima = tma;
+            timerCycle = dispatchCycle;
+        }
+    }
+    timerInterruptPending = false;
+}
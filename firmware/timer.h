@@ -0,0 +1,22 @@
+#ifndef GBINTERCEPTOR_TIMER
+#define GBINTERCEPTOR_TIMER
+
+#include "pico/stdlib.h"
+
+#define TIMER_INTERRUPT_MAX_LATENCY 7 //Cycles between a TIMA overflow and the start of the interrupt dispatch: One cycle for the TMA reload plus the longest instruction that might be executing.
+
+extern uint8_t tima;
+extern bool timerInterruptPending;
+
+void resetTimer();
+void updateTimer(uint now);
+uint8_t readTIMA();
+void writeTIMA(uint8_t data);
+void writeTMA(uint8_t data);
+void writeTAC(uint8_t data);
+void writeDIV();
+void writeIF(uint8_t data);
+bool timerCanInterrupt();
+void timerInterruptEntry(uint dispatchCycle, bool useForSync);
+
+#endif
@@ -14,6 +14,13 @@ void setUniqueSerial();
 #define FRAME_WIDTH 160*8
 #define FRAME_HEIGHT 144*8
 
+//The host selects the resolution by the frame index: Each Game Boy pixel as an 8x8 block (default) or the native resolution
+#define FRAME_INDEX_8X 1
+#define FRAME_INDEX_NATIVE 2
+//Hosts that cannot decode MJPEG (or should not have to) can pick the uncompressed NV12 format, which only comes in the native resolution
+#define FORMAT_INDEX_MJPEG 1
+#define FORMAT_INDEX_NV12 2
+
 #ifdef BASE_VIDEO_MODE
 #define MIN_FRAME_INTERVAL 333333
 #else
@@ -39,14 +46,16 @@ enum {
 #define TUD_VIDEO_CAPTURE_DESC_LEN (                                                                                                                                                                                                                           \
     TUD_VIDEO_DESC_IAD_LEN                                                                                                                                                                                                      /* control */                  \
     + TUD_VIDEO_DESC_STD_VC_LEN + (TUD_VIDEO_DESC_CS_VC_LEN + 1 /*bInCollection*/) + TUD_VIDEO_DESC_CAMERA_TERM_LEN + TUD_VIDEO_DESC_OUTPUT_TERM_LEN                                                                            /* Interface 1, Alternate 0 */ \
-    + TUD_VIDEO_DESC_STD_VS_LEN + (TUD_VIDEO_DESC_CS_VS_IN_LEN + 1 /*bNumFormats x bControlSize*/) + TUD_VIDEO_DESC_CS_VS_FMT_MJPEG_LEN + TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN /* Interface 1, Alternate 1 */ \
+    + TUD_VIDEO_DESC_STD_VS_LEN + (TUD_VIDEO_DESC_CS_VS_IN_LEN + 2 /*bNumFormats x bControlSize*/) + TUD_VIDEO_DESC_CS_VS_FMT_MJPEG_LEN + 2*TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN                                  \
+    + TUD_VIDEO_DESC_CS_VS_FMT_UNCOMPR_LEN + TUD_VIDEO_DESC_CS_VS_FRM_UNCOMPR_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN                                                                                                /* Interface 1, Alternate 1 */ \
     + TUD_VIDEO_DESC_STD_VS_LEN + 7                                                                                                                                                                                             /* Endpoint */                 \
 )
 
 #define TUD_VIDEO_CAPTURE_DESC_BULK_LEN (                                                                                                                                                                                                                           \
     TUD_VIDEO_DESC_IAD_LEN                                                                                                                                                                                                      /* control */                  \
     + TUD_VIDEO_DESC_STD_VC_LEN + (TUD_VIDEO_DESC_CS_VC_LEN + 1 /*bInCollection*/) + TUD_VIDEO_DESC_CAMERA_TERM_LEN + TUD_VIDEO_DESC_OUTPUT_TERM_LEN                                                                            /* Interface 1, Alternate 0 */ \
-    + TUD_VIDEO_DESC_STD_VS_LEN + (TUD_VIDEO_DESC_CS_VS_IN_LEN + 1 /*bNumFormats x bControlSize*/) + TUD_VIDEO_DESC_CS_VS_FMT_MJPEG_LEN + TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN /* Interface 1, Alternate 1 */ \
+    + TUD_VIDEO_DESC_STD_VS_LEN + (TUD_VIDEO_DESC_CS_VS_IN_LEN + 2 /*bNumFormats x bControlSize*/) + TUD_VIDEO_DESC_CS_VS_FMT_MJPEG_LEN + 2*TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN                                  \
+    + TUD_VIDEO_DESC_CS_VS_FMT_UNCOMPR_LEN + TUD_VIDEO_DESC_CS_VS_FRM_UNCOMPR_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN                                                                                                /* Interface 1, Alternate 1 */ \
     + 7                                                                                                                                                                                             /* Endpoint */                 \
 )
 
@@ -73,17 +82,29 @@ enum {
                                    /*wObjectiveFocalLength*/ 0, /*bmControls*/ 0),                                                                             \
         TUD_VIDEO_DESC_OUTPUT_TERM(UVC_ENTITY_CAP_OUTPUT_TERMINAL, VIDEO_TT_STREAMING, 0, 1, 0), /* Video stream alt. 0 */                                     \
         TUD_VIDEO_DESC_STD_VS(ITF_NUM_VIDEO_STREAMING, 0, 0, _stridx),                           /* Video stream header for without still image capture */     \
-        TUD_VIDEO_DESC_CS_VS_INPUT(/*bNumFormats*/ 1,                                            /*wTotalLength - bLength */                                   \
-                                   TUD_VIDEO_DESC_CS_VS_FMT_MJPEG_LEN + TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN, \
+        TUD_VIDEO_DESC_CS_VS_INPUT(/*bNumFormats*/ 2,                                            /*wTotalLength - bLength */                                   \
+                                   TUD_VIDEO_DESC_CS_VS_FMT_MJPEG_LEN + 2*TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN +  \
+                                   TUD_VIDEO_DESC_CS_VS_FMT_UNCOMPR_LEN + TUD_VIDEO_DESC_CS_VS_FRM_UNCOMPR_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN, \
                                    _epin, /*bmInfo*/ 0, /*bTerminalLink*/ UVC_ENTITY_CAP_OUTPUT_TERMINAL,                                                      \
                                    /*bStillCaptureMethod*/ 0, /*bTriggerSupport*/ 0, /*bTriggerUsage*/ 0,                                                      \
-                                   /*bmaControls(1)*/ 0), /* Video stream format */                                                                            \
-        TUD_VIDEO_DESC_CS_VS_FMT_MJPEG(/*bFormatIndex*/ 1, /*bNumFrameDescriptors*/ 1, /*Fixed size samples*/ 1,                                               \
+                                   /*bmaControls(1)*/ 0, /*bmaControls(2)*/ 0), /* Video stream format */                                                      \
+        TUD_VIDEO_DESC_CS_VS_FMT_MJPEG(/*bFormatIndex*/ FORMAT_INDEX_MJPEG, /*bNumFrameDescriptors*/ 2, /*Fixed size samples*/ 0,                              \
                                       /*bDefaultFrameIndex*/ 1, 0, 0, 0, /*bCopyProtect*/ 0), /* Video stream frame format */                                  \
-        TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT(/*bFrameIndex */ 1, 0, _width, _height,                                                                            \
-                                              FRAME_SIZE * 8 * 30, FRAME_SIZE_NO_CHROMA * 8 * 60,                                                              \
+        TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT(/*bFrameIndex */ FRAME_INDEX_8X, 0, _width, _height,                                                               \
+                                              FRAME_SIZE * 8 * 30, FRAME_SIZE * 8 * 60,                                                                        \
                                               FRAME_SIZE,                                                                                                      \
                                               333333, MIN_FRAME_INTERVAL, 333333, 166667),       /*default 30fps, 30fps, 60fps*/                                           \
+        TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT(/*bFrameIndex */ FRAME_INDEX_NATIVE, 0, SCREEN_W, SCREEN_H,                                                        \
+                                              JPEG_NATIVE_MAX_SIZE * 8 * 30, JPEG_NATIVE_MAX_SIZE * 8 * 60,                                                    \
+                                              JPEG_NATIVE_MAX_SIZE,                                                                                            \
+                                              333333, MIN_FRAME_INTERVAL, 333333, 166667),       /*default 30fps, 30fps, 60fps*/                                           \
+        TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING(VIDEO_COLOR_PRIMARIES_BT709, VIDEO_COLOR_XFER_CH_BT709, VIDEO_COLOR_COEF_SMPTE170M),                               \
+        TUD_VIDEO_DESC_CS_VS_FMT_NV12(/*bFormatIndex*/ FORMAT_INDEX_NV12, /*bNumFrameDescriptors*/ 1,                                                          \
+                                     /*bDefaultFrameIndex*/ 1, 0, 0, 0, /*bCopyProtect*/ 0),                                                                   \
+        TUD_VIDEO_DESC_CS_VS_FRM_UNCOMPR_CONT(/*bFrameIndex */ 1, 0, SCREEN_W, SCREEN_H,                                                                       \
+                                              RAW_FRAME_SIZE * 8 * 15, RAW_FRAME_SIZE * 8 * 30,                                                                \
+                                              RAW_FRAME_SIZE,                                                                                                  \
+                                              333333, 333333, 666667, 333334),                   /*default 30fps, 30fps, 15fps*/                               \
         TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING(VIDEO_COLOR_PRIMARIES_BT709, VIDEO_COLOR_XFER_CH_BT709, VIDEO_COLOR_COEF_SMPTE170M), /* VS alt 1 */                \
         TUD_VIDEO_DESC_STD_VS(ITF_NUM_VIDEO_STREAMING, 1, 1, _stridx),                                                           /* EP */                      \
         TUD_VIDEO_DESC_EP_ISO(_epin, _epsize, 1)
@@ -99,17 +120,29 @@ enum {
                                    /*wObjectiveFocalLength*/ 0, /*bmControls*/ 0),                                                                             \
         TUD_VIDEO_DESC_OUTPUT_TERM(UVC_ENTITY_CAP_OUTPUT_TERMINAL, VIDEO_TT_STREAMING, 0, 1, 0), /* Video stream alt. 0 */                                     \
         TUD_VIDEO_DESC_STD_VS(ITF_NUM_VIDEO_STREAMING, 0, 1, _stridx),                           /* Video stream header for without still image capture */     \
-        TUD_VIDEO_DESC_CS_VS_INPUT(/*bNumFormats*/ 1,                                            /*wTotalLength - bLength */                                   \
-                                   TUD_VIDEO_DESC_CS_VS_FMT_MJPEG_LEN + TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN, \
+        TUD_VIDEO_DESC_CS_VS_INPUT(/*bNumFormats*/ 2,                                            /*wTotalLength - bLength */                                   \
+                                   TUD_VIDEO_DESC_CS_VS_FMT_MJPEG_LEN + 2*TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN +  \
+                                   TUD_VIDEO_DESC_CS_VS_FMT_UNCOMPR_LEN + TUD_VIDEO_DESC_CS_VS_FRM_UNCOMPR_CONT_LEN + TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING_LEN, \
                                    _epin, /*bmInfo*/ 0, /*bTerminalLink*/ UVC_ENTITY_CAP_OUTPUT_TERMINAL,                                                      \
                                    /*bStillCaptureMethod*/ 0, /*bTriggerSupport*/ 0, /*bTriggerUsage*/ 0,                                                      \
-                                   /*bmaControls(1)*/ 0), /* Video stream format */                                                                            \
-        TUD_VIDEO_DESC_CS_VS_FMT_MJPEG(/*bFormatIndex*/ 1, /*bNumFrameDescriptors*/ 1, /*Fixed size samples*/ 1,                                               \
+                                   /*bmaControls(1)*/ 0, /*bmaControls(2)*/ 0), /* Video stream format */                                                      \
+        TUD_VIDEO_DESC_CS_VS_FMT_MJPEG(/*bFormatIndex*/ FORMAT_INDEX_MJPEG, /*bNumFrameDescriptors*/ 2, /*Fixed size samples*/ 0,                              \
                                       /*bDefaultFrameIndex*/ 1, 0, 0, 0, /*bCopyProtect*/ 0), /* Video stream frame format */                                  \
-        TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT(/*bFrameIndex */ 1, 0, _width, _height,                                                                            \
-                                              FRAME_SIZE * 8 * 30, FRAME_SIZE_NO_CHROMA * 8 * 60,                                                              \
+        TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT(/*bFrameIndex */ FRAME_INDEX_8X, 0, _width, _height,                                                               \
+                                              FRAME_SIZE * 8 * 30, FRAME_SIZE * 8 * 60,                                                                        \
                                               FRAME_SIZE,                                                                                                      \
                                               333333, MIN_FRAME_INTERVAL, 333333, 166667),       /*default 30fps, 30fps, 60fps*/                                           \
+        TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT(/*bFrameIndex */ FRAME_INDEX_NATIVE, 0, SCREEN_W, SCREEN_H,                                                        \
+                                              JPEG_NATIVE_MAX_SIZE * 8 * 30, JPEG_NATIVE_MAX_SIZE * 8 * 60,                                                    \
+                                              JPEG_NATIVE_MAX_SIZE,                                                                                            \
+                                              333333, MIN_FRAME_INTERVAL, 333333, 166667),       /*default 30fps, 30fps, 60fps*/                                           \
+        TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING(VIDEO_COLOR_PRIMARIES_BT709, VIDEO_COLOR_XFER_CH_BT709, VIDEO_COLOR_COEF_SMPTE170M),                               \
+        TUD_VIDEO_DESC_CS_VS_FMT_NV12(/*bFormatIndex*/ FORMAT_INDEX_NV12, /*bNumFrameDescriptors*/ 1,                                                          \
+                                     /*bDefaultFrameIndex*/ 1, 0, 0, 0, /*bCopyProtect*/ 0),                                                                   \
+        TUD_VIDEO_DESC_CS_VS_FRM_UNCOMPR_CONT(/*bFrameIndex */ 1, 0, SCREEN_W, SCREEN_H,                                                                       \
+                                              RAW_FRAME_SIZE * 8 * 15, RAW_FRAME_SIZE * 8 * 30,                                                                \
+                                              RAW_FRAME_SIZE,                                                                                                  \
+                                              333333, 333333, 666667, 333334),                   /*default 30fps, 30fps, 15fps*/                               \
         TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING(VIDEO_COLOR_PRIMARIES_BT709, VIDEO_COLOR_XFER_CH_BT709, VIDEO_COLOR_COEF_SMPTE170M), /* VS alt 1 */                \
         TUD_VIDEO_DESC_EP_BULK(_epin, _epsize, 1)
 